@@ -82,6 +82,7 @@
  *       Successful execution of this command may be verified with
  *       the following telemetry:
  *       - #HS_HkTlm_Payload_t.CmdCount will be cleared
+ *       - The #HS_CmdStatsTlm_Payload_t counters will be cleared
  *       - The #HS_RESET_INF_EID debug event message will be
  *         generated when the command is executed
  *
@@ -420,6 +421,184 @@
  */
 #define HS_DISABLE_CPU_HOG_CC 11
 
+/**
+ * \brief Manage Tables
+ *
+ *  \par Description
+ *       Requests that HS manage the tables identified in the command
+ *       parameter on its next cycle. This command is sent by Table
+ *       Services, via #CFE_TBL_NotifyByMessage, when an HS table has a
+ *       load, validation or dump pending. It is not normally sent from
+ *       the ground.
+ *
+ *  \par Command Structure
+ *       #HS_ManageTablesCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified by the
+ *       table load, validation or dump completing on the next HS cycle.
+ *       The command counter is not incremented since this is an
+ *       internal message.
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Parameter does not identify any HS table
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkTlm_Payload_t.CmdErrCount will increment
+ *       - Error specific event message #HS_CMD_LEN_ERR_EID
+ *       - Error specific event message #HS_MANAGE_TABLES_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ */
+#define HS_MANAGE_TABLES_CC 12
+
+/**
+ * \brief Send Action History
+ *
+ *  \par Description
+ *       Sends the action history telemetry packet, listing the most
+ *       recent monitor actions oldest first. The history is kept in the
+ *       Critical Data Store so it survives the processor resets HS
+ *       performs.
+ *
+ *  \par Command Structure
+ *       #HS_SendHistoryCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkTlm_Payload_t.CmdCount will increment
+ *       - The #HS_HistoryPkt_t telemetry packet will be sent
+ *       - The #HS_SEND_HISTORY_DBG_EID debug event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkTlm_Payload_t.CmdErrCount will increment
+ *       - Error specific event message #HS_CMD_LEN_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ */
+#define HS_SEND_HISTORY_CC 13
+
+/**
+ * \brief Reset Timing
+ *
+ *  \par Description
+ *       Resets the phase durations, cycle counters and wakeup interval
+ *       statistics reported in the #HS_TimingPkt_t telemetry packet,
+ *       which is sent with each housekeeping packet.
+ *
+ *  \par Command Structure
+ *       #HS_ResetTimingCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkTlm_Payload_t.CmdCount will increment
+ *       - Every #HS_PhaseTiming_t.Count in #HS_TimingTlm_Payload_t will
+ *         be set to 0
+ *       - The #HS_RESET_TIMING_DBG_EID debug event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkTlm_Payload_t.CmdErrCount will increment
+ *       - Error specific event message #HS_CMD_LEN_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ */
+#define HS_RESET_TIMING_CC 14
+
+/**
+ * \brief Register Memory Pool
+ *
+ *  \par Description
+ *       Registers the ES handle of a memory pool under the name of the
+ *       application that owns it and an index chosen by that application.
+ *       Memory Monitor Table entries name pools the same way, since a
+ *       pool handle is only valid for the boot it was created in. The
+ *       owning application sends this command each time it creates the
+ *       pool; registering the same name and index again replaces the
+ *       handle, and the Memory Monitor picks up the new handle at once.
+ *
+ *  \par Command Structure
+ *       #HS_RegisterPoolCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkTlm_Payload_t.CmdCount will increment
+ *       - The #HS_REGISTER_POOL_DBG_EID debug event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Application name is empty
+ *       - Pool handle does not identify a memory pool
+ *       - All #HS_MAX_REGISTERED_POOLS registrations are in use
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkTlm_Payload_t.CmdErrCount will increment
+ *       - Error specific event message #HS_CMD_LEN_ERR_EID
+ *       - Error specific event message #HS_REGISTER_POOL_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ */
+#define HS_REGISTER_POOL_CC 15
+
+/**
+ * \brief Register Task Stack
+ *
+ *  \par Description
+ *       Tells the Stack Monitor where the stack of a task is, so its
+ *       high-water mark can be measured. The stack is the buffer the task
+ *       was created on, found through its OSAL symbol, and its size is the
+ *       one ES reports for the task. The owning application fills the
+ *       buffer with #HS_STACKMON_FILL_BYTE before it creates the task and
+ *       sends this command afterwards; registering the same task name again
+ *       replaces the stack.
+ *
+ *  \par Command Structure
+ *       #HS_RegisterStackCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkTlm_Payload_t.CmdCount will increment
+ *       - The #HS_REGISTER_STACK_DBG_EID debug event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Task name is empty
+ *       - OSAL can't find the stack symbol
+ *       - All #HS_MAX_REGISTERED_STACKS registrations are in use
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkTlm_Payload_t.CmdErrCount will increment
+ *       - Error specific event message #HS_CMD_LEN_ERR_EID
+ *       - Error specific event message #HS_REGISTER_STACK_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ */
+#define HS_REGISTER_STACK_CC 16
+
 /**\}*/
 
 #endif
@@ -29,6 +29,9 @@
  * @note This file may be overridden/superceded by mission-provided definitions
  * either by overriding this header or by generating definitions from a command/data
  * dictionary tool.
+ *
+ * The table capacities can also be set on the compiler command line, which
+ * the host capacity matrix in unit-test uses to build several sizes at once.
  */
 #ifndef HS_INTERFACE_CFG_H
 #define HS_INTERFACE_CFG_H
@@ -54,11 +57,17 @@
  *
  *       XCT Size = HS_MAX_EXEC_CNT_SLOTS * sizeof(#HS_XCTEntry_t)
  *
+ *       HS holds two compiled copies of the table in RAM along with
+ *       the task or counter ID resolved for each slot, 2 * (XCT Size +
+ *       HS_MAX_EXEC_CNT_SLOTS * 8) bytes.
+ *
  *       The total size of this table should not exceed the
  *       cFE size limit for a single buffered table set by the
  *       #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE parameter
  */
+#ifndef HS_MAX_EXEC_CNT_SLOTS
 #define HS_MAX_EXEC_CNT_SLOTS 32
+#endif
 
 /**
  * \brief Maximum message action types
@@ -77,11 +86,17 @@
  *
  *       MAT Size = HS_MAX_MSG_ACT_TYPES * (HS_MAX_MSG_ACT_SIZE + 4)
  *
+ *       HS holds two compiled copies of the table in RAM along with
+ *       the delay before each entry's next sequence step, 2 * (MAT
+ *       Size + HS_MAX_MSG_ACT_TYPES * 8) bytes.
+ *
  *       The total size of this table should not exceed the
  *       cFE size limit for a single buffered table set by the
  *       #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE parameter
  */
+#ifndef HS_MAX_MSG_ACT_TYPES
 #define HS_MAX_MSG_ACT_TYPES 8
+#endif
 
 /**
  * \brief Maximum message action size (in bytes)
@@ -124,11 +139,36 @@
  *
  *       AMT Size = HS_MAX_MONITORED_APPS * sizeof(#HS_AMTEntry_t)
  *
+ *       HS holds two compiled copies of the table in RAM along with
+ *       the list of entries that have an action, 2 * (AMT Size +
+ *       HS_MAX_MONITORED_APPS * 4) bytes.
+ *
  *       The total size of this table should not exceed the
  *       cFE size limit for a single buffered table set by the
  *       #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE parameter
  */
+#ifndef HS_MAX_MONITORED_APPS
 #define HS_MAX_MONITORED_APPS 32
+#endif
+
+/**
+ * \brief Maximum number of escalation rungs per monitored application
+ *
+ *  \par Description:
+ *       Number of further actions an Application Monitor Table entry
+ *       can escalate through if the application stays missing after
+ *       its first action.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 255.
+ *
+ *       This parameter adds HS_MAX_ESCALATION_RUNGS * 4 bytes to
+ *       each Application Monitor Table entry. Changing it changes the
+ *       layout of the table, so table images built before the change
+ *       will fail to load and must be rebuilt.
+ */
+#define HS_MAX_ESCALATION_RUNGS 3
 
 /**
  * \brief Maximum number of monitored events
@@ -148,11 +188,158 @@
  *
  *       EMT Size = HS_MAX_MONITORED_EVENTS * sizeof(#HS_EMTEntry_t)
  *
+ *       HS holds two compiled copies of the table in RAM along with
+ *       its event ID hash index, 2 * (EMT Size +
+ *       HS_MAX_MONITORED_EVENTS * 4 + #HS_EVENTMON_HASH_BUCKETS * 4)
+ *       bytes.
+ *
  *       The total size of this table should not exceed the
  *       cFE size limit for a single buffered table set by the
  *       #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE parameter
  */
+#ifndef HS_MAX_MONITORED_EVENTS
 #define HS_MAX_MONITORED_EVENTS 16
+#endif
+
+/**
+ * \brief Maximum number of monitored memory pools
+ *
+ *  \par Description:
+ *       Maximum number of ES memory pools and OS heaps that can be
+ *       monitored for free space and fragmentation
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 255.
+ *
+ *       This parameter will dictate the size of the Memory
+ *       Monitor Table (MMT):
+ *
+ *       MMT Size = HS_MAX_MONITORED_MEM * sizeof(#HS_MMTEntry_t)
+ *
+ *       HS holds two compiled copies of the table in RAM along with
+ *       the list of entries in use and the pool each one resolves to,
+ *       2 * (MMT Size + HS_MAX_MONITORED_MEM * 8) bytes.
+ *
+ *       The free space of each entry is also reported in housekeeping
+ *       telemetry, 12 bytes per entry.
+ */
+#ifndef HS_MAX_MONITORED_MEM
+#define HS_MAX_MONITORED_MEM 8
+#endif
+
+/**
+ * \brief Maximum number of monitored messages
+ *
+ *  \par Description:
+ *       Maximum number of software bus messages that can be monitored
+ *       for freshness
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 255.
+ *
+ *       This parameter will dictate the size of the Message
+ *       Freshness Table (MFT):
+ *
+ *       MFT Size = HS_MAX_MONITORED_MSGS * sizeof(#HS_MFTEntry_t)
+ *
+ *       HS holds two compiled copies of the table in RAM along with
+ *       its message ID hash index, 2 * (MFT Size +
+ *       HS_MAX_MONITORED_MSGS * 4 + #HS_MSGMON_HASH_BUCKETS * 4)
+ *       bytes.
+ *
+ *       The arrival count and age of each entry are also reported in
+ *       housekeeping telemetry, 8 bytes per entry.
+ */
+#ifndef HS_MAX_MONITORED_MSGS
+#define HS_MAX_MONITORED_MSGS 16
+#endif
+
+/**
+ * \brief Maximum entry pairs in the validation report
+ *
+ *  \par Description:
+ *       Maximum number of duplicate or conflicting table entry pairs
+ *       reported in the validation report telemetry packet. Additional
+ *       pairs are counted but not listed.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 16 bit integer (65535).
+ */
+#define HS_MAX_VAL_REPORT_PAIRS 8
+
+/**
+ * \brief Action history depth
+ *
+ *  \par Description:
+ *       Number of most recent monitor actions kept in the Critical Data
+ *       Store and reported in the action history telemetry packet.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 255. The history CDS block holds
+ *       8 + HS_HISTORY_DEPTH * 24 bytes, all of which are copied to
+ *       the CDS each time an action is recorded.
+ */
+#define HS_HISTORY_DEPTH 16
+
+/**
+ * \brief Command handler time histogram bins
+ *
+ *  \par Description:
+ *       Number of bins in the command handler run time histogram of the
+ *       command statistics telemetry packet. The first bin counts runs
+ *       shorter than #HS_CMD_HIST_BASE_USEC, each following bin spans
+ *       four times the range of the one before it, and the last bin
+ *       counts all longer runs.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 2 and no more than 16.
+ */
+#define HS_CMD_HIST_BINS 8
+
+/**
+ * \brief Reported CPU cores
+ *
+ *  \par Description:
+ *       Number of CPU cores whose utilization is reported in housekeeping
+ *       telemetry when the system monitor can measure each core. Higher
+ *       numbered cores are not reported.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 255.
+ */
+#define HS_MAX_CPU_CORES 8
+
+/**
+ * \brief Reported task stacks
+ *
+ *  \par Description:
+ *       Number of tasks with the fullest stacks that the stack monitor
+ *       reports in housekeeping telemetry, 12 bytes per task.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 255.
+ */
+#define HS_STACKMON_TOP_N 4
+
+/**
+ * \brief Reported software bus pipes
+ *
+ *  \par Description:
+ *       Number of software bus pipes whose depth is reported in the SB
+ *       monitor telemetry packet, 12 bytes per pipe. When no pipe names
+ *       are configured, the first pipes SB reports are used.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 255.
+ */
+#define HS_SBMON_MAX_PIPES 16
 
 /**\}*/
 
@@ -52,6 +52,65 @@
  */
 #define HS_WATCHDOG_TIMEOUT_VALUE 10000
 
+/**
+ * \brief Watchdog Task Period (in milliseconds)
+ *
+ *  \par Description:
+ *       How often the watchdog task services the watchdog. The watchdog
+ *       task is a child task that services the watchdog on its own
+ *       schedule as long as the HS main loop keeps making progress, so
+ *       slow HS cycles don't delay servicing. If this parameter is set
+ *       to 0 no task is created and the main loop services the watchdog
+ *       at the end of each cycle, which is the default.
+ *
+ *  \par Limits:
+ *       This parameter must be less than #HS_WATCHDOG_TIMEOUT_VALUE.
+ */
+#define HS_WATCHDOG_TASK_PERIOD 0
+
+/**
+ * \brief Watchdog Task Heartbeat Timeout (in milliseconds)
+ *
+ *  \par Description:
+ *       The watchdog task stops servicing the watchdog once the HS main
+ *       loop has not completed a cycle for this long, so a hung HS still
+ *       lets the watchdog expire.
+ *
+ *  \par Limits:
+ *       This parameter must be at least #HS_WATCHDOG_TASK_PERIOD and
+ *       should be longer than the longest expected HS cycle, including
+ *       the wait for a wakeup message.
+ */
+#define HS_WATCHDOG_HEARTBEAT_TIMEOUT 5000
+
+/**
+ * \brief Watchdog Task Name
+ *
+ *  \par Limits:
+ *       Must be shorter than #OS_MAX_API_NAME.
+ */
+#define HS_WATCHDOG_TASK_NAME "HS_WDT"
+
+/**
+ * \brief Watchdog Task Stack Size
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ */
+#define HS_WATCHDOG_TASK_STACK_SIZE 4096
+
+/**
+ * \brief Watchdog Task Priority
+ *
+ *  \par Description:
+ *       Should be a higher priority (lower number) than HS itself so the
+ *       watchdog is serviced on time while HS is busy.
+ *
+ *  \par Limits:
+ *       This parameter must be between 1 and 255.
+ */
+#define HS_WATCHDOG_TASK_PRIORITY 20
+
 /**
  *  \brief Time to wait after performing processing (in milliseconds)
  *
@@ -85,6 +144,35 @@
  */
 #define HS_WAKEUP_TIMEOUT 1200
 
+/**
+ *  \brief Cycle Processing Budget
+ *
+ *  \par Description:
+ *       Time in milliseconds HS may spend processing one cycle, from the
+ *       arrival of the wakeup (or its timeout) to the end of
+ *       #HS_ProcessMain. Longer cycles are counted as overruns in the
+ *       timing telemetry packet.
+ *
+ *  \par Limits
+ *       This parameter must be greater than 0 and can not exceed 4294967
+ */
+#define HS_CYCLE_BUDGET 250
+
+/**
+ *  \brief Command Handler Histogram Base
+ *
+ *  \par Description:
+ *       Upper limit in microseconds of the first bin of the command
+ *       handler run time histogram. Each following bin's upper limit is
+ *       four times the previous one's.
+ *
+ *  \par Limits
+ *       This parameter must be greater than 0, and its last finite bin
+ *       limit, #HS_CMD_HIST_BASE_USEC * 4^(#HS_CMD_HIST_BINS - 2), can
+ *       not exceed 4294967295.
+ */
+#define HS_CMD_HIST_BASE_USEC 16
+
 /**
  * \brief CPU aliveness output string
  *
@@ -170,6 +258,79 @@
  */
 #define HS_WAKEUP_PIPE_DEPTH 1
 
+/**
+ * \brief Software bus monitor pipe depth
+ *
+ *  \par Description:
+ *       Depth of the software bus pipe HS receives SB statistics and
+ *       housekeeping telemetry on. Used during initialization in the
+ *       call to #CFE_SB_CreatePipe
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ */
+#define HS_SBMON_PIPE_DEPTH 4
+
+/**
+ * \brief Software bus message monitor pipe depth
+ *
+ *  \par Description:
+ *       Depth of the software bus pipe HS receives the messages listed
+ *       in the Message Freshness Table on. HS empties the pipe every
+ *       cycle, so this should hold the monitored messages expected per
+ *       HS cycle. Used during initialization in the call to
+ *       #CFE_SB_CreatePipe
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ */
+#define HS_MSGMON_PIPE_DEPTH 32
+
+/**
+ * \brief Software bus message monitor message limit
+ *
+ *  \par Description:
+ *       Most copies of any one monitored message that can wait on the
+ *       message monitor pipe, passed to #CFE_SB_SubscribeEx. Only
+ *       arrival matters, so this keeps a fast message from filling the
+ *       pipe and hiding slower ones. Copies over the limit are dropped
+ *       by the software bus and counted in its message limit errors.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 65535.
+ */
+#define HS_MSGMON_MSG_LIMIT 4
+
+/**
+ * \brief Command pipe messages processed per cycle
+ *
+ *  \par Description:
+ *       Largest number of commands and HK requests HS reads from its
+ *       command pipe each cycle. Housekeeping requests and priority
+ *       commands are processed as soon as they are read; the rest wait
+ *       until the event pipe has been serviced. Messages left in the pipe
+ *       are read in the following cycles.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can not exceed 65535.
+ */
+#define HS_CMD_PIPE_BUDGET 12
+
+/**
+ * \brief Event pipe messages processed per cycle
+ *
+ *  \par Description:
+ *       Largest number of event messages HS reads from its event pipe
+ *       each cycle. This bounds how long a burst of events can delay the
+ *       commands that wait in the normal lane. Events left in the pipe are
+ *       read in the following cycles.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ */
+#define HS_EVENT_PIPE_BUDGET 32
+
 /**
  *  \brief Time to wait before a processor reset (in milliseconds)
  *
@@ -183,6 +344,124 @@
  */
 #define HS_RESET_TASK_DELAY 50
 
+/**
+ *  \brief Length of one Message Action cooldown count (in milliseconds)
+ *
+ *  \par Description:
+ *       Each count of a Message Actions Table entry's Cooldown holds the
+ *       message off for this long. Cooldowns are timed against MET, so
+ *       they do not change if the HS wakeup rate does. The default
+ *       matches the nominal 1 Hz HS cycle.
+ *
+ *  \par Limits
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 65537 so a full cooldown fits in 32 bits.
+ */
+#define HS_MSG_ACT_COOLDOWN_MSEC 1000
+
+/**
+ *  \brief Escalation Recovery Check-ins
+ *
+ *  \par Description:
+ *       Number of check-ins a monitored application must make after an
+ *       escalation rung is taken before its escalation ladder starts
+ *       again from the first action.
+ *
+ *  \par Limits
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 65535.
+ */
+#define HS_ESCALATION_RECOVERY_CHECKINS 10
+
+/**
+ *  \brief Message Action Queue Depth
+ *
+ *  \par Description:
+ *       Maximum number of triggered Message Actions waiting to be sent.
+ *       When the queue is full the least urgent action is suppressed.
+ *
+ *  \par Limits
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 65535.
+ */
+#define HS_MSG_ACT_QUEUE_DEPTH 16
+
+/**
+ *  \brief Message Action Send Rate (per second)
+ *
+ *  \par Description:
+ *       Sustained number of queued Message Actions that may be sent
+ *       each second of MET.
+ *
+ *  \par Limits
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 1000.
+ */
+#define HS_MSG_ACT_RATE 4
+
+/**
+ *  \brief Message Action Send Burst
+ *
+ *  \par Description:
+ *       Number of queued Message Actions that may be sent at once after
+ *       a quiet period.
+ *
+ *  \par Limits
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 1000.
+ */
+#define HS_MSG_ACT_BURST 8
+
+/**
+ *  \brief Message Action Sequence Pending Steps
+ *
+ *  \par Description:
+ *       Maximum number of Message Action sequence steps waiting out
+ *       their NextDelay at once. A step that can't be scheduled ends
+ *       its sequence and is counted as suppressed.
+ *
+ *  \par Limits
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 65535.
+ */
+#define HS_MSG_ACT_MAX_PENDING_STEPS 8
+
+/**
+ *  \brief Monitor State Snapshot Period
+ *
+ *  \par Description:
+ *       Number of HS cycles between writes of the monitor state snapshot
+ *       to the Critical Data Store. Each write stores one section of the
+ *       snapshot (AppMon, CPU utilization or Message Action cooldowns), so
+ *       a full snapshot takes three periods. The snapshot is only restored
+ *       when HS itself restarts; after a processor or power-on reset the
+ *       monitored apps start over, so monitoring does too. A value of 0
+ *       disables the snapshot.
+ *
+ *  \par Limits
+ *       This parameter can't be larger than 65535. Each section must be
+ *       saved more often than #HS_SNAPSHOT_MAX_AGE or it will never be
+ *       restored, so 3 * HS_SNAPSHOT_PERIOD HS cycles must take less
+ *       than #HS_SNAPSHOT_MAX_AGE seconds. The default of 5 refreshes
+ *       each section every 15 seconds at the nominal 1 Hz HS cycle, for
+ *       one small CDS write every 5 seconds.
+ */
+#define HS_SNAPSHOT_PERIOD 5
+
+/**
+ *  \brief Monitor State Snapshot Maximum Age (in seconds)
+ *
+ *  \par Description:
+ *       A snapshot section older than this when HS starts is not
+ *       restored, since the monitor state it holds no longer reflects
+ *       the system.
+ *
+ *  \par Limits
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 65535.
+ */
+#define HS_SNAPSHOT_MAX_AGE 60
+
 /**
  *  \brief Time to wait for all apps to be started (in milliseconds)
  *
@@ -226,6 +505,36 @@
  */
 #define HS_EVENTMON_DEFAULT_STATE HS_STATE_ENABLED
 
+/**
+ * \brief Default State of Table Services Notifications
+ *
+ *  \par Description:
+ *       When enabled, HS asks Table Services to send a #HS_MANAGE_TABLES_CC
+ *       command whenever one of its tables has a load, validation or dump
+ *       pending and manages that table when notified, checking the status
+ *       of notified tables only every #HS_TBL_NOTIFY_POLL_CYCLES cycles.
+ *       When disabled, the status of every table is checked each HS cycle.
+ *
+ *  \par Limits:
+ *       Must be HS_STATE_ENABLED or HS_STATE_DISABLED
+ */
+#define HS_TBL_NOTIFY_DEFAULT_STATE HS_STATE_DISABLED
+
+/**
+ * \brief Table Services Notification Poll Cycles
+ *
+ *  \par Description:
+ *       How many HS cycles pass between status checks of the tables Table
+ *       Services notifies HS about. A notification is only sent once, so
+ *       this picks up a load, validation or dump whose notification was
+ *       lost, for example to a full command pipe.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 32 bit integer (4294967295).
+ */
+#define HS_TBL_NOTIFY_POLL_CYCLES 60
+
 /**
  * \brief Default State of the Aliveness Indicator
  *
@@ -302,6 +611,61 @@
  */
 #define HS_MAT_FILENAME "/cf/hs_mat.tbl"
 
+/**
+ * \brief Memory Monitor Table (MMT) filename
+ *
+ *  \par Description:
+ *       Default file to load the Memory Monitor Table from
+ *       during a power-on reset sequence
+ *
+ *  \par Limits:
+ *       This string shouldn't be longer than #OS_MAX_PATH_LEN for the
+ *       target platform in question
+ */
+#define HS_MMT_FILENAME "/cf/hs_mmt.tbl"
+
+/**
+ * \brief Message Freshness Table (MFT) filename
+ *
+ *  \par Description:
+ *       Default file to load the Message Freshness Table from
+ *       during a power-on reset sequence
+ *
+ *  \par Limits:
+ *       This string shouldn't be longer than #OS_MAX_PATH_LEN for the
+ *       target platform in question
+ */
+#define HS_MFT_FILENAME "/cf/hs_mft.tbl"
+
+/**
+ * \brief Memory Monitor Cycles per Sample
+ *
+ *  \par Description:
+ *       How many HS cycles pass between samples of the memory pools in
+ *       the Memory Monitor Table. Pools run out over minutes or hours,
+ *       so they don't need to be sampled every cycle.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 32 bit integer (4294967295).
+ */
+#define HS_MEMMON_CYCLES_PER_SAMPLE 10
+
+/**
+ * \brief Maximum number of registered memory pools
+ *
+ *  \par Description:
+ *       How many memory pools applications can register with
+ *       #HS_REGISTER_POOL_CC at once. A pool has to be registered for a
+ *       Memory Monitor Table entry naming it to be monitored, but pools
+ *       can be registered whether or not an entry names them.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 255.
+ */
+#define HS_MAX_REGISTERED_POOLS 8
+
 /**
  * \brief System monitor PSP
  *
@@ -335,6 +699,300 @@
  */
 #define HS_SYSTEM_MONITOR_SUBCHANNEL_NAME "cpu-load"
 
+/**
+ * \brief System monitor /proc directory
+ *
+ *  \par Description:
+ *       Directory holding the Linux kernel "stat" file, which HS reads
+ *       aggregate and per-core CPU time from when the
+ *       #HS_SYSTEM_MONITOR_DEVICE module is not found. The directory is
+ *       mapped into the OSAL file system under the same name, and the file
+ *       is kept open. If the file can't be opened, CPU monitoring will be
+ *       disabled.
+ *
+ *  \par Limits:
+ *       This string shouldn't be longer than #OS_MAX_PATH_LEN minus
+ *       the length of "/stat"
+ */
+#define HS_SYSTEM_MONITOR_PROC_DIR "/proc"
+
+/**
+ * \brief System monitor /proc read size
+ *
+ *  \par Description:
+ *       Number of bytes read from the start of the "stat" file in
+ *       #HS_SYSTEM_MONITOR_PROC_DIR on each sample. The CPU lines come first,
+ *       so this only needs to hold the aggregate line and one line for each
+ *       of #HS_MAX_CPU_CORES cores, about 100 bytes each.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 128 and can't be larger than 65535.
+ *       The buffer is part of the HS global data.
+ */
+#define HS_SYSTEM_MONITOR_PROC_BUF_SIZE 2048
+
+/**
+ * \brief System Monitor Sampler Task Period (in milliseconds)
+ *
+ *  \par Description:
+ *       How often the sampler task reads the system monitor. The sampler
+ *       task is a child task that reads the PSP device or /proc on its own
+ *       schedule, so a device read that blocks doesn't stretch the HS cycle,
+ *       and HS averages the samples taken during each utilization interval.
+ *       If this parameter is set to 0 no task is created and HS reads the
+ *       system monitor itself once per interval. With the /proc backend
+ *       the period is raised to at least #HS_SYSMON_PROC_MIN_PERIOD.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than an unsigned 32 bit
+ *       integer (4294967295).
+ */
+#define HS_SYSMON_TASK_PERIOD 0
+
+/**
+ * \brief System Monitor Sampler Task Minimum /proc Period (in milliseconds)
+ *
+ *  \par Description:
+ *       Shortest sampler task period used with the /proc backend. Linux
+ *       counts CPU time in /proc/stat in clock ticks (USER_HZ, normally
+ *       100 per second), so a sample only a tick or two long can only read
+ *       as 0%, 50% or 100% busy. The default of five ticks gives each
+ *       sample a resolution of 20%. PSP devices are not limited.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 32 bit integer (4294967295).
+ */
+#define HS_SYSMON_PROC_MIN_PERIOD 50
+
+/**
+ * \brief System Monitor Sampler Task Name
+ *
+ *  \par Limits:
+ *       Must be shorter than #OS_MAX_API_NAME.
+ */
+#define HS_SYSMON_TASK_NAME "HS_SYSMON"
+
+/**
+ * \brief System Monitor Sampler Task Stack Size
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ */
+#define HS_SYSMON_TASK_STACK_SIZE 4096
+
+/**
+ * \brief System Monitor Sampler Task Priority
+ *
+ *  \par Description:
+ *       Should be a lower priority (higher number) than HS itself so
+ *       sampling never delays monitoring.
+ *
+ *  \par Limits:
+ *       This parameter must be between 1 and 255.
+ */
+#define HS_SYSMON_TASK_PRIORITY 150
+
+/**
+ * \brief System Monitor Sample Read Attempts
+ *
+ *  \par Description:
+ *       Number of times HS tries to read the sampler's published totals
+ *       when it finds them being updated. HS never waits on the sampler,
+ *       which may be preempted by HS in the middle of an update, so after
+ *       this many attempts the interval reuses the previous utilization.
+ *
+ *  \par Limits:
+ *       This parameter must be between 1 and 255.
+ */
+#define HS_SYSMON_READ_ATTEMPTS 3
+
+/**
+ * \brief System Monitor Sample Ring Depth
+ *
+ *  \par Description:
+ *       Number of sampler task samples kept for HS to scan for bursts.
+ *       HS scans the ring every cycle, so it must hold more samples than
+ *       the sampler takes in one HS cycle; older samples are overwritten
+ *       and counted as lost. With a 10 millisecond #HS_SYSMON_TASK_PERIOD
+ *       (100 Hz, PSP devices only) and a 1 Hz HS cycle, 256 leaves room
+ *       for a late cycle.
+ *
+ *  \par Limits:
+ *       This parameter must be a power of two between 4 and 1024. HS
+ *       copies the ring to its stack while scanning it.
+ */
+#define HS_SYSMON_RING_DEPTH 256
+
+/**
+ * \brief CPU Utilization Burst Threshold
+ *
+ *  \par Description:
+ *       Sampler task samples at or above this utilization are part of a
+ *       burst. Each interval HS reports the number of bursts that started
+ *       and the length of the longest one, which show short spikes that
+ *       the interval average hides.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #HS_CPU_UTILIZATION_MAX or
+ *       65535.
+ */
+#define HS_UTIL_BURST_THRESHOLD 9000
+
+/**
+ * \brief Maximum number of registered task stacks
+ *
+ *  \par Description:
+ *       How many task stacks the stack monitor can know the location of
+ *       at once. HS registers the stacks of its own child tasks, and
+ *       other applications register theirs with #HS_REGISTER_STACK_CC.
+ *       Tasks without a registered stack are not monitored.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 2, for the HS child tasks, and
+ *       can't be larger than 255.
+ */
+#define HS_MAX_REGISTERED_STACKS 16
+
+/**
+ * \brief Task stack fill byte
+ *
+ *  \par Description:
+ *       Value a task stack is filled with before the task is created. The
+ *       stack monitor takes the bytes at the low end of the stack that
+ *       still hold it as never used, which assumes stacks grow down as
+ *       they do on every processor cFS runs on.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than an unsigned 8 bit
+ *       integer (255). A value tasks rarely write, such as 0xA5, keeps
+ *       the high-water mark from being underestimated.
+ */
+#define HS_STACKMON_FILL_BYTE 0xA5
+
+/**
+ * \brief Task stacks checked per cycle
+ *
+ *  \par Description:
+ *       Number of registered task stacks scanned for their high-water
+ *       mark each HS cycle. A scan reads the unused part of the stack, so
+ *       limiting it keeps the time spent each cycle the same no matter
+ *       how many stacks are registered.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 16 bit integer (65535).
+ */
+#define HS_STACKMON_TASKS_PER_CYCLE 2
+
+/**
+ * \brief Task stack usage limit
+ *
+ *  \par Description:
+ *       Percentage of a task's stack that, once used, triggers
+ *       #HS_STACKMON_ACTION_TYPE. A high-water mark never goes down, so
+ *       the action is taken once for each task that crosses the limit.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 100.
+ */
+#define HS_STACKMON_USAGE_LIMIT 80
+
+/**
+ * \brief Task stack limit action
+ *
+ *  \par Description:
+ *       Action taken when a task crosses #HS_STACKMON_USAGE_LIMIT, one of
+ *       the Stack Monitor Action Types or, above #HS_STACKMON_ACT_LAST_NONMSG,
+ *       a Message Action Table entry.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #HS_STACKMON_ACT_LAST_NONMSG
+ *       plus #HS_MAX_MSG_ACT_TYPES.
+ */
+#define HS_STACKMON_ACTION_TYPE 1
+
+/**
+ * \brief Software Bus Monitor Cycles per Sample
+ *
+ *  \par Description:
+ *       How many HS cycles pass between requests for SB statistics. The
+ *       depth growth of each pipe is measured over this period.
+ *
+ *       Each request is a Send SB Statistics command to SB, so it counts
+ *       in the SB command counter and SB issues its statistics sent event
+ *       (a debug event) every time. Ground checks of the SB command
+ *       counter have to allow for it.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 32 bit integer (4294967295).
+ */
+#define HS_SBMON_CYCLES_PER_SAMPLE 10
+
+/**
+ * \brief Monitored software bus pipes
+ *
+ *  \par Description:
+ *       Initializer of the NULL terminated list of the names of the pipes
+ *       reported by the SB monitor, for example
+ *       { "CI_LAB_CMD_PIPE", "TO_LAB_CMD_PIPE", NULL }. The default, an
+ *       empty list, reports every pipe SB has.
+ *
+ *  \par Limits:
+ *       Only the first #HS_SBMON_MAX_PIPES names are used. Names are
+ *       looked up every sample, so pipes created after HS starts are
+ *       found, and each missing pipe counts as a lookup error in SB.
+ */
+#define HS_SBMON_PIPE_NAMES \
+    {                       \
+        NULL                \
+    }
+
+/**
+ * \brief Software bus pipe near full percentage
+ *
+ *  \par Description:
+ *       A pipe holding at least this percentage of its maximum depth is
+ *       near full.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 100.
+ */
+#define HS_SBMON_FULL_PCT 75
+
+/**
+ * \brief Software bus pipe near full samples
+ *
+ *  \par Description:
+ *       Number of samples in a row a pipe must be near full before
+ *       #HS_SBMON_ACTION_TYPE is taken, so a burst the consumer catches
+ *       up on is not acted on.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 65534.
+ */
+#define HS_SBMON_FULL_SAMPLES 3
+
+/**
+ * \brief Software bus pipe near full action
+ *
+ *  \par Description:
+ *       Action taken when a pipe has been near full for
+ *       #HS_SBMON_FULL_SAMPLES samples, one of the SB Monitor Action Types
+ *       or, above #HS_SBMON_ACT_LAST_NONMSG, a Message Action Table entry.
+ *       It is taken again only after the pipe has drained below
+ *       #HS_SBMON_FULL_PCT.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #HS_SBMON_ACT_LAST_NONMSG
+ *       plus #HS_MAX_MSG_ACT_TYPES.
+ */
+#define HS_SBMON_ACTION_TYPE 1
+
 /**
  * \brief CPU Utilization Cycles per Interval
  *
@@ -416,6 +1074,50 @@
  */
 #define HS_UTIL_AVERAGE_NUM_INTERVAL 4
 
+/**
+ * \brief Event Monitor Lookup Hash Buckets
+ *
+ *  \par Description:
+ *       Number of buckets in the event ID hash index that is compiled
+ *       from the Event Monitor Table on every table update. Incoming
+ *       events are only compared against table entries that hash to
+ *       the same bucket.
+ *
+ *  \par Limits:
+ *       This parameter must be a power of two, greater than 0 and
+ *       can't be larger than 65536.
+ */
+#define HS_EVENTMON_HASH_BUCKETS 32
+
+/**
+ * \brief Message Monitor Lookup Hash Buckets
+ *
+ *  \par Description:
+ *       Number of buckets in the message ID hash index that is compiled
+ *       from the Message Freshness Table on every table update. Each
+ *       message received on the message monitor pipe is only compared
+ *       against table entries that hash to the same bucket.
+ *
+ *  \par Limits:
+ *       This parameter must be a power of two, greater than 0 and
+ *       can't be larger than 65536.
+ */
+#define HS_MSGMON_HASH_BUCKETS 16
+
+/**
+ * \brief Table Validation Duplicate Check Hash Buckets
+ *
+ *  \par Description:
+ *       Number of buckets in the hash used to find duplicate and
+ *       conflicting entries when the Application Monitor, Event
+ *       Monitor and Message Freshness Tables are validated.
+ *
+ *  \par Limits:
+ *       This parameter must be a power of two, greater than 0 and
+ *       can't be larger than 65536.
+ */
+#define HS_VALIDATE_HASH_BUCKETS 64
+
 /**
  * \brief Mission specific version number for HS application
  *
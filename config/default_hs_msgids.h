@@ -51,6 +51,21 @@
 /** \brief HS Housekeeping Telemetry            */
 #define HS_HK_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_HS_HK_TLM_TOPICID)
 
+/** \brief HS Table Validation Report Telemetry */
+#define HS_VAL_REPORT_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_HS_VAL_REPORT_TLM_TOPICID)
+
+/** \brief HS Action History Telemetry */
+#define HS_HISTORY_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_HS_HISTORY_TLM_TOPICID)
+
+/** \brief HS Phase Timing Telemetry */
+#define HS_TIMING_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_HS_TIMING_TLM_TOPICID)
+
+/** \brief HS Command Statistics Telemetry */
+#define HS_CMDSTATS_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_HS_CMDSTATS_TLM_TOPICID)
+
+/** \brief HS Software Bus Monitor Telemetry */
+#define HS_SBMON_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_HS_SBMON_TLM_TOPICID)
+
 /**\}*/
 
 #endif
@@ -42,6 +42,35 @@
 
 #define HS_BITS_PER_APPMON_ENABLE 32 /**< \brief HS Bits per AppMon Enable entry */
 
+/**
+ * \name HS Cycle Phases
+ * \{
+ */
+#define HS_PHASE_TBLMGMT  0  /**< \brief Table management */
+#define HS_PHASE_CPUUTIL  1  /**< \brief CPU utilization monitoring */
+#define HS_PHASE_APPMON   2  /**< \brief Application monitoring */
+#define HS_PHASE_EVENTMON 3  /**< \brief Event monitoring */
+#define HS_PHASE_CMDS     4  /**< \brief Command pipe reading, HK requests and priority commands */
+#define HS_PHASE_MSGACTS  5  /**< \brief Sending queued Message Actions */
+#define HS_PHASE_CMDLANE  6  /**< \brief Normal lane command processing */
+#define HS_PHASE_MEMMON   7  /**< \brief Memory pool monitoring */
+#define HS_PHASE_STACKMON 8  /**< \brief Task stack monitoring */
+#define HS_PHASE_SBMON    9  /**< \brief Software bus pipe monitoring */
+#define HS_PHASE_MSGMON   10 /**< \brief Message freshness monitoring */
+#define HS_NUM_PHASES     11 /**< \brief Number of timed phases */
+/**\}*/
+
+/**
+ * \name HS Command Lanes
+ * \{
+ */
+#define HS_CMD_LANE_PRIORITY 0 /**< \brief HK requests and priority commands, processed as soon as read */
+#define HS_CMD_LANE_NORMAL   1 /**< \brief Other commands, processed after the event pipe */
+#define HS_NUM_CMD_LANES     2 /**< \brief Number of command lanes */
+/**\}*/
+
+#define HS_NUM_CMD_CODES (HS_REGISTER_STACK_CC + 1) /**< \brief Number of HS command codes, highest plus one */
+
 /************************************************************************
  * Type Definitions
  ************************************************************************/
@@ -182,6 +211,91 @@ typedef struct
     HS_SetMaxResets_Payload_t Payload;
 } HS_SetMaxResetsCmd_t;
 
+/**
+ *  \brief Manage Tables Payload
+ *
+ *  Matches the layout of the Table Services notification message
+ */
+typedef struct
+{
+    uint32 Parameter; /**< \brief HS Table Notification Flags of the tables to manage */
+} HS_ManageTables_Payload_t;
+
+/**
+ *  \brief Manage Tables Command
+ *
+ *  For command details see #HS_MANAGE_TABLES_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    HS_ManageTables_Payload_t Payload;
+} HS_ManageTablesCmd_t;
+
+/**
+ *  \brief No Arguments Command
+ *
+ *  For command details see #HS_SEND_HISTORY_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} HS_SendHistoryCmd_t;
+
+/**
+ *  \brief No Arguments Command
+ *
+ *  For command details see #HS_RESET_TIMING_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} HS_ResetTimingCmd_t;
+
+/**
+ *  \brief Register Memory Pool Payload
+ */
+typedef struct
+{
+    char   AppName[CFE_MISSION_MAX_API_LEN]; /**< \brief Name of the application that owns the pool */
+    uint32 PoolIndex;                        /**< \brief Index the application chose for the pool */
+    uint32 PoolHandle;                       /**< \brief ES handle of the pool in this boot */
+} HS_RegisterPool_Payload_t;
+
+/**
+ *  \brief Register Memory Pool Command
+ *
+ *  For command details see #HS_REGISTER_POOL_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    HS_RegisterPool_Payload_t Payload;
+} HS_RegisterPoolCmd_t;
+
+/**
+ *  \brief Register Task Stack Payload
+ */
+typedef struct
+{
+    char TaskName[CFE_MISSION_MAX_API_LEN];     /**< \brief Name of the task */
+    char StackSymbol[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Symbol of the buffer the task was created on */
+} HS_RegisterStack_Payload_t;
+
+/**
+ *  \brief Register Task Stack Command
+ *
+ *  For command details see #HS_REGISTER_STACK_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    HS_RegisterStack_Payload_t Payload;
+} HS_RegisterStackCmd_t;
+
 /**
  *  \brief No Arguments Command
  *
@@ -199,6 +313,41 @@ typedef struct
  * \{
  */
 
+/**
+ *  \brief Memory Monitor Entry Status
+ *
+ *  All fields are 0xFFFFFFFF while the entry's memory can't be read.
+ */
+typedef struct
+{
+    uint32 FreeBytes;        /**< \brief Free bytes at the last sample */
+    uint32 LowWaterBytes;    /**< \brief Fewest free bytes seen since the Memory Monitor table was loaded */
+    uint32 LargestFreeBlock; /**< \brief Largest free block at the last sample */
+} HS_MemMonTlm_t;
+
+/**
+ *  \brief Task Stack Status
+ *
+ *  All fields are 0 for entries no task has filled.
+ */
+typedef struct
+{
+    uint32 TaskId;         /**< \brief ES task ID */
+    uint32 StackSize;      /**< \brief Stack size in bytes */
+    uint32 HighWaterBytes; /**< \brief Most stack bytes the task has used */
+} HS_StackMonTlm_t;
+
+/**
+ *  \brief Message Monitor Entry Status
+ *
+ *  Both fields are 0 for unused entries.
+ */
+typedef struct
+{
+    uint32 ArrivalCount; /**< \brief Messages received since the Message Freshness table was loaded */
+    uint32 AgeMsec;      /**< \brief Time since the message last arrived, or since the table was loaded */
+} HS_MsgMonTlm_t;
+
 /**
  *  \brief Housekeeping Packet Payload
  */
@@ -220,9 +369,24 @@ typedef struct
     uint32 AppMonEnables[((HS_MAX_MONITORED_APPS - 1) / HS_BITS_PER_APPMON_ENABLE) + 1];
     /**< \brief Enable states of App Monitor Entries */
 
-    uint32 MsgActExec;  /**< \brief Number of Software Bus Message Actions Executed */
-    uint32 UtilCpuAvg;  /**< \brief Current CPU Utilization Average */
-    uint32 UtilCpuPeak; /**< \brief Current CPU Utilization Peak */
+    uint32 MsgActExec;       /**< \brief Number of Software Bus Message Actions Executed */
+    uint32 MsgActQueued;     /**< \brief Number of Software Bus Message Actions Queued */
+    uint32 MsgActSuppressed; /**< \brief Number of Software Bus Message Actions Suppressed */
+    uint32 UtilCpuAvg;       /**< \brief Current CPU Utilization Average */
+    uint32 UtilCpuPeak;      /**< \brief Current CPU Utilization Peak */
+
+    uint32 UtilCpuCores[HS_MAX_CPU_CORES]; /**< \brief CPU Utilization of each core, 0xFFFFFFFF if not known */
+
+    uint32 UtilBurstCount;   /**< \brief CPU Utilization bursts started last interval */
+    uint32 UtilBurstLongest; /**< \brief Longest CPU Utilization burst last interval, in milliseconds */
+    uint32 UtilSamplePeak;   /**< \brief Highest sampler task CPU Utilization sample last interval */
+    uint32 UtilSamplesLost;  /**< \brief Sampler task samples overwritten before they were scanned */
+
+    HS_MemMonTlm_t MemMon[HS_MAX_MONITORED_MEM]; /**< \brief Status of each Memory Monitor table entry */
+
+    HS_StackMonTlm_t StackTop[HS_STACKMON_TOP_N]; /**< \brief Tasks using the most of their stacks, fullest first */
+
+    HS_MsgMonTlm_t MsgMon[HS_MAX_MONITORED_MSGS]; /**< \brief Status of each Message Freshness table entry */
 
     uint32 ExeCounts[HS_MAX_EXEC_CNT_SLOTS]; /**< \brief Execution Counters */
 } HS_HkTlm_Payload_t;
@@ -237,6 +401,202 @@ typedef struct
     HS_HkTlm_Payload_t Payload;
 } HS_HkPacket_t;
 
+/**
+ *  \brief Validation Report Entry Pair
+ */
+typedef struct
+{
+    uint16 Entry;      /**< \brief Table entry that failed validation */
+    uint16 FirstEntry; /**< \brief Earlier table entry with the same key */
+    int16  Result;     /**< \brief Validation error of the pair */
+    uint16 Padding;    /**< \brief Structure padding */
+} HS_ValReportPair_t;
+
+/**
+ *  \brief Validation Report Packet Payload
+ */
+typedef struct
+{
+    uint8  Table;       /**< \brief HS Table Notification Flag of the validated table */
+    uint8  SpareByte;   /**< \brief Alignment Spare */
+    uint16 PairCount;   /**< \brief Duplicate or conflicting entry pairs found */
+    int32  Result;      /**< \brief Table validation result */
+    uint32 GoodCount;   /**< \brief Number of good entries */
+    uint32 BadCount;    /**< \brief Number of bad entries */
+    uint32 UnusedCount; /**< \brief Number of unused entries */
+
+    HS_ValReportPair_t Pairs[HS_MAX_VAL_REPORT_PAIRS]; /**< \brief First duplicate or conflicting pairs */
+} HS_ValReportTlm_Payload_t;
+
+/**
+ *  \brief Validation Report Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    HS_ValReportTlm_Payload_t Payload;
+} HS_ValReportPkt_t;
+
+/**
+ *  \brief Action History Entry
+ */
+typedef struct
+{
+    uint32 Sequence;   /**< \brief Action number since the history was created, 0 for an unused entry */
+    uint32 Seconds;    /**< \brief Spacecraft time the action was taken, seconds */
+    uint32 Subseconds; /**< \brief Spacecraft time the action was taken, subseconds */
+    uint8  Table;      /**< \brief HS Table Notification Flag of the monitor table that took the action */
+    uint8  SpareByte;  /**< \brief Alignment Spare */
+    uint16 Row;        /**< \brief Monitor table entry that took the action */
+    uint16 ActionType; /**< \brief Action taken, no action when the reset limit blocked a processor reset */
+    uint16 Padding;    /**< \brief Structure padding */
+} HS_HistoryEntry_t;
+
+/**
+ *  \brief Action History Packet Payload
+ */
+typedef struct
+{
+    uint16 EntryCount; /**< \brief Number of valid entries, oldest first */
+    uint16 Padding;    /**< \brief Structure padding */
+
+    HS_HistoryEntry_t Entries[HS_HISTORY_DEPTH]; /**< \brief Most recent monitor actions */
+} HS_HistoryTlm_Payload_t;
+
+/**
+ *  \brief Action History Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    HS_HistoryTlm_Payload_t Payload;
+} HS_HistoryPkt_t;
+
+/**
+ *  \brief Phase Timing
+ */
+typedef struct
+{
+    uint32 Count;   /**< \brief Number of times the phase ran since the last reset */
+    uint32 MinUsec; /**< \brief Shortest duration, microseconds */
+    uint32 AvgUsec; /**< \brief Average duration, microseconds */
+    uint32 MaxUsec; /**< \brief Longest duration, microseconds */
+} HS_PhaseTiming_t;
+
+/**
+ *  \brief Timing Packet Payload
+ */
+typedef struct
+{
+    HS_PhaseTiming_t Phases[HS_NUM_PHASES]; /**< \brief Duration of each HS cycle phase */
+
+    uint32 WakeupCount;        /**< \brief Cycles started by a wakeup message */
+    uint32 TimeoutCount;       /**< \brief Cycles started by a wakeup timeout */
+    uint32 OverrunCount;       /**< \brief Cycles that took longer than #HS_CYCLE_BUDGET */
+    uint32 CycleMaxUsec;       /**< \brief Longest cycle, microseconds */
+    uint32 IntervalCount;      /**< \brief Number of measured wakeup intervals */
+    uint32 IntervalMinUsec;    /**< \brief Shortest wakeup interval, microseconds */
+    uint32 IntervalAvgUsec;    /**< \brief Average wakeup interval, microseconds */
+    uint32 IntervalMaxUsec;    /**< \brief Longest wakeup interval, microseconds */
+    uint32 IntervalStdDevUsec; /**< \brief Standard deviation of the wakeup interval, microseconds */
+} HS_TimingTlm_Payload_t;
+
+/**
+ *  \brief Phase Timing Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    HS_TimingTlm_Payload_t Payload;
+} HS_TimingPkt_t;
+
+/**
+ *  \brief Statistics of One Command Code
+ */
+typedef struct
+{
+    uint32 AcceptCount; /**< \brief Commands with a valid length, passed to the handler */
+    uint32 RejectCount; /**< \brief Commands rejected for their length */
+    uint32 MaxUsec;     /**< \brief Longest handler run, microseconds */
+} HS_CmdCodeStats_t;
+
+/**
+ *  \brief Statistics of One Command Lane
+ *
+ *  Queueing latency is measured from the last time HS found its command
+ *  pipe empty, so it is an upper bound on how long a message waited.
+ */
+typedef struct
+{
+    uint32 Count;          /**< \brief Messages processed in the lane */
+    uint32 LatencyAvgUsec; /**< \brief Average queueing latency, microseconds */
+    uint32 LatencyMaxUsec; /**< \brief Longest queueing latency, microseconds */
+} HS_CmdLaneStats_t;
+
+/**
+ *  \brief Command Statistics Packet Payload
+ */
+typedef struct
+{
+    HS_CmdCodeStats_t Codes[HS_NUM_CMD_CODES];     /**< \brief Statistics of each command code */
+    uint32            HandlerHist[HS_CMD_HIST_BINS]; /**< \brief Handler run times, see #HS_CMD_HIST_BASE_USEC */
+    HS_CmdLaneStats_t Lanes[HS_NUM_CMD_LANES];     /**< \brief Statistics of each command lane */
+
+    uint32 CmdBudgetCount;   /**< \brief Cycles that left command pipe messages past #HS_CMD_PIPE_BUDGET */
+    uint32 EventBudgetCount; /**< \brief Cycles that left event messages past #HS_EVENT_PIPE_BUDGET */
+} HS_CmdStatsTlm_Payload_t;
+
+/**
+ *  \brief Command Statistics Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    HS_CmdStatsTlm_Payload_t Payload;
+} HS_CmdStatsPkt_t;
+
+/**
+ *  \brief Software Bus Pipe Status
+ *
+ *  All fields are 0 for entries without a pipe.
+ */
+typedef struct
+{
+    uint32 PipeId;       /**< \brief SB pipe ID */
+    uint16 CurrentDepth; /**< \brief Messages in the pipe at the last sample */
+    uint16 PeakDepth;    /**< \brief Most messages the pipe has held */
+    uint16 MaxDepth;     /**< \brief Messages the pipe can hold */
+    int16  DepthGrowth;  /**< \brief Change in CurrentDepth since the previous sample */
+} HS_SbMonPipeTlm_t;
+
+/**
+ *  \brief Software Bus Monitor Packet Payload
+ */
+typedef struct
+{
+    uint32 SampleCount;   /**< \brief SB statistics samples received */
+    uint32 OverflowCount; /**< \brief Messages SB dropped because a pipe was full */
+    uint32 MsgLimitCount; /**< \brief Messages SB dropped because a pipe had its message limit of a message ID */
+    uint16 PipeCount;     /**< \brief Entries with a pipe */
+    uint16 FullCount;     /**< \brief Pipes near full, see #HS_SBMON_FULL_PCT */
+
+    HS_SbMonPipeTlm_t Pipes[HS_SBMON_MAX_PIPES]; /**< \brief Status of each monitored pipe */
+} HS_SbMonTlm_Payload_t;
+
+/**
+ *  \brief Software Bus Monitor Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    HS_SbMonTlm_Payload_t Payload;
+} HS_SbMonPkt_t;
+
 /**\}*/
 
 #endif
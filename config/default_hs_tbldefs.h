@@ -61,16 +61,35 @@
 #define HS_LOADED_AMT 0x04
 #define HS_LOADED_EMT 0x08
 #define HS_CDS_IN_USE 0x10
+#define HS_LOADED_MMT 0x20
+#define HS_LOADED_MFT 0x40
+/**\}*/
+
+/**
+ * \name HS Table Notification Flags (Table Services notification parameter)
+ * \{
+ */
+#define HS_TBL_NOTIFY_AMT 0x01 /**< \brief AppMon Table needs to be managed */
+#define HS_TBL_NOTIFY_EMT 0x02 /**< \brief EventMon Table needs to be managed */
+#define HS_TBL_NOTIFY_MAT 0x04 /**< \brief MsgActs Table needs to be managed */
+#define HS_TBL_NOTIFY_XCT 0x08 /**< \brief ExeCount Table needs to be managed */
+#define HS_TBL_NOTIFY_AMS 0x10 /**< \brief AppMon State Table has a dump pending */
+#define HS_TBL_NOTIFY_MMT 0x20 /**< \brief MemMon Table needs to be managed */
+#define HS_TBL_NOTIFY_MFT 0x40 /**< \brief MsgMon Table needs to be managed */
+#define HS_TBL_NOTIFY_ALL 0x7F /**< \brief All HS tables */
 /**\}*/
 
 /**
  * \name HS Table Name Strings
  * \{
  */
-#define HS_AMT_TABLENAME "AppMon_Tbl"   /**< \brief AppMon Table Name */
-#define HS_EMT_TABLENAME "EventMon_Tbl" /**< \brief EventMon Table Name */
-#define HS_XCT_TABLENAME "ExeCount_Tbl" /**< \brief ExeCount Table Name */
-#define HS_MAT_TABLENAME "MsgActs_Tbl"  /**< \brief MsgAction Table Name */
+#define HS_AMT_TABLENAME "AppMon_Tbl"      /**< \brief AppMon Table Name */
+#define HS_EMT_TABLENAME "EventMon_Tbl"    /**< \brief EventMon Table Name */
+#define HS_XCT_TABLENAME "ExeCount_Tbl"    /**< \brief ExeCount Table Name */
+#define HS_MAT_TABLENAME "MsgActs_Tbl"     /**< \brief MsgAction Table Name */
+#define HS_AMS_TABLENAME "AppMonState_Tbl" /**< \brief AppMon State (dump-only) Table Name */
+#define HS_MMT_TABLENAME "MemMon_Tbl"      /**< \brief MemMon Table Name */
+#define HS_MFT_TABLENAME "MsgMon_Tbl"      /**< \brief MsgMon Table Name */
 /**\}*/
 
 /**
@@ -106,6 +125,51 @@
 #define HS_XCT_TYPE_ISR       4 /**< \brief Counter for Interrupt Service Routine */
 /**\}*/
 
+/**
+ * \name Memory Monitor Table (MMT) Resource Types
+ * \{
+ */
+#define HS_MMT_TYPE_NOTYPE 0 /**< \brief No type */
+#define HS_MMT_TYPE_POOL   1 /**< \brief ES memory pool */
+#define HS_MMT_TYPE_HEAP   2 /**< \brief OS heap */
+/**\}*/
+
+/**
+ * \name Memory Monitor Table (MMT) Action Types
+ * \{
+ */
+#define HS_MMT_ACT_NOACT       0 /**< \brief No action is taken */
+#define HS_MMT_ACT_EVENT       1 /**< \brief Generates event message when a limit is crossed */
+#define HS_MMT_ACT_LAST_NONMSG 1 /**< \brief Index for finding end of non-message actions */
+/**\}*/
+
+/**
+ * \name Message Freshness Table (MFT) Action Types
+ * \{
+ */
+#define HS_MFT_ACT_NOACT       0 /**< \brief No action is taken */
+#define HS_MFT_ACT_EVENT       1 /**< \brief Generates event message when the message goes stale */
+#define HS_MFT_ACT_LAST_NONMSG 1 /**< \brief Index for finding end of non-message actions */
+/**\}*/
+
+/**
+ * \name Stack Monitor Action Types
+ * \{
+ */
+#define HS_STACKMON_ACT_NOACT       0 /**< \brief No action is taken */
+#define HS_STACKMON_ACT_EVENT       1 /**< \brief Generates event message when a task crosses the limit */
+#define HS_STACKMON_ACT_LAST_NONMSG 1 /**< \brief Index for finding end of non-message actions */
+/**\}*/
+
+/**
+ * \name SB Monitor Action Types
+ * \{
+ */
+#define HS_SBMON_ACT_NOACT       0 /**< \brief No action is taken */
+#define HS_SBMON_ACT_EVENT       1 /**< \brief Generates event message when a pipe stays near full */
+#define HS_SBMON_ACT_LAST_NONMSG 1 /**< \brief Index for finding end of non-message actions */
+/**\}*/
+
 /**
  * \name Message Actions Table (MAT) Enable State
  * \{
@@ -122,6 +186,9 @@
 #define HS_AMTVAL_NO_ERR  0  /**< \brief No error                          */
 #define HS_AMTVAL_ERR_ACT -1 /**< \brief Invalid ActionType specified      */
 #define HS_AMTVAL_ERR_NUL -2 /**< \brief Null Safety Buffer not Null       */
+#define HS_AMTVAL_ERR_DUP -3 /**< \brief AppName already used by an entry   */
+#define HS_AMTVAL_ERR_CON -4 /**< \brief AppName used with a different action */
+#define HS_AMTVAL_ERR_ESC -5 /**< \brief Invalid escalation rung specified */
 /**\}*/
 
 /**
@@ -131,6 +198,8 @@
 #define HS_EMTVAL_NO_ERR  0  /**< \brief No error                          */
 #define HS_EMTVAL_ERR_ACT -1 /**< \brief Invalid ActionType specified      */
 #define HS_EMTVAL_ERR_NUL -2 /**< \brief Null Safety Buffer not Null       */
+#define HS_EMTVAL_ERR_DUP -3 /**< \brief AppName and EventID already used   */
+#define HS_EMTVAL_ERR_CON -4 /**< \brief AppName and EventID used with a different action */
 /**\}*/
 
 /**
@@ -142,6 +211,27 @@
 #define HS_XCTVAL_ERR_NUL  -2 /**< \brief Null Safety Buffer not Null       */
 /**\}*/
 
+/**
+ * \name Memory Monitor Table (MMT) Validation Error Enumerated Types
+ * \{
+ */
+#define HS_MMTVAL_NO_ERR   0  /**< \brief No error                          */
+#define HS_MMTVAL_ERR_TYPE -1 /**< \brief Invalid Resource Type specified   */
+#define HS_MMTVAL_ERR_ACT  -2 /**< \brief Invalid ActionType specified      */
+#define HS_MMTVAL_ERR_PCT  -3 /**< \brief MinContigPct larger than 100      */
+#define HS_MMTVAL_ERR_NAME -4 /**< \brief Pool AppName empty or unterminated */
+/**\}*/
+
+/**
+ * \name Message Freshness Table (MFT) Validation Error Enumerated Types
+ * \{
+ */
+#define HS_MFTVAL_NO_ERR  0  /**< \brief No error                          */
+#define HS_MFTVAL_ERR_ID  -1 /**< \brief Invalid Message ID specified      */
+#define HS_MFTVAL_ERR_ACT -2 /**< \brief Invalid ActionType specified      */
+#define HS_MFTVAL_ERR_DUP -3 /**< \brief Message ID already monitored      */
+/**\}*/
+
 /**
  * \name Message Actions Table (MAT) Validation Error Enumerated Types
  * \{
@@ -150,6 +240,7 @@
 #define HS_MATVAL_ERR_ID  -1 /**< \brief Invalid Message ID specified      */
 #define HS_MATVAL_ERR_LEN -2 /**< \brief Invalid Length specified          */
 #define HS_MATVAL_ERR_ENA -3 /**< \brief Invalid Enable State specified    */
+#define HS_MATVAL_ERR_NXT -4 /**< \brief Invalid or looping Next Action    */
 /**\}*/
 
 #endif
@@ -52,17 +52,48 @@
 ** in the other two.
 */
 
+/**
+ *  \brief Application Monitor Table (AMT) Escalation Rung
+ */
+typedef struct
+{
+    uint16 ActionType;  /**< \brief Action if application is still missing, #HS_AMT_ACT_NOACT ends the ladder */
+    uint16 DwellCycles; /**< \brief Cycles given to check in after the previous action, 0 uses CycleCount */
+} HS_AMTRung_t;
+
 /**
  *  \brief Application Monitor Table (AMT) Entry
+ *
+ *  Escalation was added in HS 2.5.0. AMT images built for an earlier
+ *  version are smaller than this table and must be rebuilt.
  */
 typedef struct
 {
-    char   AppName[CFE_MISSION_MAX_API_LEN]; /**< \brief Name of application to be monitored */
-    uint16 NullTerm;                         /**< \brief Buffer of nulls to terminate string */
-    uint16 CycleCount;                       /**< \brief Number of cycles before application is missing */
-    uint16 ActionType;                       /**< \brief Action to take if application is missing */
+    char         AppName[CFE_MISSION_MAX_API_LEN];    /**< \brief Name of application to be monitored */
+    uint16       NullTerm;                            /**< \brief Buffer of nulls to terminate string */
+    uint16       CycleCount;                          /**< \brief Number of cycles before application is missing */
+    uint16       ActionType;                          /**< \brief Action to take if application is missing */
+    HS_AMTRung_t Escalation[HS_MAX_ESCALATION_RUNGS]; /**< \brief Further actions if application stays missing */
 } HS_AMTEntry_t;
 
+/**
+ *  \brief Application Monitor State Table (AMS) Entry
+ *
+ *  Live runtime state for the AMT entry at the same index. The state
+ *  table is dump-only and owned by HS; a dump is a snapshot taken
+ *  between monitoring cycles.
+ */
+typedef struct
+{
+    uint32 LastExeCount;          /**< \brief Last execution count seen for the application */
+    uint32 CyclesSinceCheckIn;    /**< \brief Cycles since the execution count last changed */
+    uint32 MaxCyclesSinceCheckIn; /**< \brief Largest CyclesSinceCheckIn since the AppMon table was refreshed */
+    uint16 CheckInCountdown;      /**< \brief Cycles left until the application is declared missing */
+    uint16 CycleCount;            /**< \brief AMT cycle count the countdown was last reloaded with */
+    uint16 EscalationRung;        /**< \brief Escalation rungs taken, 0 when the next failure takes ActionType */
+    uint16 RecoveryCheckIns;      /**< \brief Check-ins since the last escalation rung was taken */
+} HS_AMSEntry_t;
+
 /**
  *  \brief Event Monitor Table (EMT) Entry
  */
@@ -84,6 +115,36 @@ typedef struct
     uint32 ResourceType;                          /**< \brief Type of execution counter */
 } HS_XCTEntry_t;
 
+/**
+ *  \brief Memory Monitor Table (MMT) Entry
+ *
+ *  A pool handle is assigned by ES when the pool is created, so it is only
+ *  valid for the boot it was created in. Pool entries instead name the
+ *  application that owns the pool and an index it chose, which stay the
+ *  same from boot to boot; the application registers its handle under
+ *  them with #HS_REGISTER_POOL_CC.
+ */
+typedef struct
+{
+    uint32 ResourceType;                     /**< \brief Type of memory being monitored */
+    char   AppName[CFE_MISSION_MAX_API_LEN]; /**< \brief Application that registers the pool, for #HS_MMT_TYPE_POOL */
+    uint32 PoolIndex;                        /**< \brief Index the pool is registered with, for #HS_MMT_TYPE_POOL */
+    uint32 MinFreeBytes;                     /**< \brief Free bytes below which ActionType is taken, 0 for no limit */
+    uint16 MinContigPct; /**< \brief Largest free block as a percent of free bytes below which ActionType is taken */
+    uint16 ActionType;   /**< \brief Action to take when a limit is crossed */
+} HS_MMTEntry_t;
+
+/**
+ *  \brief Message Freshness Table (MFT) Entry
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t MsgId;      /**< \brief Message ID to monitor */
+    uint32         MaxAgeMsec; /**< \brief Longest expected time between arrivals, 0 for an unused entry */
+    uint16         ActionType; /**< \brief Action to take when the message is older than MaxAgeMsec */
+    uint16         Spare;      /**< \brief Spare for alignment */
+} HS_MFTEntry_t;
+
 /**
  *  \brief Message Action Table buffer
  */
@@ -99,7 +160,11 @@ typedef union
 typedef struct
 {
     uint16         EnableState; /**< \brief If entry contains message */
-    uint16         Cooldown;    /**< \brief Minimum rate at which message can be sent */
+    uint16         Cooldown;    /**< \brief Minimum time between sends, in #HS_MSG_ACT_COOLDOWN_MSEC counts */
+    uint16         Priority;    /**< \brief Send order when queued, lower values are sent first */
+    uint16         NextAction;  /**< \brief Index + 1 of the entry sent after this one, 0 ends the sequence */
+    uint16         NextDelay;   /**< \brief Time before NextAction is sent, in #HS_MSG_ACT_COOLDOWN_MSEC counts */
+    uint16         Spare;       /**< \brief Spare for alignment */
     HS_MATMsgBuf_t MsgBuf;      /**< \brief Message to be sent */
 } HS_MATEntry_t;
 
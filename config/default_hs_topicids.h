@@ -29,4 +29,10 @@
 #define CFE_MISSION_HS_WAKEUP_TOPICID  0xB0 /**< \brief Msg ID to wake up HS                 */
 #define CFE_MISSION_HS_HK_TLM_TOPICID  0xAD /**< \brief HS Housekeeping Telemetry            */
 
+#define CFE_MISSION_HS_VAL_REPORT_TLM_TOPICID 0xB1 /**< \brief HS Table Validation Report Telemetry */
+#define CFE_MISSION_HS_HISTORY_TLM_TOPICID    0xB2 /**< \brief HS Action History Telemetry */
+#define CFE_MISSION_HS_TIMING_TLM_TOPICID     0xB3 /**< \brief HS Phase Timing Telemetry */
+#define CFE_MISSION_HS_CMDSTATS_TLM_TOPICID   0xB4 /**< \brief HS Command Statistics Telemetry */
+#define CFE_MISSION_HS_SBMON_TLM_TOPICID      0xB5 /**< \brief HS Software Bus Monitor Telemetry */
+
 #endif
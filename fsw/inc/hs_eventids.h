@@ -976,6 +976,587 @@
  */
 #define HS_SUB_SHORT_EVS_ERR_EID 79
 
+/**
+ * \brief HS Table Notification Registration Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to #CFE_TBL_NotifyByMessage
+ *  for an HS table returns a value other than CFE_SUCCESS. The status of
+ *  that table is checked every HS cycle instead.
+ */
+#define HS_TBL_NOTIFY_ERR_EID 80
+
+/**
+ * \brief HS Manage Tables Command Invalid Parameter Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a manage tables command is received
+ *  with a parameter that does not identify any HS table.
+ */
+#define HS_MANAGE_TABLES_ERR_EID 81
+
+/**
+ * \brief HS AppMon Table Validation Duplicate Entry Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued on the first error when a table validation
+ *  finds an AppMon table entry for an application that an earlier entry
+ *  already monitors. Both entries are reported.
+ */
+#define HS_AMTVAL_DUP_ERR_EID 82
+
+/**
+ * \brief HS EventMon Table Validation Duplicate Entry Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued on the first error when a table validation
+ *  finds an EventMon table entry for an application and event ID that an
+ *  earlier entry already monitors. Both entries are reported.
+ */
+#define HS_EMTVAL_DUP_ERR_EID 83
+
+/**
+ * \brief HS AppMon State Table Register Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when Health and Safety is unable to register or
+ *  set the address of its dump-only AppMon State Table with cFE Table Services.
+ *  Application monitoring is not affected, but the state table cannot be dumped.
+ */
+#define HS_AMS_REG_ERR_EID 84
+
+/**
+ * \brief HS App Monitor Escalated Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a monitored application fails to check in
+ *  and its AppMon entry has another escalation rung. The application is given the
+ *  rung's dwell time to check in before the rung's action is taken.
+ */
+#define HS_APPMON_ESCALATE_INF_EID 85
+
+/**
+ * \brief HS App Monitor Escalation Recovered Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when an escalated application has checked in
+ *  #HS_ESCALATION_RECOVERY_CHECKINS times in a row. Its next failure will take
+ *  the base AppMon action again.
+ */
+#define HS_APPMON_RECOVERED_INF_EID 86
+
+/**
+ * \brief HS Action History CDS Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when Health and Safety is unable to create the
+ *  Critical Data Store block of an action history slot. The action history is
+ *  still kept, but it will not survive a reset.
+ */
+#define HS_HISTORY_CDS_ERR_EID 87
+
+/**
+ * \brief HS Action History CDS Corrupt Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued at startup when action history entries restored
+ *  from the Critical Data Store fail their CRC check. The corrupt entries are
+ *  cleared and the rest of the history is kept.
+ */
+#define HS_HISTORY_CORRUPT_ERR_EID 88
+
+/**
+ * \brief HS Send Action History Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #HS_SEND_HISTORY_CC command has been
+ *  received and the action history telemetry packet has been sent.
+ */
+#define HS_SEND_HISTORY_DBG_EID 89
+
+/**
+ * \brief HS Monitor State Snapshot CDS Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when Health and Safety is unable to create the
+ *  Critical Data Store block of a monitor state snapshot section. The snapshot
+ *  is not saved, so an HS restart will start monitoring from scratch.
+ */
+#define HS_SNAPSHOT_CDS_ERR_EID 90
+
+/**
+ * \brief HS Monitor State Snapshot Restored Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued at startup when a monitor state snapshot was
+ *  found in the Critical Data Store. It reports which sections were restored;
+ *  a section is not restored if it fails its CRC check, is older than
+ *  #HS_SNAPSHOT_MAX_AGE or was taken with a different table loaded.
+ */
+#define HS_SNAPSHOT_RESTORE_INF_EID 91
+
+/**
+ * \brief HS Watchdog Task Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when Health and Safety is unable to create its
+ *  watchdog task. The main loop services the watchdog at the end of each cycle
+ *  instead.
+ */
+#define HS_WATCHDOG_TASK_ERR_EID 92
+
+/**
+ * \brief HS Main Loop Stalled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued by the watchdog task when the HS main loop has
+ *  not completed a cycle for #HS_WATCHDOG_HEARTBEAT_TIMEOUT milliseconds. The
+ *  watchdog is no longer serviced, so it will expire unless HS recovers first.
+ */
+#define HS_WATCHDOG_STALL_ERR_EID 93
+
+/**
+ * \brief HS Reset Timing Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a reset timing command has been
+ *  received and the per-phase timing statistics have been cleared.
+ */
+#define HS_RESET_TIMING_DBG_EID 94
+
+/**
+ * \brief HS System Monitor Sampler Task Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when Health and Safety is unable to create its
+ *  system monitor sampler task. HS reads the system monitor itself once per
+ *  utilization interval instead.
+ */
+#define HS_SYSMON_TASK_ERR_EID 95
+
+/**
+ * \brief HS MemMon Table Register Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when Health and Safety is unable to register its
+ *  Memory Monitor Table with cFE Table Services via the #CFE_TBL_Register API.
+ */
+#define HS_MMT_REG_ERR_EID 96
+
+/**
+ * \brief HS MemMon Table Load Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to CFE_TBL_Load
+ *  for the memory monitor table returns a value other than CFE_SUCCESS
+ */
+#define HS_MMT_LD_ERR_EID 97
+
+/**
+ * \brief HS MemMon Table Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the address can't be obtained
+ *  from table services for the memory monitor table.
+ */
+#define HS_MEMMON_GETADDR_ERR_EID 98
+
+/**
+ * \brief HS MemMon Table Verification Results Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a table validation has been
+ *  completed for a memory monitor table load
+ */
+#define HS_MMTVAL_INF_EID 99
+
+/**
+ * \brief HS MemMon Table Verification Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued on the first error when a table validation
+ *  fails for a memory monitor table load.
+ */
+#define HS_MMTVAL_ERR_EID 100
+
+/**
+ * \brief HS MemMon Table Validation Null Pointer Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued if the TableData pointer passed to
+ *  HS_ValidateMMTable is null.
+ */
+#define HS_MM_TBL_NULL_ERR_EID 101
+
+/**
+ * \brief HS Memory Monitor Event Only Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a monitored memory pool falls below its
+ *  table specified free bytes or largest free block limit, and the specified
+ *  action type is Event Only.
+ */
+#define HS_MEMMON_FAIL_ERR_EID 102
+
+/**
+ * \brief HS Memory Monitor Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a monitored memory pool falls below its
+ *  table specified free bytes or largest free block limit, and the specified
+ *  action type is a Message Action.
+ */
+#define HS_MEMMON_MSGACTS_ERR_EID 103
+
+/**
+ * \brief HS Memory Monitor Read Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the statistics of a monitored memory
+ *  pool can't be read, usually because the pool handle in the Memory Monitor
+ *  Table doesn't match a pool. It is only issued again once the pool has been
+ *  read successfully.
+ */
+#define HS_MEMMON_READ_ERR_EID 104
+
+/**
+ * \brief HS Stack Monitor Limit Crossed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a task has used more of its stack than
+ *  #HS_STACKMON_USAGE_LIMIT, and #HS_STACKMON_ACTION_TYPE is Event Only.
+ */
+#define HS_STACKMON_LIMIT_ERR_EID 105
+
+/**
+ * \brief HS Stack Monitor Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a task has used more of its stack than
+ *  #HS_STACKMON_USAGE_LIMIT, and #HS_STACKMON_ACTION_TYPE is a Message Action.
+ */
+#define HS_STACKMON_MSGACTS_ERR_EID 106
+
+/**
+ * \brief HS SB Monitor Pipe Near Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a software bus pipe has been near full
+ *  for #HS_SBMON_FULL_SAMPLES samples, and #HS_SBMON_ACTION_TYPE is Event Only.
+ */
+#define HS_SBMON_FULL_ERR_EID 107
+
+/**
+ * \brief HS SB Monitor Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a software bus pipe has been near full
+ *  for #HS_SBMON_FULL_SAMPLES samples, and #HS_SBMON_ACTION_TYPE is a Message
+ *  Action.
+ */
+#define HS_SBMON_MSGACTS_ERR_EID 108
+
+/**
+ * \brief HS Create SB Monitor Pipe Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CFS Health and Safety
+ *  is unable to create its software bus monitor pipe via the
+ *  #CFE_SB_CreatePipe API
+ */
+#define HS_CR_SBMON_PIPE_ERR_EID 109
+
+/**
+ * \brief HS SB Monitor Subscribe Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CFS Health and Safety
+ *  is unable to subscribe to SB statistics or housekeeping
+ *  telemetry via the #CFE_SB_Subscribe API
+ */
+#define HS_SUB_SBMON_ERR_EID 110
+
+/**
+ * \brief HS MsgMon Table Register Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when Health and Safety is unable to register its
+ *  Message Freshness Table with cFE Table Services via the #CFE_TBL_Register API.
+ */
+#define HS_MFT_REG_ERR_EID 111
+
+/**
+ * \brief HS MsgMon Table Load Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to CFE_TBL_Load
+ *  for the message freshness table returns a value other than CFE_SUCCESS
+ */
+#define HS_MFT_LD_ERR_EID 112
+
+/**
+ * \brief HS MsgMon Table Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the address can't be obtained
+ *  from table services for the message freshness table.
+ */
+#define HS_MSGMON_GETADDR_ERR_EID 113
+
+/**
+ * \brief HS MsgMon Table Verification Results Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a table validation has been
+ *  completed for a message freshness table load
+ */
+#define HS_MFTVAL_INF_EID 114
+
+/**
+ * \brief HS MsgMon Table Verification Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued on the first error when a table validation
+ *  fails for a message freshness table load.
+ */
+#define HS_MFTVAL_ERR_EID 115
+
+/**
+ * \brief HS MsgMon Table Duplicate Entry Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the first error of a message freshness
+ *  table validation is a message ID that an earlier entry already monitors.
+ *  Every duplicate pair is listed in the validation report packet.
+ */
+#define HS_MFTVAL_DUP_ERR_EID 116
+
+/**
+ * \brief HS MsgMon Table Validation Null Pointer Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued if the TableData pointer passed to
+ *  HS_ValidateMFTable is null.
+ */
+#define HS_MF_TBL_NULL_ERR_EID 117
+
+/**
+ * \brief HS Message Monitor Event Only Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a monitored message has not arrived for
+ *  longer than its table specified maximum age, and the specified action type
+ *  is Event Only. It is only issued again after the message has arrived.
+ */
+#define HS_MSGMON_STALE_ERR_EID 118
+
+/**
+ * \brief HS Message Monitor Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a monitored message has not arrived for
+ *  longer than its table specified maximum age, and the specified action type
+ *  is a Message Action.
+ */
+#define HS_MSGMON_MSGACTS_ERR_EID 119
+
+/**
+ * \brief HS Create Message Monitor Pipe Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CFS Health and Safety
+ *  is unable to create its message monitor pipe via the
+ *  #CFE_SB_CreatePipe API
+ */
+#define HS_CR_MSGMON_PIPE_ERR_EID 120
+
+/**
+ * \brief HS Message Monitor Subscribe Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CFS Health and Safety is unable to
+ *  subscribe to a message listed in the Message Freshness Table via the
+ *  #CFE_SB_SubscribeEx API. That entry is reported stale once its maximum
+ *  age has passed.
+ */
+#define HS_MSGMON_SUB_ERR_EID 121
+
+/**
+ * \brief HS Register Memory Pool Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #HS_REGISTER_POOL_CC command has
+ *  registered a memory pool handle.
+ */
+#define HS_REGISTER_POOL_DBG_EID 122
+
+/**
+ * \brief HS Register Memory Pool Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #HS_REGISTER_POOL_CC command has an
+ *  empty application name or a handle that does not identify a memory
+ *  pool, or when every registration is already in use.
+ */
+#define HS_REGISTER_POOL_ERR_EID 123
+
+/**
+ * \brief HS Register Task Stack Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #HS_REGISTER_STACK_CC command has
+ *  registered the stack of a task.
+ */
+#define HS_REGISTER_STACK_DBG_EID 124
+
+/**
+ * \brief HS Register Task Stack Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #HS_REGISTER_STACK_CC command has an
+ *  empty task name or a stack symbol that OSAL can't find, or when every
+ *  registration is already in use.
+ */
+#define HS_REGISTER_STACK_ERR_EID 125
+
 /**\}*/
 
 #endif
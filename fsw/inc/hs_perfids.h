@@ -30,6 +30,17 @@
  */
 
 #define HS_APPMAIN_PERF_ID  40 /**< \brief Main task performance ID */
+#define HS_TBLMGMT_PERF_ID  41 /**< \brief Table management phase performance ID */
+#define HS_CPUUTIL_PERF_ID  42 /**< \brief CPU utilization phase performance ID */
+#define HS_APPMON_PERF_ID   43 /**< \brief Application monitoring phase performance ID */
+#define HS_EVENTMON_PERF_ID 44 /**< \brief Event monitoring phase performance ID */
+#define HS_CMDS_PERF_ID     45 /**< \brief Command processing phase performance ID */
+#define HS_MSGACTS_PERF_ID  46 /**< \brief Message Action phase performance ID */
+#define HS_CMDLANE_PERF_ID  47 /**< \brief Normal lane command phase performance ID */
+#define HS_MEMMON_PERF_ID   48 /**< \brief Memory monitoring phase performance ID */
+#define HS_STACKMON_PERF_ID 49 /**< \brief Task stack monitoring phase performance ID */
+#define HS_SBMON_PERF_ID    50 /**< \brief Software bus monitoring phase performance ID */
+#define HS_MSGMON_PERF_ID   51 /**< \brief Message freshness monitoring phase performance ID */
 
 /**\}*/
 
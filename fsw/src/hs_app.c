@@ -32,7 +32,10 @@
 #include "hs_msgids.h"
 #include "hs_perfids.h"
 #include "hs_monitors.h"
+#include "hs_stackmon.h"
 #include "hs_sysmon.h"
+#include "hs_runtime.h"
+#include "hs_msgacts.h"
 #include "hs_version.h"
 #include "hs_cmds.h"
 #include "hs_dispatch.h"
@@ -83,6 +86,11 @@ void HS_AppMain(void)
         CFE_PSP_WatchdogEnable();
         CFE_PSP_WatchdogService();
 
+        /*
+        ** Hand watchdog servicing over to its own task
+        */
+        HS_WatchdogTaskInit();
+
         /*
         ** Subscribe to Event Messages
         */
@@ -147,7 +155,11 @@ void HS_AppMain(void)
         */
         if ((Status == CFE_SUCCESS) || (Status == CFE_SB_NO_MESSAGE) || (Status == CFE_SB_TIME_OUT))
         {
+            HS_TimingCycleStart(Status);
+
             Status = HS_ProcessMain();
+
+            HS_TimingCycleEnd();
         }
 
         /*
@@ -214,14 +226,23 @@ CFE_Status_t HS_AppInit(void)
     HS_AppData.CurrentEventMonState  = HS_EVENTMON_DEFAULT_STATE;
     HS_AppData.CurrentAlivenessState = HS_ALIVENESS_DEFAULT_STATE;
     HS_AppData.CurrentCPUHogState    = HS_CPUHOG_DEFAULT_STATE;
+    HS_AppData.TblNotifyState        = HS_TBL_NOTIFY_DEFAULT_STATE;
 
     HS_AppData.ExeCountState  = HS_STATE_ENABLED;
+    HS_AppData.MemMonState    = HS_STATE_ENABLED;
+    HS_AppData.MsgMonState    = HS_STATE_ENABLED;
     HS_AppData.MsgActsState   = HS_STATE_ENABLED;
     HS_AppData.AppMonLoaded   = HS_STATE_ENABLED;
     HS_AppData.EventMonLoaded = HS_STATE_ENABLED;
     HS_AppData.CDSState       = HS_STATE_ENABLED;
 
     HS_AppData.MaxCPUHoggingTime = HS_UTIL_HOGGING_TIMEOUT;
+    HS_AppData.SnapshotPeriod    = HS_SNAPSHOT_PERIOD;
+
+    HS_AppData.WatchdogTaskPeriod = HS_WATCHDOG_TASK_PERIOD;
+
+    HS_RuntimeInit();
+    HS_MsgActQueueInit();
 
     /*
     ** Register for event services...
@@ -298,6 +319,12 @@ CFE_Status_t HS_AppInit(void)
         HS_SetCDSData(0, HS_MAX_RESTART_ACTIONS);
     }
 
+    /*
+    ** Restore the escalation ladders and the action history, which have their own CDS blocks
+    */
+    HS_LadderInit();
+    HS_HistoryInit();
+
     /*
     ** Set up the HS Software Bus
     */
@@ -316,6 +343,11 @@ CFE_Status_t HS_AppInit(void)
         return Status;
     }
 
+    /*
+    ** Pick up the monitor state saved before a restart, now that the tables are compiled
+    */
+    HS_SnapshotInit();
+
     /*
     ** Perform initialization for system monitoring
     */
@@ -349,6 +381,26 @@ CFE_Status_t HS_SbInit(void)
     CFE_MSG_Init(CFE_MSG_PTR(HS_AppData.HkPacket.TelemetryHeader), CFE_SB_ValueToMsgId(HS_HK_TLM_MID),
                  sizeof(HS_HkPacket_t));
 
+    /* Initialize validation report packet  */
+    CFE_MSG_Init(CFE_MSG_PTR(HS_AppData.ValReportPkt.TelemetryHeader), CFE_SB_ValueToMsgId(HS_VAL_REPORT_TLM_MID),
+                 sizeof(HS_ValReportPkt_t));
+
+    /* Initialize action history packet  */
+    CFE_MSG_Init(CFE_MSG_PTR(HS_AppData.HistoryPkt.TelemetryHeader), CFE_SB_ValueToMsgId(HS_HISTORY_TLM_MID),
+                 sizeof(HS_HistoryPkt_t));
+
+    /* Initialize phase timing packet  */
+    CFE_MSG_Init(CFE_MSG_PTR(HS_AppData.TimingPkt.TelemetryHeader), CFE_SB_ValueToMsgId(HS_TIMING_TLM_MID),
+                 sizeof(HS_TimingPkt_t));
+
+    /* Initialize command statistics packet  */
+    CFE_MSG_Init(CFE_MSG_PTR(HS_AppData.CmdStatsPkt.TelemetryHeader), CFE_SB_ValueToMsgId(HS_CMDSTATS_TLM_MID),
+                 sizeof(HS_CmdStatsPkt_t));
+
+    /* Initialize software bus monitor packet  */
+    CFE_MSG_Init(CFE_MSG_PTR(HS_AppData.SbMonPkt.TelemetryHeader), CFE_SB_ValueToMsgId(HS_SBMON_TLM_MID),
+                 sizeof(HS_SbMonPkt_t));
+
     /* Create Command Pipe */
     Status = CFE_SB_CreatePipe(&HS_AppData.CmdPipe, HS_CMD_PIPE_DEPTH, HS_CMD_PIPE_NAME);
     if (Status != CFE_SUCCESS)
@@ -358,6 +410,9 @@ CFE_Status_t HS_SbInit(void)
         return Status;
     }
 
+    /* Queueing latency is measured from when the command pipe was last empty */
+    OS_GetLocalTime(&HS_AppData.CmdLane.EmptyTime);
+
     /* Create Event Pipe */
     Status = CFE_SB_CreatePipe(&HS_AppData.EventPipe, HS_EVENT_PIPE_DEPTH, HS_EVENT_PIPE_NAME);
     if (Status != CFE_SUCCESS)
@@ -376,6 +431,15 @@ CFE_Status_t HS_SbInit(void)
         return Status;
     }
 
+    /* Create Message Monitor Pipe, subscriptions follow the Message Freshness table */
+    Status = CFE_SB_CreatePipe(&HS_AppData.MsgMonPipe, HS_MSGMON_PIPE_DEPTH, HS_MSGMON_PIPE_NAME);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_CR_MSGMON_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Creating SB MsgMon Pipe,RC=0x%08X", (unsigned int)Status);
+        return Status;
+    }
+
     /* Subscribe to Housekeeping Request */
     Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(HS_SEND_HK_MID), HS_AppData.CmdPipe);
     if (Status != CFE_SUCCESS)
@@ -403,6 +467,16 @@ CFE_Status_t HS_SbInit(void)
         return Status;
     }
 
+    /*
+    ** Create the Software Bus Monitor pipe and subscriptions, HS runs
+    ** without the SB monitor if they can't be set up
+    */
+    if (HS_SbMonInit() != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("HS App: SB monitor disabled\n");
+        HS_AppData.SbMon.State = HS_STATE_DISABLED;
+    }
+
     /*
     ** Event message subscription delayed until after startup synch
     */
@@ -469,6 +543,43 @@ CFE_Status_t HS_TblInit(void)
         return Status;
     }
 
+    /* Register The HS Memory Monitor Table */
+    TableSize = HS_MAX_MONITORED_MEM * sizeof(HS_MMTEntry_t);
+    Status    = CFE_TBL_Register(&HS_AppData.MMTableHandle, HS_MMT_TABLENAME, TableSize, CFE_TBL_OPT_DEFAULT,
+                              HS_ValidateMMTable);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_MMT_REG_ERR_EID, CFE_EVS_EventType_ERROR, "Error Registering MemMon Table,RC=0x%08X",
+                          (unsigned int)Status);
+        return Status;
+    }
+
+    /* Register The HS Message Freshness Table */
+    TableSize = HS_MAX_MONITORED_MSGS * sizeof(HS_MFTEntry_t);
+    Status    = CFE_TBL_Register(&HS_AppData.MFTableHandle, HS_MFT_TABLENAME, TableSize, CFE_TBL_OPT_DEFAULT,
+                              HS_ValidateMFTable);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_MFT_REG_ERR_EID, CFE_EVS_EventType_ERROR, "Error Registering MsgMon Table,RC=0x%08X",
+                          (unsigned int)Status);
+        return Status;
+    }
+
+    /*
+    ** Have Table Services tell HS when a table needs to be managed
+    */
+    if (HS_AppData.TblNotifyState == HS_STATE_ENABLED)
+    {
+        HS_TblNotifyRegister(HS_AppData.AMTableHandle, HS_TBL_NOTIFY_AMT);
+        HS_TblNotifyRegister(HS_AppData.EMTableHandle, HS_TBL_NOTIFY_EMT);
+        HS_TblNotifyRegister(HS_AppData.MATableHandle, HS_TBL_NOTIFY_MAT);
+        HS_TblNotifyRegister(HS_AppData.XCTableHandle, HS_TBL_NOTIFY_XCT);
+        HS_TblNotifyRegister(HS_AppData.MMTableHandle, HS_TBL_NOTIFY_MMT);
+        HS_TblNotifyRegister(HS_AppData.MFTableHandle, HS_TBL_NOTIFY_MFT);
+    }
+
     /* Load the HS Execution Counters Table */
     Status = CFE_TBL_Load(HS_AppData.XCTableHandle, CFE_TBL_SRC_FILE, (const void *)HS_XCT_FILENAME);
     if (Status != CFE_SUCCESS)
@@ -516,6 +627,28 @@ CFE_Status_t HS_TblInit(void)
         HS_AppData.MsgActsState = HS_STATE_DISABLED;
     }
 
+    /* Load the HS Memory Monitor Table */
+    Status = CFE_TBL_Load(HS_AppData.MMTableHandle, CFE_TBL_SRC_FILE, (const void *)HS_MMT_FILENAME);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_MMT_LD_ERR_EID, CFE_EVS_EventType_ERROR, "Error Loading MemMon Table,RC=0x%08X",
+                          (unsigned int)Status);
+        HS_AppData.MemMonState = HS_STATE_DISABLED;
+        memset(HS_AppData.MemMon, 0xFF, sizeof(HS_AppData.MemMon));
+    }
+
+    /* Load the HS Message Freshness Table */
+    Status = CFE_TBL_Load(HS_AppData.MFTableHandle, CFE_TBL_SRC_FILE, (const void *)HS_MFT_FILENAME);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_MFT_LD_ERR_EID, CFE_EVS_EventType_ERROR, "Error Loading MsgMon Table,RC=0x%08X",
+                          (unsigned int)Status);
+        HS_AppData.MsgMonState = HS_STATE_DISABLED;
+    }
+
+    /* Register The HS AppMon State Table */
+    HS_AMSTableInit();
+
     /*
     ** Get pointers to table data
     */
@@ -524,6 +657,67 @@ CFE_Status_t HS_TblInit(void)
     return CFE_SUCCESS;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Register for Table Services notifications for a table           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_TblNotifyRegister(CFE_TBL_Handle_t TblHandle, uint8 TblFlag)
+{
+    CFE_Status_t Status;
+
+    Status = CFE_TBL_NotifyByMessage(TblHandle, CFE_SB_ValueToMsgId(HS_CMD_MID), HS_MANAGE_TABLES_CC, TblFlag);
+
+    if (Status == CFE_SUCCESS)
+    {
+        HS_AppData.TblNotifyMask |= TblFlag;
+    }
+    else
+    {
+        /*
+        ** Not fatal, the table status is just checked every cycle instead
+        */
+        CFE_EVS_SendEvent(HS_TBL_NOTIFY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Registering Table Notification 0x%02X,RC=0x%08X", (unsigned int)TblFlag,
+                          (unsigned int)Status);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Register the dump-only AppMon State table                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_AMSTableInit(void)
+{
+    CFE_Status_t Status;
+
+    /*
+    ** Table Services dumps straight from the runtime state, so no copy is kept
+    */
+    Status = CFE_TBL_Register(&HS_AppData.AMSTableHandle, HS_AMS_TABLENAME, sizeof(HS_AppData.AppMonState),
+                              CFE_TBL_OPT_USR_DEF_ADDR, NULL);
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_TBL_Load(HS_AppData.AMSTableHandle, CFE_TBL_SRC_ADDRESS, HS_AppData.AppMonState);
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        /*
+        ** Not fatal, the state just can't be dumped
+        */
+        CFE_EVS_SendEvent(HS_AMS_REG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Registering AppMon State Table,RC=0x%08X", (unsigned int)Status);
+        HS_AppData.AMSTableHandle = CFE_TBL_BAD_TABLE_HANDLE;
+    }
+    else if (HS_AppData.TblNotifyState == HS_STATE_ENABLED)
+    {
+        HS_TblNotifyRegister(HS_AppData.AMSTableHandle, HS_TBL_NOTIFY_AMS);
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Main Processing Loop                                            */
@@ -533,37 +727,82 @@ CFE_Status_t HS_ProcessMain(void)
 {
     CFE_Status_t Status      = CFE_SUCCESS;
     const char * AliveString = HS_CPU_ALIVE_STRING;
-    uint32       i           = 0;
 
     /*
     ** Get Tables
     */
+    HS_TimingStart(HS_PHASE_TBLMGMT);
     HS_AcquirePointers();
+    HS_TimingStop(HS_PHASE_TBLMGMT);
 
     /*
-    ** Decrement Cooldowns for Message Actions
+    ** Bursts are scanned every cycle so the sampler task ring never has to
+    ** hold a whole interval
     */
-    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
+    if (HS_AppData.SysMonSampler.TaskState == HS_STATE_ENABLED)
     {
-        if (HS_AppData.MsgActCooldown[i] != 0)
-        {
-            HS_AppData.MsgActCooldown[i]--;
-        }
+        HS_SysMonBurstUpdate();
     }
 
     if (HS_AppData.UtilizationCycleCounter == 0)
     {
+        HS_TimingStart(HS_PHASE_CPUUTIL);
         HS_MonitorUtilization();
+        HS_TimingStop(HS_PHASE_CPUUTIL);
         HS_AppData.UtilizationCycleCounter = HS_CPU_UTILIZATION_CYCLES_PER_INTERVAL;
     }
     --HS_AppData.UtilizationCycleCounter;
 
+    /*
+    ** Monitor Memory Pools
+    */
+    if (HS_AppData.MemMonState == HS_STATE_ENABLED)
+    {
+        if (HS_AppData.MemMonCycleCounter == 0)
+        {
+            HS_TimingStart(HS_PHASE_MEMMON);
+            HS_MonitorMemory();
+            HS_TimingStop(HS_PHASE_MEMMON);
+            HS_AppData.MemMonCycleCounter = HS_MEMMON_CYCLES_PER_SAMPLE;
+        }
+        --HS_AppData.MemMonCycleCounter;
+    }
+
+    /*
+    ** Monitor Task Stacks
+    */
+    HS_TimingStart(HS_PHASE_STACKMON);
+    HS_MonitorStacks();
+    HS_TimingStop(HS_PHASE_STACKMON);
+
+    /*
+    ** Monitor Software Bus Pipes
+    */
+    if (HS_AppData.SbMon.State == HS_STATE_ENABLED)
+    {
+        HS_TimingStart(HS_PHASE_SBMON);
+        HS_SbMonCycle();
+        HS_TimingStop(HS_PHASE_SBMON);
+    }
+
+    /*
+    ** Monitor Message Freshness
+    */
+    if (HS_AppData.MsgMonState == HS_STATE_ENABLED)
+    {
+        HS_TimingStart(HS_PHASE_MSGMON);
+        HS_MonitorMessages();
+        HS_TimingStop(HS_PHASE_MSGMON);
+    }
+
     /*
     ** Monitor Applications
     */
     if (HS_AppData.CurrentAppMonState == HS_STATE_ENABLED)
     {
+        HS_TimingStart(HS_PHASE_APPMON);
         HS_MonitorApplications();
+        HS_TimingStop(HS_PHASE_APPMON);
     }
 
     /*
@@ -586,9 +825,25 @@ CFE_Status_t HS_ProcessMain(void)
     Status = HS_ProcessCommands();
 
     /*
-    ** Service the Watchdog
+    ** Send Message Actions queued by this cycle's monitoring
     */
-    if (HS_AppData.ServiceWatchdogFlag == HS_STATE_ENABLED)
+    HS_TimingStart(HS_PHASE_MSGACTS);
+    HS_MsgActQueueDrain();
+    HS_TimingStop(HS_PHASE_MSGACTS);
+
+    /*
+    ** Save a section of the monitor state when due
+    */
+    HS_SnapshotSave();
+
+    /*
+    ** Service the Watchdog, or tell the watchdog task this cycle completed
+    */
+    if (HS_AppData.WatchdogTaskState == HS_STATE_ENABLED)
+    {
+        HS_AppData.WatchdogHeartbeat++;
+    }
+    else if (HS_AppData.ServiceWatchdogFlag == HS_STATE_ENABLED)
     {
         CFE_PSP_WatchdogService();
     }
@@ -603,17 +858,36 @@ CFE_Status_t HS_ProcessMain(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 CFE_Status_t HS_ProcessCommands(void)
 {
-    CFE_Status_t     Status = CFE_SUCCESS;
-    CFE_SB_Buffer_t *BufPtr = NULL;
+    CFE_Status_t     Status     = CFE_SUCCESS;
+    CFE_SB_Buffer_t *BufPtr     = NULL;
+    uint32           EventCount = 0;
+
+    /*
+    ** Command and HK Requests Pipe (HK requests and priority commands are
+    ** processed now, the rest wait in the normal lane)
+    */
+    HS_TimingStart(HS_PHASE_CMDS);
+    Status = HS_CmdPipeRead();
+    HS_TimingStop(HS_PHASE_CMDS);
 
     /*
-    ** Event Message Pipe (done first so EventMon does not get enabled without table checking)
+    ** Event Message Pipe (done before the normal lane so EventMon does not get enabled without table checking)
     */
-    if (HS_AppData.CurrentEventMonState == HS_STATE_ENABLED)
+    if ((Status == CFE_SUCCESS) && (HS_AppData.CurrentEventMonState == HS_STATE_ENABLED))
     {
-        while (Status == CFE_SUCCESS)
+        HS_TimingStart(HS_PHASE_EVENTMON);
+
+        while ((Status == CFE_SUCCESS) && (EventCount < HS_EVENT_PIPE_BUDGET))
         {
-            Status = CFE_SB_ReceiveBuffer(&BufPtr, HS_AppData.EventPipe, CFE_SB_POLL);
+            if (HS_AppData.EventHeldBufPtr != NULL)
+            {
+                BufPtr                     = HS_AppData.EventHeldBufPtr;
+                HS_AppData.EventHeldBufPtr = NULL;
+            }
+            else
+            {
+                Status = CFE_SB_ReceiveBuffer(&BufPtr, HS_AppData.EventPipe, CFE_SB_POLL);
+            }
 
             if ((Status == CFE_SUCCESS) && (BufPtr != NULL))
             {
@@ -623,42 +897,42 @@ CFE_Status_t HS_ProcessCommands(void)
                 HS_AppData.EventsMonitoredCount++;
                 HS_MonitorEvent((CFE_EVS_LongEventTlm_t *)BufPtr);
             }
+
+            EventCount++;
         }
-    }
 
-    if (Status == CFE_SB_NO_MESSAGE)
-    {
-        /*
-        ** It's Good to not get a message -- we are polling
-        */
-        Status = CFE_SUCCESS;
-    }
+        if (Status == CFE_SUCCESS)
+        {
+            /*
+            ** The budget only held events back if there is another one waiting,
+            ** it is held to be monitored first next cycle
+            */
+            Status = CFE_SB_ReceiveBuffer(&BufPtr, HS_AppData.EventPipe, CFE_SB_POLL);
 
-    /*
-    ** Command and HK Requests Pipe
-    */
-    while (Status == CFE_SUCCESS)
-    {
-        /*
-        ** Process pending Commands or HK Reqs
-        */
-        Status = CFE_SB_ReceiveBuffer(&BufPtr, HS_AppData.CmdPipe, CFE_SB_POLL);
-        if ((Status == CFE_SUCCESS) && (BufPtr != NULL))
+            if ((Status == CFE_SUCCESS) && (BufPtr != NULL))
+            {
+                HS_AppData.EventHeldBufPtr = BufPtr;
+                HS_AppData.CmdStatsPkt.Payload.EventBudgetCount++;
+            }
+        }
+
+        HS_TimingStop(HS_PHASE_EVENTMON);
+
+        if (Status == CFE_SB_NO_MESSAGE)
         {
             /*
-            ** Pass Commands/HK Req to AppPipe Processing
+            ** It's Good to not get a message -- we are polling
             */
-            HS_AppPipe(BufPtr);
+            Status = CFE_SUCCESS;
         }
     }
 
-    if (Status == CFE_SB_NO_MESSAGE)
-    {
-        /*
-        ** It's Good to not get a message -- we are polling
-        */
-        Status = CFE_SUCCESS;
-    }
+    /*
+    ** Commands waiting in the normal lane
+    */
+    HS_TimingStart(HS_PHASE_CMDLANE);
+    HS_CmdLaneDrain();
+    HS_TimingStop(HS_PHASE_CMDLANE);
 
     return Status;
 }
@@ -32,6 +32,16 @@
 #include "hs_tbldefs.h"
 #include "hs_tbl.h"
 #include "hs_platform_cfg.h"
+#include "hs_runtime.h"
+#include "hs_msgacts.h"
+#include "hs_history.h"
+#include "hs_snapshot.h"
+#include "hs_watchdog.h"
+#include "hs_timing.h"
+#include "hs_sysmon.h"
+#include "hs_sbmon.h"
+#include "hs_stackmon.h"
+#include "hs_dispatch.h"
 #include "cfe.h"
 #include "cfe_msgids.h"
 
@@ -46,21 +56,66 @@
 #define HS_CMD_PIPE_NAME    "HS_CMD_PIPE"
 #define HS_EVENT_PIPE_NAME  "HS_EVENT_PIPE"
 #define HS_WAKEUP_PIPE_NAME "HS_WAKEUP_PIPE"
+#define HS_SBMON_PIPE_NAME  "HS_SBMON_PIPE"
+#define HS_MSGMON_PIPE_NAME "HS_MSGMON_PIPE"
 /**\}*/
 
 /**
- * \name HS CDS Buffer String
+ * \name HS CDS Buffer Strings
  * \{
  */
-#define HS_CDSNAME "HS_CDS"
+#define HS_CDSNAME        "HS_CDS"
+#define HS_LADDER_CDSNAME "HS_LADDER"
 /**\}*/
 
 #define HS_TBL_VAL_ERR (-1)
 
+/**
+ * \name HS Memory Monitor Entry Flags
+ * \{
+ */
+#define HS_MEMMON_LIMIT_CROSSED 0x01 /**< \brief Below a limit, the action was taken when it was crossed */
+#define HS_MEMMON_READ_FAILED   0x02 /**< \brief Statistics could not be read, the failure was reported */
+/**\}*/
+
+/**
+ * \brief Memory Monitor telemetry value while the memory can't be read
+ */
+#define HS_MEMMON_INVALID 0xFFFFFFFF
+
+/**
+ * \name HS Message Monitor Entry Flags
+ * \{
+ */
+#define HS_MSGMON_STALE 0x01 /**< \brief Older than its maximum age, the action was taken when it went stale */
+/**\}*/
+
+/**
+ * \brief Largest number of entries checked for duplicates in one table validation
+ */
+#define HS_VALIDATE_MAX_APP_EVENT_ENTRIES \
+    ((HS_MAX_MONITORED_APPS > HS_MAX_MONITORED_EVENTS) ? HS_MAX_MONITORED_APPS : HS_MAX_MONITORED_EVENTS)
+#define HS_VALIDATE_MAX_ENTRIES                                                                     \
+    ((HS_VALIDATE_MAX_APP_EVENT_ENTRIES > HS_MAX_MONITORED_MSGS) ? HS_VALIDATE_MAX_APP_EVENT_ENTRIES \
+                                                                 : HS_MAX_MONITORED_MSGS)
+
 /************************************************************************
  * Type Definitions
  ************************************************************************/
 
+/**
+ *  \brief HS CDS Escalation Ladder Position
+ *
+ *  AppHash ties the position to the application name so a table load
+ *  that moves or replaces an entry starts that entry back at the bottom
+ */
+typedef struct
+{
+    uint32 AppHash; /**< \brief Hash of the AppName the position belongs to */
+    uint16 Rung;    /**< \brief Escalation rungs climbed, 0 is the base action */
+    uint16 RungNot; /**< \brief Inverted Rung for validation */
+} HS_CDSLadder_t;
+
 /**
  *  \brief HS CDS Data Structure
  */
@@ -72,6 +127,27 @@ typedef struct
     uint16 MaxResetsNot;       /**< \brief Inverted Max Number of Resets Allowed for validation */
 } HS_CDSData_t;
 
+/**
+ *  \brief HS CDS Escalation Ladders
+ *
+ *  Kept in a CDS block of their own so a rung climb does not rewrite
+ *  the reset counts, and a bad ladder does not cost them
+ */
+typedef struct
+{
+    HS_CDSLadder_t Ladder[HS_MAX_MONITORED_APPS]; /**< \brief AppMon escalation ladder positions */
+} HS_CDSLadders_t;
+
+/**
+ *  \brief HS Registered Memory Pool
+ */
+typedef struct
+{
+    char               AppName[CFE_MISSION_MAX_API_LEN]; /**< \brief Application that owns the pool, empty if unused */
+    uint32             PoolIndex;                        /**< \brief Index the application chose for the pool */
+    CFE_ES_MemHandle_t PoolHandle;                       /**< \brief ES handle of the pool in this boot */
+} HS_PoolReg_t;
+
 /**
  *  \brief HS Global Data Structure
  */
@@ -80,8 +156,12 @@ typedef struct
     CFE_SB_PipeId_t CmdPipe;    /**< \brief Pipe Id for HS command pipe */
     CFE_SB_PipeId_t WakeupPipe; /**< \brief Pipe Id for HS wakeup pipe */
     CFE_SB_PipeId_t EventPipe;  /**< \brief Pipe Id for HK event pipe */
+    CFE_SB_PipeId_t MsgMonPipe; /**< \brief Pipe Id for HS message monitor pipe */
+
+    CFE_SB_Buffer_t *EventHeldBufPtr; /**< \brief Event message read past the budget, monitored first next cycle */
 
     uint8 ServiceWatchdogFlag; /**< \brief Flag of current watchdog servicing state */
+    uint8 WatchdogTaskState;   /**< \brief Status of the watchdog task, main loop services watchdog if disabled */
 
     uint8 CurrentAppMonState;    /**< \brief Status of HS Application Monitor */
     uint8 CurrentEventMonState;  /**< \brief Status of HS Events Monitor */
@@ -94,35 +174,55 @@ typedef struct
     uint8 EventMonLoaded; /**< \brief If EventMon Table is loaded */
 
     uint8 CurrentCPUHogState; /**< \brief Status of HS CPU Hogging Indicator */
-    uint8 SpareBytes[3];      /**< \brief Spare bytes for 32 bit alignment padding */
+    uint8 TblNotifyState;     /**< \brief Status of Table Services notifications */
+    uint8 TblNotifyMask;      /**< \brief Tables Table Services will notify HS about */
+    uint8 TblManagePending;   /**< \brief Tables notified as needing to be managed */
 
     uint8 CmdCount;    /**< \brief Number of valid commands received */
     uint8 CmdErrCount; /**< \brief Number of invalid commands received */
+    uint8 MemMonState; /**< \brief Status of Memory Monitor Table */
+    uint8 MsgMonState; /**< \brief Status of Message Freshness Table */
 
     uint32 EventsMonitoredCount; /**< \brief Total count of event messages monitored */
 
-    uint16 MsgActCooldown[HS_MAX_MSG_ACT_TYPES];          /**< \brief Counts until Message Actions is available */
-    uint16 AppMonCheckInCountdown[HS_MAX_MONITORED_APPS]; /**< \brief Counts until Application Monitor times out */
+    CFE_TIME_SysTime_t MsgActReadyTime[HS_MAX_MSG_ACT_TYPES]; /**< \brief MET when each Message Action is available */
 
     uint32 AppMonEnables[((HS_MAX_MONITORED_APPS - 1) / HS_BITS_PER_APPMON_ENABLE) +
                          1]; /**< \brief AppMon state by monitor */
 
-    uint32 AppMonLastExeCount[HS_MAX_MONITORED_APPS]; /**< \brief Last Execution Count for application being checked */
+    HS_AMSEntry_t AppMonState[HS_MAX_MONITORED_APPS]; /**< \brief AppMon runtime state, dumped as AppMon State table */
 
     uint32 AlivenessCounter; /**< \brief Current Count towards the CPU Aliveness output period */
 
     uint32 MsgActExec; /**< \brief Number of Software Bus Message Actions Executed */
 
+    HS_MsgActQueue_t MsgActQueue; /**< \brief Triggered Message Actions waiting to be sent */
+
     uint32 RunStatus; /**< \brief HS App run status */
 
+    CFE_ES_TaskId_t WatchdogTaskId;        /**< \brief Watchdog task ID */
+    volatile uint32 WatchdogHeartbeat;     /**< \brief HS cycles completed, checked by the watchdog task */
+    uint32          WatchdogLastHeartbeat; /**< \brief Heartbeat seen by the previous watchdog task check */
+    uint32          WatchdogStaleMsec;     /**< \brief Time the heartbeat has not changed */
+    uint32          WatchdogTaskPeriod;    /**< \brief Watchdog task period in milliseconds, 0 if there is no task */
+
+    uint64 WatchdogStack[(HS_WATCHDOG_TASK_STACK_SIZE + 7) / 8]; /**< \brief Stack the watchdog task runs on */
+
     uint32 SysMonPspModuleId;  /**< \brief PSP module to track system health, cpu utilization */
     uint16 SysMonSubsystemId;  /**< \brief Subsystem ID for cpu utilization function */
     uint16 SysMonSubchannelId; /**< \brief Subchannel ID for cpu utilization function */
 
+    HS_SysMonProc_t    SysMonProc;    /**< \brief Linux /proc system monitor, used when there is no PSP module */
+    HS_SysMonSampler_t SysMonSampler; /**< \brief System monitor sampler task */
+    HS_SbMon_t         SbMon;         /**< \brief Software bus monitor */
+    HS_StackMon_t      StackMon;      /**< \brief Task stack monitor */
+
     uint32 UtilizationCycleCounter; /**< \brief Counter to run cpu utilization check */
+    uint32 TblPollCycleCounter;     /**< \brief Counter to check the status of notified tables */
 
     uint32 CurrentCPUHoggingTime; /**< \brief Count of cycles that CPU utilization is above hogging threshold */
     uint32 MaxCPUHoggingTime;     /**< \brief Count of hogging cycles after which an event reports hogging */
+    uint32 SnapshotPeriod;        /**< \brief HS cycles between monitor state snapshot writes, 0 if disabled */
     uint32 CurrentCPUUtilIndex;   /**< \brief Current index into the Utilization Tracker */
 
     uint32 UtilizationTracker[HS_UTIL_PEAK_NUM_INTERVAL]; /**< \brief Utilization from previous intervals */
@@ -130,21 +230,67 @@ typedef struct
     uint32 UtilCpuAvg;  /**< \brief Current CPU Utilization Average */
     uint32 UtilCpuPeak; /**< \brief Current CPU Utilization Peak */
 
+    uint32 UtilCpuCores[HS_MAX_CPU_CORES]; /**< \brief CPU Utilization of each core, 0xFFFFFFFF if not known */
+
+    uint32 UtilBurstCount;   /**< \brief CPU Utilization bursts started last interval */
+    uint32 UtilBurstLongest; /**< \brief Longest CPU Utilization burst last interval, in milliseconds */
+    uint32 UtilSamplePeak;   /**< \brief Highest sampler task CPU Utilization sample last interval */
+    uint32 UtilSamplesLost;  /**< \brief Sampler task samples overwritten before they were scanned */
+
+    uint32         MemMonCycleCounter;                /**< \brief Counter to run memory pool check */
+    HS_MemMonTlm_t MemMon[HS_MAX_MONITORED_MEM];      /**< \brief Status of each Memory Monitor table entry */
+    uint8          MemMonFlags[HS_MAX_MONITORED_MEM]; /**< \brief HS_MEMMON_* flags of each entry */
+    HS_PoolReg_t   PoolReg[HS_MAX_REGISTERED_POOLS];  /**< \brief Memory pools registered by their applications */
+
+    HS_MsgMonTlm_t     MsgMon[HS_MAX_MONITORED_MSGS];            /**< \brief Status of each Message Freshness entry */
+    CFE_TIME_SysTime_t MsgMonLastArrival[HS_MAX_MONITORED_MSGS]; /**< \brief MET of each entry's last arrival */
+    uint8              MsgMonFlags[HS_MAX_MONITORED_MSGS];       /**< \brief HS_MSGMON_* flags of each entry */
+    CFE_SB_MsgId_t     MsgMonSubscribed[HS_MAX_MONITORED_MSGS];  /**< \brief Message IDs subscribed on the pipe */
+    uint32             MsgMonSubscribedCount;                    /**< \brief Number of valid MsgMonSubscribed */
+
     CFE_TBL_Handle_t AMTableHandle; /**< \brief Apps Monitor table handle */
     CFE_TBL_Handle_t EMTableHandle; /**< \brief Events Monitor table handle */
     CFE_TBL_Handle_t MATableHandle; /**< \brief Message Actions table handle */
 
-    CFE_TBL_Handle_t XCTableHandle; /**< \brief Execution Counters table handle */
-    HS_XCTEntry_t *  XCTablePtr;    /**< \brief Ptr to Execution Counters table entry */
+    CFE_TBL_Handle_t XCTableHandle;  /**< \brief Execution Counters table handle */
+    CFE_TBL_Handle_t AMSTableHandle; /**< \brief AppMon State dump-only table handle */
+    HS_XCTEntry_t *  XCTablePtr;     /**< \brief Ptr to Execution Counters table entry */
+    CFE_TBL_Handle_t MMTableHandle;  /**< \brief Memory Monitor table handle */
+    HS_MMTEntry_t *  MMTablePtr;     /**< \brief Ptr to Memory Monitor table entry */
+    CFE_TBL_Handle_t MFTableHandle;  /**< \brief Message Freshness table handle */
+    HS_MFTEntry_t *  MFTablePtr;     /**< \brief Ptr to Message Freshness table entry */
 
     HS_AMTEntry_t *AMTablePtr; /**< \brief Ptr to Apps Monitor table entry */
     HS_EMTEntry_t *EMTablePtr; /**< \brief Ptr to Events Monitor table entry */
     HS_MATEntry_t *MATablePtr; /**< \brief Ptr to Message Actions table entry */
 
+    HS_RuntimeBuf_t RuntimeBuf[HS_RUNTIME_NUM_BUFS]; /**< \brief Compiled table runtime buffers */
+    uint8           RuntimeActiveMask;               /**< \brief Tables whose active runtime buffer is the second */
+    uint8           RuntimeStagedMask;               /**< \brief Tables with a pending update in the inactive buffer */
+
     CFE_ES_CDSHandle_t MyCDSHandle; /* \brief Handle to CDS memory block */
     HS_CDSData_t       CDSData;     /* \brief Copy of Critical Data */
 
+    CFE_ES_CDSHandle_t LadderCDSHandle; /**< \brief Handle to escalation ladder CDS memory block */
+    HS_CDSLadders_t    CDSLadders;      /**< \brief Copy of the escalation ladder positions */
+    uint8              LadderCDSState;  /**< \brief Status of storing the escalation ladders in the CDS */
+
+    HS_History_t       History;     /**< \brief Action history, kept in the CDS */
+    HS_Snapshot_t      Snapshot;    /**< \brief Monitor state snapshot, kept in the CDS */
+
+    HS_Timing_t  Timing;  /**< \brief Cycle phase timing statistics */
+    HS_CmdLane_t CmdLane; /**< \brief Commands waiting in the normal lane and lane latency */
+
     HS_HkPacket_t HkPacket; /**< \brief HK Housekeeping Packet */
+
+    HS_ValReportPkt_t ValReportPkt; /**< \brief Table Validation Report Packet */
+    HS_HistoryPkt_t   HistoryPkt;   /**< \brief Action History Packet */
+    HS_TimingPkt_t    TimingPkt;    /**< \brief Phase Timing Packet */
+    HS_CmdStatsPkt_t  CmdStatsPkt;  /**< \brief Command Statistics Packet, counted in place */
+    HS_SbMonPkt_t     SbMonPkt;     /**< \brief Software Bus Monitor Packet */
+
+    uint32 ValHashHead[HS_VALIDATE_HASH_BUCKETS]; /**< \brief First validated entry link per key hash bucket */
+    uint32 ValHashNext[HS_VALIDATE_MAX_ENTRIES];  /**< \brief Next validated entry link in the same bucket */
 } HS_AppData_t;
 
 /************************************************************************
@@ -215,6 +361,38 @@ CFE_Status_t HS_SbInit(void);
  */
 CFE_Status_t HS_TblInit(void);
 
+/**
+ * \brief Register for Table Services notifications for a table
+ *
+ *  \par Description
+ *       Asks Table Services to send a #HS_MANAGE_TABLES_CC command with
+ *       the table's notification flag whenever the table has a load,
+ *       validation or dump pending.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       If registration fails the table status is checked every cycle
+ *       as if notifications were disabled.
+ *
+ *  \param [in] TblHandle  Handle of the registered table
+ *  \param [in] TblFlag    HS Table Notification Flag for the table
+ */
+void HS_TblNotifyRegister(CFE_TBL_Handle_t TblHandle, uint8 TblFlag);
+
+/**
+ * \brief Register the AppMon State Table
+ *
+ *  \par Description
+ *       Registers the dump-only AppMon State Table with its address set
+ *       to the live #HS_AMSEntry_t array, so a dump is a direct snapshot
+ *       of the AppMon runtime state. Dumps are serviced between
+ *       monitoring cycles, so each one is a consistent snapshot.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Failure is reported but not fatal. The table handle is set to
+ *       #CFE_TBL_BAD_TABLE_HANDLE so the table is never managed.
+ */
+void HS_AMSTableInit(void);
+
 /**
  * \brief Perform Normal Periodic Processing
  *
@@ -236,8 +414,10 @@ CFE_Status_t HS_ProcessMain(void);
  * \brief Process commands received from cFE Software Bus
  *
  *  \par Description
- *       This function pulls messages from command pipe and processes
- *       them accordingly.
+ *       This function reads the command pipe, processing housekeeping
+ *       requests and priority commands at once, then processes up to
+ *       #HS_EVENT_PIPE_BUDGET event messages, then the commands that
+ *       waited in the normal lane.
  *
  *  \par Assumptions, External Events, and Notes:
  *       None
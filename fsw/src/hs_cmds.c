@@ -28,11 +28,20 @@
 #include "hs_app.h"
 #include "hs_cmds.h"
 #include "hs_monitors.h"
+#include "hs_stackmon.h"
+#include "hs_runtime.h"
+#include "hs_msgacts.h"
+#include "hs_history.h"
+#include "hs_timing.h"
+#include "hs_dispatch.h"
 #include "hs_msgids.h"
 #include "hs_eventids.h"
 #include "hs_utils.h"
 #include "hs_version.h"
 
+#include <stddef.h>
+#include <string.h>
+
 /**
  * \brief Internal Macro to access the internal payload structure of a message
  *
@@ -41,6 +50,41 @@
  */
 #define HS_GET_CMD_PAYLOAD(ptr, type) (&((const type *)(ptr))->Payload)
 
+/************************************************************************
+** Table Management Table
+*************************************************************************/
+
+/**
+ * \brief Management table entry of a compiled HS table
+ */
+#define HS_TBL_MGMT_ENTRY(Flag, Handle, Compiled, Compile, Refresh, State, AddrError, EventID, Name)       \
+    {                                                                                                   \
+        (Flag), &HS_AppData.Handle, offsetof(HS_RuntimeBuf_t, Compiled), (HS_TblCompile_t)(Compile), \
+            (Refresh), &HS_AppData.State, (AddrError), (EventID), (Name)                              \
+    }
+
+/*
+** Tables are managed, and their status refreshed, in this order
+*/
+
+/* clang-format off */
+const HS_TblMgmtEntry_t HS_TblMgmtTable[HS_NUM_MANAGED_TBLS] =
+{
+    HS_TBL_MGMT_ENTRY(HS_TBL_NOTIFY_AMT, AMTableHandle, AMTCompiled, HS_RuntimeCompileAMT, HS_AppMonStatusRefresh,
+                      AppMonLoaded, HS_AppMonAddrError, HS_APPMON_GETADDR_ERR_EID, "AppMon"),
+    HS_TBL_MGMT_ENTRY(HS_TBL_NOTIFY_EMT, EMTableHandle, EMTCompiled, HS_RuntimeCompileEMT, NULL,
+                      EventMonLoaded, HS_EventMonAddrError, HS_EVENTMON_GETADDR_ERR_EID, "EventMon"),
+    HS_TBL_MGMT_ENTRY(HS_TBL_NOTIFY_MAT, MATableHandle, MATCompiled, HS_RuntimeCompileMAT, HS_MsgActsStatusRefresh,
+                      MsgActsState, NULL, HS_MSGACTS_GETADDR_ERR_EID, "MsgActs"),
+    HS_TBL_MGMT_ENTRY(HS_TBL_NOTIFY_XCT, XCTableHandle, XCTCompiled, HS_RuntimeCompileXCT, NULL,
+                      ExeCountState, NULL, HS_EXECOUNT_GETADDR_ERR_EID, "ExeCount"),
+    HS_TBL_MGMT_ENTRY(HS_TBL_NOTIFY_MMT, MMTableHandle, MMTCompiled, HS_RuntimeCompileMMT, HS_MemMonStatusRefresh,
+                      MemMonState, NULL, HS_MEMMON_GETADDR_ERR_EID, "MemMon"),
+    HS_TBL_MGMT_ENTRY(HS_TBL_NOTIFY_MFT, MFTableHandle, MFTCompiled, HS_RuntimeCompileMFT, HS_MsgMonStatusRefresh,
+                      MsgMonState, NULL, HS_MSGMON_GETADDR_ERR_EID, "MsgMon"),
+};
+/* clang-format on */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Housekeeping request                                            */
@@ -50,12 +94,11 @@ CFE_Status_t HS_SendHkCmd(const HS_SendHkCmd_t *BufPtr)
 {
     CFE_ES_AppId_t AppId = CFE_ES_APPID_UNDEFINED;
 
-    uint32             ExeCount;
-    CFE_ES_TaskId_t    TaskId;
-    CFE_ES_CounterId_t CounterId;
-    CFE_ES_TaskInfo_t  TaskInfo;
-    int32              Status;
-    uint32             TableIndex;
+    uint32            ExeCount;
+    CFE_ES_TaskInfo_t TaskInfo;
+    int32             Status;
+    uint32            TableIndex;
+    HS_RuntimeBuf_t * XCRuntimePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_XCT);
 
     HS_HkTlm_Payload_t *PayloadPtr;
 
@@ -76,6 +119,8 @@ CFE_Status_t HS_SendHkCmd(const HS_SendHkCmd_t *BufPtr)
     PayloadPtr->MaxResets             = HS_AppData.CDSData.MaxResets;
     PayloadPtr->EventsMonitoredCount  = HS_AppData.EventsMonitoredCount;
     PayloadPtr->MsgActExec            = HS_AppData.MsgActExec;
+    PayloadPtr->MsgActQueued          = HS_AppData.MsgActQueue.QueuedCount;
+    PayloadPtr->MsgActSuppressed      = HS_AppData.MsgActQueue.SuppressedCount;
 
     /*
     ** Calculate the current number of invalid event monitor entries
@@ -119,6 +164,14 @@ CFE_Status_t HS_SendHkCmd(const HS_SendHkCmd_t *BufPtr)
     {
         PayloadPtr->StatusFlags |= HS_CDS_IN_USE;
     }
+    if (HS_AppData.MemMonState == HS_STATE_ENABLED)
+    {
+        PayloadPtr->StatusFlags |= HS_LOADED_MMT;
+    }
+    if (HS_AppData.MsgMonState == HS_STATE_ENABLED)
+    {
+        PayloadPtr->StatusFlags |= HS_LOADED_MFT;
+    }
 
     /*
     ** Update the AppMon Enables
@@ -131,6 +184,20 @@ CFE_Status_t HS_SendHkCmd(const HS_SendHkCmd_t *BufPtr)
     PayloadPtr->UtilCpuAvg  = HS_AppData.UtilCpuAvg;
     PayloadPtr->UtilCpuPeak = HS_AppData.UtilCpuPeak;
 
+    for (TableIndex = 0; TableIndex < HS_MAX_CPU_CORES; TableIndex++)
+    {
+        PayloadPtr->UtilCpuCores[TableIndex] = HS_AppData.UtilCpuCores[TableIndex];
+    }
+
+    PayloadPtr->UtilBurstCount   = HS_AppData.UtilBurstCount;
+    PayloadPtr->UtilBurstLongest = HS_AppData.UtilBurstLongest;
+    PayloadPtr->UtilSamplePeak   = HS_AppData.UtilSamplePeak;
+    PayloadPtr->UtilSamplesLost  = HS_AppData.UtilSamplesLost;
+
+    memcpy(PayloadPtr->MemMon, HS_AppData.MemMon, sizeof(PayloadPtr->MemMon));
+    memcpy(PayloadPtr->StackTop, HS_AppData.StackMon.Reported, sizeof(PayloadPtr->StackTop));
+    memcpy(PayloadPtr->MsgMon, HS_AppData.MsgMon, sizeof(PayloadPtr->MsgMon));
+
     /*
     ** Add the execution counters
     */
@@ -142,26 +209,36 @@ CFE_Status_t HS_SendHkCmd(const HS_SendHkCmd_t *BufPtr)
         {
             switch (HS_AppData.XCTablePtr[TableIndex].ResourceType)
             {
+                /*
+                ** A resource that was not found or has since been restarted
+                ** is looked up again by name
+                */
                 case HS_XCT_TYPE_APP_MAIN:
                 case HS_XCT_TYPE_APP_CHILD:
-                    Status = CFE_ES_GetTaskIDByName(&TaskId, HS_AppData.XCTablePtr[TableIndex].ResourceName);
+                    Status = CFE_ES_GetTaskInfo(&TaskInfo, XCRuntimePtr->XCTaskId[TableIndex]);
+
+                    if ((Status != CFE_SUCCESS) && HS_RuntimeResolveXC(XCRuntimePtr, TableIndex))
+                    {
+                        Status = CFE_ES_GetTaskInfo(&TaskInfo, XCRuntimePtr->XCTaskId[TableIndex]);
+                    }
 
                     if (Status == CFE_SUCCESS)
                     {
-                        Status = CFE_ES_GetTaskInfo(&TaskInfo, TaskId);
-                        if (Status == CFE_SUCCESS)
-                        {
-                            ExeCount = TaskInfo.ExecutionCounter;
-                        }
+                        ExeCount = TaskInfo.ExecutionCounter;
                     }
                     break;
                 case HS_XCT_TYPE_DEVICE:
                 case HS_XCT_TYPE_ISR:
-                    Status = CFE_ES_GetGenCounterIDByName(&CounterId, HS_AppData.XCTablePtr[TableIndex].ResourceName);
+                    Status = CFE_ES_GetGenCount(XCRuntimePtr->XCCounterId[TableIndex], &ExeCount);
 
-                    if (Status == CFE_SUCCESS)
+                    if ((Status != CFE_SUCCESS) && HS_RuntimeResolveXC(XCRuntimePtr, TableIndex))
+                    {
+                        Status = CFE_ES_GetGenCount(XCRuntimePtr->XCCounterId[TableIndex], &ExeCount);
+                    }
+
+                    if (Status != CFE_SUCCESS)
                     {
-                        CFE_ES_GetGenCount(CounterId, &ExeCount);
+                        ExeCount = HS_INVALID_EXECOUNT;
                     }
                     break;
                 case HS_XCT_TYPE_NOTYPE:
@@ -185,6 +262,22 @@ CFE_Status_t HS_SendHkCmd(const HS_SendHkCmd_t *BufPtr)
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(HS_AppData.HkPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(HS_AppData.HkPacket.TelemetryHeader), true);
 
+    /*
+    ** Timestamp and send phase timing packet
+    */
+    HS_TimingReport(&HS_AppData.TimingPkt.Payload);
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(HS_AppData.TimingPkt.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(HS_AppData.TimingPkt.TelemetryHeader), true);
+
+    /*
+    ** Timestamp and send command statistics packet
+    */
+    HS_CmdLaneReport();
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(HS_AppData.CmdStatsPkt.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(HS_AppData.CmdStatsPkt.TelemetryHeader), true);
+
     return CFE_SUCCESS;
 }
 
@@ -227,6 +320,12 @@ void HS_ResetCounters(void)
     HS_AppData.CmdErrCount          = 0;
     HS_AppData.EventsMonitoredCount = 0;
     HS_AppData.MsgActExec           = 0;
+
+    HS_AppData.MsgActQueue.QueuedCount     = 0;
+    HS_AppData.MsgActQueue.SuppressedCount = 0;
+
+    memset(&HS_AppData.CmdStatsPkt.Payload, 0, sizeof(HS_AppData.CmdStatsPkt.Payload));
+    memset(HS_AppData.CmdLane.LatencyTotalUsec, 0, sizeof(HS_AppData.CmdLane.LatencyTotalUsec));
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -448,203 +547,411 @@ CFE_Status_t HS_SetMaxResetsCmd(const HS_SetMaxResetsCmd_t *BufPtr)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Acquire table pointers                                          */
+/* Manage tables command                                           */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_AcquirePointers(void)
+CFE_Status_t HS_ManageTablesCmd(const HS_ManageTablesCmd_t *BufPtr)
 {
-    CFE_Status_t Status;
+    const HS_ManageTables_Payload_t *CmdPtr;
 
-    /*
-    ** Release the table (AppMon)
-    */
-    CFE_TBL_ReleaseAddress(HS_AppData.AMTableHandle);
+    CmdPtr = HS_GET_CMD_PAYLOAD(BufPtr, HS_ManageTablesCmd_t);
 
-    /*
-    ** Manage the table (AppMon)
-    */
-    CFE_TBL_Manage(HS_AppData.AMTableHandle);
+    if ((CmdPtr->Parameter == 0) || ((CmdPtr->Parameter & ~((uint32)HS_TBL_NOTIFY_ALL)) != 0))
+    {
+        CFE_EVS_SendEvent(HS_MANAGE_TABLES_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid manage tables request: Parameter = 0x%08X", (unsigned int)CmdPtr->Parameter);
+        HS_AppData.CmdErrCount++;
+    }
+    else
+    {
+        /*
+        ** Internal message from Table Services, so the command counter is
+        ** left alone. The tables are managed at the start of the next cycle.
+        */
+        HS_AppData.TblManagePending |= (uint8)CmdPtr->Parameter;
+    }
 
-    /*
-    ** Get a pointer to the table (AppMon)
-    */
-    Status = CFE_TBL_GetAddress((void *)&HS_AppData.AMTablePtr, HS_AppData.AMTableHandle);
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send action history command                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HS_SendHistoryCmd(const HS_SendHistoryCmd_t *BufPtr)
+{
+    HS_AppData.CmdCount++;
+
+    HS_HistoryReport(&HS_AppData.HistoryPkt.Payload);
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(HS_AppData.HistoryPkt.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(HS_AppData.HistoryPkt.TelemetryHeader), true);
+
+    CFE_EVS_SendEvent(HS_SEND_HISTORY_DBG_EID, CFE_EVS_EventType_DEBUG, "Action history sent: %d entries",
+                      (int)HS_AppData.HistoryPkt.Payload.EntryCount);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reset phase timing command                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HS_ResetTimingCmd(const HS_ResetTimingCmd_t *BufPtr)
+{
+    HS_AppData.CmdCount++;
+
+    HS_TimingReset();
+
+    CFE_EVS_SendEvent(HS_RESET_TIMING_DBG_EID, CFE_EVS_EventType_DEBUG, "Timing statistics reset");
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Register memory pool command                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HS_RegisterPoolCmd(const HS_RegisterPoolCmd_t *BufPtr)
+{
+    const HS_RegisterPool_Payload_t *CmdPtr;
+    HS_RuntimeBuf_t *                MMRuntimePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MMT);
+    HS_PoolReg_t *                   RegPtr;
+    CFE_ES_MemPoolStats_t            PoolStats;
+    CFE_ES_MemHandle_t               PoolHandle;
+    char                             AppName[CFE_MISSION_MAX_API_LEN];
+    uint32                           RegIndex;
+    uint32                           SlotIndex = HS_MAX_REGISTERED_POOLS;
+    uint32                           TableIndex;
+    CFE_Status_t                     Status;
+
+    CmdPtr     = HS_GET_CMD_PAYLOAD(BufPtr, HS_RegisterPoolCmd_t);
+    PoolHandle = CFE_ResourceId_FromInteger(CmdPtr->PoolHandle);
+
+    strncpy(AppName, CmdPtr->AppName, sizeof(AppName) - 1);
+    AppName[sizeof(AppName) - 1] = '\0';
 
     /*
-    ** If there is a new table, refresh status (AppMon)
+    ** Registering the same pool again replaces its handle, otherwise the first free slot is taken
     */
-    if (Status == CFE_TBL_INFO_UPDATED)
+    for (RegIndex = 0; RegIndex < HS_MAX_REGISTERED_POOLS; RegIndex++)
     {
-        HS_AppMonStatusRefresh();
+        RegPtr = &HS_AppData.PoolReg[RegIndex];
+
+        if (RegPtr->AppName[0] == '\0')
+        {
+            if (SlotIndex == HS_MAX_REGISTERED_POOLS)
+            {
+                SlotIndex = RegIndex;
+            }
+        }
+        else if ((RegPtr->PoolIndex == CmdPtr->PoolIndex) && (strncmp(RegPtr->AppName, AppName, sizeof(AppName)) == 0))
+        {
+            SlotIndex = RegIndex;
+            break;
+        }
     }
 
-    /*
-    ** If Address acquisition fails and currently enabled, report and disable (AppMon)
-    */
-    if (Status < CFE_SUCCESS)
+    Status = CFE_ES_GetMemPoolStats(&PoolStats, PoolHandle);
+
+    if (AppName[0] == '\0')
+    {
+        CFE_EVS_SendEvent(HS_REGISTER_POOL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Register pool err: Pool %u has no application name", (unsigned int)CmdPtr->PoolIndex);
+        HS_AppData.CmdErrCount++;
+    }
+    else if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_REGISTER_POOL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Register pool err: %s pool %u: Handle 0x%08X is not a memory pool, RC=0x%08X", AppName,
+                          (unsigned int)CmdPtr->PoolIndex, (unsigned int)CmdPtr->PoolHandle, (unsigned int)Status);
+        HS_AppData.CmdErrCount++;
+    }
+    else if (SlotIndex == HS_MAX_REGISTERED_POOLS)
     {
+        CFE_EVS_SendEvent(HS_REGISTER_POOL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Register pool err: %s pool %u: All %d registrations in use", AppName,
+                          (unsigned int)CmdPtr->PoolIndex, HS_MAX_REGISTERED_POOLS);
+        HS_AppData.CmdErrCount++;
+    }
+    else
+    {
+        RegPtr = &HS_AppData.PoolReg[SlotIndex];
+
+        memcpy(RegPtr->AppName, AppName, sizeof(RegPtr->AppName));
+        RegPtr->PoolIndex  = CmdPtr->PoolIndex;
+        RegPtr->PoolHandle = PoolHandle;
+
         /*
-        ** Only report and disable if enabled or the table was previously loaded (AppMon)
+        ** Entries naming the pool watch the new handle from the next sample on
         */
-        if ((HS_AppData.AppMonLoaded == HS_STATE_ENABLED) || (HS_AppData.CurrentAppMonState == HS_STATE_ENABLED))
+        for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_MEM; TableIndex++)
         {
-            CFE_EVS_SendEvent(HS_APPMON_GETADDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Error getting AppMon Table address, RC=0x%08X, Application Monitoring Disabled",
-                              (unsigned int)Status);
-            HS_AppData.CurrentAppMonState = HS_STATE_DISABLED;
-            HS_AppData.AppMonLoaded       = HS_STATE_DISABLED;
+            if (MMRuntimePtr->MMTable[TableIndex].ResourceType == HS_MMT_TYPE_POOL)
+            {
+                HS_RuntimeResolveMM(MMRuntimePtr, TableIndex);
+            }
         }
+
+        HS_AppData.CmdCount++;
+
+        CFE_EVS_SendEvent(HS_REGISTER_POOL_DBG_EID, CFE_EVS_EventType_DEBUG, "Registered %s pool %u: Handle 0x%08X",
+                          AppName, (unsigned int)CmdPtr->PoolIndex, (unsigned int)CmdPtr->PoolHandle);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Register task stack command                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HS_RegisterStackCmd(const HS_RegisterStackCmd_t *BufPtr)
+{
+    const HS_RegisterStack_Payload_t *CmdPtr;
+    char                              TaskName[CFE_MISSION_MAX_API_LEN];
+    char                              StackSymbol[CFE_MISSION_MAX_PATH_LEN];
+    cpuaddr                           StackBase = 0;
+    int32                             OsStatus;
+
+    CmdPtr = HS_GET_CMD_PAYLOAD(BufPtr, HS_RegisterStackCmd_t);
+
+    strncpy(TaskName, CmdPtr->TaskName, sizeof(TaskName) - 1);
+    TaskName[sizeof(TaskName) - 1] = '\0';
+    strncpy(StackSymbol, CmdPtr->StackSymbol, sizeof(StackSymbol) - 1);
+    StackSymbol[sizeof(StackSymbol) - 1] = '\0';
+
+    OsStatus = OS_SymbolLookup(&StackBase, StackSymbol);
+
+    if (TaskName[0] == '\0')
+    {
+        CFE_EVS_SendEvent(HS_REGISTER_STACK_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Register stack err: Stack %s has no task name", StackSymbol);
+        HS_AppData.CmdErrCount++;
+    }
+    else if (OsStatus != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_REGISTER_STACK_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Register stack err: %s: Symbol %s not found, RC=%d", TaskName, StackSymbol, (int)OsStatus);
+        HS_AppData.CmdErrCount++;
+    }
+    else if (!HS_StackMonRegister(TaskName, StackBase))
+    {
+        CFE_EVS_SendEvent(HS_REGISTER_STACK_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Register stack err: %s: All %d registrations in use", TaskName, HS_MAX_REGISTERED_STACKS);
+        HS_AppData.CmdErrCount++;
     }
-    /*
-    ** Otherwise, mark that the table is loaded (AppMon)
-    */
     else
     {
-        HS_AppData.AppMonLoaded = HS_STATE_ENABLED;
+        HS_AppData.CmdCount++;
+
+        CFE_EVS_SendEvent(HS_REGISTER_STACK_DBG_EID, CFE_EVS_EventType_DEBUG, "Registered %s stack: Symbol %s",
+                          TaskName, StackSymbol);
     }
 
-    /*
-    ** Release the table (EventMon)
-    */
-    CFE_TBL_ReleaseAddress(HS_AppData.EMTableHandle);
+    return CFE_SUCCESS;
+}
 
-    /*
-    ** Manage the table (EventMon)
-    */
-    CFE_TBL_Manage(HS_AppData.EMTableHandle);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check if a table needs to be managed this cycle                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_TblManageNeeded(uint8 TblFlag, CFE_TBL_Handle_t TblHandle, bool Compiled)
+{
+    bool Needed;
 
-    /*
-    ** Get a pointer to the table (EventMon)
-    */
-    Status = CFE_TBL_GetAddress((void *)&HS_AppData.EMTablePtr, HS_AppData.EMTableHandle);
+    if (!Compiled)
+    {
+        Needed = true;
+    }
+    else if (((HS_AppData.TblNotifyMask & TblFlag) != 0) && (HS_AppData.TblPollCycleCounter != 0))
+    {
+        /*
+        ** Table Services notifies HS of pending actions for this table
+        */
+        Needed = ((HS_AppData.TblManagePending & TblFlag) != 0);
+    }
+    else
+    {
+        /*
+        ** Notified tables are polled too now and then, in case a notification was lost
+        */
+        Needed = ((HS_AppData.TblManagePending & TblFlag) != 0) || (CFE_TBL_GetStatus(TblHandle) != CFE_SUCCESS);
+    }
 
-    /*
-    ** If Address acquisition fails and currently enabled, report and disable (EventMon)
-    */
-    if (Status < CFE_SUCCESS)
+    HS_AppData.TblManagePending &= (uint8)~TblFlag;
+
+    return Needed;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Acquire table pointers                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_AcquirePointers(void)
+{
+    CFE_Status_t             Status;
+    const HS_TblMgmtEntry_t *EntryPtr;
+    void *                   TblPtr      = NULL;
+    uint8                    UpdatedMask = 0;
+    bool                     Compiled;
+    uint32                   i;
+
+    for (i = 0; i < HS_NUM_MANAGED_TBLS; i++)
     {
+        EntryPtr = &HS_TblMgmtTable[i];
+        Compiled =
+            (*((const uint8 *)HS_RUNTIME_ACTIVE_BUF(EntryPtr->TblFlag) + EntryPtr->CompiledOffset) != 0);
+
         /*
-        ** Only report and disable if enabled or the table was previously loaded (EventMon)
+        ** Only manage the table if it has not been compiled yet or if
+        ** Table Services has a load, validation or dump pending
         */
-        if ((HS_AppData.EventMonLoaded == HS_STATE_ENABLED) || (HS_AppData.CurrentEventMonState == HS_STATE_ENABLED))
+        if (!HS_TblManageNeeded(EntryPtr->TblFlag, *EntryPtr->HandlePtr, Compiled))
         {
-            CFE_EVS_SendEvent(HS_EVENTMON_GETADDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Error getting EventMon Table address, RC=0x%08X, Event Monitoring Disabled",
-                              (unsigned int)Status);
+            continue;
+        }
 
-            if (HS_AppData.CurrentEventMonState == HS_STATE_ENABLED)
-            {
-                Status = CFE_SB_Unsubscribe(CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID), HS_AppData.EventPipe);
+        CFE_TBL_Manage(*EntryPtr->HandlePtr);
 
-                if (Status != CFE_SUCCESS)
-                {
-                    CFE_EVS_SendEvent(HS_BADEMT_LONG_UNSUB_EID, CFE_EVS_EventType_ERROR,
-                                      "Error Unsubscribing from long-format Events,RC=0x%08X", (unsigned int)Status);
-                }
+        Status = CFE_TBL_GetAddress(&TblPtr, *EntryPtr->HandlePtr);
 
-                Status = CFE_SB_Unsubscribe(CFE_SB_ValueToMsgId(CFE_EVS_SHORT_EVENT_MSG_MID), HS_AppData.EventPipe);
+        /*
+        ** If there is a new table, compile it into its inactive runtime buffer
+        */
+        if ((Status == CFE_TBL_INFO_UPDATED) || ((Status >= CFE_SUCCESS) && (!Compiled)))
+        {
+            EntryPtr->Compile(HS_RuntimeStage(EntryPtr->TblFlag), TblPtr);
+            UpdatedMask |= EntryPtr->TblFlag;
+        }
 
-                if (Status != CFE_SUCCESS)
-                {
-                    CFE_EVS_SendEvent(HS_BADEMT_SHORT_UNSUB_EID, CFE_EVS_EventType_ERROR,
-                                      "Error Unsubscribing from short-format Events,RC=0x%08X", (unsigned int)Status);
-                }
-            }
+        CFE_TBL_ReleaseAddress(*EntryPtr->HandlePtr);
 
-            HS_AppData.CurrentEventMonState = HS_STATE_DISABLED;
-            HS_AppData.EventMonLoaded       = HS_STATE_DISABLED;
+        /*
+        ** If Address acquisition fails report and disable, otherwise make sure it is enabled
+        */
+        if (Status < CFE_SUCCESS)
+        {
+            if (EntryPtr->AddrError != NULL)
+            {
+                EntryPtr->AddrError(Status);
+            }
+            else if (*EntryPtr->StatePtr == HS_STATE_ENABLED)
+            {
+                /*
+                ** To prevent redundant reporting, only report if enabled
+                */
+                CFE_EVS_SendEvent(EntryPtr->AddrErrEventID, CFE_EVS_EventType_ERROR,
+                                  "Error getting %s Table address, RC=0x%08X", EntryPtr->Name, (unsigned int)Status);
+                *EntryPtr->StatePtr = HS_STATE_DISABLED;
+            }
+        }
+        else
+        {
+            *EntryPtr->StatePtr = HS_STATE_ENABLED;
         }
     }
+
     /*
-    ** Otherwise, mark that the table is loaded (EventMon)
+    ** Activate the newly compiled tables at the cycle boundary
     */
-    else
+    if (UpdatedMask != 0)
     {
-        HS_AppData.EventMonLoaded = HS_STATE_ENABLED;
+        HS_RuntimeSwap();
     }
 
     /*
-    ** Release the table (MsgActs)
-    */
-    CFE_TBL_ReleaseAddress(HS_AppData.MATableHandle);
-
-    /*
-    ** Manage the table (MsgActs)
+    ** Status derived from a table is refreshed whenever a new table is compiled
     */
-    CFE_TBL_Manage(HS_AppData.MATableHandle);
+    for (i = 0; i < HS_NUM_MANAGED_TBLS; i++)
+    {
+        EntryPtr = &HS_TblMgmtTable[i];
 
-    /*
-    ** Get a pointer to the table (MsgActs)
-    */
-    Status = CFE_TBL_GetAddress((void *)&HS_AppData.MATablePtr, HS_AppData.MATableHandle);
+        if (((UpdatedMask & EntryPtr->TblFlag) != 0) && (EntryPtr->Refresh != NULL))
+        {
+            EntryPtr->Refresh();
+        }
+    }
 
     /*
-    ** If there is a new table, refresh status (MsgActs)
+    ** Service any dump of the AppMon state between cycles so it is a consistent snapshot
     */
-    if (Status == CFE_TBL_INFO_UPDATED)
+    if ((HS_AppData.AMSTableHandle != CFE_TBL_BAD_TABLE_HANDLE) &&
+        HS_TblManageNeeded(HS_TBL_NOTIFY_AMS, HS_AppData.AMSTableHandle, true))
     {
-        HS_MsgActsStatusRefresh();
+        CFE_TBL_Manage(HS_AppData.AMSTableHandle);
     }
 
-    /*
-    ** If Address acquisition fails report and disable (MsgActs)
-    */
-    if (Status < CFE_SUCCESS)
+    if (HS_AppData.TblPollCycleCounter == 0)
     {
-        /*
-        ** To prevent redundant reporting, only report if enabled (MsgActs)
-        */
-        if (HS_AppData.MsgActsState == HS_STATE_ENABLED)
-        {
-            CFE_EVS_SendEvent(HS_MSGACTS_GETADDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Error getting MsgActs Table address, RC=0x%08X", (unsigned int)Status);
-            HS_AppData.MsgActsState = HS_STATE_DISABLED;
-        }
+        HS_AppData.TblPollCycleCounter = HS_TBL_NOTIFY_POLL_CYCLES;
     }
+    --HS_AppData.TblPollCycleCounter;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report and disable on an AppMon table address error             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_AppMonAddrError(CFE_Status_t Status)
+{
     /*
-    ** Otherwise, make sure it is enabled (MsgActs)
+    ** Only report and disable if enabled or the table was previously loaded
     */
-    else
+    if ((HS_AppData.AppMonLoaded == HS_STATE_ENABLED) || (HS_AppData.CurrentAppMonState == HS_STATE_ENABLED))
     {
-        HS_AppData.MsgActsState = HS_STATE_ENABLED;
+        CFE_EVS_SendEvent(HS_APPMON_GETADDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error getting AppMon Table address, RC=0x%08X, Application Monitoring Disabled",
+                          (unsigned int)Status);
+        HS_AppData.CurrentAppMonState = HS_STATE_DISABLED;
+        HS_AppData.AppMonLoaded       = HS_STATE_DISABLED;
     }
+}
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report and disable on an EventMon table address error           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_EventMonAddrError(CFE_Status_t Status)
+{
     /*
-    ** Release the table (ExeCount)
+    ** Only report and disable if enabled or the table was previously loaded
     */
-    CFE_TBL_ReleaseAddress(HS_AppData.XCTableHandle);
+    if ((HS_AppData.EventMonLoaded == HS_STATE_ENABLED) || (HS_AppData.CurrentEventMonState == HS_STATE_ENABLED))
+    {
+        CFE_EVS_SendEvent(HS_EVENTMON_GETADDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error getting EventMon Table address, RC=0x%08X, Event Monitoring Disabled",
+                          (unsigned int)Status);
 
-    /*
-    ** Manage the table (ExeCount)
-    */
-    CFE_TBL_Manage(HS_AppData.XCTableHandle);
+        if (HS_AppData.CurrentEventMonState == HS_STATE_ENABLED)
+        {
+            Status = CFE_SB_Unsubscribe(CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID), HS_AppData.EventPipe);
 
-    /*
-    ** Get a pointer to the table (ExeCount)
-    */
-    Status = CFE_TBL_GetAddress((void *)&HS_AppData.XCTablePtr, HS_AppData.XCTableHandle);
+            if (Status != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(HS_BADEMT_LONG_UNSUB_EID, CFE_EVS_EventType_ERROR,
+                                  "Error Unsubscribing from long-format Events,RC=0x%08X", (unsigned int)Status);
+            }
 
-    /*
-    ** If Address acquisition fails report and disable (ExeCount)
-    */
-    if (Status < CFE_SUCCESS)
-    {
-        /*
-        ** To prevent redundant reporting, only report if enabled (ExeCount)
-        */
-        if (HS_AppData.ExeCountState == HS_STATE_ENABLED)
-        {
-            CFE_EVS_SendEvent(HS_EXECOUNT_GETADDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Error getting ExeCount Table address, RC=0x%08X", (unsigned int)Status);
-            HS_AppData.ExeCountState = HS_STATE_DISABLED;
+            Status = CFE_SB_Unsubscribe(CFE_SB_ValueToMsgId(CFE_EVS_SHORT_EVENT_MSG_MID), HS_AppData.EventPipe);
+
+            if (Status != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(HS_BADEMT_SHORT_UNSUB_EID, CFE_EVS_EventType_ERROR,
+                                  "Error Unsubscribing from short-format Events,RC=0x%08X", (unsigned int)Status);
+            }
         }
-    }
-    /*
-    ** Otherwise, make sure it is enabled (ExeCount)
-    */
-    else
-    {
-        HS_AppData.ExeCountState = HS_STATE_ENABLED;
+
+        HS_AppData.CurrentEventMonState = HS_STATE_DISABLED;
+        HS_AppData.EventMonLoaded       = HS_STATE_DISABLED;
     }
 }
 
@@ -657,6 +964,8 @@ void HS_AppMonStatusRefresh(void)
 {
     uint32 TableIndex  = 0;
     uint32 EnableIndex = 0;
+    uint32 AppHash;
+    uint16 Rung;
 
     /*
     ** Clear all AppMon Enable bits
@@ -671,16 +980,33 @@ void HS_AppMonStatusRefresh(void)
     */
     for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++)
     {
-        HS_AppData.AppMonLastExeCount[TableIndex] = 0;
+        HS_AppData.AppMonState[TableIndex].LastExeCount          = 0;
+        HS_AppData.AppMonState[TableIndex].CyclesSinceCheckIn    = 0;
+        HS_AppData.AppMonState[TableIndex].MaxCyclesSinceCheckIn = 0;
+        HS_AppData.AppMonState[TableIndex].CycleCount            = HS_AppData.AMTablePtr[TableIndex].CycleCount;
+
+        /*
+        ** Keep an escalation ladder position only while the entry still monitors the same App
+        ** and the ladder still has that many rungs
+        */
+        AppHash = HS_KeyHash(HS_AppData.AMTablePtr[TableIndex].AppName, 0);
+        Rung    = HS_AppData.CDSLadders.Ladder[TableIndex].Rung;
+        if ((HS_AppData.CDSLadders.Ladder[TableIndex].AppHash != AppHash) || (Rung > HS_MAX_ESCALATION_RUNGS) ||
+            ((Rung != 0) && (HS_AppData.AMTablePtr[TableIndex].Escalation[Rung - 1].ActionType == HS_AMT_ACT_NOACT)))
+        {
+            HS_SetCDSLadder(TableIndex, AppHash, 0);
+        }
+        HS_AppData.AppMonState[TableIndex].EscalationRung   = HS_AppData.CDSLadders.Ladder[TableIndex].Rung;
+        HS_AppData.AppMonState[TableIndex].RecoveryCheckIns = 0;
 
         if ((HS_AppData.AMTablePtr[TableIndex].CycleCount == 0) ||
             (HS_AppData.AMTablePtr[TableIndex].ActionType == HS_AMT_ACT_NOACT))
         {
-            HS_AppData.AppMonCheckInCountdown[TableIndex] = 0;
+            HS_AppData.AppMonState[TableIndex].CheckInCountdown = 0;
         }
         else
         {
-            HS_AppData.AppMonCheckInCountdown[TableIndex] = HS_AppData.AMTablePtr[TableIndex].CycleCount;
+            HS_AppData.AppMonState[TableIndex].CheckInCountdown = HS_AppData.AMTablePtr[TableIndex].CycleCount;
             HS_AppData.AppMonEnables[TableIndex / HS_BITS_PER_APPMON_ENABLE] |=
                 (1 << (TableIndex % HS_BITS_PER_APPMON_ENABLE));
         }
@@ -701,6 +1027,60 @@ void HS_MsgActsStatusRefresh(void)
     */
     for (TableIndex = 0; TableIndex < HS_MAX_MSG_ACT_TYPES; TableIndex++)
     {
-        HS_AppData.MsgActCooldown[TableIndex] = 0;
+        HS_AppData.MsgActReadyTime[TableIndex].Seconds    = 0;
+        HS_AppData.MsgActReadyTime[TableIndex].Subseconds = 0;
+    }
+
+    /*
+    ** Queued actions are table indices into the old table
+    */
+    HS_MsgActQueueFlush();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Refresh MemMon Status (on Table Update)                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MemMonStatusRefresh(void)
+{
+    /*
+    ** Entries may now watch different memory, so nothing carries over
+    ** and nothing is reported until the entry is next sampled
+    */
+    memset(HS_AppData.MemMon, 0xFF, sizeof(HS_AppData.MemMon));
+    memset(HS_AppData.MemMonFlags, 0, sizeof(HS_AppData.MemMonFlags));
+
+    /*
+    ** Sample the new table on this cycle
+    */
+    HS_AppData.MemMonCycleCounter = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Refresh MsgMon Status (on Table Update)                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgMonStatusRefresh(void)
+{
+    CFE_TIME_SysTime_t Now;
+    uint32             TableIndex;
+
+    /*
+    ** Entries may now watch different messages, so nothing carries over
+    */
+    memset(HS_AppData.MsgMon, 0, sizeof(HS_AppData.MsgMon));
+    memset(HS_AppData.MsgMonFlags, 0, sizeof(HS_AppData.MsgMonFlags));
+
+    /*
+    ** Every message gets its full maximum age to arrive from now
+    */
+    Now = CFE_TIME_GetMET();
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_MSGS; TableIndex++)
+    {
+        HS_AppData.MsgMonLastArrival[TableIndex] = Now;
     }
+
+    HS_MsgMonSubscribe();
 }
@@ -30,6 +30,50 @@
  ************************************************************************/
 #include "cfe_error.h"
 #include "hs_msg.h"
+#include "hs_runtime.h"
+
+/*************************************************************************
+ * Constants
+ ************************************************************************/
+
+/**
+ * \brief Number of tables managed by #HS_AcquirePointers
+ */
+#define HS_NUM_MANAGED_TBLS 6
+
+/*************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ * \brief Table compile function, called with the inactive runtime buffer and the table data
+ */
+typedef void (*HS_TblCompile_t)(HS_RuntimeBuf_t *BufPtr, const void *TblPtr);
+
+/**
+ * \brief Table management table entry
+ */
+typedef struct
+{
+    uint8             TblFlag;        /**< \brief HS Table Notification Flag of the table */
+    CFE_TBL_Handle_t *HandlePtr;      /**< \brief Handle of the table */
+    size_t            CompiledOffset; /**< \brief Offset of the table's compiled flag in #HS_RuntimeBuf_t */
+    HS_TblCompile_t   Compile;        /**< \brief Compiles the table into a runtime buffer */
+    void (*Refresh)(void);            /**< \brief Refreshes status for a new table, NULL if none */
+    uint8 *StatePtr;                  /**< \brief State enabled while the table address can be acquired */
+    void (*AddrError)(CFE_Status_t Status); /**< \brief Handles an address error, NULL to disable StatePtr */
+    uint16      AddrErrEventID;             /**< \brief Event ID of the default address error event */
+    const char *Name;                       /**< \brief Table name used in the default address error event */
+} HS_TblMgmtEntry_t;
+
+/*************************************************************************
+ * Exported Data
+ ************************************************************************/
+
+/**
+ * \brief Table management table, in the order the tables are managed
+ */
+extern const HS_TblMgmtEntry_t HS_TblMgmtTable[HS_NUM_MANAGED_TBLS];
 
 /*************************************************************************
  * Exported Functions
@@ -52,13 +96,17 @@ void HS_ResetCounters(void);
  * \brief Manages HS tables
  *
  *  \par Description
- *       Manages load requests for the AppMon, EventMon, ExeCount and MsgActs
- *       tables and update notification for the AppMon and MsgActs tables.
- *       Also releases and acquires table addresses. Gets called at the start
- *       of each processing cycle and on initialization.
+ *       Manages load requests for the tables in #HS_TblMgmtTable and
+ *       refreshes the status derived from each new table.
+ *       Gets called at the start of each processing cycle and on
+ *       initialization.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       A table is only managed when Table Services reports or notifies
+ *       a pending action for it or it has never been compiled. Updated tables are
+ *       compiled into the inactive runtime buffer and the table address
+ *       is released right away; the buffers are swapped before returning
+ *       and the status of every table compiled this call is refreshed.
  *
  *  \sa #CFE_TBL_Manage
  */
@@ -260,6 +308,137 @@ CFE_Status_t HS_ResetResetsPerformedCmd(const HS_ResetResetsPerformedCmd_t *BufP
  */
 CFE_Status_t HS_SetMaxResetsCmd(const HS_SetMaxResetsCmd_t *BufPtr);
 
+/**
+ * \brief Process a manage tables command
+ *
+ *  \par Description
+ *       Marks the tables identified in the command parameter as needing
+ *       to be managed at the start of the next cycle. Sent by Table
+ *       Services when a table has a load, validation or dump pending.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The command counter is not incremented since this is an
+ *       internal message.
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_MANAGE_TABLES_CC
+ */
+CFE_Status_t HS_ManageTablesCmd(const HS_ManageTablesCmd_t *BufPtr);
+
+/**
+ * \brief Process a send action history command
+ *
+ *  \par Description
+ *       Sends the action history telemetry packet, oldest entry first.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_SEND_HISTORY_CC
+ */
+CFE_Status_t HS_SendHistoryCmd(const HS_SendHistoryCmd_t *BufPtr);
+
+/**
+ * \brief Process a reset phase timing command
+ *
+ *  \par Description
+ *       Clears the phase, cycle and wakeup timing statistics.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_RESET_TIMING_CC
+ */
+CFE_Status_t HS_ResetTimingCmd(const HS_ResetTimingCmd_t *BufPtr);
+
+/**
+ * \brief Process a register memory pool command
+ *
+ *  \par Description
+ *       Registers a memory pool handle under the name of the application
+ *       that owns it and the index it chose, then resolves the Memory
+ *       Monitor entries that name the pool again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Registrations are kept in RAM, so they last until HS restarts
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_REGISTER_POOL_CC
+ */
+CFE_Status_t HS_RegisterPoolCmd(const HS_RegisterPoolCmd_t *BufPtr);
+
+/**
+ * \brief Process a register task stack command
+ *
+ *  \par Description
+ *       Looks up the symbol of the buffer a task was created on and
+ *       registers it as the stack of the task with the stack monitor.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Registrations are kept in RAM, so they last until HS restarts
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_REGISTER_STACK_CC
+ */
+CFE_Status_t HS_RegisterStackCmd(const HS_RegisterStackCmd_t *BufPtr);
+
+/**
+ * \brief Check if a table needs to be managed
+ *
+ *  \par Description
+ *       A table needs to be managed if it has never been compiled, or
+ *       if Table Services has a load, validation or dump pending for it.
+ *       Tables registered for notifications are managed when a
+ *       #HS_MANAGE_TABLES_CC command has been received for them and only
+ *       have their status checked with #CFE_TBL_GetStatus every
+ *       #HS_TBL_NOTIFY_POLL_CYCLES cycles; all others are checked every cycle.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Clears the pending notification for the table.
+ *
+ *  \param [in] TblFlag    HS Table Notification Flag for the table
+ *  \param [in] TblHandle  Handle of the table
+ *  \param [in] Compiled   If the table has been compiled into the active runtime buffer
+ *
+ *  \return true if the table needs to be managed this cycle
+ */
+bool HS_TblManageNeeded(uint8 TblFlag, CFE_TBL_Handle_t TblHandle, bool Compiled);
+
+/**
+ * \brief Handle an AppMon table address error
+ *
+ *  \par Description
+ *       Reports the error and disables Application Monitoring if it
+ *       was enabled or the table was previously loaded.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Status  Status returned by #CFE_TBL_GetAddress
+ */
+void HS_AppMonAddrError(CFE_Status_t Status);
+
+/**
+ * \brief Handle an EventMon table address error
+ *
+ *  \par Description
+ *       Reports the error and disables Event Monitoring, unsubscribing
+ *       from events, if it was enabled or the table was previously loaded.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Status  Status returned by #CFE_TBL_GetAddress
+ */
+void HS_EventMonAddrError(CFE_Status_t Status);
+
 /**
  * \brief Refresh Critical Applications Monitor Status
  *
@@ -287,4 +466,32 @@ void HS_AppMonStatusRefresh(void);
  */
 void HS_MsgActsStatusRefresh(void);
 
+/**
+ * \brief Refresh Memory Monitor Status
+ *
+ *  \par Description
+ *       This function gets called when HS detects that a new
+ *       memory monitor table has been loaded: it then clears the
+ *       reported status and low-water marks of all entries and
+ *       rearms their actions.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_MemMonStatusRefresh(void);
+
+/**
+ * \brief Refresh Message Monitor Status
+ *
+ *  \par Description
+ *       This function gets called when HS detects that a new
+ *       message freshness table has been loaded: it then clears the
+ *       arrival counts of all entries, restarts their ages, rearms
+ *       their actions and subscribes to the new table's messages.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_MsgMonStatusRefresh(void);
+
 #endif
@@ -33,6 +33,49 @@
 #include "hs_dispatch.h"
 #include "hs_version.h"
 
+#include <string.h>
+
+/************************************************************************
+** Command Dispatch Table
+*************************************************************************/
+
+/**
+ * \brief Dispatch table entry of a command message type and its handler
+ */
+#define HS_CMD_DISPATCH_ENTRY(CmdType, Handler, Priority) {sizeof(CmdType), (HS_CmdHandler_t)(Handler), (Priority)}
+
+/*
+** Commands that stop a runaway monitor are priority commands, so they are
+** not held up behind a busy event pipe. They still run after the commands
+** read before them, so ground commands keep their order
+*/
+
+/* clang-format off */
+const HS_CmdDispatchEntry_t HS_CmdDispatchTable[HS_NUM_CMD_CODES] =
+{
+    [HS_NOOP_CC]                   = HS_CMD_DISPATCH_ENTRY(HS_NoopCmd_t, HS_NoopCmd, false),
+    [HS_RESET_CC]                  = HS_CMD_DISPATCH_ENTRY(HS_ResetCmd_t, HS_ResetCmd, false),
+    [HS_ENABLE_APP_MON_CC]         = HS_CMD_DISPATCH_ENTRY(HS_EnableAppMonCmd_t, HS_EnableAppMonCmd, false),
+    [HS_DISABLE_APP_MON_CC]        = HS_CMD_DISPATCH_ENTRY(HS_DisableAppMonCmd_t, HS_DisableAppMonCmd, true),
+    [HS_ENABLE_EVENT_MON_CC]       = HS_CMD_DISPATCH_ENTRY(HS_EnableEventMonCmd_t, HS_EnableEventMonCmd, false),
+    [HS_DISABLE_EVENT_MON_CC]      = HS_CMD_DISPATCH_ENTRY(HS_DisableEventMonCmd_t, HS_DisableEventMonCmd, true),
+    [HS_ENABLE_ALIVENESS_CC]       = HS_CMD_DISPATCH_ENTRY(HS_EnableAlivenessCmd_t, HS_EnableAlivenessCmd, false),
+    [HS_DISABLE_ALIVENESS_CC]      = HS_CMD_DISPATCH_ENTRY(HS_DisableAlivenessCmd_t, HS_DisableAlivenessCmd, false),
+    [HS_RESET_RESETS_PERFORMED_CC] = HS_CMD_DISPATCH_ENTRY(HS_ResetResetsPerformedCmd_t, HS_ResetResetsPerformedCmd,
+                                                           false),
+    [HS_SET_MAX_RESETS_CC]         = HS_CMD_DISPATCH_ENTRY(HS_SetMaxResetsCmd_t, HS_SetMaxResetsCmd, false),
+    [HS_ENABLE_CPU_HOG_CC]         = HS_CMD_DISPATCH_ENTRY(HS_EnableCpuHogCmd_t, HS_EnableCpuHogCmd, false),
+    [HS_DISABLE_CPU_HOG_CC]        = HS_CMD_DISPATCH_ENTRY(HS_DisableCpuHogCmd_t, HS_DisableCpuHogCmd, true),
+    [HS_MANAGE_TABLES_CC]          = HS_CMD_DISPATCH_ENTRY(HS_ManageTablesCmd_t, HS_ManageTablesCmd, false),
+    [HS_SEND_HISTORY_CC]           = HS_CMD_DISPATCH_ENTRY(HS_SendHistoryCmd_t, HS_SendHistoryCmd, false),
+    [HS_RESET_TIMING_CC]           = HS_CMD_DISPATCH_ENTRY(HS_ResetTimingCmd_t, HS_ResetTimingCmd, false),
+    [HS_REGISTER_POOL_CC]          = HS_CMD_DISPATCH_ENTRY(HS_RegisterPoolCmd_t, HS_RegisterPoolCmd, false),
+    [HS_REGISTER_STACK_CC]         = HS_CMD_DISPATCH_ENTRY(HS_RegisterStackCmd_t, HS_RegisterStackCmd, false),
+};
+
+const HS_CmdDispatchEntry_t HS_SendHkDispatchEntry = HS_CMD_DISPATCH_ENTRY(HS_SendHkCmd_t, HS_SendHkCmd, true);
+/* clang-format on */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Verify message packet length                                    */
@@ -102,7 +145,7 @@ void HS_AppPipe(const CFE_SB_Buffer_t *BufPtr)
         ** Housekeeping telemetry request
         */
         case HS_SEND_HK_MID:
-            HS_SendHkVerifyDispatch(BufPtr);
+            HS_DispatchCmd(BufPtr, &HS_SendHkDispatchEntry, NULL);
             break;
 
         /*
@@ -112,65 +155,18 @@ void HS_AppPipe(const CFE_SB_Buffer_t *BufPtr)
 
             CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
 
-            switch (CommandCode)
+            if ((CommandCode < HS_NUM_CMD_CODES) && (HS_CmdDispatchTable[CommandCode].Handler != NULL))
             {
-                case HS_NOOP_CC:
-                    HS_NoopVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_RESET_CC:
-                    HS_ResetVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_ENABLE_APP_MON_CC:
-                    HS_EnableAppMonVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_DISABLE_APP_MON_CC:
-                    HS_DisableAppMonVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_ENABLE_EVENT_MON_CC:
-                    HS_EnableEventMonVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_DISABLE_EVENT_MON_CC:
-                    HS_DisableEventMonVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_ENABLE_ALIVENESS_CC:
-                    HS_EnableAlivenessVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_DISABLE_ALIVENESS_CC:
-                    HS_DisableAlivenessVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_RESET_RESETS_PERFORMED_CC:
-                    HS_ResetResetsPerformedVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_SET_MAX_RESETS_CC:
-                    HS_SetMaxResetsVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_ENABLE_CPU_HOG_CC:
-                    HS_EnableCpuHogVerifyDispatch(BufPtr);
-                    break;
-
-                case HS_DISABLE_CPU_HOG_CC:
-                    HS_DisableCpuHogVerifyDispatch(BufPtr);
-                    break;
-
-                default:
-                    CFE_EVS_SendEvent(HS_CC_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Invalid command code: ID = 0x%08lX, CC = %d",
-                                      (unsigned long)CFE_SB_MsgIdToValue(MessageID), CommandCode);
-
-                    HS_AppData.CmdErrCount++;
-                    break;
+                HS_DispatchCmd(BufPtr, &HS_CmdDispatchTable[CommandCode],
+                               &HS_AppData.CmdStatsPkt.Payload.Codes[CommandCode]);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(HS_CC_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid command code: ID = 0x%08lX, CC = %d",
+                                  (unsigned long)CFE_SB_MsgIdToValue(MessageID), CommandCode);
 
-            } /* end CommandCode switch */
+                HS_AppData.CmdErrCount++;
+            }
             break;
 
         /*
@@ -187,234 +183,244 @@ void HS_AppPipe(const CFE_SB_Buffer_t *BufPtr)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Housekeeping request                                            */
+/* Verify and dispatch a message                                   */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_SendHkVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+void HS_DispatchCmd(const CFE_SB_Buffer_t *BufPtr, const HS_CmdDispatchEntry_t *EntryPtr,
+                    HS_CmdCodeStats_t *StatsPtr)
 {
-    size_t ExpectedLength = sizeof(HS_SendHkCmd_t);
+    OS_time_t Start;
+    OS_time_t Stop;
+    uint32    Usec;
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    if (!HS_VerifyMsgLength(&BufPtr->Msg, EntryPtr->ExpectedLength))
     {
-        HS_SendHkCmd((const HS_SendHkCmd_t *)BufPtr);
+        if (StatsPtr != NULL)
+        {
+            StatsPtr->RejectCount++;
+        }
     }
-}
-
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* Noop command                                                    */
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_NoopVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    size_t ExpectedLength = sizeof(HS_NoopCmd_t);
-
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    else if (StatsPtr == NULL)
     {
-        HS_NoopCmd((const HS_NoopCmd_t *)BufPtr);
+        EntryPtr->Handler(BufPtr);
     }
-}
+    else
+    {
+        StatsPtr->AcceptCount++;
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* Reset counters command                                          */
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_ResetVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    size_t ExpectedLength = sizeof(HS_ResetCmd_t);
+        OS_GetLocalTime(&Start);
+        EntryPtr->Handler(BufPtr);
+        OS_GetLocalTime(&Stop);
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
-    {
-        HS_ResetCmd((const HS_ResetCmd_t *)BufPtr);
-    }
-}
+        Usec = HS_TimingElapsedUsec(Start, Stop);
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* Enable applications monitor command                             */
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_EnableAppMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    size_t ExpectedLength = sizeof(HS_EnableAppMonCmd_t);
+        if (Usec > StatsPtr->MaxUsec)
+        {
+            StatsPtr->MaxUsec = Usec;
+        }
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
-    {
-        HS_EnableAppMonCmd((const HS_EnableAppMonCmd_t *)BufPtr);
+        HS_AppData.CmdStatsPkt.Payload.HandlerHist[HS_CmdHistBin(Usec)]++;
     }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Disable applications monitor command                            */
+/* Read the command pipe                                           */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_DisableAppMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+CFE_Status_t HS_CmdPipeRead(void)
 {
-    size_t ExpectedLength = sizeof(HS_DisableAppMonCmd_t);
+    HS_CmdLane_t *   LanePtr   = &HS_AppData.CmdLane;
+    CFE_Status_t     Status    = CFE_SUCCESS;
+    CFE_SB_Buffer_t *BufPtr    = NULL;
+    uint32           ReadCount = 0;
+    size_t           Size      = 0;
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    LanePtr->ReadSince = LanePtr->EmptyTime;
+
+    while ((Status == CFE_SUCCESS) && (ReadCount < HS_CMD_PIPE_BUDGET))
     {
-        HS_DisableAppMonCmd((const HS_DisableAppMonCmd_t *)BufPtr);
-    }
-}
+        if (LanePtr->HeldBufPtr != NULL)
+        {
+            BufPtr              = LanePtr->HeldBufPtr;
+            LanePtr->HeldBufPtr = NULL;
+        }
+        else
+        {
+            Status = CFE_SB_ReceiveBuffer(&BufPtr, HS_AppData.CmdPipe, CFE_SB_POLL);
+        }
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* Enable events monitor command                                   */
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_EnableEventMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    size_t ExpectedLength = sizeof(HS_EnableEventMonCmd_t);
+        if ((Status == CFE_SUCCESS) && (BufPtr != NULL))
+        {
+            /*
+            ** A priority command read behind a waiting one waits with it, so a
+            ** DISABLE can't overtake an ENABLE and the normal lane still runs
+            ** after the event pipe
+            */
+            if (HS_IsPriorityCmd(BufPtr) && (LanePtr->Count == 0))
+            {
+                HS_CmdLaneDispatch(BufPtr, HS_CMD_LANE_PRIORITY);
+            }
+            else
+            {
+                /*
+                ** A message too big for a slot keeps its header size, so it
+                ** still fails the length check when it is dispatched
+                */
+                CFE_MSG_GetSize(&BufPtr->Msg, &Size);
+
+                if (Size > sizeof(LanePtr->Slots[0]))
+                {
+                    Size = sizeof(LanePtr->Slots[0]);
+                }
+
+                memcpy(&LanePtr->Slots[LanePtr->Count], BufPtr, Size);
+                LanePtr->Count++;
+            }
+        }
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
-    {
-        HS_EnableEventMonCmd((const HS_EnableEventMonCmd_t *)BufPtr);
+        ReadCount++;
     }
-}
-
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* Disable event monitor command                                   */
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_DisableEventMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    size_t ExpectedLength = sizeof(HS_DisableEventMonCmd_t);
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    if (Status == CFE_SUCCESS)
     {
-        HS_DisableEventMonCmd((const HS_DisableEventMonCmd_t *)BufPtr);
-    }
-}
+        /*
+        ** The budget only held messages back if there is another one waiting
+        */
+        Status = CFE_SB_ReceiveBuffer(&BufPtr, HS_AppData.CmdPipe, CFE_SB_POLL);
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* Enable aliveness indicator command                              */
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_EnableAlivenessVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    size_t ExpectedLength = sizeof(HS_EnableAlivenessCmd_t);
+        if ((Status == CFE_SUCCESS) && (BufPtr != NULL))
+        {
+            LanePtr->HeldBufPtr = BufPtr;
+            HS_AppData.CmdStatsPkt.Payload.CmdBudgetCount++;
+        }
+    }
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    if (Status == CFE_SB_NO_MESSAGE)
     {
-        HS_EnableAlivenessCmd((const HS_EnableAlivenessCmd_t *)BufPtr);
+        /*
+        ** It's Good to not get a message -- we are polling
+        */
+        OS_GetLocalTime(&LanePtr->EmptyTime);
+        Status = CFE_SUCCESS;
     }
+
+    return Status;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Disable aliveness indicator command                             */
+/* Process the commands waiting in the normal lane                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_DisableAlivenessVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+void HS_CmdLaneDrain(void)
 {
-    size_t ExpectedLength = sizeof(HS_DisableAlivenessCmd_t);
+    uint32 Slot;
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    for (Slot = 0; Slot < HS_AppData.CmdLane.Count; Slot++)
     {
-        HS_DisableAlivenessCmd((const HS_DisableAlivenessCmd_t *)BufPtr);
+        HS_CmdLaneDispatch(&HS_AppData.CmdLane.Slots[Slot].Buf, HS_CMD_LANE_NORMAL);
     }
+
+    HS_AppData.CmdLane.Count = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Enable cpu hogging indicator command                            */
+/* Process a message in a command lane                             */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_EnableCpuHogVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+void HS_CmdLaneDispatch(const CFE_SB_Buffer_t *BufPtr, uint32 Lane)
 {
-    size_t ExpectedLength = sizeof(HS_EnableCpuHogCmd_t);
+    HS_CmdLaneStats_t *StatsPtr = &HS_AppData.CmdStatsPkt.Payload.Lanes[Lane];
+    OS_time_t          Now;
+    uint32             Usec;
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    OS_GetLocalTime(&Now);
+
+    Usec = HS_TimingElapsedUsec(HS_AppData.CmdLane.ReadSince, Now);
+
+    if (Usec > StatsPtr->LatencyMaxUsec)
     {
-        HS_EnableCpuHogCmd((const HS_EnableCpuHogCmd_t *)BufPtr);
+        StatsPtr->LatencyMaxUsec = Usec;
     }
+
+    StatsPtr->Count++;
+    HS_AppData.CmdLane.LatencyTotalUsec[Lane] += Usec;
+
+    HS_AppPipe(BufPtr);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Disable cpu hogging indicator command                           */
+/* Check if a command pipe message goes in the priority lane       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_DisableCpuHogVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+bool HS_IsPriorityCmd(const CFE_SB_Buffer_t *BufPtr)
 {
-    size_t ExpectedLength = sizeof(HS_DisableCpuHogCmd_t);
+    bool              Priority    = false;
+    CFE_MSG_FcnCode_t CommandCode = 0;
+    CFE_SB_MsgId_t    MessageID   = CFE_SB_INVALID_MSG_ID;
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+
+    if (CFE_SB_MsgIdToValue(MessageID) == HS_SEND_HK_MID)
     {
-        HS_DisableCpuHogCmd((const HS_DisableCpuHogCmd_t *)BufPtr);
+        Priority = HS_SendHkDispatchEntry.Priority;
     }
+    else if (CFE_SB_MsgIdToValue(MessageID) == HS_CMD_MID)
+    {
+        CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
+
+        if (CommandCode < HS_NUM_CMD_CODES)
+        {
+            Priority = HS_CmdDispatchTable[CommandCode].Priority;
+        }
+    }
+
+    return Priority;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Reset processor resets performed count command                  */
+/* Compute the average queueing latency of each command lane       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_ResetResetsPerformedVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+void HS_CmdLaneReport(void)
 {
-    size_t ExpectedLength = sizeof(HS_ResetResetsPerformedCmd_t);
+    HS_CmdLaneStats_t *StatsPtr;
+    uint32             Lane;
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    for (Lane = 0; Lane < HS_NUM_CMD_LANES; Lane++)
     {
-        HS_ResetResetsPerformedCmd((const HS_ResetResetsPerformedCmd_t *)BufPtr);
+        StatsPtr = &HS_AppData.CmdStatsPkt.Payload.Lanes[Lane];
+
+        if (StatsPtr->Count == 0)
+        {
+            StatsPtr->LatencyAvgUsec = 0;
+        }
+        else
+        {
+            StatsPtr->LatencyAvgUsec = (uint32)(HS_AppData.CmdLane.LatencyTotalUsec[Lane] / StatsPtr->Count);
+        }
     }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Set max processor resets command                                */
+/* Find the handler time histogram bin of a run time               */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_SetMaxResetsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+uint32 HS_CmdHistBin(uint32 Usec)
 {
-    size_t ExpectedLength = sizeof(HS_SetMaxResetsCmd_t);
+    uint32 Bin   = 0;
+    uint32 Limit = HS_CMD_HIST_BASE_USEC;
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    while ((Bin < (HS_CMD_HIST_BINS - 1)) && (Usec >= Limit))
     {
-        HS_SetMaxResetsCmd((const HS_SetMaxResetsCmd_t *)BufPtr);
+        Bin++;
+        Limit *= 4;
     }
+
+    return Bin;
 }
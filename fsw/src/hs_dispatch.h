@@ -29,6 +29,69 @@
  * Includes
  ************************************************************************/
 #include "cfe.h"
+#include "hs_msg.h"
+#include "hs_platform_cfg.h"
+
+/*************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ * \brief Command handler, called with the verified command message
+ */
+typedef CFE_Status_t (*HS_CmdHandler_t)(const void *BufPtr);
+
+/**
+ * \brief Command dispatch table entry
+ */
+typedef struct
+{
+    size_t          ExpectedLength; /**< \brief Required length of the command message */
+    HS_CmdHandler_t Handler;        /**< \brief Handler of the command, NULL for unused codes */
+    bool            Priority;       /**< \brief Processed ahead of the event pipe unless read behind others */
+} HS_CmdDispatchEntry_t;
+
+/**
+ * \brief Normal lane message slot, large enough for any HS command
+ */
+typedef union
+{
+    CFE_SB_Buffer_t       Buf;             /**< \brief Message as a software bus buffer */
+    HS_SetMaxResetsCmd_t  SetMaxResetsCmd; /**< \brief Largest commands with a payload */
+    HS_ManageTablesCmd_t  ManageTablesCmd;
+    HS_RegisterPoolCmd_t  RegisterPoolCmd;
+    HS_RegisterStackCmd_t RegisterStackCmd;
+} HS_CmdLaneSlot_t;
+
+/**
+ * \brief Command lane state
+ */
+typedef struct
+{
+    HS_CmdLaneSlot_t Slots[HS_CMD_PIPE_BUDGET]; /**< \brief Commands waiting in the normal lane */
+    uint16           Count;                     /**< \brief Number of commands waiting in the normal lane */
+
+    CFE_SB_Buffer_t *HeldBufPtr; /**< \brief Message read past the budget, processed first by the next read */
+
+    OS_time_t EmptyTime; /**< \brief When the command pipe was last found empty */
+    OS_time_t ReadSince; /**< \brief Value of EmptyTime when the current read started */
+
+    uint64 LatencyTotalUsec[HS_NUM_CMD_LANES]; /**< \brief Sum of the queueing latency of each lane */
+} HS_CmdLane_t;
+
+/*************************************************************************
+ * Exported Data
+ ************************************************************************/
+
+/**
+ * \brief Command dispatch table, indexed by command code
+ */
+extern const HS_CmdDispatchEntry_t HS_CmdDispatchTable[HS_NUM_CMD_CODES];
+
+/**
+ * \brief Dispatch entry of the housekeeping request
+ */
+extern const HS_CmdDispatchEntry_t HS_SendHkDispatchEntry;
 
 /*************************************************************************
  * Exported Functions
@@ -39,8 +102,8 @@
  *
  *  \par Description
  *       Processes a single software bus command pipe message. Checks
- *       the message and command IDs and calls the appropriate routine
- *       to handle the message.
+ *       the message ID and looks up the command code in
+ *       #HS_CmdDispatchTable to find the expected length and handler.
  *
  *  \par Assumptions, External Events, and Notes:
  *       None
@@ -72,118 +135,99 @@ void HS_AppPipe(const CFE_SB_Buffer_t *BufPtr);
 bool HS_VerifyMsgLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength);
 
 /**
- * \brief Housekeeping dispatcher
+ * \brief Verify and dispatch a message
  *
- * Verifies and processes the received command
- */
-void HS_SendHkVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
-
-/**
- * \brief Noop command dispatcher
- *
- * Verifies and processes the received command
- *
- *  \sa #HS_NOOP_CC
- */
-void HS_NoopVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
-
-/**
- * \brief Reset counters dispatcher
+ *  \par Description
+ *       Calls the entry's handler if the message length matches the
+ *       entry. When statistics are given, the message is counted as
+ *       accepted or rejected and the handler run time is recorded.
  *
- * Verifies and processes the received command
+ *  \par Assumptions, External Events, and Notes:
+ *       None
  *
- *  \sa #HS_RESET_CC
+ *  \param[in] BufPtr   Pointer to Software Bus buffer
+ *  \param[in] EntryPtr Dispatch table entry of the message
+ *  \param[in] StatsPtr Statistics of the command code, or NULL
  */
-void HS_ResetVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+void HS_DispatchCmd(const CFE_SB_Buffer_t *BufPtr, const HS_CmdDispatchEntry_t *EntryPtr,
+                    HS_CmdCodeStats_t *StatsPtr);
 
 /**
- * \brief Enable application monitor dispatcher
- *
- * Verifies and processes the received command
+ * \brief Read the command pipe
  *
- *  \sa #HS_ENABLE_APP_MON_CC
- */
-void HS_EnableAppMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
-
-/**
- * \brief Disable application monitor dispatcher
+ *  \par Description
+ *       Reads up to #HS_CMD_PIPE_BUDGET messages from the command pipe.
+ *       Housekeeping requests and priority commands are processed as
+ *       they are read while the normal lane is empty; other messages, and
+ *       priority ones read behind them, are copied to the normal lane to
+ *       be processed in order by #HS_CmdLaneDrain. When the budget is used up one more message is
+ *       read to find out if any were left waiting, and it is held to be
+ *       processed first by the next read.
  *
- * Verifies and processes the received command
+ *  \par Assumptions, External Events, and Notes:
+ *       The normal lane is empty when this is called. A held message
+ *       stays valid because the command pipe is only read here.
  *
- *  \sa #HS_DISABLE_APP_MON_CC
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
  */
-void HS_DisableAppMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+CFE_Status_t HS_CmdPipeRead(void);
 
 /**
- * \brief Enable critical events monitor dispatcher
- *
- * Verifies and processes the received command
+ * \brief Process the commands waiting in the normal lane
  *
- *  \sa #HS_ENABLE_EVENT_MON_CC
+ *  \par Assumptions, External Events, and Notes:
+ *       None
  */
-void HS_EnableEventMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+void HS_CmdLaneDrain(void);
 
 /**
- * \brief Disable critical events monitor dispatcher
- *
- * Verifies and processes the received command
+ * \brief Process a message in a command lane
  *
- *  \sa #HS_DISABLE_EVENT_MON_CC
- */
-void HS_DisableEventMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
-
-/**
- * \brief Enable aliveness indicator dispatcher
+ *  \par Description
+ *       Records the queueing latency of the message in the lane
+ *       statistics, then passes it to #HS_AppPipe.
  *
- * Verifies and processes the received command
+ *  \par Assumptions, External Events, and Notes:
+ *       None
  *
- *  \sa #HS_ENABLE_ALIVENESS_CC
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *  \param[in] Lane   Command lane, one of the HS_CMD_LANE_* values
  */
-void HS_EnableAlivenessVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+void HS_CmdLaneDispatch(const CFE_SB_Buffer_t *BufPtr, uint32 Lane);
 
 /**
- * \brief Disable aliveness indicator dispatcher
- *
- * Verifies and processes the received command
+ * \brief Check if a command pipe message goes in the priority lane
  *
- *  \sa #HS_DISABLE_ALIVENESS_CC
- */
-void HS_DisableAlivenessVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
-
-/**
- * \brief Enable CPU Hogging indicator dispatcher
+ *  \par Assumptions, External Events, and Notes:
+ *       None
  *
- * Verifies and processes the received command
+ *  \param[in] BufPtr Pointer to Software Bus buffer
  *
- *  \sa #HS_ENABLE_CPU_HOG_CC
+ *  \return Boolean priority response
+ *  \retval true  Housekeeping request or priority command
+ *  \retval false Any other message
  */
-void HS_EnableCpuHogVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool HS_IsPriorityCmd(const CFE_SB_Buffer_t *BufPtr);
 
 /**
- * \brief Disable CPU Hogging indicator dispatcher
- *
- * Verifies and processes the received command
+ * \brief Compute the average queueing latency of each command lane
  *
- *  \sa #HS_DISABLE_CPU_HOG_CC
+ *  \par Assumptions, External Events, and Notes:
+ *       None
  */
-void HS_DisableCpuHogVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+void HS_CmdLaneReport(void);
 
 /**
- * \brief Reset resets performed dispatcher
+ * \brief Find the handler time histogram bin of a run time
  *
- * Verifies and processes the received command
- *
- *  \sa #HS_SET_MAX_RESETS_CC
- */
-void HS_ResetResetsPerformedVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
-
-/**
- * \brief Set max resets dispatcher
+ *  \par Assumptions, External Events, and Notes:
+ *       None
  *
- * Verifies and processes the received command
+ *  \param[in] Usec Handler run time in microseconds
  *
- *  \sa #HS_RESET_RESETS_PERFORMED_CC
+ *  \return Index into #HS_CmdStatsTlm_Payload_t.HandlerHist
  */
-void HS_SetMaxResetsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+uint32 HS_CmdHistBin(uint32 Usec);
 
 #endif
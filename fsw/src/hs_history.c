@@ -0,0 +1,205 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to keep the CFS Health and Safety (HS) action history
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "hs_app.h"
+#include "hs_history.h"
+#include "hs_eventids.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize the action history                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_HistoryInit(void)
+{
+    HS_History_t *     HistoryPtr = &HS_AppData.History;
+    HS_HistoryHeader_t Header;
+    uint32             SlotIndex;
+    uint32             NewestSequence = 0;
+    uint32             CorruptCount   = 0;
+    bool               StoreBlock     = true;
+    CFE_Status_t       Status;
+
+    memset(HistoryPtr, 0, sizeof(*HistoryPtr));
+
+    memset(&Header, 0, sizeof(Header));
+    Header.Depth    = HS_HISTORY_DEPTH;
+    Header.SlotSize = sizeof(HS_HistorySlot_t);
+    Header.Crc      = CFE_ES_CalculateCRC(&Header, offsetof(HS_HistoryHeader_t, Crc), 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+    HistoryPtr->CDSState = HS_AppData.CDSState;
+
+    if (HistoryPtr->CDSState == HS_STATE_ENABLED)
+    {
+        Status = CFE_ES_RegisterCDS(&HistoryPtr->CDSHandle, sizeof(HS_HistoryBlock_t), HS_HISTORY_CDSNAME);
+
+        if (Status == CFE_ES_CDS_ALREADY_EXISTS)
+        {
+            Status = CFE_ES_RestoreFromCDS(&HistoryPtr->Block, HistoryPtr->CDSHandle);
+
+            if ((Status != CFE_SUCCESS) || (memcmp(&HistoryPtr->Block.Header, &Header, sizeof(Header)) != 0))
+            {
+                /*
+                ** Without a good header none of the slots can be trusted
+                */
+                memset(&HistoryPtr->Block, 0, sizeof(HistoryPtr->Block));
+                CorruptCount = HS_HISTORY_DEPTH;
+            }
+            else
+            {
+                StoreBlock = false;
+            }
+
+            Status = CFE_SUCCESS;
+        }
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(HS_HISTORY_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Failed to create action history CDS block (Err=0x%08x), history not saved",
+                              (unsigned int)Status);
+
+            HistoryPtr->CDSState = HS_STATE_DISABLED;
+        }
+    }
+
+    for (SlotIndex = 0; SlotIndex < HS_HISTORY_DEPTH; SlotIndex++)
+    {
+        /*
+        ** Unused slots have no CRC to check
+        */
+        if ((HistoryPtr->Block.Slots[SlotIndex].Entry.Sequence != 0) &&
+            (HistoryPtr->Block.Slots[SlotIndex].Crc != HS_HistorySlotCrc(&HistoryPtr->Block.Slots[SlotIndex])))
+        {
+            memset(&HistoryPtr->Block.Slots[SlotIndex], 0, sizeof(HistoryPtr->Block.Slots[SlotIndex]));
+            CorruptCount++;
+            StoreBlock = true;
+        }
+        else if (HistoryPtr->Block.Slots[SlotIndex].Entry.Sequence > NewestSequence)
+        {
+            /*
+            ** Recording resumes just after the newest entry, which also leaves
+            ** the oldest entry in NextSlot
+            */
+            NewestSequence       = HistoryPtr->Block.Slots[SlotIndex].Entry.Sequence;
+            HistoryPtr->NextSlot = (SlotIndex + 1) % HS_HISTORY_DEPTH;
+        }
+    }
+
+    if (CorruptCount != 0)
+    {
+        CFE_EVS_SendEvent(HS_HISTORY_CORRUPT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Action history in CDS was corrupt, %d entries cleared", (int)CorruptCount);
+    }
+
+    /*
+    ** A block restored intact is already stored as it is
+    */
+    HistoryPtr->Block.Header = Header;
+    if ((HistoryPtr->CDSState == HS_STATE_ENABLED) && StoreBlock)
+    {
+        CFE_ES_CopyToCDS(HistoryPtr->CDSHandle, &HistoryPtr->Block);
+    }
+
+    HistoryPtr->NextSequence = NewestSequence + 1;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record a monitor action                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_HistoryRecord(uint8 Table, uint16 Row, uint16 ActionType)
+{
+    HS_History_t *     HistoryPtr = &HS_AppData.History;
+    HS_HistorySlot_t * SlotPtr    = &HistoryPtr->Block.Slots[HistoryPtr->NextSlot];
+    CFE_TIME_SysTime_t Now;
+
+    Now = CFE_TIME_GetTime();
+
+    memset(SlotPtr, 0, sizeof(*SlotPtr));
+
+    SlotPtr->Entry.Sequence   = HistoryPtr->NextSequence;
+    SlotPtr->Entry.Seconds    = Now.Seconds;
+    SlotPtr->Entry.Subseconds = Now.Subseconds;
+    SlotPtr->Entry.Table      = Table;
+    SlotPtr->Entry.Row        = Row;
+    SlotPtr->Entry.ActionType = ActionType;
+    SlotPtr->Crc              = HS_HistorySlotCrc(SlotPtr);
+
+    /*
+    ** One copy of the whole block per record, the other slots are unchanged
+    */
+    if (HistoryPtr->CDSState == HS_STATE_ENABLED)
+    {
+        CFE_ES_CopyToCDS(HistoryPtr->CDSHandle, &HistoryPtr->Block);
+    }
+
+    HistoryPtr->NextSequence++;
+    HistoryPtr->NextSlot = (HistoryPtr->NextSlot + 1) % HS_HISTORY_DEPTH;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute the CRC of a history slot                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_HistorySlotCrc(const HS_HistorySlot_t *SlotPtr)
+{
+    return CFE_ES_CalculateCRC(&SlotPtr->Entry, sizeof(SlotPtr->Entry), 0, CFE_MISSION_ES_DEFAULT_CRC);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy the action history into a telemetry payload                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_HistoryReport(HS_HistoryTlm_Payload_t *PayloadPtr)
+{
+    const HS_History_t *HistoryPtr = &HS_AppData.History;
+    uint32              SlotIndex  = HistoryPtr->NextSlot;
+    uint32              i;
+
+    memset(PayloadPtr, 0, sizeof(*PayloadPtr));
+
+    /*
+    ** NextSlot holds the oldest entry, so walking the ring from there is oldest first
+    */
+    for (i = 0; i < HS_HISTORY_DEPTH; i++)
+    {
+        if (HistoryPtr->Block.Slots[SlotIndex].Entry.Sequence != 0)
+        {
+            PayloadPtr->Entries[PayloadPtr->EntryCount] = HistoryPtr->Block.Slots[SlotIndex].Entry;
+            PayloadPtr->EntryCount++;
+        }
+
+        SlotIndex = (SlotIndex + 1) % HS_HISTORY_DEPTH;
+    }
+}
@@ -0,0 +1,156 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Health and Safety (HS) action history
+ *
+ * The most recent monitor actions are kept in a ring in the Critical Data
+ * Store so the cause of an HS processor reset can be found afterwards.
+ * Each ring slot is its own CRC protected CDS block, so recording an
+ * action writes only that slot.
+ */
+#ifndef HS_HISTORY_H
+#define HS_HISTORY_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "hs_msg.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Name of the action history CDS block
+ */
+#define HS_HISTORY_CDSNAME "HS_HIST"
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief HS Action History Slot, as stored in the CDS
+ */
+typedef struct
+{
+    HS_HistoryEntry_t Entry; /**< \brief Recorded action */
+    uint32            Crc;   /**< \brief CRC of Entry for validation */
+} HS_HistorySlot_t;
+
+/**
+ *  \brief HS Action History Block Header
+ *
+ *  Describes the layout the block was stored with, so a block left by a
+ *  build with a different history depth or entry is not restored
+ */
+typedef struct
+{
+    uint16 Depth;    /**< \brief #HS_HISTORY_DEPTH the block was stored with */
+    uint16 SlotSize; /**< \brief Size of a slot the block was stored with */
+    uint32 Crc;      /**< \brief CRC of Depth and SlotSize for validation */
+} HS_HistoryHeader_t;
+
+/**
+ *  \brief HS Action History Block, as stored in the CDS
+ */
+typedef struct
+{
+    HS_HistoryHeader_t Header;                  /**< \brief Block layout */
+    HS_HistorySlot_t   Slots[HS_HISTORY_DEPTH]; /**< \brief History ring, each slot checked on its own */
+} HS_HistoryBlock_t;
+
+/**
+ *  \brief HS Action History Ring
+ */
+typedef struct
+{
+    HS_HistoryBlock_t  Block;     /**< \brief Copy of the CDS history block */
+    CFE_ES_CDSHandle_t CDSHandle; /**< \brief Handle to the history CDS block */
+
+    uint32 NextSequence; /**< \brief Sequence number of the next recorded action */
+    uint16 NextSlot;     /**< \brief Slot the next action is recorded in, also the oldest entry */
+    uint8  CDSState;     /**< \brief Status of storing the history in the CDS */
+    uint8  SpareByte;    /**< \brief Spare for alignment */
+} HS_History_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Initialize the action history
+ *
+ *  \par Description
+ *       Registers the history CDS block and restores the slots left by
+ *       a previous run. A block with a bad header is cleared, as are
+ *       slots that fail their CRC check. Recording resumes after the
+ *       newest restored entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called after the main HS CDS block is created; the history is
+ *       only kept in memory if that failed.
+ */
+void HS_HistoryInit(void);
+
+/**
+ * \brief Record a monitor action
+ *
+ *  \par Description
+ *       Overwrites the oldest history entry with the action and stores
+ *       the history block in the CDS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Table         HS Table Notification Flag of the monitor table
+ *  \param [in]   Row           Monitor table entry that took the action
+ *  \param [in]   ActionType    Action taken
+ */
+void HS_HistoryRecord(uint8 Table, uint16 Row, uint16 ActionType);
+
+/**
+ * \brief Compute the CRC of a history slot
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   *SlotPtr      History slot
+ *
+ *  \return CRC of the slot's entry
+ */
+uint32 HS_HistorySlotCrc(const HS_HistorySlot_t *SlotPtr);
+
+/**
+ * \brief Copy the action history into a telemetry payload
+ *
+ *  \par Description
+ *       Fills the payload with the used history entries, oldest first.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [out]  *PayloadPtr   Action history telemetry payload
+ */
+void HS_HistoryReport(HS_HistoryTlm_Payload_t *PayloadPtr);
+
+#endif
@@ -29,6 +29,9 @@
 #include "hs_app.h"
 #include "hs_monitors.h"
 #include "hs_sysmon.h"
+#include "hs_runtime.h"
+#include "hs_msgacts.h"
+#include "hs_history.h"
 #include "hs_tbldefs.h"
 #include "hs_eventids.h"
 #include "hs_utils.h"
@@ -43,23 +46,31 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void HS_MonitorApplications(void)
 {
-    CFE_ES_AppInfo_t AppInfo;
-    CFE_ES_AppId_t   AppId = CFE_ES_APPID_UNDEFINED;
-    CFE_Status_t     Status;
-    uint32           TableIndex = 0;
-    uint16           ActionType;
-    uint32           MsgActsIndex = 0;
+    CFE_ES_AppInfo_t       AppInfo;
+    CFE_ES_AppId_t         AppId = CFE_ES_APPID_UNDEFINED;
+    CFE_Status_t           Status;
+    const HS_RuntimeBuf_t *RuntimePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_AMT);
+    uint32                 ListIndex  = 0;
+    uint32                 TableIndex = 0;
+    uint16                 ActionType;
+    uint16                 Rung;
+    uint32                 MsgActsIndex = 0;
+    const HS_AMTRung_t *   NextRungPtr;
 
     memset(&AppInfo, 0, sizeof(AppInfo));
 
-    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++)
+    /*
+    ** Only visit the compiled list of entries that have an action
+    */
+    for (ListIndex = 0; ListIndex < RuntimePtr->AMActiveCount; ListIndex++)
     {
+        TableIndex = RuntimePtr->AMActiveList[ListIndex];
         ActionType = HS_AppData.AMTablePtr[TableIndex].ActionType;
 
         /*
-        ** Check this App if it has an action, and hasn't already expired
+        ** Check this App if it hasn't already expired
         */
-        if ((ActionType != HS_AMT_ACT_NOACT) && (HS_AppData.AppMonCheckInCountdown[TableIndex] != 0))
+        if (HS_AppData.AppMonState[TableIndex].CheckInCountdown != 0)
         {
             Status = CFE_ES_GetAppIDByName(&AppId, HS_AppData.AMTablePtr[TableIndex].AppName);
 
@@ -67,7 +78,8 @@ void HS_MonitorApplications(void)
             {
                 Status = CFE_ES_GetAppInfo(&AppInfo, AppId);
             }
-            else if (HS_AppData.AppMonCheckInCountdown[TableIndex] == HS_AppData.AMTablePtr[TableIndex].CycleCount)
+            else if (HS_AppData.AppMonState[TableIndex].CheckInCountdown ==
+                     HS_AppData.AMTablePtr[TableIndex].CycleCount)
             {
                 /*
                 ** Only send an error event the first time the App fails to resolve
@@ -87,28 +99,89 @@ void HS_MonitorApplications(void)
             /*
             ** Failure to get an execution counter is not considered an automatic failure (or eventworthy)
             */
-            if ((Status == CFE_SUCCESS) && (HS_AppData.AppMonLastExeCount[TableIndex] != AppInfo.ExecutionCounter))
+            if ((Status == CFE_SUCCESS) &&
+                (HS_AppData.AppMonState[TableIndex].LastExeCount != AppInfo.ExecutionCounter))
             {
                 /*
                 ** Set the current count, and reset the timeout
                 */
-                HS_AppData.AppMonCheckInCountdown[TableIndex] = HS_AppData.AMTablePtr[TableIndex].CycleCount;
-                HS_AppData.AppMonLastExeCount[TableIndex]     = AppInfo.ExecutionCounter;
+                HS_AppData.AppMonState[TableIndex].CheckInCountdown   = HS_AppData.AMTablePtr[TableIndex].CycleCount;
+                HS_AppData.AppMonState[TableIndex].LastExeCount       = AppInfo.ExecutionCounter;
+                HS_AppData.AppMonState[TableIndex].CyclesSinceCheckIn = 0;
+
+                /*
+                ** Enough consecutive check-ins after an escalation put the App back at the bottom
+                */
+                if (HS_AppData.CDSLadders.Ladder[TableIndex].Rung != 0)
+                {
+                    HS_AppData.AppMonState[TableIndex].RecoveryCheckIns++;
+                    if (HS_AppData.AppMonState[TableIndex].RecoveryCheckIns >= HS_ESCALATION_RECOVERY_CHECKINS)
+                    {
+                        HS_SetCDSLadder(TableIndex, HS_AppData.CDSLadders.Ladder[TableIndex].AppHash, 0);
+                        CFE_EVS_SendEvent(HS_APPMON_RECOVERED_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                          "App Monitor Recovered: APP:(%s): Escalation reset",
+                                          HS_AppData.AMTablePtr[TableIndex].AppName);
+                    }
+                }
             }
             else
             {
-                HS_AppData.AppMonCheckInCountdown[TableIndex]--;
+                HS_AppData.AppMonState[TableIndex].CheckInCountdown--;
+
+                /*
+                ** Track the worst check-in gap seen so CycleCount margins can be tuned
+                */
+                HS_AppData.AppMonState[TableIndex].CyclesSinceCheckIn++;
+                if (HS_AppData.AppMonState[TableIndex].CyclesSinceCheckIn >
+                    HS_AppData.AppMonState[TableIndex].MaxCyclesSinceCheckIn)
+                {
+                    HS_AppData.AppMonState[TableIndex].MaxCyclesSinceCheckIn =
+                        HS_AppData.AppMonState[TableIndex].CyclesSinceCheckIn;
+                }
 
                 /*
                 ** Take Action once the counter reaches zero
                 */
-                if (HS_AppData.AppMonCheckInCountdown[TableIndex] == 0)
+                if (HS_AppData.AppMonState[TableIndex].CheckInCountdown == 0)
                 {
                     /*
-                    ** Unset the enabled bit flag
+                    ** Each rung already climbed replaces the base action
                     */
-                    HS_AppData.AppMonEnables[TableIndex / HS_BITS_PER_APPMON_ENABLE] &=
-                        ~(1 << (TableIndex % HS_BITS_PER_APPMON_ENABLE));
+                    Rung = HS_AppData.CDSLadders.Ladder[TableIndex].Rung;
+                    if (Rung != 0)
+                    {
+                        ActionType = HS_AppData.AMTablePtr[TableIndex].Escalation[Rung - 1].ActionType;
+                    }
+
+                    if ((Rung < HS_MAX_ESCALATION_RUNGS) &&
+                        (HS_AppData.AMTablePtr[TableIndex].Escalation[Rung].ActionType != HS_AMT_ACT_NOACT))
+                    {
+                        /*
+                        ** Climb before acting so a processor reset doesn't lose the climb,
+                        ** then give the App the next rung's dwell time to check in
+                        */
+                        NextRungPtr = &HS_AppData.AMTablePtr[TableIndex].Escalation[Rung];
+                        HS_SetCDSLadder(TableIndex, HS_AppData.CDSLadders.Ladder[TableIndex].AppHash, Rung + 1);
+                        CFE_EVS_SendEvent(HS_APPMON_ESCALATE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                          "App Monitor Escalated: APP:(%s): Rung: %d",
+                                          HS_AppData.AMTablePtr[TableIndex].AppName, (int)(Rung + 1));
+
+                        HS_AppData.AppMonState[TableIndex].CheckInCountdown = NextRungPtr->DwellCycles;
+                        if (HS_AppData.AppMonState[TableIndex].CheckInCountdown == 0)
+                        {
+                            HS_AppData.AppMonState[TableIndex].CheckInCountdown =
+                                HS_AppData.AMTablePtr[TableIndex].CycleCount;
+                        }
+                    }
+                    else
+                    {
+                        /*
+                        ** Unset the enabled bit flag
+                        */
+                        HS_AppData.AppMonEnables[TableIndex / HS_BITS_PER_APPMON_ENABLE] &=
+                            ~(1 << (TableIndex % HS_BITS_PER_APPMON_ENABLE));
+                    }
+
                     switch (ActionType)
                     {
                         case HS_AMT_ACT_PROC_RESET:
@@ -122,6 +195,7 @@ void HS_MonitorApplications(void)
                             if (HS_AppData.CDSData.ResetsPerformed < HS_AppData.CDSData.MaxResets)
                             {
                                 HS_SetCDSData((HS_AppData.CDSData.ResetsPerformed + 1), HS_AppData.CDSData.MaxResets);
+                                HS_HistoryRecord(HS_TBL_NOTIFY_AMT, TableIndex, ActionType);
 
                                 OS_TaskDelay(HS_RESET_TASK_DELAY);
                                 CFE_ES_WriteToSysLog("HS App: App Monitor Failure: APP:(%s): Action: Processor Reset\n",
@@ -131,6 +205,10 @@ void HS_MonitorApplications(void)
                             }
                             else
                             {
+                                /*
+                                ** Recorded as no action, since no reset was performed
+                                */
+                                HS_HistoryRecord(HS_TBL_NOTIFY_AMT, TableIndex, HS_AMT_ACT_NOACT);
                                 CFE_EVS_SendEvent(HS_RESET_LIMIT_ERR_EID, CFE_EVS_EventType_ERROR,
                                                   "Processor Reset Action Limit Reached: No Reset Performed");
                             }
@@ -138,6 +216,7 @@ void HS_MonitorApplications(void)
                             break;
 
                         case HS_AMT_ACT_APP_RESTART:
+                            HS_HistoryRecord(HS_TBL_NOTIFY_AMT, TableIndex, ActionType);
                             CFE_EVS_SendEvent(HS_APPMON_RESTART_ERR_EID, CFE_EVS_EventType_ERROR,
                                               "App Monitor Failure: APP:(%s) Action: Restart Application",
                                               HS_AppData.AMTablePtr[TableIndex].AppName);
@@ -162,6 +241,7 @@ void HS_MonitorApplications(void)
                             break;
 
                         case HS_AMT_ACT_EVENT:
+                            HS_HistoryRecord(HS_TBL_NOTIFY_AMT, TableIndex, ActionType);
                             CFE_EVS_SendEvent(HS_APPMON_FAIL_ERR_EID, CFE_EVS_EventType_ERROR,
                                               "App Monitor Failure: APP:(%s): Action: Event Only",
                                               HS_AppData.AMTablePtr[TableIndex].AppName);
@@ -176,28 +256,17 @@ void HS_MonitorApplications(void)
                             MsgActsIndex = ActionType - HS_AMT_ACT_LAST_NONMSG - 1;
 
                             /*
-                            ** Check to see if this is a valid Message Action Type
+                            ** Queue the message if this Message Action can be triggered
                             */
-                            if ((HS_AppData.MsgActsState == HS_STATE_ENABLED) && (MsgActsIndex < HS_MAX_MSG_ACT_TYPES))
+                            if (HS_MsgActTrigger(MsgActsIndex))
                             {
-                                /*
-                                ** Send the message if off cooldown and not disabled
-                                */
-                                if ((HS_AppData.MsgActCooldown[MsgActsIndex] == 0) &&
-                                    (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_DISABLED))
+                                HS_HistoryRecord(HS_TBL_NOTIFY_AMT, TableIndex, ActionType);
+                                if (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT)
                                 {
-                                    CFE_SB_TransmitMsg(
-                                        (const CFE_MSG_Message_t *)&HS_AppData.MATablePtr[MsgActsIndex].MsgBuf, true);
-                                    HS_AppData.MsgActExec++;
-                                    HS_AppData.MsgActCooldown[MsgActsIndex] =
-                                        HS_AppData.MATablePtr[MsgActsIndex].Cooldown;
-                                    if (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT)
-                                    {
-                                        CFE_EVS_SendEvent(
-                                            HS_APPMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                            "App Monitor Failure: APP:(%s): Action: Message Action Index: %d",
-                                            HS_AppData.AMTablePtr[TableIndex].AppName, (int)MsgActsIndex);
-                                    }
+                                    CFE_EVS_SendEvent(
+                                        HS_APPMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                        "App Monitor Failure: APP:(%s): Action: Message Action Index: %d",
+                                        HS_AppData.AMTablePtr[TableIndex].AppName, (int)MsgActsIndex);
                                 }
                             }
 
@@ -205,11 +274,11 @@ void HS_MonitorApplications(void)
                             break;
                     } /* end switch */
 
-                } /* end (HS_AppData.AppMonCheckInCountdown[TableIndex] == 0) if */
+                } /* end (HS_AppData.AppMonState[TableIndex].CheckInCountdown == 0) if */
 
             } /* end "failed to update counter" else */
 
-        } /* end (HS_AppData.AppMonCheckInCountdown[TableIndex] != 0) if */
+        } /* end (HS_AppData.AppMonState[TableIndex].CheckInCountdown != 0) if */
 
     } /* end for loop */
 }
@@ -221,22 +290,29 @@ void HS_MonitorApplications(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
 {
-    uint32           TableIndex = 0;
-    CFE_Status_t     Status     = CFE_SUCCESS;
-    CFE_ES_AppId_t   AppId      = CFE_ES_APPID_UNDEFINED;
-    uint16           ActionType;
-    uint32           MsgActsIndex = 0;
-    CFE_SB_Buffer_t *SendPtr      = NULL;
+    const HS_RuntimeBuf_t *RuntimePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_EMT);
+    uint32                 TableLink;
+    uint32                 TableIndex = 0;
+    CFE_Status_t           Status     = CFE_SUCCESS;
+    CFE_ES_AppId_t         AppId      = CFE_ES_APPID_UNDEFINED;
+    uint16                 ActionType;
+    uint32                 MsgActsIndex = 0;
 
-    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_EVENTS; TableIndex++)
+    /*
+    ** Only visit entries with an action whose event ID shares the hash bucket
+    */
+    TableLink = RuntimePtr->EMHashHead[HS_RUNTIME_EVENT_HASH(EventPtr->Payload.PacketID.EventID)];
+
+    while (TableLink != 0)
     {
+        TableIndex = TableLink - 1;
+        TableLink  = RuntimePtr->EMHashNext[TableIndex];
         ActionType = HS_AppData.EMTablePtr[TableIndex].ActionType;
 
         /*
-        ** Check this Event Monitor if it has an action, and the event IDs match
+        ** Check this Event Monitor if the event IDs match
         */
-        if ((ActionType != HS_EMT_ACT_NOACT) &&
-            (HS_AppData.EMTablePtr[TableIndex].EventID == EventPtr->Payload.PacketID.EventID))
+        if (HS_AppData.EMTablePtr[TableIndex].EventID == EventPtr->Payload.PacketID.EventID)
         {
             if (strncmp(HS_AppData.EMTablePtr[TableIndex].AppName, EventPtr->Payload.PacketID.AppName,
                         OS_MAX_API_NAME) == 0)
@@ -258,6 +334,7 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
                         if (HS_AppData.CDSData.ResetsPerformed < HS_AppData.CDSData.MaxResets)
                         {
                             HS_SetCDSData((HS_AppData.CDSData.ResetsPerformed + 1), HS_AppData.CDSData.MaxResets);
+                            HS_HistoryRecord(HS_TBL_NOTIFY_EMT, TableIndex, ActionType);
 
                             OS_TaskDelay(HS_RESET_TASK_DELAY);
                             CFE_ES_WriteToSysLog("HS App: Event Monitor: APP:(%s) EID:(%d): Action: Processor Reset\n",
@@ -268,6 +345,10 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
                         }
                         else
                         {
+                            /*
+                            ** Recorded as no action, since no reset was performed
+                            */
+                            HS_HistoryRecord(HS_TBL_NOTIFY_EMT, TableIndex, HS_EMT_ACT_NOACT);
                             CFE_EVS_SendEvent(HS_RESET_LIMIT_ERR_EID, CFE_EVS_EventType_ERROR,
                                               "Processor Reset Action Limit Reached: No Reset Performed");
                         }
@@ -275,6 +356,7 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
                         break;
 
                     case HS_EMT_ACT_APP_RESTART:
+                        HS_HistoryRecord(HS_TBL_NOTIFY_EMT, TableIndex, ActionType);
                         /*
                         ** Check to see if the App is still there, and try to restart if it is
                         */
@@ -298,6 +380,7 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
                         break;
 
                     case HS_EMT_ACT_APP_DELETE:
+                        HS_HistoryRecord(HS_TBL_NOTIFY_EMT, TableIndex, ActionType);
                         /*
                         ** Check to see if the App is still there, and try to delete if it is
                         */
@@ -329,29 +412,18 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
                         MsgActsIndex = ActionType - HS_EMT_ACT_LAST_NONMSG - 1;
 
                         /*
-                        ** Check to see if this is a valid Message Action Type
+                        ** Queue the message if this Message Action can be triggered
                         */
-                        if ((HS_AppData.MsgActsState == HS_STATE_ENABLED) && (MsgActsIndex < HS_MAX_MSG_ACT_TYPES))
+                        if (HS_MsgActTrigger(MsgActsIndex))
                         {
-                            /*
-                            ** Send the message if off cooldown and not disabled
-                            */
-                            if ((HS_AppData.MsgActCooldown[MsgActsIndex] == 0) &&
-                                (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_DISABLED))
+                            HS_HistoryRecord(HS_TBL_NOTIFY_EMT, TableIndex, ActionType);
+                            if (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT)
                             {
-                                SendPtr = (CFE_SB_Buffer_t *)&HS_AppData.MATablePtr[MsgActsIndex].MsgBuf;
-                                CFE_SB_TransmitMsg(&SendPtr->Msg, true);
-
-                                HS_AppData.MsgActExec++;
-                                HS_AppData.MsgActCooldown[MsgActsIndex] = HS_AppData.MATablePtr[MsgActsIndex].Cooldown;
-                                if (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT)
-                                {
-                                    CFE_EVS_SendEvent(
-                                        HS_EVENTMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                        "Event Monitor: APP:(%s) EID:(%d): Action: Message Action Index: %d",
-                                        HS_AppData.EMTablePtr[TableIndex].AppName,
-                                        HS_AppData.EMTablePtr[TableIndex].EventID, (int)MsgActsIndex);
-                                }
+                                CFE_EVS_SendEvent(
+                                    HS_EVENTMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                    "Event Monitor: APP:(%s) EID:(%d): Action: Message Action Index: %d",
+                                    HS_AppData.EMTablePtr[TableIndex].AppName,
+                                    HS_AppData.EMTablePtr[TableIndex].EventID, (int)MsgActsIndex);
                             }
                         }
 
@@ -363,7 +435,7 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
 
         } /* end EventID comparison */
 
-    } /* end for loop */
+    } /* end hash chain loop */
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -448,6 +520,398 @@ void HS_MonitorUtilization(void)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Monitor Memory Pools                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorMemory(void)
+{
+    const HS_RuntimeBuf_t *RuntimePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MMT);
+    uint32                 ListIndex;
+    uint32                 TableIndex;
+    uint32                 FreeBytes;
+    uint32                 LargestFree;
+    uint16                 ActionType;
+    uint32                 MsgActsIndex = 0;
+    bool                   LimitCrossed;
+    CFE_Status_t           Status;
+
+    for (ListIndex = 0; ListIndex < RuntimePtr->MMActiveCount; ListIndex++)
+    {
+        TableIndex = RuntimePtr->MMActiveList[ListIndex];
+
+        Status = HS_MemMonRead(TableIndex, &FreeBytes, &LargestFree);
+        if (Status != CFE_SUCCESS)
+        {
+            /*
+            ** Report a failure once, it will usually persist until the table is fixed
+            */
+            if ((HS_AppData.MemMonFlags[TableIndex] & HS_MEMMON_READ_FAILED) == 0)
+            {
+                CFE_EVS_SendEvent(HS_MEMMON_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Memory Monitor: Entry %d: Statistics not available, RC=0x%08X", (int)TableIndex,
+                                  (unsigned int)Status);
+                HS_AppData.MemMonFlags[TableIndex] |= HS_MEMMON_READ_FAILED;
+            }
+
+            HS_AppData.MemMon[TableIndex].FreeBytes        = HS_MEMMON_INVALID;
+            HS_AppData.MemMon[TableIndex].LargestFreeBlock = HS_MEMMON_INVALID;
+            continue;
+        }
+
+        HS_AppData.MemMonFlags[TableIndex] &= ~HS_MEMMON_READ_FAILED;
+
+        HS_AppData.MemMon[TableIndex].FreeBytes        = FreeBytes;
+        HS_AppData.MemMon[TableIndex].LargestFreeBlock = LargestFree;
+        if (FreeBytes < HS_AppData.MemMon[TableIndex].LowWaterBytes)
+        {
+            HS_AppData.MemMon[TableIndex].LowWaterBytes = FreeBytes;
+        }
+
+        /*
+        ** Fragmentation is a largest free block that is a small part of what is free
+        */
+        LimitCrossed = false;
+        if (FreeBytes < HS_AppData.MMTablePtr[TableIndex].MinFreeBytes)
+        {
+            LimitCrossed = true;
+        }
+        else if (((uint64)LargestFree * 100) < ((uint64)HS_AppData.MMTablePtr[TableIndex].MinContigPct * FreeBytes))
+        {
+            LimitCrossed = true;
+        }
+
+        if (!LimitCrossed)
+        {
+            HS_AppData.MemMonFlags[TableIndex] &= ~HS_MEMMON_LIMIT_CROSSED;
+            continue;
+        }
+
+        /*
+        ** Only act when the limit is crossed, not every sample it stays crossed
+        */
+        if ((HS_AppData.MemMonFlags[TableIndex] & HS_MEMMON_LIMIT_CROSSED) != 0)
+        {
+            continue;
+        }
+
+        HS_AppData.MemMonFlags[TableIndex] |= HS_MEMMON_LIMIT_CROSSED;
+
+        ActionType = HS_AppData.MMTablePtr[TableIndex].ActionType;
+
+        switch (ActionType)
+        {
+            case HS_MMT_ACT_NOACT:
+                break;
+
+            case HS_MMT_ACT_EVENT:
+                HS_HistoryRecord(HS_TBL_NOTIFY_MMT, TableIndex, ActionType);
+                CFE_EVS_SendEvent(HS_MEMMON_FAIL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Memory Monitor: Entry %d: Free = %u, Largest Free Block = %u: Action: Event Only",
+                                  (int)TableIndex, (unsigned int)FreeBytes, (unsigned int)LargestFree);
+                break;
+
+            /*
+            ** Message Action types processing (invalid will be skipped)
+            */
+            default:
+
+                /* Calculate the requested message action index */
+                MsgActsIndex = ActionType - HS_MMT_ACT_LAST_NONMSG - 1;
+
+                /*
+                ** Queue the message if this Message Action can be triggered
+                */
+                if (HS_MsgActTrigger(MsgActsIndex))
+                {
+                    HS_HistoryRecord(HS_TBL_NOTIFY_MMT, TableIndex, ActionType);
+                    if (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT)
+                    {
+                        CFE_EVS_SendEvent(HS_MEMMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "Memory Monitor: Entry %d: Free = %u, Largest Free Block = %u: "
+                                          "Action: Message Action Index: %d",
+                                          (int)TableIndex, (unsigned int)FreeBytes, (unsigned int)LargestFree,
+                                          (int)MsgActsIndex);
+                    }
+                }
+
+                /* Otherwise, Take No Action */
+                break;
+        } /* end switch */
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read the free space of a monitored memory pool                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HS_MemMonRead(uint32 TableIndex, uint32 *FreeBytesPtr, uint32 *LargestFreePtr)
+{
+    CFE_ES_MemPoolStats_t PoolStats;
+    OS_heap_prop_t        HeapProp;
+    CFE_Status_t          Status;
+    uint32                BucketIndex;
+    uint64                FreeBytes   = 0;
+    uint64                LargestFree = 0;
+
+    if (HS_AppData.MMTablePtr[TableIndex].ResourceType == HS_MMT_TYPE_POOL)
+    {
+        Status = CFE_ES_GetMemPoolStats(&PoolStats, HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MMT)->MMPoolId[TableIndex]);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+
+        /*
+        ** Freed blocks sit in their bucket until reused, so they count as free,
+        ** but only blocks of that one size can be taken from a bucket
+        */
+        FreeBytes   = PoolStats.NumFreeBytes;
+        LargestFree = PoolStats.NumFreeBytes;
+        for (BucketIndex = 0; BucketIndex < CFE_MISSION_ES_POOL_MAX_BUCKETS; BucketIndex++)
+        {
+            if (PoolStats.BlockStats[BucketIndex].NumFree != 0)
+            {
+                FreeBytes += (uint64)PoolStats.BlockStats[BucketIndex].BlockSize *
+                             PoolStats.BlockStats[BucketIndex].NumFree;
+
+                if (PoolStats.BlockStats[BucketIndex].BlockSize > LargestFree)
+                {
+                    LargestFree = PoolStats.BlockStats[BucketIndex].BlockSize;
+                }
+            }
+        }
+    }
+    else
+    {
+        Status = OS_HeapGetInfo(&HeapProp);
+        if (Status != OS_SUCCESS)
+        {
+            return Status;
+        }
+
+        FreeBytes   = HeapProp.free_bytes;
+        LargestFree = HeapProp.largest_free_block;
+    }
+
+    /*
+    ** Saturate below the invalid value rather than wrap
+    */
+    if (FreeBytes >= HS_MEMMON_INVALID)
+    {
+        FreeBytes = HS_MEMMON_INVALID - 1;
+    }
+
+    if (LargestFree > FreeBytes)
+    {
+        LargestFree = FreeBytes;
+    }
+
+    *FreeBytesPtr   = (uint32)FreeBytes;
+    *LargestFreePtr = (uint32)LargestFree;
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Monitor Message Freshness                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorMessages(void)
+{
+    CFE_SB_Buffer_t *  BufPtr    = NULL;
+    CFE_SB_MsgId_t     MessageID = CFE_SB_INVALID_MSG_ID;
+    CFE_TIME_SysTime_t Now;
+    CFE_TIME_SysTime_t Age;
+    uint32             AgeMsec;
+    uint32             MsgCount;
+    uint32             TableIndex;
+    uint16             ActionType;
+    uint32             MsgIdValue;
+    uint32             MsgActsIndex = 0;
+
+    /*
+    ** Arrival times have the resolution of the HS cycle, so one MET read serves them all
+    */
+    Now = CFE_TIME_GetMET();
+
+    /*
+    ** Only the arrival of a message matters, not its contents
+    */
+    for (MsgCount = 0; MsgCount < HS_MSGMON_PIPE_DEPTH; MsgCount++)
+    {
+        if ((CFE_SB_ReceiveBuffer(&BufPtr, HS_AppData.MsgMonPipe, CFE_SB_POLL) != CFE_SUCCESS) || (BufPtr == NULL))
+        {
+            break;
+        }
+
+        CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+        HS_MsgMonArrival(MessageID, Now);
+    }
+
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_MSGS; TableIndex++)
+    {
+        if (HS_AppData.MFTablePtr[TableIndex].MaxAgeMsec == 0)
+        {
+            continue;
+        }
+
+        /*
+        ** Ages too long for 32 bits of milliseconds (about 49 days) are saturated
+        */
+        Age = CFE_TIME_Subtract(Now, HS_AppData.MsgMonLastArrival[TableIndex]);
+        if (Age.Seconds >= (0xFFFFFFFF / 1000))
+        {
+            AgeMsec = 0xFFFFFFFF;
+        }
+        else
+        {
+            AgeMsec = (Age.Seconds * 1000) + (CFE_TIME_Sub2MicroSecs(Age.Subseconds) / 1000);
+        }
+
+        HS_AppData.MsgMon[TableIndex].AgeMsec = AgeMsec;
+
+        /*
+        ** Only act when the message goes stale, not every cycle it stays stale
+        */
+        if ((AgeMsec <= HS_AppData.MFTablePtr[TableIndex].MaxAgeMsec) ||
+            ((HS_AppData.MsgMonFlags[TableIndex] & HS_MSGMON_STALE) != 0))
+        {
+            continue;
+        }
+
+        HS_AppData.MsgMonFlags[TableIndex] |= HS_MSGMON_STALE;
+
+        ActionType = HS_AppData.MFTablePtr[TableIndex].ActionType;
+        MsgIdValue = CFE_SB_MsgIdToValue(HS_AppData.MFTablePtr[TableIndex].MsgId);
+
+        switch (ActionType)
+        {
+            case HS_MFT_ACT_NOACT:
+                break;
+
+            case HS_MFT_ACT_EVENT:
+                HS_HistoryRecord(HS_TBL_NOTIFY_MFT, TableIndex, ActionType);
+                CFE_EVS_SendEvent(HS_MSGMON_STALE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Message Monitor: MID 0x%08X: Age = %u ms, Max = %u ms: Action: Event Only",
+                                  (unsigned int)MsgIdValue, (unsigned int)AgeMsec,
+                                  (unsigned int)HS_AppData.MFTablePtr[TableIndex].MaxAgeMsec);
+                break;
+
+            /*
+            ** Message Action types processing (invalid will be skipped)
+            */
+            default:
+
+                /* Calculate the requested message action index */
+                MsgActsIndex = ActionType - HS_MFT_ACT_LAST_NONMSG - 1;
+
+                /*
+                ** Queue the message if this Message Action can be triggered
+                */
+                if (HS_MsgActTrigger(MsgActsIndex))
+                {
+                    HS_HistoryRecord(HS_TBL_NOTIFY_MFT, TableIndex, ActionType);
+                    if (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT)
+                    {
+                        CFE_EVS_SendEvent(HS_MSGMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "Message Monitor: MID 0x%08X: Age = %u ms, Max = %u ms: "
+                                          "Action: Message Action Index: %d",
+                                          (unsigned int)MsgIdValue, (unsigned int)AgeMsec,
+                                          (unsigned int)HS_AppData.MFTablePtr[TableIndex].MaxAgeMsec,
+                                          (int)MsgActsIndex);
+                    }
+                }
+
+                /* Otherwise, Take No Action */
+                break;
+        } /* end switch */
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record the arrival of a monitored message                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgMonArrival(CFE_SB_MsgId_t MessageID, CFE_TIME_SysTime_t ArrivalTime)
+{
+    const HS_RuntimeBuf_t *RuntimePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MFT);
+    uint32                 TableLink;
+    uint32                 TableIndex;
+
+    /*
+    ** Only visit entries in use whose message ID shares the hash bucket
+    */
+    TableLink = RuntimePtr->MFHashHead[HS_RUNTIME_MSGID_HASH(MessageID)];
+
+    while (TableLink != 0)
+    {
+        TableIndex = TableLink - 1;
+        TableLink  = RuntimePtr->MFHashNext[TableIndex];
+
+        /*
+        ** Validation keeps message IDs unique, so the first match is the only one
+        */
+        if (CFE_SB_MsgId_Equal(HS_AppData.MFTablePtr[TableIndex].MsgId, MessageID))
+        {
+            HS_AppData.MsgMonLastArrival[TableIndex] = ArrivalTime;
+            HS_AppData.MsgMon[TableIndex].ArrivalCount++;
+            HS_AppData.MsgMonFlags[TableIndex] &= ~HS_MSGMON_STALE;
+            break;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Subscribe to the messages of the Message Freshness table        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgMonSubscribe(void)
+{
+    uint32       TableIndex;
+    CFE_Status_t Status;
+
+    /*
+    ** Drop the previous table's messages, copies already on the pipe won't match an entry
+    */
+    for (TableIndex = 0; TableIndex < HS_AppData.MsgMonSubscribedCount; TableIndex++)
+    {
+        CFE_SB_Unsubscribe(HS_AppData.MsgMonSubscribed[TableIndex], HS_AppData.MsgMonPipe);
+    }
+
+    HS_AppData.MsgMonSubscribedCount = 0;
+
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_MSGS; TableIndex++)
+    {
+        if (HS_AppData.MFTablePtr[TableIndex].MaxAgeMsec == 0)
+        {
+            continue;
+        }
+
+        Status = CFE_SB_SubscribeEx(HS_AppData.MFTablePtr[TableIndex].MsgId, HS_AppData.MsgMonPipe,
+                                    CFE_SB_DEFAULT_QOS, HS_MSGMON_MSG_LIMIT);
+        if (Status != CFE_SUCCESS)
+        {
+            /*
+            ** The entry still ages, so it is reported stale if the problem persists
+            */
+            CFE_EVS_SendEvent(HS_MSGMON_SUB_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error Subscribing to MsgMon MID 0x%08X,RC=0x%08X",
+                              (unsigned int)CFE_SB_MsgIdToValue(HS_AppData.MFTablePtr[TableIndex].MsgId),
+                              (unsigned int)Status);
+            continue;
+        }
+
+        HS_AppData.MsgMonSubscribed[HS_AppData.MsgMonSubscribedCount] = HS_AppData.MFTablePtr[TableIndex].MsgId;
+        HS_AppData.MsgMonSubscribedCount++;
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Validate the Application Monitor Table                          */
@@ -465,6 +929,10 @@ int32 HS_ValidateAMTable(void *TableData)
     uint16 CycleCount;
     uint16 NullTerm;
 
+    uint32 Bucket;
+    uint32 Link;
+    uint32 FirstIndex = 0;
+
     uint32 GoodCount                = 0;
     uint32 BadCount                 = 0;
     uint32 UnusedCount              = 0;
@@ -478,6 +946,8 @@ int32 HS_ValidateAMTable(void *TableData)
         return HS_TBL_VAL_ERR;
     }
 
+    HS_ValReportInit(HS_TBL_NOTIFY_AMT);
+
     for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++)
     {
         ActionType  = TableArray[TableIndex].ActionType;
@@ -508,33 +978,91 @@ int32 HS_ValidateAMTable(void *TableData)
             EntryResult = HS_AMTVAL_ERR_ACT;
             BadCount++;
         }
-        else
+        else if (!HS_AMTEscalationIsValid(&TableArray[TableIndex]))
         {
             /*
-            ** Otherwise, this entry is good
+            ** Escalation ladder has an invalid or unreachable rung
             */
-            GoodCount++;
+            EntryResult = HS_AMTVAL_ERR_ESC;
+            BadCount++;
         }
-        /*
-        ** Generate detailed event for "first" error
-        */
-        if ((EntryResult != HS_AMTVAL_NO_ERR) && (TableResult == CFE_SUCCESS))
+        else
         {
-            strncpy(BadName, TableArray[TableIndex].AppName, OS_MAX_API_NAME - 1);
-            BadName[OS_MAX_API_NAME - 1] = '\0';
-            CFE_EVS_SendEvent(HS_AMTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "AppMon verify err: Entry = %d, Err = %d, Action = %d, App = %s", (int)TableIndex,
-                              (int)EntryResult, ActionType, BadName);
-            TableResult = EntryResult;
-        }
-    }
+            /*
+            ** Look for an earlier good entry for the same application
+            */
+            Bucket = HS_KeyHash(TableArray[TableIndex].AppName, 0) & (HS_VALIDATE_HASH_BUCKETS - 1);
+            Link   = HS_AppData.ValHashHead[Bucket];
 
-    /*
-    ** Generate informational event with error totals
-    */
-    CFE_EVS_SendEvent(HS_AMTVAL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                      "AppMon verify results: good = %d, bad = %d, unused = %d", (int)GoodCount, (int)BadCount,
-                      (int)UnusedCount);
+            while ((Link != 0) &&
+                   (strncmp(TableArray[Link - 1].AppName, TableArray[TableIndex].AppName, OS_MAX_API_NAME) != 0))
+            {
+                Link = HS_AppData.ValHashNext[Link - 1];
+            }
+
+            if (Link != 0)
+            {
+                /*
+                ** Application is already monitored, with the same or a different action
+                */
+                FirstIndex = Link - 1;
+
+                if (TableArray[FirstIndex].ActionType == ActionType)
+                {
+                    EntryResult = HS_AMTVAL_ERR_DUP;
+                }
+                else
+                {
+                    EntryResult = HS_AMTVAL_ERR_CON;
+                }
+
+                HS_ValReportAddPair(TableIndex, FirstIndex, EntryResult);
+                BadCount++;
+            }
+            else
+            {
+                /*
+                ** Otherwise, this entry is good
+                */
+                HS_AppData.ValHashNext[TableIndex] = HS_AppData.ValHashHead[Bucket];
+                HS_AppData.ValHashHead[Bucket]     = TableIndex + 1;
+                GoodCount++;
+            }
+        }
+        /*
+        ** Generate detailed event for "first" error
+        */
+        if ((EntryResult != HS_AMTVAL_NO_ERR) && (TableResult == CFE_SUCCESS))
+        {
+            strncpy(BadName, TableArray[TableIndex].AppName, OS_MAX_API_NAME - 1);
+            BadName[OS_MAX_API_NAME - 1] = '\0';
+
+            if ((EntryResult == HS_AMTVAL_ERR_DUP) || (EntryResult == HS_AMTVAL_ERR_CON))
+            {
+                CFE_EVS_SendEvent(HS_AMTVAL_DUP_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "AppMon verify err: Entry = %d, Err = %d, Action = %d, App = %s, "
+                                  "First Entry = %d, First Action = %d",
+                                  (int)TableIndex, (int)EntryResult, ActionType, BadName, (int)FirstIndex,
+                                  TableArray[FirstIndex].ActionType);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(HS_AMTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "AppMon verify err: Entry = %d, Err = %d, Action = %d, App = %s", (int)TableIndex,
+                                  (int)EntryResult, ActionType, BadName);
+            }
+            TableResult = EntryResult;
+        }
+    }
+
+    /*
+    ** Generate informational event with error totals
+    */
+    CFE_EVS_SendEvent(HS_AMTVAL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "AppMon verify results: good = %d, bad = %d, unused = %d", (int)GoodCount, (int)BadCount,
+                      (int)UnusedCount);
+
+    HS_ValReportSend(TableResult, GoodCount, BadCount, UnusedCount);
 
     return TableResult;
 }
@@ -556,6 +1084,10 @@ int32 HS_ValidateEMTable(void *TableData)
     uint16 EventID;
     uint16 NullTerm;
 
+    uint32 Bucket;
+    uint32 Link;
+    uint32 FirstIndex = 0;
+
     uint32 GoodCount                = 0;
     uint32 BadCount                 = 0;
     uint32 UnusedCount              = 0;
@@ -569,6 +1101,8 @@ int32 HS_ValidateEMTable(void *TableData)
         return HS_TBL_VAL_ERR;
     }
 
+    HS_ValReportInit(HS_TBL_NOTIFY_EMT);
+
     for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_EVENTS; TableIndex++)
     {
         ActionType  = TableArray[TableIndex].ActionType;
@@ -602,9 +1136,46 @@ int32 HS_ValidateEMTable(void *TableData)
         else
         {
             /*
-            ** Otherwise, this entry is good
+            ** Look for an earlier good entry for the same application and event
             */
-            GoodCount++;
+            Bucket = HS_KeyHash(TableArray[TableIndex].AppName, EventID) & (HS_VALIDATE_HASH_BUCKETS - 1);
+            Link   = HS_AppData.ValHashHead[Bucket];
+
+            while ((Link != 0) &&
+                   ((TableArray[Link - 1].EventID != EventID) ||
+                    (strncmp(TableArray[Link - 1].AppName, TableArray[TableIndex].AppName, OS_MAX_API_NAME) != 0)))
+            {
+                Link = HS_AppData.ValHashNext[Link - 1];
+            }
+
+            if (Link != 0)
+            {
+                /*
+                ** Event is already monitored, with the same or a different action
+                */
+                FirstIndex = Link - 1;
+
+                if (TableArray[FirstIndex].ActionType == ActionType)
+                {
+                    EntryResult = HS_EMTVAL_ERR_DUP;
+                }
+                else
+                {
+                    EntryResult = HS_EMTVAL_ERR_CON;
+                }
+
+                HS_ValReportAddPair(TableIndex, FirstIndex, EntryResult);
+                BadCount++;
+            }
+            else
+            {
+                /*
+                ** Otherwise, this entry is good
+                */
+                HS_AppData.ValHashNext[TableIndex] = HS_AppData.ValHashHead[Bucket];
+                HS_AppData.ValHashHead[Bucket]     = TableIndex + 1;
+                GoodCount++;
+            }
         }
         /*
         ** Generate detailed event for "first" error
@@ -613,9 +1184,21 @@ int32 HS_ValidateEMTable(void *TableData)
         {
             strncpy(BadName, TableArray[TableIndex].AppName, OS_MAX_API_NAME - 1);
             BadName[OS_MAX_API_NAME - 1] = '\0';
-            CFE_EVS_SendEvent(HS_EMTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "EventMon verify err: Entry = %d, Err = %d, Action = %d, ID = %d App = %s",
-                              (int)TableIndex, (int)EntryResult, ActionType, EventID, BadName);
+
+            if ((EntryResult == HS_EMTVAL_ERR_DUP) || (EntryResult == HS_EMTVAL_ERR_CON))
+            {
+                CFE_EVS_SendEvent(HS_EMTVAL_DUP_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "EventMon verify err: Entry = %d, Err = %d, Action = %d, ID = %d App = %s, "
+                                  "First Entry = %d, First Action = %d",
+                                  (int)TableIndex, (int)EntryResult, ActionType, EventID, BadName, (int)FirstIndex,
+                                  TableArray[FirstIndex].ActionType);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(HS_EMTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "EventMon verify err: Entry = %d, Err = %d, Action = %d, ID = %d App = %s",
+                                  (int)TableIndex, (int)EntryResult, ActionType, EventID, BadName);
+            }
             TableResult = EntryResult;
         }
     }
@@ -627,9 +1210,114 @@ int32 HS_ValidateEMTable(void *TableData)
                       "EventMon verify results: good = %d, bad = %d, unused = %d", (int)GoodCount, (int)BadCount,
                       (int)UnusedCount);
 
+    HS_ValReportSend(TableResult, GoodCount, BadCount, UnusedCount);
+
     return TableResult;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start a table validation report                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_ValReportInit(uint8 Table)
+{
+    memset(&HS_AppData.ValReportPkt.Payload, 0, sizeof(HS_AppData.ValReportPkt.Payload));
+    HS_AppData.ValReportPkt.Payload.Table = Table;
+
+    memset(HS_AppData.ValHashHead, 0, sizeof(HS_AppData.ValHashHead));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add a duplicate entry pair to the validation report             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_ValReportAddPair(uint32 Entry, uint32 FirstEntry, int32 Result)
+{
+    HS_ValReportTlm_Payload_t *PayloadPtr = &HS_AppData.ValReportPkt.Payload;
+
+    if (PayloadPtr->PairCount < HS_MAX_VAL_REPORT_PAIRS)
+    {
+        PayloadPtr->Pairs[PayloadPtr->PairCount].Entry      = (uint16)Entry;
+        PayloadPtr->Pairs[PayloadPtr->PairCount].FirstEntry = (uint16)FirstEntry;
+        PayloadPtr->Pairs[PayloadPtr->PairCount].Result     = (int16)Result;
+    }
+
+    if (PayloadPtr->PairCount < 0xFFFF)
+    {
+        PayloadPtr->PairCount++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send the table validation report                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_ValReportSend(int32 Result, uint32 GoodCount, uint32 BadCount, uint32 UnusedCount)
+{
+    HS_ValReportTlm_Payload_t *PayloadPtr = &HS_AppData.ValReportPkt.Payload;
+
+    PayloadPtr->Result      = Result;
+    PayloadPtr->GoodCount   = GoodCount;
+    PayloadPtr->BadCount    = BadCount;
+    PayloadPtr->UnusedCount = UnusedCount;
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(HS_AppData.ValReportPkt.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(HS_AppData.ValReportPkt.TelemetryHeader), true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check if a Message Action is off cooldown                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_MsgActReady(uint32 MsgActsIndex)
+{
+    return (CFE_TIME_Compare(CFE_TIME_GetMET(), HS_AppData.MsgActReadyTime[MsgActsIndex]) != CFE_TIME_A_LT_B);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start the cooldown of a Message Action that was just sent       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgActStartCooldown(uint32 MsgActsIndex)
+{
+    CFE_TIME_SysTime_t Cooldown;
+    uint32             CooldownMsec = (uint32)HS_AppData.MATablePtr[MsgActsIndex].Cooldown * HS_MSG_ACT_COOLDOWN_MSEC;
+
+    Cooldown.Seconds    = CooldownMsec / 1000;
+    Cooldown.Subseconds = CFE_TIME_Micro2SubSecs((CooldownMsec % 1000) * 1000);
+
+    HS_AppData.MsgActReadyTime[MsgActsIndex] = CFE_TIME_Add(CFE_TIME_GetMET(), Cooldown);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Queue a Message Action if it can be triggered                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_MsgActTrigger(uint32 MsgActsIndex)
+{
+    if ((HS_AppData.MsgActsState != HS_STATE_ENABLED) || (MsgActsIndex >= HS_MAX_MSG_ACT_TYPES))
+    {
+        return false;
+    }
+
+    if ((HS_AppData.MATablePtr[MsgActsIndex].EnableState == HS_MAT_STATE_DISABLED) ||
+        !HS_MsgActReady(MsgActsIndex))
+    {
+        return false;
+    }
+
+    HS_MsgActEnqueue(MsgActsIndex);
+    HS_MsgActStartCooldown(MsgActsIndex);
+
+    return true;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Validate the Execution Counters Table                           */
@@ -720,6 +1408,242 @@ int32 HS_ValidateXCTable(void *TableData)
     return TableResult;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate the Memory Monitor Table                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ValidateMMTable(void *TableData)
+{
+    HS_MMTEntry_t *TableArray = (HS_MMTEntry_t *)TableData;
+
+    int32  TableResult = CFE_SUCCESS;
+    uint32 TableIndex;
+    int32  EntryResult;
+    uint32 ResourceType;
+    uint16 ActionType;
+    uint16 MinContigPct;
+
+    uint32 GoodCount   = 0;
+    uint32 BadCount    = 0;
+    uint32 UnusedCount = 0;
+
+    if (TableData == NULL)
+    {
+        CFE_EVS_SendEvent(HS_MM_TBL_NULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error in MM Table Validation. Table is null.");
+
+        return HS_TBL_VAL_ERR;
+    }
+
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_MEM; TableIndex++)
+    {
+        ResourceType = TableArray[TableIndex].ResourceType;
+        ActionType   = TableArray[TableIndex].ActionType;
+        MinContigPct = TableArray[TableIndex].MinContigPct;
+        EntryResult  = HS_MMTVAL_NO_ERR;
+
+        if (ResourceType == HS_MMT_TYPE_NOTYPE)
+        {
+            /*
+            ** Unused table entry
+            */
+            UnusedCount++;
+        }
+        else if ((ResourceType != HS_MMT_TYPE_POOL) && (ResourceType != HS_MMT_TYPE_HEAP))
+        {
+            /*
+            ** Resource Type is not valid
+            */
+            EntryResult = HS_MMTVAL_ERR_TYPE;
+            BadCount++;
+        }
+        else if (ActionType > (HS_MMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES))
+        {
+            /*
+            ** Action is not valid
+            */
+            EntryResult = HS_MMTVAL_ERR_ACT;
+            BadCount++;
+        }
+        else if (MinContigPct > 100)
+        {
+            /*
+            ** Largest free block can't be more than all that is free
+            */
+            EntryResult = HS_MMTVAL_ERR_PCT;
+            BadCount++;
+        }
+        else if ((ResourceType == HS_MMT_TYPE_POOL) &&
+                 ((TableArray[TableIndex].AppName[0] == '\0') ||
+                  (memchr(TableArray[TableIndex].AppName, '\0', sizeof(TableArray[TableIndex].AppName)) == NULL)))
+        {
+            /*
+            ** A pool is found by the name of the application that registers it
+            */
+            EntryResult = HS_MMTVAL_ERR_NAME;
+            BadCount++;
+        }
+        else
+        {
+            /*
+            ** Otherwise, this entry is good
+            */
+            GoodCount++;
+        }
+
+        /*
+        ** Generate detailed event for "first" error
+        */
+        if ((EntryResult != HS_MMTVAL_NO_ERR) && (TableResult == CFE_SUCCESS))
+        {
+            CFE_EVS_SendEvent(HS_MMTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "MemMon verify err: Entry = %d, Err = %d, Type = %d, Action = %d, Pct = %d",
+                              (int)TableIndex, (int)EntryResult, (int)ResourceType, ActionType, MinContigPct);
+            TableResult = EntryResult;
+        }
+    }
+
+    /*
+    ** Generate informational event with error totals
+    */
+    CFE_EVS_SendEvent(HS_MMTVAL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "MemMon verify results: good = %d, bad = %d, unused = %d", (int)GoodCount, (int)BadCount,
+                      (int)UnusedCount);
+
+    return TableResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate the Message Freshness Table                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ValidateMFTable(void *TableData)
+{
+    HS_MFTEntry_t *TableArray = (HS_MFTEntry_t *)TableData;
+
+    int32  TableResult = CFE_SUCCESS;
+    uint32 TableIndex;
+    int32  EntryResult;
+    uint16 ActionType;
+
+    CFE_SB_MsgId_t MessageID;
+
+    uint32 Bucket;
+    uint32 Link;
+    uint32 FirstIndex = 0;
+
+    uint32 GoodCount   = 0;
+    uint32 BadCount    = 0;
+    uint32 UnusedCount = 0;
+
+    if (TableData == NULL)
+    {
+        CFE_EVS_SendEvent(HS_MF_TBL_NULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error in MF Table Validation. Table is null.");
+
+        return HS_TBL_VAL_ERR;
+    }
+
+    HS_ValReportInit(HS_TBL_NOTIFY_MFT);
+
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_MSGS; TableIndex++)
+    {
+        MessageID   = TableArray[TableIndex].MsgId;
+        ActionType  = TableArray[TableIndex].ActionType;
+        EntryResult = HS_MFTVAL_NO_ERR;
+
+        if (TableArray[TableIndex].MaxAgeMsec == 0)
+        {
+            /*
+            ** Unused table entry
+            */
+            UnusedCount++;
+        }
+        else if (!CFE_SB_IsValidMsgId(MessageID))
+        {
+            /*
+            ** Message ID isn't valid
+            */
+            EntryResult = HS_MFTVAL_ERR_ID;
+            BadCount++;
+        }
+        else if (ActionType > (HS_MFT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES))
+        {
+            /*
+            ** Action is not valid
+            */
+            EntryResult = HS_MFTVAL_ERR_ACT;
+            BadCount++;
+        }
+        else
+        {
+            /*
+            ** Look for an earlier good entry for the same message, it can only be subscribed once
+            */
+            Bucket = CFE_SB_MsgIdToValue(MessageID) & (HS_VALIDATE_HASH_BUCKETS - 1);
+            Link   = HS_AppData.ValHashHead[Bucket];
+
+            while ((Link != 0) && !CFE_SB_MsgId_Equal(TableArray[Link - 1].MsgId, MessageID))
+            {
+                Link = HS_AppData.ValHashNext[Link - 1];
+            }
+
+            if (Link != 0)
+            {
+                FirstIndex  = Link - 1;
+                EntryResult = HS_MFTVAL_ERR_DUP;
+
+                HS_ValReportAddPair(TableIndex, FirstIndex, EntryResult);
+                BadCount++;
+            }
+            else
+            {
+                /*
+                ** Otherwise, this entry is good
+                */
+                HS_AppData.ValHashNext[TableIndex] = HS_AppData.ValHashHead[Bucket];
+                HS_AppData.ValHashHead[Bucket]     = TableIndex + 1;
+                GoodCount++;
+            }
+        }
+
+        /*
+        ** Generate detailed event for "first" error
+        */
+        if ((EntryResult != HS_MFTVAL_NO_ERR) && (TableResult == CFE_SUCCESS))
+        {
+            if (EntryResult == HS_MFTVAL_ERR_DUP)
+            {
+                CFE_EVS_SendEvent(HS_MFTVAL_DUP_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "MsgMon verify err: Entry = %d, Err = %d, MID = 0x%08X, First Entry = %d",
+                                  (int)TableIndex, (int)EntryResult, (unsigned int)CFE_SB_MsgIdToValue(MessageID),
+                                  (int)FirstIndex);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(HS_MFTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "MsgMon verify err: Entry = %d, Err = %d, MID = 0x%08X, Action = %d",
+                                  (int)TableIndex, (int)EntryResult, (unsigned int)CFE_SB_MsgIdToValue(MessageID),
+                                  ActionType);
+            }
+            TableResult = EntryResult;
+        }
+    }
+
+    /*
+    ** Generate informational event with error totals
+    */
+    CFE_EVS_SendEvent(HS_MFTVAL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "MsgMon verify results: good = %d, bad = %d, unused = %d", (int)GoodCount, (int)BadCount,
+                      (int)UnusedCount);
+
+    HS_ValReportSend(TableResult, GoodCount, BadCount, UnusedCount);
+
+    return TableResult;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Validate the Message Actions Table                              */
@@ -742,6 +1666,8 @@ int32 HS_ValidateMATable(void *TableData)
     uint32 BadCount    = 0;
     uint32 UnusedCount = 0;
 
+    uint8 SeqState[HS_MAX_MSG_ACT_TYPES];
+
     if (TableData == NULL)
     {
         CFE_EVS_SendEvent(HS_MA_TBL_NULL_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -750,6 +1676,8 @@ int32 HS_ValidateMATable(void *TableData)
         return HS_TBL_VAL_ERR;
     }
 
+    HS_ValidateMASequences(TableArray, SeqState);
+
     for (TableIndex = 0; TableIndex < HS_MAX_MSG_ACT_TYPES; TableIndex++)
     {
         EntryResult = HS_MATVAL_NO_ERR;
@@ -789,6 +1717,15 @@ int32 HS_ValidateMATable(void *TableData)
             EntryResult = HS_MATVAL_ERR_LEN;
             BadCount++;
         }
+        else if (SeqState[TableIndex] != HS_MASEQ_GOOD)
+        {
+            /*
+            ** Sequence links out of the table, to an entry that
+            ** is not enabled, or never ends
+            */
+            EntryResult = HS_MATVAL_ERR_NXT;
+            BadCount++;
+        }
         else
         {
             /*
@@ -818,6 +1755,89 @@ int32 HS_ValidateMATable(void *TableData)
     return TableResult;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check the Message Actions Table sequences                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_ValidateMASequences(const HS_MATEntry_t *TableArray, uint8 *SeqState)
+{
+    uint32 Path[HS_MAX_MSG_ACT_TYPES];
+    uint32 PathLength;
+    uint32 StartIndex;
+    uint32 TableIndex;
+    uint16 NextAction;
+    uint16 NextState;
+    uint8  Result;
+
+    memset(SeqState, HS_MASEQ_UNVISITED, HS_MAX_MSG_ACT_TYPES);
+
+    for (StartIndex = 0; StartIndex < HS_MAX_MSG_ACT_TYPES; StartIndex++)
+    {
+        PathLength = 0;
+        TableIndex = StartIndex;
+        Result     = HS_MASEQ_ON_PATH;
+
+        /*
+        ** Follow the links until the sequence ends or joins one already checked
+        */
+        while (Result == HS_MASEQ_ON_PATH)
+        {
+            if (SeqState[TableIndex] == HS_MASEQ_ON_PATH)
+            {
+                /*
+                ** Back on the path being followed, so it loops
+                */
+                Result = HS_MASEQ_BAD;
+            }
+            else if (SeqState[TableIndex] != HS_MASEQ_UNVISITED)
+            {
+                Result = SeqState[TableIndex];
+            }
+            else
+            {
+                SeqState[TableIndex] = HS_MASEQ_ON_PATH;
+                Path[PathLength]     = TableIndex;
+                PathLength++;
+
+                NextAction = TableArray[TableIndex].NextAction;
+
+                if (NextAction == 0)
+                {
+                    Result = HS_MASEQ_GOOD;
+                }
+                else if (NextAction > HS_MAX_MSG_ACT_TYPES)
+                {
+                    Result = HS_MASEQ_BAD;
+                }
+                else
+                {
+                    /*
+                    ** A step can only be sent if its entry is enabled
+                    */
+                    NextState = TableArray[NextAction - 1].EnableState;
+
+                    if ((NextState != HS_MAT_STATE_ENABLED) && (NextState != HS_MAT_STATE_NOEVENT))
+                    {
+                        Result = HS_MASEQ_BAD;
+                    }
+
+                    TableIndex = NextAction - 1;
+                }
+            }
+        }
+
+        /*
+        ** Every entry on the path shares the result
+        */
+        while (PathLength > 0)
+        {
+            PathLength--;
+            SeqState[Path[PathLength]] = Result;
+        }
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Set the values being stored in the CDS                          */
@@ -840,3 +1860,122 @@ void HS_SetCDSData(uint16 ResetsPerformed, uint16 MaxResets)
         CFE_ES_CopyToCDS(HS_AppData.MyCDSHandle, &HS_AppData.CDSData);
     }
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Restore the escalation ladders                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_LadderInit(void)
+{
+    CFE_Status_t Status;
+
+    HS_AppData.LadderCDSState = HS_AppData.CDSState;
+
+    if (HS_AppData.LadderCDSState != HS_STATE_ENABLED)
+    {
+        HS_InitCDSLadders();
+        return;
+    }
+
+    Status = CFE_ES_RegisterCDS(&HS_AppData.LadderCDSHandle, sizeof(HS_CDSLadders_t), HS_LADDER_CDSNAME);
+
+    if (Status == CFE_ES_CDS_ALREADY_EXISTS)
+    {
+        Status = CFE_ES_RestoreFromCDS(&HS_AppData.CDSLadders, HS_AppData.LadderCDSHandle);
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(HS_CDS_RESTORE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Failed to restore escalation ladders from CDS (Err=0x%08x), initializing ladders",
+                              (unsigned int)Status);
+            HS_InitCDSLadders();
+        }
+        else if (HS_CDSLaddersCorrupt())
+        {
+            /*
+            ** Only the ladders are reinitialized, the reset counts are in their own block
+            */
+            CFE_EVS_SendEvent(HS_CDS_CORRUPT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Escalation ladders in CDS were corrupt, initializing ladders");
+            HS_InitCDSLadders();
+        }
+    }
+    else if (Status == CFE_SUCCESS)
+    {
+        HS_InitCDSLadders();
+    }
+    else
+    {
+        /*
+        ** Ladders still work, they just start at the bottom after a reset
+        */
+        HS_AppData.LadderCDSState = HS_STATE_DISABLED;
+        HS_InitCDSLadders();
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Update and store an escalation ladder position                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SetCDSLadder(uint32 TableIndex, uint32 AppHash, uint16 Rung)
+{
+    HS_AppData.CDSLadders.Ladder[TableIndex].AppHash = AppHash;
+    HS_AppData.CDSLadders.Ladder[TableIndex].Rung    = Rung;
+    HS_AppData.CDSLadders.Ladder[TableIndex].RungNot = ~Rung;
+
+    HS_AppData.AppMonState[TableIndex].EscalationRung   = Rung;
+    HS_AppData.AppMonState[TableIndex].RecoveryCheckIns = 0;
+
+    /*
+    ** Stored right away, a climb is often followed by a reset
+    */
+    if (HS_AppData.LadderCDSState == HS_STATE_ENABLED)
+    {
+        CFE_ES_CopyToCDS(HS_AppData.LadderCDSHandle, &HS_AppData.CDSLadders);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check restored escalation ladder positions                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_CDSLaddersCorrupt(void)
+{
+    uint32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++)
+    {
+        if (HS_AppData.CDSLadders.Ladder[TableIndex].Rung != (uint16)~HS_AppData.CDSLadders.Ladder[TableIndex].RungNot)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize the escalation ladders                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_InitCDSLadders(void)
+{
+    uint32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++)
+    {
+        HS_AppData.CDSLadders.Ladder[TableIndex].AppHash = 0;
+        HS_AppData.CDSLadders.Ladder[TableIndex].Rung    = 0;
+        HS_AppData.CDSLadders.Ladder[TableIndex].RungNot = (uint16)~0;
+    }
+
+    if (HS_AppData.LadderCDSState == HS_STATE_ENABLED)
+    {
+        CFE_ES_CopyToCDS(HS_AppData.LadderCDSHandle, &HS_AppData.CDSLadders);
+    }
+}
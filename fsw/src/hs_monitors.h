@@ -30,6 +30,21 @@
  *************************************************************************/
 #include "cfe.h"
 #include "cfe_evs_msg.h"
+#include "hs_tbl.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \name HS Message Actions Sequence Check States
+ * \{
+ */
+#define HS_MASEQ_UNVISITED 0 /**< \brief Entry has not been reached yet */
+#define HS_MASEQ_ON_PATH   1 /**< \brief Entry is on the sequence being followed */
+#define HS_MASEQ_GOOD      2 /**< \brief Sequence from the entry ends */
+#define HS_MASEQ_BAD       3 /**< \brief Sequence from the entry loops or has a bad link */
+/**\}*/
 
 /*************************************************************************
  * Exported Functions
@@ -45,7 +60,8 @@
  *       action is taken.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the entries in the compiled active list of the active
+ *       runtime buffer are checked.
  */
 void HS_MonitorApplications(void);
 
@@ -58,7 +74,8 @@ void HS_MonitorApplications(void);
  *       taken.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the entries chained in the event ID hash bucket of the
+ *       active runtime buffer are compared.
  *
  *  \param[in] EventPtr  Pointer to the event message
  */
@@ -78,6 +95,88 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr);
  */
 void HS_MonitorUtilization(void);
 
+/**
+ * \brief Check free space of each memory pool in MemMon table
+ *
+ *  \par Description
+ *       Cycles through the Memory Monitor Table reading the free bytes
+ *       and largest free block of each monitored memory pool. If either
+ *       falls below its table specified limit, the table specified action
+ *       is taken.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The action is only taken when a limit is crossed, and can be
+ *       taken again once the pool has been back within its limits.
+ */
+void HS_MonitorMemory(void);
+
+/**
+ * \brief Read the free space of a monitored memory pool
+ *
+ *  \par Description
+ *       Reads the free bytes and the largest free block of the memory
+ *       pool or heap of a Memory Monitor Table entry. Blocks freed back
+ *       to a memory pool bucket count as free.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Values that don't fit in 32 bits are saturated below
+ *       #HS_MEMMON_INVALID.
+ *
+ *  \param [in]  TableIndex      Memory Monitor Table index
+ *  \param [out] FreeBytesPtr    Free bytes in the pool
+ *  \param [out] LargestFreePtr  Size of the largest free block in the pool
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copydoc CFE_SUCCESS
+ */
+CFE_Status_t HS_MemMonRead(uint32 TableIndex, uint32 *FreeBytesPtr, uint32 *LargestFreePtr);
+
+/**
+ * \brief Check the freshness of each message in MsgMon table
+ *
+ *  \par Description
+ *       Empties the message monitor pipe, recording the arrival of each
+ *       message, then cycles through the Message Freshness Table. If a
+ *       message has not arrived for longer than its table specified
+ *       maximum age, the table specified action is taken.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Arrival times have the resolution of the HS cycle. The action
+ *       is only taken when a message goes stale, and can be taken again
+ *       once the message has arrived.
+ */
+void HS_MonitorMessages(void);
+
+/**
+ * \brief Record the arrival of a monitored message
+ *
+ *  \par Description
+ *       Looks the message ID up in the compiled Message Freshness Table
+ *       hash index and, if it is monitored, restarts the entry's age and
+ *       counts the arrival.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Messages that no entry monitors are ignored.
+ *
+ *  \param [in] MessageID    Message ID of the received message
+ *  \param [in] ArrivalTime  MET the message was received at
+ */
+void HS_MsgMonArrival(CFE_SB_MsgId_t MessageID, CFE_TIME_SysTime_t ArrivalTime);
+
+/**
+ * \brief Subscribe to the messages of the Message Freshness table
+ *
+ *  \par Description
+ *       Unsubscribes the message monitor pipe from the messages of the
+ *       previous table and subscribes it to each message in use in the
+ *       active table, at most #HS_MSGMON_MSG_LIMIT of each waiting.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A failed subscription is reported and the entry is left to go
+ *       stale.
+ */
+void HS_MsgMonSubscribe(void);
+
 /**
  * \brief Validate application monitor table
  *
@@ -86,7 +185,10 @@ void HS_MonitorUtilization(void);
  *       the application monitor table is required
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Entries for an application that an earlier entry already
+ *       monitors are found through a hash of the application name, so
+ *       the check is linear in the table size. The results are sent in
+ *       the validation report packet.
  *
  *  \param [in]   *TableData     Pointer to the table data to validate
  *
@@ -94,6 +196,8 @@ void HS_MonitorUtilization(void);
  *  \retval #CFE_SUCCESS       \copydoc CFE_SUCCESS
  *  \retval #HS_AMTVAL_ERR_ACT \copydoc HS_AMTVAL_ERR_ACT
  *  \retval #HS_AMTVAL_ERR_NUL \copydoc HS_AMTVAL_ERR_NUL
+ *  \retval #HS_AMTVAL_ERR_DUP \copydoc HS_AMTVAL_ERR_DUP
+ *  \retval #HS_AMTVAL_ERR_CON \copydoc HS_AMTVAL_ERR_CON
  *
  *  \sa #HS_ValidateEMTable, #HS_ValidateXCTable, #HS_ValidateMATable
  */
@@ -107,7 +211,10 @@ int32 HS_ValidateAMTable(void *TableData);
  *       the event monitor table is required
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Entries for an application and event ID that an earlier entry
+ *       already monitors are found through a hash of the name and ID,
+ *       so the check is linear in the table size. The results are sent
+ *       in the validation report packet.
  *
  *  \param [in]   *TableData     Pointer to the table data to validate
  *
@@ -115,11 +222,112 @@ int32 HS_ValidateAMTable(void *TableData);
  *  \retval #CFE_SUCCESS       \copydoc CFE_SUCCESS
  *  \retval #HS_EMTVAL_ERR_ACT \copydoc HS_EMTVAL_ERR_ACT
  *  \retval #HS_EMTVAL_ERR_NUL \copydoc HS_EMTVAL_ERR_NUL
+ *  \retval #HS_EMTVAL_ERR_DUP \copydoc HS_EMTVAL_ERR_DUP
+ *  \retval #HS_EMTVAL_ERR_CON \copydoc HS_EMTVAL_ERR_CON
  *
  *  \sa #HS_ValidateAMTable, #HS_ValidateXCTable, #HS_ValidateMATable
  */
 int32 HS_ValidateEMTable(void *TableData);
 
+/**
+ * \brief Start a table validation report
+ *
+ *  \par Description
+ *       Clears the validation report and the duplicate check hash for
+ *       a new table validation.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Table  HS Table Notification Flag of the table being validated
+ */
+void HS_ValReportInit(uint8 Table);
+
+/**
+ * \brief Add a duplicate entry pair to the validation report
+ *
+ *  \par Description
+ *       Records a table entry that has the same key as an earlier entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only the first #HS_MAX_VAL_REPORT_PAIRS pairs are listed, but
+ *       all pairs are counted.
+ *
+ *  \param [in] Entry       Table entry that failed validation
+ *  \param [in] FirstEntry  Earlier table entry with the same key
+ *  \param [in] Result      Validation error of the pair
+ */
+void HS_ValReportAddPair(uint32 Entry, uint32 FirstEntry, int32 Result);
+
+/**
+ * \brief Send the table validation report
+ *
+ *  \par Description
+ *       Fills in the validation totals and sends the validation report
+ *       packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Result       Table validation result
+ *  \param [in] GoodCount    Number of good entries
+ *  \param [in] BadCount     Number of bad entries
+ *  \param [in] UnusedCount  Number of unused entries
+ */
+void HS_ValReportSend(int32 Result, uint32 GoodCount, uint32 BadCount, uint32 UnusedCount);
+
+/**
+ * \brief Check if a Message Action is off cooldown
+ *
+ *  \par Description
+ *       Compares the current MET against the time the Message Action's
+ *       last cooldown expires.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       MsgActsIndex must be less than #HS_MAX_MSG_ACT_TYPES
+ *
+ *  \param [in] MsgActsIndex  Message Actions table index
+ *
+ *  \return Boolean ready response
+ *  \retval true  Message Action may be sent
+ *  \retval false Message Action is still cooling down
+ */
+bool HS_MsgActReady(uint32 MsgActsIndex);
+
+/**
+ * \brief Start the cooldown of a Message Action
+ *
+ *  \par Description
+ *       Sets the time the Message Action is next available to the current
+ *       MET plus its table Cooldown in #HS_MSG_ACT_COOLDOWN_MSEC counts.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       MsgActsIndex must be less than #HS_MAX_MSG_ACT_TYPES
+ *
+ *  \param [in] MsgActsIndex  Message Actions table index
+ */
+void HS_MsgActStartCooldown(uint32 MsgActsIndex);
+
+/**
+ * \brief Trigger a Message Action
+ *
+ *  \par Description
+ *       Queues the Message Action and starts its cooldown when Message
+ *       Actions are enabled, the index is in range, the entry is not
+ *       disabled and it is off cooldown.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller records history and reports the monitor specific
+ *       event when the action is taken.
+ *
+ *  \param [in] MsgActsIndex  Message Actions table index
+ *
+ *  \return Boolean triggered response
+ *  \retval true  Message Action was queued
+ *  \retval false Message Action was not queued
+ */
+bool HS_MsgActTrigger(uint32 MsgActsIndex);
+
 /**
  * \brief Validate execution counter table
  *
@@ -141,6 +349,53 @@ int32 HS_ValidateEMTable(void *TableData);
  */
 int32 HS_ValidateXCTable(void *TableData);
 
+/**
+ * \brief Validate memory monitor table
+ *
+ *  \par Description
+ *       This function is called by table services when a validation of
+ *       the memory monitor table is required
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Pools are only checked for an application name here, whether
+ *       one is registered is only known at run time
+ *
+ *  \param [in]   *TableData     Pointer to the table data to validate
+ *
+ *  \return Table validation status
+ *  \retval #CFE_SUCCESS        \copydoc CFE_SUCCESS
+ *  \retval #HS_MMTVAL_ERR_TYPE \copydoc HS_MMTVAL_ERR_TYPE
+ *  \retval #HS_MMTVAL_ERR_ACT  \copydoc HS_MMTVAL_ERR_ACT
+ *  \retval #HS_MMTVAL_ERR_PCT  \copydoc HS_MMTVAL_ERR_PCT
+ *  \retval #HS_MMTVAL_ERR_NAME \copydoc HS_MMTVAL_ERR_NAME
+ *
+ *  \sa #HS_ValidateAMTable, #HS_ValidateEMTable, #HS_ValidateXCTable
+ */
+int32 HS_ValidateMMTable(void *TableData);
+
+/**
+ * \brief Validate message freshness table
+ *
+ *  \par Description
+ *       This function is called by table services when a validation of
+ *       the message freshness table is required
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each message ID can only be in the table once, as the message
+ *       monitor pipe can only be subscribed to it once
+ *
+ *  \param [in]   *TableData     Pointer to the table data to validate
+ *
+ *  \return Table validation status
+ *  \retval #CFE_SUCCESS       \copydoc CFE_SUCCESS
+ *  \retval #HS_MFTVAL_ERR_ID  \copydoc HS_MFTVAL_ERR_ID
+ *  \retval #HS_MFTVAL_ERR_ACT \copydoc HS_MFTVAL_ERR_ACT
+ *  \retval #HS_MFTVAL_ERR_DUP \copydoc HS_MFTVAL_ERR_DUP
+ *
+ *  \sa #HS_ValidateAMTable, #HS_ValidateEMTable, #HS_ValidateMMTable
+ */
+int32 HS_ValidateMFTable(void *TableData);
+
 /**
  * \brief Validate message actions table
  *
@@ -158,11 +413,31 @@ int32 HS_ValidateXCTable(void *TableData);
  *  \retval #HS_MATVAL_ERR_ID  \copydoc HS_MATVAL_ERR_ID
  *  \retval #HS_MATVAL_ERR_LEN \copydoc HS_MATVAL_ERR_LEN
  *  \retval #HS_MATVAL_ERR_ENA \copydoc HS_MATVAL_ERR_ENA
+ *  \retval #HS_MATVAL_ERR_NXT \copydoc HS_MATVAL_ERR_NXT
  *
  *  \sa #HS_ValidateAMTable, #HS_ValidateEMTable, #HS_ValidateXCTable
  */
 int32 HS_ValidateMATable(void *TableData);
 
+/**
+ * \brief Check the message actions table sequences
+ *
+ *  \par Description
+ *       Follows the NextAction links from every message actions table
+ *       entry and records whether the sequence from that entry ends.
+ *       A sequence is bad if a link is out of range, targets an entry
+ *       that is not enabled, or loops.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each entry is followed at most once, the result of a sequence
+ *       is shared by every entry that leads into it.
+ *
+ *  \param [in]   *TableArray    Pointer to the message actions table
+ *  \param [out]  *SeqState      #HS_MASEQ_GOOD or #HS_MASEQ_BAD for each
+ *                               table entry
+ */
+void HS_ValidateMASequences(const HS_MATEntry_t *TableArray, uint8 *SeqState);
+
 /**
  * \brief Update and store CDS data
  *
@@ -178,4 +453,64 @@ int32 HS_ValidateMATable(void *TableData);
  */
 void HS_SetCDSData(uint16 ResetsPerformed, uint16 MaxResets);
 
+/**
+ * \brief Restore the escalation ladders
+ *
+ *  \par Description
+ *       Registers the escalation ladder CDS block and restores the
+ *       ladder positions left by a previous run. The ladders start at
+ *       the bottom if the block is new, can't be restored or fails its
+ *       check, without touching the reset counts.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called after the main HS CDS block is created; the ladders are
+ *       only kept in memory if that failed.
+ */
+void HS_LadderInit(void);
+
+/**
+ * \brief Update and store an escalation ladder position
+ *
+ *  \par Description
+ *       Sets the escalation ladder position of an application monitor
+ *       table entry, mirrors it into the AppMon State table, and stores
+ *       the ladders in their critical data store block.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   TableIndex     Application monitor table index
+ *  \param [in]   AppHash        Hash of the entry's AppName
+ *  \param [in]   Rung           Escalation rungs climbed
+ */
+void HS_SetCDSLadder(uint32 TableIndex, uint32 AppHash, uint16 Rung);
+
+/**
+ * \brief Check restored escalation ladder positions
+ *
+ *  \par Description
+ *       Checks every escalation ladder position restored from the
+ *       critical data store against its inverse.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Ladder corruption
+ *  \retval true  At least one position does not match its inverse
+ *  \retval false All positions are intact
+ */
+bool HS_CDSLaddersCorrupt(void);
+
+/**
+ * \brief Initialize the escalation ladders
+ *
+ *  \par Description
+ *       Puts every escalation ladder back at the bottom and stores the
+ *       ladders in the critical data store.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_InitCDSLadders(void);
+
 #endif
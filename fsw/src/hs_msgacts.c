@@ -0,0 +1,232 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to queue and rate limit CFS Health and Safety (HS)
+ *   Message Actions
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "hs_app.h"
+#include "hs_msgacts.h"
+#include "hs_monitors.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize the Message Action queue                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgActQueueInit(void)
+{
+    memset(&HS_AppData.MsgActQueue, 0, sizeof(HS_AppData.MsgActQueue));
+
+    HS_AppData.MsgActQueue.Tokens     = HS_MSG_ACT_BURST * HS_MSG_ACT_TOKEN_UNITS;
+    HS_AppData.MsgActQueue.LastRefill = CFE_TIME_GetMET();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Queue a Message Action                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgActEnqueue(uint32 MsgActsIndex)
+{
+    HS_MsgActQueue_t *QueuePtr = &HS_AppData.MsgActQueue;
+    uint16            Priority = HS_AppData.MATablePtr[MsgActsIndex].Priority;
+    uint32            Position = 0;
+
+    /*
+    ** When full, the least urgent action makes room, unless that is the new one
+    */
+    if (QueuePtr->Count == HS_MSG_ACT_QUEUE_DEPTH)
+    {
+        QueuePtr->SuppressedCount++;
+
+        if (Priority >= HS_AppData.MATablePtr[QueuePtr->Entries[0]].Priority)
+        {
+            return;
+        }
+
+        QueuePtr->Count--;
+        memmove(&QueuePtr->Entries[0], &QueuePtr->Entries[1], QueuePtr->Count * sizeof(QueuePtr->Entries[0]));
+    }
+
+    /*
+    ** Go in front of less urgent actions and behind the rest, so equal
+    ** priorities stay first in, first out
+    */
+    while ((Position < QueuePtr->Count) && (HS_AppData.MATablePtr[QueuePtr->Entries[Position]].Priority > Priority))
+    {
+        Position++;
+    }
+
+    memmove(&QueuePtr->Entries[Position + 1], &QueuePtr->Entries[Position],
+            (QueuePtr->Count - Position) * sizeof(QueuePtr->Entries[0]));
+
+    QueuePtr->Entries[Position] = (uint16)MsgActsIndex;
+    QueuePtr->Count++;
+    QueuePtr->QueuedCount++;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send queued Message Actions                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgActQueueDrain(void)
+{
+    HS_MsgActQueue_t *QueuePtr = &HS_AppData.MsgActQueue;
+    CFE_SB_Buffer_t * SendPtr  = NULL;
+
+    HS_MsgActRefillTokens();
+    HS_MsgActStepsDue();
+
+    while ((QueuePtr->Count != 0) && (QueuePtr->Tokens >= HS_MSG_ACT_TOKEN_UNITS))
+    {
+        QueuePtr->Count--;
+        QueuePtr->Tokens -= HS_MSG_ACT_TOKEN_UNITS;
+
+        SendPtr = (CFE_SB_Buffer_t *)&HS_AppData.MATablePtr[QueuePtr->Entries[QueuePtr->Count]].MsgBuf;
+        CFE_SB_TransmitMsg(&SendPtr->Msg, true);
+
+        HS_AppData.MsgActExec++;
+
+        HS_MsgActScheduleNext(QueuePtr->Entries[QueuePtr->Count]);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Drop all queued Message Actions                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgActQueueFlush(void)
+{
+    HS_AppData.MsgActQueue.SuppressedCount += HS_AppData.MsgActQueue.Count + HS_AppData.MsgActQueue.StepCount;
+
+    HS_AppData.MsgActQueue.Count     = 0;
+    HS_AppData.MsgActQueue.StepCount = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Refill the Message Action token bucket                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgActRefillTokens(void)
+{
+    CFE_TIME_SysTime_t Now;
+    CFE_TIME_SysTime_t Elapsed;
+    uint32             ElapsedMsec;
+
+    Now     = CFE_TIME_GetMET();
+    Elapsed = CFE_TIME_Subtract(Now, HS_AppData.MsgActQueue.LastRefill);
+
+    HS_AppData.MsgActQueue.LastRefill = Now;
+
+    /*
+    ** The bucket can't take longer than HS_MSG_ACT_BURST seconds to fill,
+    ** which also keeps the token math within 32 bits
+    */
+    if (Elapsed.Seconds >= HS_MSG_ACT_BURST)
+    {
+        HS_AppData.MsgActQueue.Tokens = HS_MSG_ACT_BURST * HS_MSG_ACT_TOKEN_UNITS;
+    }
+    else
+    {
+        ElapsedMsec = (Elapsed.Seconds * 1000) + (CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds) / 1000);
+
+        HS_AppData.MsgActQueue.Tokens += ElapsedMsec * HS_MSG_ACT_RATE;
+
+        if (HS_AppData.MsgActQueue.Tokens > (HS_MSG_ACT_BURST * HS_MSG_ACT_TOKEN_UNITS))
+        {
+            HS_AppData.MsgActQueue.Tokens = HS_MSG_ACT_BURST * HS_MSG_ACT_TOKEN_UNITS;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Schedule the next step of a Message Action sequence             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgActScheduleNext(uint32 MsgActsIndex)
+{
+    HS_MsgActQueue_t *QueuePtr   = &HS_AppData.MsgActQueue;
+    uint16            NextAction = HS_AppData.MATablePtr[MsgActsIndex].NextAction;
+
+    if (NextAction == 0)
+    {
+        return;
+    }
+
+    if (QueuePtr->StepCount == HS_MSG_ACT_MAX_PENDING_STEPS)
+    {
+        QueuePtr->SuppressedCount++;
+        return;
+    }
+
+    QueuePtr->Steps[QueuePtr->StepCount].MsgActsIndex = NextAction - 1;
+    QueuePtr->Steps[QueuePtr->StepCount].DueTime =
+        CFE_TIME_Add(QueuePtr->LastRefill, HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MAT)->MANextDelay[MsgActsIndex]);
+    QueuePtr->StepCount++;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Queue Message Action sequence steps that are due                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MsgActStepsDue(void)
+{
+    HS_MsgActQueue_t *QueuePtr  = &HS_AppData.MsgActQueue;
+    uint32            StepIndex = 0;
+    uint32            MsgActsIndex;
+
+    while (StepIndex < QueuePtr->StepCount)
+    {
+        if (CFE_TIME_Compare(QueuePtr->LastRefill, QueuePtr->Steps[StepIndex].DueTime) == CFE_TIME_A_LT_B)
+        {
+            StepIndex++;
+        }
+        else
+        {
+            MsgActsIndex = QueuePtr->Steps[StepIndex].MsgActsIndex;
+
+            /*
+            ** Steps are held to the same limits as any other trigger
+            */
+            if (!HS_MsgActTrigger(MsgActsIndex))
+            {
+                QueuePtr->SuppressedCount++;
+            }
+
+            /*
+            ** Step order doesn't matter, so fill the hole with the last step
+            */
+            QueuePtr->StepCount--;
+            QueuePtr->Steps[StepIndex] = QueuePtr->Steps[QueuePtr->StepCount];
+        }
+    }
+}
@@ -0,0 +1,184 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Health and Safety (HS) Message Action queue
+ *
+ * Message Actions fired by the monitors are queued by MAT entry priority
+ * and sent at the end of the HS cycle, limited by a token bucket so a
+ * cascade of failures can't flood the software bus. An entry with a
+ * NextAction starts a sequence; each following step waits out its delay
+ * across HS cycles and is then queued like any other action.
+ */
+#ifndef HS_MSGACTS_H
+#define HS_MSGACTS_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "hs_tbl.h"
+#include "hs_platform_cfg.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Token bucket units per Message Action
+ */
+#define HS_MSG_ACT_TOKEN_UNITS 1000
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief HS Message Action Sequence Step
+ */
+typedef struct
+{
+    CFE_TIME_SysTime_t DueTime;      /**< \brief MET the step is queued at */
+    uint16             MsgActsIndex; /**< \brief Message Actions table index of the step */
+    uint16             Spare;        /**< \brief Spare for alignment */
+} HS_MsgActStep_t;
+
+/**
+ *  \brief HS Message Action Queue
+ *
+ *  Entries are kept sorted with the least urgent first, so the next
+ *  action to send is always the last entry. Entries of equal priority
+ *  are sent in the order they were queued.
+ */
+typedef struct
+{
+    uint16 Entries[HS_MSG_ACT_QUEUE_DEPTH]; /**< \brief Queued Message Actions table indices */
+    uint32 Count;                           /**< \brief Number of valid entries in Entries */
+
+    HS_MsgActStep_t Steps[HS_MSG_ACT_MAX_PENDING_STEPS]; /**< \brief Sequence steps waiting for their delay */
+    uint32          StepCount;                           /**< \brief Number of valid entries in Steps */
+
+    uint32             Tokens;     /**< \brief Available sends, in #HS_MSG_ACT_TOKEN_UNITS */
+    CFE_TIME_SysTime_t LastRefill; /**< \brief MET the token bucket was last refilled */
+
+    uint32 QueuedCount;     /**< \brief Number of Message Actions queued */
+    uint32 SuppressedCount; /**< \brief Number of Message Actions dropped without being sent */
+} HS_MsgActQueue_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Initialize the Message Action queue
+ *
+ *  \par Description
+ *       Empties the queue and fills the token bucket.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_MsgActQueueInit(void);
+
+/**
+ * \brief Queue a Message Action
+ *
+ *  \par Description
+ *       Queues the Message Action behind any queued action of the same or
+ *       higher priority. If the queue is full, the least urgent action
+ *       (which may be the new one) is suppressed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       MsgActsIndex must be less than #HS_MAX_MSG_ACT_TYPES
+ *
+ *  \param [in] MsgActsIndex  Message Actions table index
+ */
+void HS_MsgActEnqueue(uint32 MsgActsIndex);
+
+/**
+ * \brief Send queued Message Actions
+ *
+ *  \par Description
+ *       Refills the token bucket, queues any sequence steps that are due
+ *       and sends queued Message Actions in priority order for as long as
+ *       there are tokens. Each sent action with a NextAction schedules the
+ *       next step of its sequence.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once at the end of each HS cycle.
+ */
+void HS_MsgActQueueDrain(void);
+
+/**
+ * \brief Drop all queued Message Actions
+ *
+ *  \par Description
+ *       Counts every queued Message Action and pending sequence step as
+ *       suppressed and empties the queue.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Used when the Message Actions table changes, since queued indices
+ *       refer to the old table.
+ */
+void HS_MsgActQueueFlush(void);
+
+/**
+ * \brief Refill the Message Action token bucket
+ *
+ *  \par Description
+ *       Adds #HS_MSG_ACT_RATE tokens per second of MET since the last
+ *       refill, up to #HS_MSG_ACT_BURST tokens.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_MsgActRefillTokens(void);
+
+/**
+ * \brief Schedule the next step of a Message Action sequence
+ *
+ *  \par Description
+ *       If the Message Action has a NextAction, holds it for NextDelay
+ *       before it is queued. If all step slots are in use the sequence
+ *       ends and the step is counted as suppressed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Delays are measured from the last token bucket refill.
+ *
+ *  \param [in] MsgActsIndex  Message Actions table index that was just sent
+ */
+void HS_MsgActScheduleNext(uint32 MsgActsIndex);
+
+/**
+ * \brief Queue Message Action sequence steps that are due
+ *
+ *  \par Description
+ *       Triggers every pending step whose delay has passed, the same
+ *       way a monitor triggers a Message Action. A step that can't be
+ *       triggered, because Message Actions or its entry are disabled
+ *       or its entry is cooling down, ends its sequence and is counted
+ *       as suppressed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Delays are measured against the last token bucket refill.
+ */
+void HS_MsgActStepsDue(void);
+
+#endif
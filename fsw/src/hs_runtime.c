@@ -0,0 +1,341 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to compile CFS Health and Safety (HS) tables into
+ *   double-buffered runtime structures
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "hs_app.h"
+#include "hs_runtime.h"
+#include "hs_tbldefs.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize the compiled table runtime                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_RuntimeInit(void)
+{
+    memset(HS_AppData.RuntimeBuf, 0, sizeof(HS_AppData.RuntimeBuf));
+
+    HS_AppData.RuntimeActiveMask = 0;
+    HS_AppData.RuntimeStagedMask = 0;
+
+    HS_RuntimeSetTablePtrs();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get a table's inactive runtime buffer for compiling             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+HS_RuntimeBuf_t *HS_RuntimeStage(uint8 TblFlag)
+{
+    HS_AppData.RuntimeStagedMask |= TblFlag;
+
+    return &HS_AppData.RuntimeBuf[(HS_AppData.RuntimeActiveMask & TblFlag) == 0];
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Activate the staged runtime buffers                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_RuntimeSwap(void)
+{
+    if (HS_AppData.RuntimeStagedMask != 0)
+    {
+        HS_AppData.RuntimeActiveMask ^= HS_AppData.RuntimeStagedMask;
+        HS_AppData.RuntimeStagedMask = 0;
+
+        /*
+        ** Monitors only ever read the active compiled tables
+        */
+        HS_RuntimeSetTablePtrs();
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Point the HS table pointers at the active compiled tables       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_RuntimeSetTablePtrs(void)
+{
+    HS_AppData.AMTablePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_AMT)->AMTable;
+    HS_AppData.EMTablePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_EMT)->EMTable;
+    HS_AppData.MATablePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MAT)->MATable;
+    HS_AppData.XCTablePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_XCT)->XCTable;
+    HS_AppData.MMTablePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MMT)->MMTable;
+    HS_AppData.MFTablePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MFT)->MFTable;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile the Apps Monitor table                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_RuntimeCompileAMT(HS_RuntimeBuf_t *BufPtr, const HS_AMTEntry_t *TblPtr)
+{
+    uint32 TableIndex;
+
+    memcpy(BufPtr->AMTable, TblPtr, sizeof(BufPtr->AMTable));
+
+    /*
+    ** Identifies the table a saved monitor state belongs to
+    */
+    BufPtr->AMTCrc = CFE_ES_CalculateCRC(BufPtr->AMTable, sizeof(BufPtr->AMTable), 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+    /*
+    ** Only entries with an action need to be visited by the monitor
+    */
+    BufPtr->AMActiveCount = 0;
+
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++)
+    {
+        if (BufPtr->AMTable[TableIndex].ActionType != HS_AMT_ACT_NOACT)
+        {
+            BufPtr->AMActiveList[BufPtr->AMActiveCount] = TableIndex;
+            BufPtr->AMActiveCount++;
+        }
+    }
+
+    BufPtr->AMTCompiled = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile the Events Monitor table                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_RuntimeCompileEMT(HS_RuntimeBuf_t *BufPtr, const HS_EMTEntry_t *TblPtr)
+{
+    uint32 TableIndex;
+    uint32 Bucket;
+
+    memcpy(BufPtr->EMTable, TblPtr, sizeof(BufPtr->EMTable));
+
+    memset(BufPtr->EMHashHead, 0, sizeof(BufPtr->EMHashHead));
+    memset(BufPtr->EMHashNext, 0, sizeof(BufPtr->EMHashNext));
+    BufPtr->EMActiveCount = 0;
+
+    /*
+    ** Insert in reverse so each bucket chain is in table order
+    */
+    for (TableIndex = HS_MAX_MONITORED_EVENTS; TableIndex > 0; TableIndex--)
+    {
+        if (BufPtr->EMTable[TableIndex - 1].ActionType != HS_EMT_ACT_NOACT)
+        {
+            Bucket = HS_RUNTIME_EVENT_HASH(BufPtr->EMTable[TableIndex - 1].EventID);
+
+            BufPtr->EMHashNext[TableIndex - 1] = BufPtr->EMHashHead[Bucket];
+            BufPtr->EMHashHead[Bucket]         = TableIndex;
+            BufPtr->EMActiveCount++;
+        }
+    }
+
+    BufPtr->EMTCompiled = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile the Message Actions table                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_RuntimeCompileMAT(HS_RuntimeBuf_t *BufPtr, const HS_MATEntry_t *TblPtr)
+{
+    uint32 TableIndex;
+    uint32 DelayMsec;
+
+    memcpy(BufPtr->MATable, TblPtr, sizeof(BufPtr->MATable));
+
+    BufPtr->MATCrc = CFE_ES_CalculateCRC(BufPtr->MATable, sizeof(BufPtr->MATable), 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+    /*
+    ** Sequence steps are scheduled as a time offset
+    */
+    for (TableIndex = 0; TableIndex < HS_MAX_MSG_ACT_TYPES; TableIndex++)
+    {
+        DelayMsec = (uint32)BufPtr->MATable[TableIndex].NextDelay * HS_MSG_ACT_COOLDOWN_MSEC;
+
+        BufPtr->MANextDelay[TableIndex].Seconds    = DelayMsec / 1000;
+        BufPtr->MANextDelay[TableIndex].Subseconds = CFE_TIME_Micro2SubSecs((DelayMsec % 1000) * 1000);
+    }
+
+    BufPtr->MATCompiled = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile the Execution Counters table                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_RuntimeCompileXCT(HS_RuntimeBuf_t *BufPtr, const HS_XCTEntry_t *TblPtr)
+{
+    uint32 TableIndex;
+
+    memcpy(BufPtr->XCTable, TblPtr, sizeof(BufPtr->XCTable));
+
+    /*
+    ** Resources that don't exist yet are resolved again when they are read
+    */
+    for (TableIndex = 0; TableIndex < HS_MAX_EXEC_CNT_SLOTS; TableIndex++)
+    {
+        HS_RuntimeResolveXC(BufPtr, TableIndex);
+    }
+
+    BufPtr->XCTCompiled = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile the Memory Monitor table                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_RuntimeCompileMMT(HS_RuntimeBuf_t *BufPtr, const HS_MMTEntry_t *TblPtr)
+{
+    uint32 TableIndex;
+
+    memcpy(BufPtr->MMTable, TblPtr, sizeof(BufPtr->MMTable));
+
+    /*
+    ** Only entries in use need to be visited by the monitor
+    */
+    BufPtr->MMActiveCount = 0;
+
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_MEM; TableIndex++)
+    {
+        BufPtr->MMPoolId[TableIndex] = CFE_ES_MEMHANDLE_UNDEFINED;
+
+        if (BufPtr->MMTable[TableIndex].ResourceType == HS_MMT_TYPE_NOTYPE)
+        {
+            continue;
+        }
+
+        /*
+        ** Pools that aren't registered yet are resolved when they are
+        */
+        if (BufPtr->MMTable[TableIndex].ResourceType == HS_MMT_TYPE_POOL)
+        {
+            HS_RuntimeResolveMM(BufPtr, TableIndex);
+        }
+
+        BufPtr->MMActiveList[BufPtr->MMActiveCount] = TableIndex;
+        BufPtr->MMActiveCount++;
+    }
+
+    BufPtr->MMTCompiled = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile the Message Freshness table                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_RuntimeCompileMFT(HS_RuntimeBuf_t *BufPtr, const HS_MFTEntry_t *TblPtr)
+{
+    uint32 TableIndex;
+    uint32 Bucket;
+
+    memcpy(BufPtr->MFTable, TblPtr, sizeof(BufPtr->MFTable));
+
+    memset(BufPtr->MFHashHead, 0, sizeof(BufPtr->MFHashHead));
+    memset(BufPtr->MFHashNext, 0, sizeof(BufPtr->MFHashNext));
+    BufPtr->MFActiveCount = 0;
+
+    /*
+    ** Insert in reverse so each bucket chain is in table order
+    */
+    for (TableIndex = HS_MAX_MONITORED_MSGS; TableIndex > 0; TableIndex--)
+    {
+        if (BufPtr->MFTable[TableIndex - 1].MaxAgeMsec != 0)
+        {
+            Bucket = HS_RUNTIME_MSGID_HASH(BufPtr->MFTable[TableIndex - 1].MsgId);
+
+            BufPtr->MFHashNext[TableIndex - 1] = BufPtr->MFHashHead[Bucket];
+            BufPtr->MFHashHead[Bucket]         = TableIndex;
+            BufPtr->MFActiveCount++;
+        }
+    }
+
+    BufPtr->MFTCompiled = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Resolve an Execution Counters slot                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_RuntimeResolveXC(HS_RuntimeBuf_t *BufPtr, uint32 TableIndex)
+{
+    CFE_Status_t Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+
+    BufPtr->XCTaskId[TableIndex]    = CFE_ES_TASKID_UNDEFINED;
+    BufPtr->XCCounterId[TableIndex] = CFE_ES_COUNTERID_UNDEFINED;
+
+    switch (BufPtr->XCTable[TableIndex].ResourceType)
+    {
+        case HS_XCT_TYPE_APP_MAIN:
+        case HS_XCT_TYPE_APP_CHILD:
+            Status = CFE_ES_GetTaskIDByName(&BufPtr->XCTaskId[TableIndex], BufPtr->XCTable[TableIndex].ResourceName);
+            break;
+        case HS_XCT_TYPE_DEVICE:
+        case HS_XCT_TYPE_ISR:
+            Status = CFE_ES_GetGenCounterIDByName(&BufPtr->XCCounterId[TableIndex],
+                                                  BufPtr->XCTable[TableIndex].ResourceName);
+            break;
+        default:
+            break;
+    }
+
+    return (Status == CFE_SUCCESS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Resolve a Memory Monitor entry                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_RuntimeResolveMM(HS_RuntimeBuf_t *BufPtr, uint32 TableIndex)
+{
+    const HS_MMTEntry_t *EntryPtr = &BufPtr->MMTable[TableIndex];
+    uint32               RegIndex;
+
+    BufPtr->MMPoolId[TableIndex] = CFE_ES_MEMHANDLE_UNDEFINED;
+
+    for (RegIndex = 0; RegIndex < HS_MAX_REGISTERED_POOLS; RegIndex++)
+    {
+        if ((HS_AppData.PoolReg[RegIndex].AppName[0] != '\0') &&
+            (HS_AppData.PoolReg[RegIndex].PoolIndex == EntryPtr->PoolIndex) &&
+            (strncmp(HS_AppData.PoolReg[RegIndex].AppName, EntryPtr->AppName, sizeof(EntryPtr->AppName)) == 0))
+        {
+            BufPtr->MMPoolId[TableIndex] = HS_AppData.PoolReg[RegIndex].PoolHandle;
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,313 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Health and Safety (HS) compiled table
+ *   runtime structures
+ *
+ * Each table update is compiled into the inactive one of two runtime
+ * buffers. The buffers are swapped at the start of an HS cycle so the
+ * monitors only ever see one consistent, compiled view of the tables.
+ *
+ * Each table has its own active buffer, so an update only compiles that
+ * one table and nothing is carried over between the buffers. The cost is
+ * RAM: every table is held twice, along with its compiled indices.
+ */
+#ifndef HS_RUNTIME_H
+#define HS_RUNTIME_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "hs_tbl.h"
+#include "hs_platform_cfg.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Number of compiled runtime buffers (active and inactive)
+ */
+#define HS_RUNTIME_NUM_BUFS 2
+
+/**
+ * \brief Active runtime buffer of a table
+ *
+ * Selected by the table's #HS_TBL_NOTIFY_AMT style flag
+ */
+#define HS_RUNTIME_ACTIVE_BUF(TblFlag) (&HS_AppData.RuntimeBuf[(HS_AppData.RuntimeActiveMask & (TblFlag)) != 0])
+
+/**
+ * \brief Event Monitor hash bucket for an event ID
+ */
+#define HS_RUNTIME_EVENT_HASH(EventID) ((uint32)(EventID) & (HS_EVENTMON_HASH_BUCKETS - 1))
+
+/**
+ * \brief Message Monitor hash bucket for a message ID
+ */
+#define HS_RUNTIME_MSGID_HASH(MsgId) ((uint32)CFE_SB_MsgIdToValue(MsgId) & (HS_MSGMON_HASH_BUCKETS - 1))
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief HS Compiled Table Runtime Buffer
+ *
+ *  Hash chain links store the table index plus one, so a zeroed buffer
+ *  is a valid empty index.
+ */
+typedef struct
+{
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];   /**< \brief Compiled copy of the Apps Monitor table */
+    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS]; /**< \brief Compiled copy of the Events Monitor table */
+    HS_MATEntry_t MATable[HS_MAX_MSG_ACT_TYPES];    /**< \brief Compiled copy of the Message Actions table */
+    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];   /**< \brief Compiled copy of the Execution Counters table */
+    HS_MMTEntry_t MMTable[HS_MAX_MONITORED_MEM];    /**< \brief Compiled copy of the Memory Monitor table */
+    HS_MFTEntry_t MFTable[HS_MAX_MONITORED_MSGS];   /**< \brief Compiled copy of the Message Freshness table */
+
+    uint32 AMActiveList[HS_MAX_MONITORED_APPS]; /**< \brief AppMon table indices that have an action */
+    uint32 AMActiveCount;                       /**< \brief Number of valid entries in AMActiveList */
+
+    CFE_TIME_SysTime_t MANextDelay[HS_MAX_MSG_ACT_TYPES]; /**< \brief Delay before each MsgAct's next step */
+
+    CFE_ES_TaskId_t    XCTaskId[HS_MAX_EXEC_CNT_SLOTS];    /**< \brief Resolved task of each ExeCount slot */
+    CFE_ES_CounterId_t XCCounterId[HS_MAX_EXEC_CNT_SLOTS]; /**< \brief Resolved counter of each ExeCount slot */
+
+    uint32             MMActiveList[HS_MAX_MONITORED_MEM]; /**< \brief MemMon table indices in use */
+    uint32             MMActiveCount;                      /**< \brief Number of valid entries in MMActiveList */
+    CFE_ES_MemHandle_t MMPoolId[HS_MAX_MONITORED_MEM];     /**< \brief Registered pool of each MemMon entry */
+
+    uint32 EMHashHead[HS_EVENTMON_HASH_BUCKETS]; /**< \brief First EventMon link per event ID hash bucket */
+    uint32 EMHashNext[HS_MAX_MONITORED_EVENTS];  /**< \brief Next EventMon link in the same hash bucket */
+    uint32 EMActiveCount;                        /**< \brief Number of EventMon entries in the hash index */
+
+    uint32 MFHashHead[HS_MSGMON_HASH_BUCKETS]; /**< \brief First MsgMon link per message ID hash bucket */
+    uint32 MFHashNext[HS_MAX_MONITORED_MSGS];  /**< \brief Next MsgMon link in the same hash bucket */
+    uint32 MFActiveCount;                      /**< \brief Number of MsgMon entries in the hash index */
+
+    uint32 AMTCrc; /**< \brief CRC of the compiled Apps Monitor table */
+    uint32 MATCrc; /**< \brief CRC of the compiled Message Actions table */
+
+    uint8 AMTCompiled; /**< \brief Apps Monitor table has been compiled into this buffer */
+    uint8 EMTCompiled; /**< \brief Events Monitor table has been compiled into this buffer */
+    uint8 MATCompiled; /**< \brief Message Actions table has been compiled into this buffer */
+    uint8 XCTCompiled; /**< \brief Execution Counters table has been compiled into this buffer */
+    uint8 MMTCompiled; /**< \brief Memory Monitor table has been compiled into this buffer */
+    uint8 MFTCompiled; /**< \brief Message Freshness table has been compiled into this buffer */
+} HS_RuntimeBuf_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Initialize the compiled table runtime
+ *
+ *  \par Description
+ *       Clears both runtime buffers, selects the first as active for
+ *       every table and points the HS table pointers at its (empty)
+ *       compiled tables.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_RuntimeInit(void);
+
+/**
+ * \brief Get the runtime buffer to compile a table update into
+ *
+ *  \par Description
+ *       Returns the table's inactive runtime buffer and marks the table
+ *       as staged. Only that table's part of the buffer may be written.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] TblFlag  Table flag (#HS_TBL_NOTIFY_AMT style)
+ *
+ *  \return Pointer to the table's inactive runtime buffer
+ */
+HS_RuntimeBuf_t *HS_RuntimeStage(uint8 TblFlag);
+
+/**
+ * \brief Make the staged runtime buffers active
+ *
+ *  \par Description
+ *       Swaps the active and inactive runtime buffers of every staged
+ *       table and points the HS table pointers at the newly active
+ *       compiled tables.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called between monitoring cycles.
+ */
+void HS_RuntimeSwap(void);
+
+/**
+ * \brief Point the HS table pointers at the active compiled tables
+ *
+ *  \par Description
+ *       Sets each HS table pointer from that table's active runtime
+ *       buffer.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_RuntimeSetTablePtrs(void);
+
+/**
+ * \brief Compile the Apps Monitor table
+ *
+ *  \par Description
+ *       Copies the table into the runtime buffer and builds the dense
+ *       list of entries that have an action.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] BufPtr  Runtime buffer to compile into
+ *  \param [in] TblPtr  Apps Monitor table data
+ */
+void HS_RuntimeCompileAMT(HS_RuntimeBuf_t *BufPtr, const HS_AMTEntry_t *TblPtr);
+
+/**
+ * \brief Compile the Events Monitor table
+ *
+ *  \par Description
+ *       Copies the table into the runtime buffer and builds the event
+ *       ID hash index over entries that have an action. Entries that
+ *       share a bucket are chained in table order.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] BufPtr  Runtime buffer to compile into
+ *  \param [in] TblPtr  Events Monitor table data
+ */
+void HS_RuntimeCompileEMT(HS_RuntimeBuf_t *BufPtr, const HS_EMTEntry_t *TblPtr);
+
+/**
+ * \brief Compile the Message Actions table
+ *
+ *  \par Description
+ *       Copies the table into the runtime buffer and converts the delay
+ *       before each entry's next sequence step to a time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] BufPtr  Runtime buffer to compile into
+ *  \param [in] TblPtr  Message Actions table data
+ */
+void HS_RuntimeCompileMAT(HS_RuntimeBuf_t *BufPtr, const HS_MATEntry_t *TblPtr);
+
+/**
+ * \brief Compile the Execution Counters table
+ *
+ *  \par Description
+ *       Copies the table into the runtime buffer and resolves the task
+ *       or counter of each slot, so housekeeping does not have to look
+ *       them up by name.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] BufPtr  Runtime buffer to compile into
+ *  \param [in] TblPtr  Execution Counters table data
+ */
+void HS_RuntimeCompileXCT(HS_RuntimeBuf_t *BufPtr, const HS_XCTEntry_t *TblPtr);
+
+/**
+ * \brief Compile the Memory Monitor table
+ *
+ *  \par Description
+ *       Copies the table into the runtime buffer, builds the dense list
+ *       of entries in use and resolves the pool each entry watches.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] BufPtr  Runtime buffer to compile into
+ *  \param [in] TblPtr  Memory Monitor table data
+ */
+void HS_RuntimeCompileMMT(HS_RuntimeBuf_t *BufPtr, const HS_MMTEntry_t *TblPtr);
+
+/**
+ * \brief Compile the Message Freshness table
+ *
+ *  \par Description
+ *       Copies the table into the runtime buffer and builds the message
+ *       ID hash index of the entries in use.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] BufPtr  Runtime buffer to compile into
+ *  \param [in] TblPtr  Message Freshness table data
+ */
+void HS_RuntimeCompileMFT(HS_RuntimeBuf_t *BufPtr, const HS_MFTEntry_t *TblPtr);
+
+/**
+ * \brief Resolve an Execution Counters slot
+ *
+ *  \par Description
+ *       Looks up the task or counter named by the slot and caches its
+ *       ID in the runtime buffer. The cache is cleared if it is not
+ *       found.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called again when a cached ID goes stale, for example after the
+ *       task is restarted or if it did not exist when the table was
+ *       compiled.
+ *
+ *  \param [in] BufPtr      Runtime buffer holding the compiled table
+ *  \param [in] TableIndex  Execution Counters table index
+ *
+ *  \return Execution status
+ *  \retval true   The slot resolved
+ *  \retval false  The slot did not resolve
+ */
+bool HS_RuntimeResolveXC(HS_RuntimeBuf_t *BufPtr, uint32 TableIndex);
+
+/**
+ * \brief Resolve a Memory Monitor entry
+ *
+ *  \par Description
+ *       Looks up the pool registered under the application name and
+ *       index of the entry and caches its handle in the runtime buffer.
+ *       The cache is cleared if no pool is registered under them.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called again for every pool entry when a pool is registered, so
+ *       an entry picks up a pool registered after the table was compiled
+ *       or registered again with a new handle.
+ *
+ *  \param [in] BufPtr      Runtime buffer holding the compiled table
+ *  \param [in] TableIndex  Memory Monitor table index
+ *
+ *  \return Execution status
+ *  \retval true   The entry resolved
+ *  \retval false  The entry did not resolve
+ */
+bool HS_RuntimeResolveMM(HS_RuntimeBuf_t *BufPtr, uint32 TableIndex);
+
+#endif
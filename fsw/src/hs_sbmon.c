@@ -0,0 +1,338 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used for the CFS Health and Safety (HS) software bus monitor
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "hs_app.h"
+#include "hs_sbmon.h"
+#include "hs_monitors.h"
+#include "hs_msgacts.h"
+#include "hs_tbldefs.h"
+#include "hs_eventids.h"
+#include "cfe_msgids.h"
+
+#include <string.h>
+
+/************************************************************************
+** Exported Data
+*************************************************************************/
+const char *const HS_SbMonPipeNames[] = HS_SBMON_PIPE_NAMES;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize the software bus monitor                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HS_SbMonInit(void)
+{
+    HS_SbMon_t * SbMonPtr = &HS_AppData.SbMon;
+    CFE_Status_t Status;
+
+    memset(SbMonPtr, 0, sizeof(*SbMonPtr));
+
+    Status = CFE_SB_CreatePipe(&SbMonPtr->Pipe, HS_SBMON_PIPE_DEPTH, HS_SBMON_PIPE_NAME);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_CR_SBMON_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Creating SB Monitor Pipe,RC=0x%08X", (unsigned int)Status);
+        return Status;
+    }
+
+    Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID), SbMonPtr->Pipe);
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(CFE_SB_HK_TLM_MID), SbMonPtr->Pipe);
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_SUB_SBMON_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Subscribing to SB Telemetry,RC=0x%08X", (unsigned int)Status);
+        CFE_SB_DeletePipe(SbMonPtr->Pipe);
+        return Status;
+    }
+
+    CFE_MSG_Init(CFE_MSG_PTR(SbMonPtr->StatsCmd.CommandHeader), CFE_SB_ValueToMsgId(CFE_SB_CMD_MID),
+                 sizeof(SbMonPtr->StatsCmd));
+    CFE_MSG_SetFcnCode(CFE_MSG_PTR(SbMonPtr->StatsCmd.CommandHeader), CFE_SB_SEND_SB_STATS_CC);
+
+    SbMonPtr->PipeNames = HS_SbMonPipeNames;
+    SbMonPtr->State     = HS_STATE_ENABLED;
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run the software bus monitor for one cycle                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SbMonCycle(void)
+{
+    HS_SbMon_t *     SbMonPtr  = &HS_AppData.SbMon;
+    CFE_SB_Buffer_t *BufPtr    = NULL;
+    CFE_SB_MsgId_t   MessageID = CFE_SB_INVALID_MSG_ID;
+    size_t           Size      = 0;
+    uint32           MsgCount;
+
+    /*
+    ** The pipe only ever holds the replies to a few requests, so it can be
+    ** emptied every cycle
+    */
+    for (MsgCount = 0; MsgCount < HS_SBMON_PIPE_DEPTH; MsgCount++)
+    {
+        if ((CFE_SB_ReceiveBuffer(&BufPtr, SbMonPtr->Pipe, CFE_SB_POLL) != CFE_SUCCESS) || (BufPtr == NULL))
+        {
+            break;
+        }
+
+        CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+        CFE_MSG_GetSize(&BufPtr->Msg, &Size);
+
+        if ((CFE_SB_MsgIdToValue(MessageID) == CFE_SB_STATS_TLM_MID) && (Size >= sizeof(CFE_SB_StatsTlm_t)))
+        {
+            HS_SbMonProcessStats((const CFE_SB_StatsTlm_t *)BufPtr);
+        }
+        else if ((CFE_SB_MsgIdToValue(MessageID) == CFE_SB_HK_TLM_MID) &&
+                 (Size >= sizeof(CFE_SB_HousekeepingTlm_t)))
+        {
+            HS_SbMonProcessHk((const CFE_SB_HousekeepingTlm_t *)BufPtr);
+        }
+    }
+
+    if (SbMonPtr->CycleCounter == 0)
+    {
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(SbMonPtr->StatsCmd.CommandHeader), true);
+        SbMonPtr->CycleCounter = HS_SBMON_CYCLES_PER_SAMPLE;
+    }
+    --SbMonPtr->CycleCounter;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process SB statistics                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SbMonProcessStats(const CFE_SB_StatsTlm_t *StatsPtr)
+{
+    HS_SbMon_t *                   SbMonPtr   = &HS_AppData.SbMon;
+    HS_SbMonTlm_Payload_t *        PayloadPtr = &HS_AppData.SbMonPkt.Payload;
+    const CFE_SB_PipeDepthStats_t *DepthPtr   = NULL;
+    CFE_SB_PipeId_t                PipeId;
+    uint32                         PipeIndex;
+    uint32                         StatsIndex = 0;
+
+    for (PipeIndex = 0; PipeIndex < HS_SBMON_MAX_PIPES; PipeIndex++)
+    {
+        DepthPtr = NULL;
+
+        if (SbMonPtr->PipeNames[0] == NULL)
+        {
+            /*
+            ** Every pipe in use, in the order SB reports them
+            */
+            while ((DepthPtr == NULL) && (StatsIndex < CFE_MISSION_SB_MAX_PIPES))
+            {
+                if (StatsPtr->Payload.PipeDepthStats[StatsIndex].MaxQueueDepth != 0)
+                {
+                    DepthPtr = &StatsPtr->Payload.PipeDepthStats[StatsIndex];
+                }
+                StatsIndex++;
+            }
+        }
+        else if (SbMonPtr->PipeNames[PipeIndex] == NULL)
+        {
+            /*
+            ** Past the end of the configured names
+            */
+            break;
+        }
+        else if (CFE_SB_GetPipeIdByName(&PipeId, SbMonPtr->PipeNames[PipeIndex]) == CFE_SUCCESS)
+        {
+            /*
+            ** Looked up every sample since the pipe may be created after HS starts
+            */
+            for (StatsIndex = 0; (DepthPtr == NULL) && (StatsIndex < CFE_MISSION_SB_MAX_PIPES); StatsIndex++)
+            {
+                if ((StatsPtr->Payload.PipeDepthStats[StatsIndex].MaxQueueDepth != 0) &&
+                    CFE_RESOURCEID_TEST_EQUAL(StatsPtr->Payload.PipeDepthStats[StatsIndex].PipeId, PipeId))
+                {
+                    DepthPtr = &StatsPtr->Payload.PipeDepthStats[StatsIndex];
+                }
+            }
+        }
+
+        HS_SbMonUpdatePipe(PipeIndex, DepthPtr);
+    }
+
+    PayloadPtr->PipeCount = 0;
+    PayloadPtr->FullCount = 0;
+
+    for (PipeIndex = 0; PipeIndex < HS_SBMON_MAX_PIPES; PipeIndex++)
+    {
+        if (PayloadPtr->Pipes[PipeIndex].MaxDepth != 0)
+        {
+            PayloadPtr->PipeCount++;
+        }
+
+        if (SbMonPtr->Pipes[PipeIndex].FullCount != 0)
+        {
+            PayloadPtr->FullCount++;
+        }
+    }
+
+    PayloadPtr->SampleCount++;
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(HS_AppData.SbMonPkt.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(HS_AppData.SbMonPkt.TelemetryHeader), true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process SB housekeeping telemetry                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SbMonProcessHk(const CFE_SB_HousekeepingTlm_t *HkPtr)
+{
+    HS_SbMon_t *           SbMonPtr   = &HS_AppData.SbMon;
+    HS_SbMonTlm_Payload_t *PayloadPtr = &HS_AppData.SbMonPkt.Payload;
+
+    /*
+    ** The SB counters are 16 bits, so only their differences are added up
+    */
+    if (SbMonPtr->HkReceived)
+    {
+        PayloadPtr->OverflowCount += (uint16)(HkPtr->Payload.PipeOverflowErrorCounter - SbMonPtr->LastOverflowCount);
+        PayloadPtr->MsgLimitCount += (uint16)(HkPtr->Payload.MsgLimitErrorCounter - SbMonPtr->LastMsgLimitCount);
+    }
+
+    SbMonPtr->LastOverflowCount = HkPtr->Payload.PipeOverflowErrorCounter;
+    SbMonPtr->LastMsgLimitCount = HkPtr->Payload.MsgLimitErrorCounter;
+    SbMonPtr->HkReceived        = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Update one monitored pipe                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SbMonUpdatePipe(uint32 PipeIndex, const CFE_SB_PipeDepthStats_t *DepthPtr)
+{
+    HS_SbMonPipe_t *   PipePtr      = &HS_AppData.SbMon.Pipes[PipeIndex];
+    HS_SbMonPipeTlm_t *TlmPtr       = &HS_AppData.SbMonPkt.Payload.Pipes[PipeIndex];
+    uint16             ActionType   = HS_SBMON_ACTION_TYPE;
+    uint32             MsgActsIndex = 0;
+    char               PipeName[OS_MAX_API_NAME];
+
+    if (DepthPtr == NULL)
+    {
+        memset(PipePtr, 0, sizeof(*PipePtr));
+        memset(TlmPtr, 0, sizeof(*TlmPtr));
+        return;
+    }
+
+    /*
+    ** A different pipe in the entry starts over, with no growth yet
+    */
+    if (!CFE_RESOURCEID_TEST_EQUAL(PipePtr->PipeId, DepthPtr->PipeId))
+    {
+        PipePtr->PipeId    = DepthPtr->PipeId;
+        PipePtr->LastDepth = DepthPtr->CurrentQueueDepth;
+        PipePtr->FullCount = 0;
+    }
+
+    TlmPtr->PipeId       = CFE_RESOURCEID_TO_ULONG(DepthPtr->PipeId);
+    TlmPtr->CurrentDepth = DepthPtr->CurrentQueueDepth;
+    TlmPtr->PeakDepth    = DepthPtr->PeakQueueDepth;
+    TlmPtr->MaxDepth     = DepthPtr->MaxQueueDepth;
+    TlmPtr->DepthGrowth  = (int16)((int32)DepthPtr->CurrentQueueDepth - (int32)PipePtr->LastDepth);
+
+    PipePtr->LastDepth = DepthPtr->CurrentQueueDepth;
+
+    if (((uint32)DepthPtr->CurrentQueueDepth * 100) < ((uint32)HS_SBMON_FULL_PCT * DepthPtr->MaxQueueDepth))
+    {
+        PipePtr->FullCount = 0;
+        return;
+    }
+
+    if (PipePtr->FullCount < HS_SBMON_FULL_SAMPLES)
+    {
+        PipePtr->FullCount++;
+    }
+
+    /*
+    ** Only act once until the pipe drains
+    */
+    if (PipePtr->FullCount != HS_SBMON_FULL_SAMPLES)
+    {
+        return;
+    }
+
+    PipePtr->FullCount++;
+
+    if (CFE_SB_GetPipeName(PipeName, sizeof(PipeName), DepthPtr->PipeId) != CFE_SUCCESS)
+    {
+        strncpy(PipeName, "Unknown", sizeof(PipeName));
+    }
+
+    switch (ActionType)
+    {
+        case HS_SBMON_ACT_NOACT:
+            break;
+
+        case HS_SBMON_ACT_EVENT:
+            CFE_EVS_SendEvent(HS_SBMON_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB Monitor: Pipe %s: Depth %u of %u for %u samples: Action: Event Only", PipeName,
+                              (unsigned int)DepthPtr->CurrentQueueDepth, (unsigned int)DepthPtr->MaxQueueDepth,
+                              (unsigned int)HS_SBMON_FULL_SAMPLES);
+            break;
+
+        /*
+        ** Message Action types processing (invalid will be skipped)
+        */
+        default:
+
+            /* Calculate the requested message action index */
+            MsgActsIndex = ActionType - HS_SBMON_ACT_LAST_NONMSG - 1;
+
+            /*
+            ** Queue the message if this Message Action can be triggered
+            */
+            if (HS_MsgActTrigger(MsgActsIndex))
+            {
+                if (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT)
+                {
+                    CFE_EVS_SendEvent(HS_SBMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "SB Monitor: Pipe %s: Depth %u of %u for %u samples: "
+                                      "Action: Message Action Index: %d",
+                                      PipeName, (unsigned int)DepthPtr->CurrentQueueDepth,
+                                      (unsigned int)DepthPtr->MaxQueueDepth, (unsigned int)HS_SBMON_FULL_SAMPLES,
+                                      (int)MsgActsIndex);
+                }
+            }
+
+            break;
+    }
+}
@@ -0,0 +1,163 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Health and Safety (HS) software bus monitor
+ *
+ * Every few cycles HS asks SB for its statistics and reports the depth of
+ * each monitored pipe and how fast it is growing, so a consumer falling
+ * behind is seen before its pipe overflows. SB housekeeping telemetry adds
+ * the messages dropped since HS started; SB only counts those for all
+ * pipes together.
+ */
+#ifndef HS_SBMON_H
+#define HS_SBMON_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "cfe_sb_msg.h"
+#include "hs_msg.h"
+#include "hs_platform_cfg.h"
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief Software bus monitor state of one pipe entry
+ */
+typedef struct
+{
+    CFE_SB_PipeId_t PipeId;    /**< \brief Pipe in the entry at the last sample */
+    uint16          LastDepth; /**< \brief Depth of the pipe at the last sample */
+    uint16          FullCount; /**< \brief Samples in a row the pipe has been near full */
+} HS_SbMonPipe_t;
+
+/**
+ *  \brief Software bus monitor state
+ */
+typedef struct
+{
+    uint32          State;        /**< \brief Whether SB pipes are monitored */
+    CFE_SB_PipeId_t Pipe;         /**< \brief Pipe SB statistics and housekeeping are received on */
+    uint32          CycleCounter; /**< \brief Cycles until the next statistics request */
+
+    const char *const *PipeNames; /**< \brief NULL terminated names of the monitored pipes, all if empty */
+
+    CFE_SB_SendSbStatsCmd_t StatsCmd; /**< \brief SB statistics request */
+
+    HS_SbMonPipe_t Pipes[HS_SBMON_MAX_PIPES]; /**< \brief State of each pipe entry */
+
+    bool   HkReceived;        /**< \brief SB housekeeping telemetry has been received */
+    uint16 LastOverflowCount; /**< \brief SB pipe overflow counter in the last SB housekeeping */
+    uint16 LastMsgLimitCount; /**< \brief SB message limit counter in the last SB housekeeping */
+} HS_SbMon_t;
+
+/*************************************************************************
+ * Exported Data
+ ************************************************************************/
+
+/**
+ * \brief Names of the monitored pipes, from #HS_SBMON_PIPE_NAMES
+ */
+extern const char *const HS_SbMonPipeNames[];
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Initialize the software bus monitor
+ *
+ *  \par Description
+ *       Creates the pipe SB statistics and housekeeping telemetry are
+ *       received on, subscribes to them and builds the statistics request.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called from HS_SbInit()
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t HS_SbMonInit(void);
+
+/**
+ * \brief Run the software bus monitor for one cycle
+ *
+ *  \par Description
+ *       Processes the SB telemetry received since the previous cycle, then
+ *       requests SB statistics every #HS_SBMON_CYCLES_PER_SAMPLE cycles.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       SB answers the request on its own task, so the statistics are
+ *       usually processed on the next cycle.
+ */
+void HS_SbMonCycle(void);
+
+/**
+ * \brief Process SB statistics
+ *
+ *  \par Description
+ *       Updates each monitored pipe from the pipe depths SB reported,
+ *       takes #HS_SBMON_ACTION_TYPE for pipes that stayed near full and
+ *       sends the SB monitor telemetry packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Without configured names the entries hold the pipes in the order
+ *       SB reports them, and an entry is reset when its pipe changes.
+ *
+ *  \param [in] StatsPtr  SB statistics telemetry
+ */
+void HS_SbMonProcessStats(const CFE_SB_StatsTlm_t *StatsPtr);
+
+/**
+ * \brief Process SB housekeeping telemetry
+ *
+ *  \par Description
+ *       Adds the messages SB dropped since the previous SB housekeeping
+ *       packet to the SB monitor telemetry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The first packet received only sets the starting counts.
+ *
+ *  \param [in] HkPtr  SB housekeeping telemetry
+ */
+void HS_SbMonProcessHk(const CFE_SB_HousekeepingTlm_t *HkPtr);
+
+/**
+ * \brief Update one monitored pipe
+ *
+ *  \par Description
+ *       Reports the depth of the pipe and its growth since the previous
+ *       sample, and takes #HS_SBMON_ACTION_TYPE once the pipe has been
+ *       near full for #HS_SBMON_FULL_SAMPLES samples.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The action is taken again only after the pipe has drained below
+ *       #HS_SBMON_FULL_PCT.
+ *
+ *  \param [in] PipeIndex  Monitored pipe entry
+ *  \param [in] DepthPtr   Depth statistics of the pipe, NULL to clear the entry
+ */
+void HS_SbMonUpdatePipe(uint32 PipeIndex, const CFE_SB_PipeDepthStats_t *DepthPtr);
+
+#endif
@@ -0,0 +1,329 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to save and restore the CFS Health and Safety (HS)
+ *   monitor state snapshot
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "hs_app.h"
+#include "hs_snapshot.h"
+#include "hs_eventids.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize the monitor state snapshot                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SnapshotInit(void)
+{
+    HS_Snapshot_t *      SnapshotPtr = &HS_AppData.Snapshot;
+    HS_SnapshotHeader_t *HeaderPtr;
+    char                 CDSName[CFE_MISSION_ES_CDS_MAX_NAME_LENGTH];
+    size_t               Size;
+    uint32               Section;
+    bool                 Existed                            = false;
+    bool                 Restored[HS_SNAPSHOT_NUM_SECTIONS] = {false};
+    bool                 RestoreAllowed                     = false;
+    CFE_ES_CounterId_t   BootCounterId;
+    CFE_Status_t         Status;
+
+    memset(SnapshotPtr, 0, sizeof(*SnapshotPtr));
+
+    SnapshotPtr->Countdown = HS_AppData.SnapshotPeriod;
+    SnapshotPtr->CDSState  = (HS_AppData.SnapshotPeriod != 0) ? HS_AppData.CDSState : HS_STATE_DISABLED;
+
+    /*
+    ** ES counters live in RAM, so they outlive a restart of HS but not a reset. Finding the
+    ** counter means HS was restarted and the monitored system kept running, which is the
+    ** only case where the saved state still describes it
+    */
+    if (SnapshotPtr->CDSState == HS_STATE_ENABLED)
+    {
+        if (CFE_ES_GetGenCounterIDByName(&BootCounterId, HS_SNAPSHOT_BOOT_COUNTER) == CFE_SUCCESS)
+        {
+            RestoreAllowed = true;
+        }
+        else
+        {
+            CFE_ES_RegisterGenCounter(&BootCounterId, HS_SNAPSHOT_BOOT_COUNTER);
+        }
+    }
+
+    for (Section = 0; (Section < HS_SNAPSHOT_NUM_SECTIONS) && (SnapshotPtr->CDSState == HS_STATE_ENABLED); Section++)
+    {
+        snprintf(CDSName, sizeof(CDSName), HS_SNAPSHOT_CDSNAME, (unsigned int)Section);
+
+        HeaderPtr = HS_SnapshotSection(Section, &Size);
+        Status    = CFE_ES_RegisterCDS(&SnapshotPtr->Handles[Section], Size, CDSName);
+
+        if (Status == CFE_ES_CDS_ALREADY_EXISTS)
+        {
+            Existed = true;
+
+            if (RestoreAllowed)
+            {
+                /*
+                ** Restoring is a straight copy, nothing has to be replayed
+                */
+                Status = CFE_ES_RestoreFromCDS(HeaderPtr, SnapshotPtr->Handles[Section]);
+
+                if ((Status == CFE_SUCCESS) && HS_SnapshotValid(Section))
+                {
+                    HS_SnapshotApply(Section);
+                    Restored[Section] = true;
+                }
+            }
+
+            Status = CFE_SUCCESS;
+        }
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(HS_SNAPSHOT_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Failed to create monitor snapshot CDS block %d (Err=0x%08x), snapshot not saved",
+                              (int)Section, (unsigned int)Status);
+
+            SnapshotPtr->CDSState = HS_STATE_DISABLED;
+        }
+    }
+
+    if (Existed)
+    {
+        CFE_EVS_SendEvent(HS_SNAPSHOT_RESTORE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Monitor snapshot restored from CDS: AppMon=%d CPU=%d MsgActs=%d",
+                          (int)Restored[HS_SNAPSHOT_APPMON], (int)Restored[HS_SNAPSHOT_UTIL],
+                          (int)Restored[HS_SNAPSHOT_MSGACT]);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Save the next monitor state snapshot section when due           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SnapshotSave(void)
+{
+    HS_Snapshot_t *      SnapshotPtr = &HS_AppData.Snapshot;
+    HS_SnapshotHeader_t *HeaderPtr;
+    size_t               Size;
+
+    if (SnapshotPtr->CDSState != HS_STATE_ENABLED)
+    {
+        return;
+    }
+
+    SnapshotPtr->Countdown--;
+
+    if (SnapshotPtr->Countdown == 0)
+    {
+        /*
+        ** Only one section is written per period to keep each cycle's CDS write small
+        */
+        HS_SnapshotCapture(SnapshotPtr->NextSection);
+
+        HeaderPtr            = HS_SnapshotSection(SnapshotPtr->NextSection, &Size);
+        HeaderPtr->TableCrc  = HS_SnapshotTableCrc(SnapshotPtr->NextSection);
+        HeaderPtr->SavedTime = CFE_TIME_GetMET();
+        HeaderPtr->Crc       = HS_SnapshotCrc(HeaderPtr, Size);
+
+        CFE_ES_CopyToCDS(SnapshotPtr->Handles[SnapshotPtr->NextSection], HeaderPtr);
+
+        SnapshotPtr->NextSection = (SnapshotPtr->NextSection + 1) % HS_SNAPSHOT_NUM_SECTIONS;
+        SnapshotPtr->Countdown   = HS_AppData.SnapshotPeriod;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get a snapshot section and its size                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+HS_SnapshotHeader_t *HS_SnapshotSection(uint32 Section, size_t *SizePtr)
+{
+    HS_SnapshotHeader_t *HeaderPtr;
+
+    switch (Section)
+    {
+        case HS_SNAPSHOT_APPMON:
+            HeaderPtr = &HS_AppData.Snapshot.AppMon.Header;
+            *SizePtr  = sizeof(HS_AppData.Snapshot.AppMon);
+            break;
+
+        case HS_SNAPSHOT_UTIL:
+            HeaderPtr = &HS_AppData.Snapshot.Util.Header;
+            *SizePtr  = sizeof(HS_AppData.Snapshot.Util);
+            break;
+
+        default:
+            HeaderPtr = &HS_AppData.Snapshot.MsgAct.Header;
+            *SizePtr  = sizeof(HS_AppData.Snapshot.MsgAct);
+            break;
+    }
+
+    return HeaderPtr;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the CRC of the table a snapshot section belongs to          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_SnapshotTableCrc(uint32 Section)
+{
+    uint32 TableCrc = 0;
+
+    if (Section == HS_SNAPSHOT_APPMON)
+    {
+        TableCrc = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_AMT)->AMTCrc;
+    }
+    else if (Section == HS_SNAPSHOT_MSGACT)
+    {
+        TableCrc = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MAT)->MATCrc;
+    }
+
+    return TableCrc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute the CRC of a snapshot section                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_SnapshotCrc(const HS_SnapshotHeader_t *HeaderPtr, size_t Size)
+{
+    const uint8 *DataPtr = (const uint8 *)HeaderPtr + sizeof(HeaderPtr->Crc);
+
+    return CFE_ES_CalculateCRC(DataPtr, Size - sizeof(HeaderPtr->Crc), 0, CFE_MISSION_ES_DEFAULT_CRC);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy the monitor state into a snapshot section                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SnapshotCapture(uint32 Section)
+{
+    HS_Snapshot_t *SnapshotPtr = &HS_AppData.Snapshot;
+
+    switch (Section)
+    {
+        case HS_SNAPSHOT_APPMON:
+            memcpy(SnapshotPtr->AppMon.AppMonState, HS_AppData.AppMonState, sizeof(HS_AppData.AppMonState));
+            memcpy(SnapshotPtr->AppMon.AppMonEnables, HS_AppData.AppMonEnables, sizeof(HS_AppData.AppMonEnables));
+            break;
+
+        case HS_SNAPSHOT_UTIL:
+            memcpy(SnapshotPtr->Util.UtilizationTracker, HS_AppData.UtilizationTracker,
+                   sizeof(HS_AppData.UtilizationTracker));
+            SnapshotPtr->Util.CurrentCPUUtilIndex     = HS_AppData.CurrentCPUUtilIndex;
+            SnapshotPtr->Util.UtilCpuAvg              = HS_AppData.UtilCpuAvg;
+            SnapshotPtr->Util.UtilCpuPeak             = HS_AppData.UtilCpuPeak;
+            SnapshotPtr->Util.CurrentCPUHoggingTime   = HS_AppData.CurrentCPUHoggingTime;
+            SnapshotPtr->Util.UtilizationCycleCounter = HS_AppData.UtilizationCycleCounter;
+            break;
+
+        default:
+            memcpy(SnapshotPtr->MsgAct.MsgActReadyTime, HS_AppData.MsgActReadyTime,
+                   sizeof(HS_AppData.MsgActReadyTime));
+            break;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy a restored snapshot section into the monitor state         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SnapshotApply(uint32 Section)
+{
+    const HS_Snapshot_t *SnapshotPtr = &HS_AppData.Snapshot;
+    uint32               TableIndex;
+
+    switch (Section)
+    {
+        case HS_SNAPSHOT_APPMON:
+            memcpy(HS_AppData.AppMonState, SnapshotPtr->AppMon.AppMonState, sizeof(HS_AppData.AppMonState));
+            memcpy(HS_AppData.AppMonEnables, SnapshotPtr->AppMon.AppMonEnables, sizeof(HS_AppData.AppMonEnables));
+
+            /*
+            ** The escalation ladder is written to the CDS on every climb, so it is
+            ** newer than any snapshot and stays the one source of the rung
+            */
+            for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++)
+            {
+                HS_AppData.AppMonState[TableIndex].EscalationRung   = HS_AppData.CDSLadders.Ladder[TableIndex].Rung;
+                HS_AppData.AppMonState[TableIndex].RecoveryCheckIns = 0;
+            }
+            break;
+
+        case HS_SNAPSHOT_UTIL:
+            memcpy(HS_AppData.UtilizationTracker, SnapshotPtr->Util.UtilizationTracker,
+                   sizeof(HS_AppData.UtilizationTracker));
+            HS_AppData.CurrentCPUUtilIndex     = SnapshotPtr->Util.CurrentCPUUtilIndex;
+            HS_AppData.UtilCpuAvg              = SnapshotPtr->Util.UtilCpuAvg;
+            HS_AppData.UtilCpuPeak             = SnapshotPtr->Util.UtilCpuPeak;
+            HS_AppData.CurrentCPUHoggingTime   = SnapshotPtr->Util.CurrentCPUHoggingTime;
+            HS_AppData.UtilizationCycleCounter = SnapshotPtr->Util.UtilizationCycleCounter;
+            break;
+
+        default:
+            memcpy(HS_AppData.MsgActReadyTime, SnapshotPtr->MsgAct.MsgActReadyTime,
+                   sizeof(HS_AppData.MsgActReadyTime));
+            break;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check a restored snapshot section                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_SnapshotValid(uint32 Section)
+{
+    const HS_SnapshotHeader_t *HeaderPtr;
+    CFE_TIME_SysTime_t         Age;
+    size_t                     Size;
+
+    HeaderPtr = HS_SnapshotSection(Section, &Size);
+
+    if (HeaderPtr->Crc != HS_SnapshotCrc(HeaderPtr, Size))
+    {
+        return false;
+    }
+
+    if (HeaderPtr->TableCrc != HS_SnapshotTableCrc(Section))
+    {
+        return false;
+    }
+
+    /*
+    ** A section saved "in the future" means MET was reset, which wraps to a huge age
+    */
+    Age = CFE_TIME_Subtract(CFE_TIME_GetMET(), HeaderPtr->SavedTime);
+
+    return (Age.Seconds < HS_SNAPSHOT_MAX_AGE);
+}
@@ -0,0 +1,244 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Health and Safety (HS) monitor state snapshot
+ *
+ * The monitor runtime state is saved to the Critical Data Store a section
+ * at a time, one section every #HS_SNAPSHOT_PERIOD cycles, and restored
+ * when HS starts so monitoring picks up where it left off instead of
+ * warming up again. Each section is its own CRC protected CDS block and
+ * records the table it belongs to, so a section is only restored over
+ * the same table.
+ */
+#ifndef HS_SNAPSHOT_H
+#define HS_SNAPSHOT_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "hs_msg.h"
+#include "hs_tbl.h"
+#include "hs_platform_cfg.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Format of the CDS block name of each snapshot section
+ */
+#define HS_SNAPSHOT_CDSNAME "HS_SNAP%u"
+
+/**
+ * \brief Name of the ES generic counter that marks HS as started since the last reset
+ */
+#define HS_SNAPSHOT_BOOT_COUNTER "HS_BOOT"
+
+/**
+ * \name HS Monitor State Snapshot Sections
+ * \{
+ */
+#define HS_SNAPSHOT_APPMON       0 /**< \brief AppMon countdowns and enables */
+#define HS_SNAPSHOT_UTIL         1 /**< \brief CPU utilization history */
+#define HS_SNAPSHOT_MSGACT       2 /**< \brief Message Action cooldowns */
+#define HS_SNAPSHOT_NUM_SECTIONS 3 /**< \brief Number of snapshot sections */
+/**\}*/
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief HS Monitor State Snapshot Section Header
+ */
+typedef struct
+{
+    uint32             Crc;       /**< \brief CRC of the rest of the section */
+    uint32             TableCrc;  /**< \brief CRC of the compiled table the state belongs to, 0 if none */
+    CFE_TIME_SysTime_t SavedTime; /**< \brief MET the section was saved */
+} HS_SnapshotHeader_t;
+
+/**
+ *  \brief HS AppMon Snapshot Section
+ */
+typedef struct
+{
+    HS_SnapshotHeader_t Header; /**< \brief Section header */
+
+    HS_AMSEntry_t AppMonState[HS_MAX_MONITORED_APPS]; /**< \brief AppMon runtime state */
+    uint32        AppMonEnables[((HS_MAX_MONITORED_APPS - 1) / HS_BITS_PER_APPMON_ENABLE) +
+                         1]; /**< \brief AppMon state by monitor */
+} HS_SnapshotAppMon_t;
+
+/**
+ *  \brief HS CPU Utilization Snapshot Section
+ */
+typedef struct
+{
+    HS_SnapshotHeader_t Header; /**< \brief Section header */
+
+    uint32 UtilizationTracker[HS_UTIL_PEAK_NUM_INTERVAL]; /**< \brief Utilization from previous intervals */
+    uint32 CurrentCPUUtilIndex;                           /**< \brief Current index into the Utilization Tracker */
+    uint32 UtilCpuAvg;                                    /**< \brief CPU Utilization Average */
+    uint32 UtilCpuPeak;                                   /**< \brief CPU Utilization Peak */
+    uint32 CurrentCPUHoggingTime;                         /**< \brief Count of hogging cycles */
+    uint32 UtilizationCycleCounter;                       /**< \brief Counter to run cpu utilization check */
+} HS_SnapshotUtil_t;
+
+/**
+ *  \brief HS Message Action Snapshot Section
+ */
+typedef struct
+{
+    HS_SnapshotHeader_t Header; /**< \brief Section header */
+
+    CFE_TIME_SysTime_t MsgActReadyTime[HS_MAX_MSG_ACT_TYPES]; /**< \brief MET when each Message Action is available */
+} HS_SnapshotMsgAct_t;
+
+/**
+ *  \brief HS Monitor State Snapshot
+ */
+typedef struct
+{
+    HS_SnapshotAppMon_t AppMon; /**< \brief AppMon section, as last saved or restored */
+    HS_SnapshotUtil_t   Util;   /**< \brief CPU utilization section, as last saved or restored */
+    HS_SnapshotMsgAct_t MsgAct; /**< \brief Message Action section, as last saved or restored */
+
+    CFE_ES_CDSHandle_t Handles[HS_SNAPSHOT_NUM_SECTIONS]; /**< \brief CDS block handle of each section */
+
+    uint16 Countdown;   /**< \brief Cycles until the next section is saved */
+    uint8  NextSection; /**< \brief Section saved next */
+    uint8  CDSState;    /**< \brief Status of saving the snapshot in the CDS */
+} HS_Snapshot_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Initialize the monitor state snapshot
+ *
+ *  \par Description
+ *       Registers the CDS block of each snapshot section and, when HS
+ *       itself was restarted, restores the sections left by the previous
+ *       run over the monitor state. A section is skipped if it fails its
+ *       CRC check, is older than #HS_SNAPSHOT_MAX_AGE or was saved with a
+ *       different table. Nothing is restored after a processor or
+ *       power-on reset, since every monitored app started over too.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called after the tables are loaded and compiled, so the restored
+ *       state replaces the state set up for the new tables. Does nothing
+ *       if #HS_SNAPSHOT_PERIOD is 0 or the main HS CDS block could not
+ *       be created. A restart is told apart from a reset by the
+ *       #HS_SNAPSHOT_BOOT_COUNTER ES generic counter, which HS registers
+ *       the first time it starts after a reset.
+ */
+void HS_SnapshotInit(void);
+
+/**
+ * \brief Save the monitor state snapshot
+ *
+ *  \par Description
+ *       Called once per HS cycle. Every #HS_SNAPSHOT_PERIOD cycles the
+ *       next section is captured from the monitor state and stored in
+ *       its CDS block.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_SnapshotSave(void);
+
+/**
+ * \brief Get a snapshot section
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Section       Snapshot section
+ *  \param [out]  *SizePtr      Size of the section
+ *
+ *  \return Pointer to the section's header
+ */
+HS_SnapshotHeader_t *HS_SnapshotSection(uint32 Section, size_t *SizePtr);
+
+/**
+ * \brief Get the CRC of the table a snapshot section belongs to
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Section       Snapshot section
+ *
+ *  \return CRC of the active compiled table, 0 if the section has no table
+ */
+uint32 HS_SnapshotTableCrc(uint32 Section);
+
+/**
+ * \brief Compute the CRC of a snapshot section
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   *HeaderPtr    Header of the section
+ *  \param [in]   Size          Size of the section
+ *
+ *  \return CRC of the section after its Crc field
+ */
+uint32 HS_SnapshotCrc(const HS_SnapshotHeader_t *HeaderPtr, size_t Size);
+
+/**
+ * \brief Copy the monitor state into a snapshot section
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Section       Snapshot section
+ */
+void HS_SnapshotCapture(uint32 Section);
+
+/**
+ * \brief Copy a restored snapshot section into the monitor state
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The AppMon escalation rungs are taken from the escalation ladder
+ *       in the main HS CDS block rather than from the snapshot.
+ *
+ *  \param [in]   Section       Snapshot section
+ */
+void HS_SnapshotApply(uint32 Section);
+
+/**
+ * \brief Check a restored snapshot section
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Section       Snapshot section
+ *
+ *  \return Whether the section can be restored
+ *  \retval true  The section is intact, recent and belongs to the active table
+ *  \retval false The section must not be restored
+ */
+bool HS_SnapshotValid(uint32 Section);
+
+#endif
@@ -0,0 +1,249 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used for the CFS Health and Safety (HS) task stack monitor
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "hs_app.h"
+#include "hs_stackmon.h"
+#include "hs_monitors.h"
+#include "hs_tbldefs.h"
+#include "hs_eventids.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Register the stack of a task                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_StackMonRegister(const char *TaskName, cpuaddr StackBase)
+{
+    HS_StackReg_t *RegPtr;
+    uint32         RegIndex;
+    uint32         SlotIndex = HS_MAX_REGISTERED_STACKS;
+
+    /*
+    ** Registering the same task again replaces its stack, otherwise the first free slot is taken
+    */
+    for (RegIndex = 0; RegIndex < HS_MAX_REGISTERED_STACKS; RegIndex++)
+    {
+        RegPtr = &HS_AppData.StackMon.Stacks[RegIndex];
+
+        if (RegPtr->TaskName[0] == '\0')
+        {
+            if (SlotIndex == HS_MAX_REGISTERED_STACKS)
+            {
+                SlotIndex = RegIndex;
+            }
+        }
+        else if (strncmp(RegPtr->TaskName, TaskName, sizeof(RegPtr->TaskName)) == 0)
+        {
+            SlotIndex = RegIndex;
+            break;
+        }
+    }
+
+    if (SlotIndex == HS_MAX_REGISTERED_STACKS)
+    {
+        return false;
+    }
+
+    RegPtr = &HS_AppData.StackMon.Stacks[SlotIndex];
+
+    strncpy(RegPtr->TaskName, TaskName, sizeof(RegPtr->TaskName) - 1);
+    RegPtr->TaskName[sizeof(RegPtr->TaskName) - 1] = '\0';
+    RegPtr->StackBase                              = StackBase;
+    RegPtr->CrossedId                              = CFE_ES_TASKID_UNDEFINED;
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Monitor task stack high-water marks                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorStacks(void)
+{
+    HS_StackMon_t *   StackMonPtr = &HS_AppData.StackMon;
+    HS_StackReg_t *   RegPtr;
+    CFE_ES_TaskId_t   TaskId;
+    CFE_ES_TaskInfo_t TaskInfo;
+    HS_StackMonTlm_t  Entry;
+    uint32            Checked      = 0;
+    uint16            ActionType   = HS_STACKMON_ACTION_TYPE;
+    uint32            MsgActsIndex = 0;
+
+    while (Checked < HS_STACKMON_TASKS_PER_CYCLE)
+    {
+        /*
+        ** Report the pass once every registration has been checked, the next one starts next cycle
+        */
+        if (StackMonPtr->NextStack >= HS_MAX_REGISTERED_STACKS)
+        {
+            memcpy(StackMonPtr->Reported, StackMonPtr->Top, sizeof(StackMonPtr->Reported));
+            memset(StackMonPtr->Top, 0, sizeof(StackMonPtr->Top));
+            StackMonPtr->NextStack = 0;
+            break;
+        }
+
+        RegPtr = &StackMonPtr->Stacks[StackMonPtr->NextStack];
+        StackMonPtr->NextStack++;
+
+        if (RegPtr->TaskName[0] == '\0')
+        {
+            continue;
+        }
+
+        Checked++;
+
+        /*
+        ** Skip tasks that aren't running, ES knows how big the stack is
+        */
+        if ((CFE_ES_GetTaskIDByName(&TaskId, RegPtr->TaskName) != CFE_SUCCESS) ||
+            (CFE_ES_GetTaskInfo(&TaskInfo, TaskId) != CFE_SUCCESS) || (TaskInfo.StackSize == 0))
+        {
+            continue;
+        }
+
+        Entry.TaskId         = CFE_RESOURCEID_TO_ULONG(TaskId);
+        Entry.StackSize      = CFE_ES_MEMOFFSET_TO_SIZET(TaskInfo.StackSize);
+        Entry.HighWaterBytes = HS_StackMonHighWater(RegPtr->StackBase, Entry.StackSize);
+
+        /*
+        ** A running task always uses some of its stack, so one still filled isn't the task's
+        */
+        if (Entry.HighWaterBytes == 0)
+        {
+            continue;
+        }
+
+        HS_StackMonRank(&Entry);
+
+        if (((uint64)Entry.HighWaterBytes * 100) < ((uint64)HS_STACKMON_USAGE_LIMIT * Entry.StackSize))
+        {
+            continue;
+        }
+
+        /*
+        ** A high-water mark never goes down, so only act once for each task
+        */
+        if (CFE_RESOURCEID_TEST_EQUAL(RegPtr->CrossedId, TaskId))
+        {
+            continue;
+        }
+
+        RegPtr->CrossedId = TaskId;
+
+        switch (ActionType)
+        {
+            case HS_STACKMON_ACT_NOACT:
+                break;
+
+            case HS_STACKMON_ACT_EVENT:
+                CFE_EVS_SendEvent(HS_STACKMON_LIMIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Stack Monitor: Task %s: Used %u of %u stack bytes: Action: Event Only",
+                                  RegPtr->TaskName, (unsigned int)Entry.HighWaterBytes, (unsigned int)Entry.StackSize);
+                break;
+
+            /*
+            ** Message Action types processing (invalid will be skipped)
+            */
+            default:
+
+                /* Calculate the requested message action index */
+                MsgActsIndex = ActionType - HS_STACKMON_ACT_LAST_NONMSG - 1;
+
+                /*
+                ** Queue the message if this Message Action can be triggered
+                */
+                if (HS_MsgActTrigger(MsgActsIndex))
+                {
+                    if (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT)
+                    {
+                        CFE_EVS_SendEvent(HS_STACKMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "Stack Monitor: Task %s: Used %u of %u stack bytes: "
+                                          "Action: Message Action Index: %d",
+                                          RegPtr->TaskName, (unsigned int)Entry.HighWaterBytes,
+                                          (unsigned int)Entry.StackSize, (int)MsgActsIndex);
+                    }
+                }
+
+                /* Otherwise, Take No Action */
+                break;
+        } /* end switch */
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Measure the high-water mark of a stack                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_StackMonHighWater(cpuaddr StackBase, uint32 StackSize)
+{
+    const uint8 *StackPtr = (const uint8 *)StackBase;
+    uint32       Unused   = 0;
+
+    /*
+    ** Stacks grow down, so the bytes that were never used are at the low end
+    */
+    while ((Unused < StackSize) && (StackPtr[Unused] == HS_STACKMON_FILL_BYTE))
+    {
+        Unused++;
+    }
+
+    return StackSize - Unused;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Rank a task among the fullest stacks of the pass                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_StackMonRank(const HS_StackMonTlm_t *EntryPtr)
+{
+    HS_StackMonTlm_t *TopPtr   = HS_AppData.StackMon.Top;
+    uint32            Position = 0;
+
+    /*
+    ** Fuller stacks go first, ties keep the order they were found in, and
+    ** unused entries have a stack size of 0
+    */
+    while ((Position < HS_STACKMON_TOP_N) && (TopPtr[Position].StackSize != 0) &&
+           (((uint64)TopPtr[Position].HighWaterBytes * EntryPtr->StackSize) >=
+            ((uint64)EntryPtr->HighWaterBytes * TopPtr[Position].StackSize)))
+    {
+        Position++;
+    }
+
+    if (Position == HS_STACKMON_TOP_N)
+    {
+        return;
+    }
+
+    memmove(&TopPtr[Position + 1], &TopPtr[Position], (HS_STACKMON_TOP_N - Position - 1) * sizeof(TopPtr[0]));
+    TopPtr[Position] = *EntryPtr;
+}
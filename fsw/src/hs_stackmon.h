@@ -0,0 +1,145 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Health and Safety (HS) task stack monitor
+ *
+ * ES reports the size of each task's stack but neither ES nor OSAL say
+ * where it is, so a task's stack is registered by name with the address of
+ * the buffer the task was created on. That buffer is filled with
+ * #HS_STACKMON_FILL_BYTE beforehand, and the bytes at its low end that still
+ * hold the fill byte have never been used. A few registered stacks are
+ * scanned each cycle, which keeps the cost of a cycle the same however many
+ * stacks there are.
+ */
+#ifndef HS_STACKMON_H
+#define HS_STACKMON_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "hs_msg.h"
+#include "hs_platform_cfg.h"
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief Registered task stack
+ */
+typedef struct
+{
+    char            TaskName[CFE_MISSION_MAX_API_LEN]; /**< \brief Task the stack belongs to, empty if unused */
+    cpuaddr         StackBase;                         /**< \brief Lowest address of the stack */
+    CFE_ES_TaskId_t CrossedId;                         /**< \brief Task that crossed the usage limit, if any */
+} HS_StackReg_t;
+
+/**
+ *  \brief Task stack monitor state
+ */
+typedef struct
+{
+    HS_StackReg_t Stacks[HS_MAX_REGISTERED_STACKS]; /**< \brief Registered task stacks */
+    uint32        NextStack;                        /**< \brief Next registration to check this pass */
+
+    HS_StackMonTlm_t Top[HS_STACKMON_TOP_N];      /**< \brief Fullest stacks found so far this pass */
+    HS_StackMonTlm_t Reported[HS_STACKMON_TOP_N]; /**< \brief Fullest stacks found by the last complete pass */
+} HS_StackMon_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Register the stack of a task
+ *
+ *  \par Description
+ *       Records where the stack of the named task starts. Registering the
+ *       same name again replaces the stack, otherwise the first unused
+ *       registration is taken.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The stack has to be filled with #HS_STACKMON_FILL_BYTE before
+ *       the task is created. Registrations are kept in RAM, so they last
+ *       until HS restarts.
+ *
+ *  \param [in] TaskName   ES name of the task
+ *  \param [in] StackBase  Address of the buffer the task was created on
+ *
+ *  \return Whether the stack was registered
+ *  \retval false All #HS_MAX_REGISTERED_STACKS registrations are in use
+ */
+bool HS_StackMonRegister(const char *TaskName, cpuaddr StackBase);
+
+/**
+ * \brief Check the stack high-water marks of a few tasks
+ *
+ *  \par Description
+ *       Scans the next #HS_STACKMON_TASKS_PER_CYCLE registered stacks,
+ *       ranks them for housekeeping telemetry and takes
+ *       #HS_STACKMON_ACTION_TYPE for a task that has used
+ *       #HS_STACKMON_USAGE_LIMIT percent of its stack. Once every
+ *       registration has been checked, the ranking is reported and a new
+ *       pass starts.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Tasks that aren't running are skipped, as are stacks still
+ *       entirely filled, which the task was not created on. The action
+ *       is taken once for each task, as its high-water mark can't go back
+ *       down.
+ */
+void HS_MonitorStacks(void);
+
+/**
+ * \brief Measure the high-water mark of a stack
+ *
+ *  \par Description
+ *       Counts the bytes at the low end of the stack that still hold
+ *       #HS_STACKMON_FILL_BYTE, stopping at the first one that doesn't.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Stacks grow down, so only the part of the stack that has never
+ *       been used is read.
+ *
+ *  \param [in] StackBase  Lowest address of the stack
+ *  \param [in] StackSize  Size of the stack in bytes
+ *
+ *  \return Most stack bytes the task has used, 0 if it has used none
+ */
+uint32 HS_StackMonHighWater(cpuaddr StackBase, uint32 StackSize);
+
+/**
+ * \brief Rank a task among the fullest stacks of the pass
+ *
+ *  \par Description
+ *       Inserts a task into the list of the #HS_STACKMON_TOP_N fullest
+ *       stacks found so far this pass, ranked by the used part of the
+ *       stack, if it is fuller than the last one.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] EntryPtr  Task stack status
+ */
+void HS_StackMonRank(const HS_StackMonTlm_t *EntryPtr);
+
+#endif
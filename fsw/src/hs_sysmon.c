@@ -23,7 +23,8 @@
  *
  * Access functions to read system monitor variables such as CPU utilization,
  * temperature, and other health metrics.  Typically these go through the PSP
- * as they are platform-specific.
+ * as they are platform-specific, but Linux targets without a system monitor
+ * PSP module can read CPU time from /proc instead.
  */
 
 /*************************************************************************
@@ -32,6 +33,8 @@
 #include "hs_sysmon.h"
 #include "hs_platform_cfg.h"
 #include "hs_app.h"
+#include "hs_stackmon.h"
+#include "hs_eventids.h"
 
 #include "cfe.h"
 #include "cfe_psp.h"
@@ -39,6 +42,9 @@
 #include "iodriver_analog_io.h"
 #include "osapi.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 /*
  * --------------------------------------------------------
  * Initialize The System Monitor functions
@@ -48,10 +54,28 @@ CFE_Status_t HS_SysMonInit(void)
 {
     CFE_PSP_IODriver_Location_t Location;
     CFE_Status_t                StatusCode;
+    uint32                      Core;
+
+    HS_AppData.SysMonProc.FileId       = OS_OBJECT_ID_UNDEFINED;
+    HS_AppData.SysMonSampler.TaskState = HS_STATE_DISABLED;
+
+    for (Core = 0; Core < HS_MAX_CPU_CORES; Core++)
+    {
+        HS_AppData.UtilCpuCores[Core] = 0xFFFFFFFF;
+    }
 
     if (CFE_PSP_IODriver_FindByName(HS_SYSTEM_MONITOR_DEVICE, &HS_AppData.SysMonPspModuleId) != CFE_PSP_SUCCESS)
     {
-        CFE_ES_WriteToSysLog("%s(): No system monitor device available, CPU usage will not be reported\n", __func__);
+        if (HS_SysMonProcInit() == CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s(): System Monitor using %s/stat\n", __func__, HS_SYSTEM_MONITOR_PROC_DIR);
+        }
+        else
+        {
+            CFE_ES_WriteToSysLog("%s(): No system monitor device available, CPU usage will not be reported\n",
+                                 __func__);
+        }
+
         StatusCode = CFE_SUCCESS;
     }
     else
@@ -107,6 +131,12 @@ CFE_Status_t HS_SysMonInit(void)
         }
     }
 
+    if ((StatusCode == CFE_SUCCESS) &&
+        ((HS_AppData.SysMonPspModuleId != 0) || OS_ObjectIdDefined(HS_AppData.SysMonProc.FileId)))
+    {
+        HS_SysMonTaskInit();
+    }
+
     return StatusCode;
 }
 
@@ -114,6 +144,15 @@ void HS_SysMonCleanup(void)
 {
     CFE_PSP_IODriver_Location_t Location;
 
+    /*
+    ** Stop sampling before the device and file it reads go away
+    */
+    if (HS_AppData.SysMonSampler.TaskState == HS_STATE_ENABLED)
+    {
+        CFE_ES_DeleteChildTask(HS_AppData.SysMonSampler.TaskId);
+        HS_AppData.SysMonSampler.TaskState = HS_STATE_DISABLED;
+    }
+
     if (HS_AppData.SysMonPspModuleId != 0)
     {
         Location.PspModuleId  = HS_AppData.SysMonPspModuleId;
@@ -127,6 +166,12 @@ void HS_SysMonCleanup(void)
                                  (unsigned long)HS_AppData.SysMonPspModuleId);
         }
     }
+
+    if (OS_ObjectIdDefined(HS_AppData.SysMonProc.FileId))
+    {
+        OS_close(HS_AppData.SysMonProc.FileId);
+        HS_AppData.SysMonProc.FileId = OS_OBJECT_ID_UNDEFINED;
+    }
 }
 
 /*
@@ -135,6 +180,22 @@ void HS_SysMonCleanup(void)
  * --------------------------------------------------------
  */
 CFE_Status_t HS_SysMonGetCpuUtilization(void)
+{
+    if (HS_AppData.SysMonSampler.TaskState == HS_STATE_ENABLED)
+    {
+        HS_SysMonBurstReport();
+        return HS_SysMonTaskConsume();
+    }
+
+    return HS_SysMonReadCpuUtilization();
+}
+
+/*
+ * --------------------------------------------------------
+ * Read the System CPU utilization now
+ * --------------------------------------------------------
+ */
+int32 HS_SysMonReadCpuUtilization(void)
 {
     const CFE_PSP_IODriver_Location_t Location = {.PspModuleId  = HS_AppData.SysMonPspModuleId,
                                                   .SubsystemId  = HS_AppData.SysMonSubsystemId,
@@ -146,6 +207,11 @@ CFE_Status_t HS_SysMonGetCpuUtilization(void)
 
     if (HS_AppData.SysMonPspModuleId == 0)
     {
+        if (OS_ObjectIdDefined(HS_AppData.SysMonProc.FileId))
+        {
+            return HS_SysMonProcSample();
+        }
+
         /* No device to get info from */
         StatusCode = CFE_PSP_ERROR_NOT_IMPLEMENTED;
     }
@@ -167,3 +233,463 @@ CFE_Status_t HS_SysMonGetCpuUtilization(void)
 
     return Value;
 }
+
+/*
+ * --------------------------------------------------------
+ * Open the Linux /proc CPU statistics
+ * --------------------------------------------------------
+ */
+CFE_Status_t HS_SysMonProcInit(void)
+{
+    osal_id_t FileSysId = OS_OBJECT_ID_UNDEFINED;
+    int32     OsStatus;
+
+    /*
+    ** The map is left in place when HS exits, so it already exists after an
+    ** app restart and only the open decides if /proc can be used
+    */
+    OS_FileSysAddFixedMap(&FileSysId, HS_SYSTEM_MONITOR_PROC_DIR, HS_SYSTEM_MONITOR_PROC_DIR);
+
+    OsStatus = OS_OpenCreate(&HS_AppData.SysMonProc.FileId, HS_SYSTEM_MONITOR_PROC_DIR "/stat", OS_FILE_FLAG_NONE,
+                             OS_READ_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        HS_AppData.SysMonProc.FileId = OS_OBJECT_ID_UNDEFINED;
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    HS_SysMonProcSample();
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * --------------------------------------------------------
+ * Sample the Linux /proc CPU statistics
+ * --------------------------------------------------------
+ */
+int32 HS_SysMonProcSample(void)
+{
+    HS_SysMonProc_t *    ProcPtr = &HS_AppData.SysMonProc;
+    HS_SysMonProcTimes_t Times;
+    char *               LinePtr;
+    char *               EndPtr;
+    uint64               Value;
+    uint32               Field;
+    uint32               Core;
+    int32                BytesRead;
+    bool                 AggregateFound = false;
+    bool                 CoreFound[HS_MAX_CPU_CORES];
+
+    /*
+    ** The file is kept open and read again from the start, which has the
+    ** kernel generate fresh contents without the cost of a new open
+    */
+    if (OS_lseek(ProcPtr->FileId, 0, OS_SEEK_SET) < 0)
+    {
+        BytesRead = -1;
+    }
+    else
+    {
+        BytesRead = OS_read(ProcPtr->FileId, ProcPtr->Buf, sizeof(ProcPtr->Buf) - 1);
+    }
+
+    /*
+    ** Cores are only marked unknown once the sample is parsed, so each
+    ** value housekeeping reads is either the old or the new one
+    */
+    memset(CoreFound, 0, sizeof(CoreFound));
+    ProcPtr->CoreCount = 0;
+
+    if (BytesRead > 0)
+    {
+        ProcPtr->Buf[BytesRead] = '\0';
+    }
+    else
+    {
+        ProcPtr->Buf[0] = '\0';
+    }
+
+    /*
+    ** The CPU lines come first: "cpu" for the aggregate, then "cpuN" for each
+    ** core, with the user, nice, system, idle, iowait, irq, softirq and steal
+    ** times. A line cut off by the end of the buffer has no newline and is
+    ** ignored.
+    */
+    LinePtr = ProcPtr->Buf;
+
+    while ((strncmp(LinePtr, "cpu", 3) == 0) && (strchr(LinePtr, '\n') != NULL))
+    {
+        if (LinePtr[3] == ' ')
+        {
+            Core = HS_MAX_CPU_CORES;
+        }
+        else
+        {
+            Core = (uint32)strtoul(&LinePtr[3], &EndPtr, 10);
+            if (EndPtr == &LinePtr[3])
+            {
+                break;
+            }
+        }
+
+        Times.Total = 0;
+        Times.Idle  = 0;
+        EndPtr      = strpbrk(LinePtr, " \n");
+
+        for (Field = 0; Field < 8; Field++)
+        {
+            LinePtr = EndPtr;
+            Value   = strtoull(LinePtr, &EndPtr, 10);
+            if (EndPtr == LinePtr)
+            {
+                break;
+            }
+
+            Times.Total += Value;
+
+            /* Idle and iowait */
+            if ((Field == 3) || (Field == 4))
+            {
+                Times.Idle += Value;
+            }
+        }
+
+        if (Core == HS_MAX_CPU_CORES)
+        {
+            if (!AggregateFound)
+            {
+                ProcPtr->AggregateUtil = HS_SysMonProcUtil(&ProcPtr->Aggregate, &Times, ProcPtr->AggregateUtil);
+                AggregateFound         = true;
+            }
+        }
+        else if (Core < HS_MAX_CPU_CORES)
+        {
+            HS_AppData.UtilCpuCores[Core] =
+                HS_SysMonProcUtil(&ProcPtr->Cores[Core], &Times, HS_AppData.UtilCpuCores[Core]);
+            CoreFound[Core] = true;
+            ProcPtr->CoreCount++;
+        }
+
+        LinePtr = strchr(LinePtr, '\n') + 1;
+    }
+
+    for (Core = 0; Core < HS_MAX_CPU_CORES; Core++)
+    {
+        if (!CoreFound[Core])
+        {
+            HS_AppData.UtilCpuCores[Core] = 0xFFFFFFFF;
+        }
+    }
+
+    if (!AggregateFound)
+    {
+        return -1;
+    }
+
+    return (int32)ProcPtr->AggregateUtil;
+}
+
+/*
+ * --------------------------------------------------------
+ * Compute utilization between two samples
+ * --------------------------------------------------------
+ */
+uint32 HS_SysMonProcUtil(HS_SysMonProcTimes_t *PrevPtr, const HS_SysMonProcTimes_t *NowPtr, uint32 LastUtil)
+{
+    uint64 TotalDelta = NowPtr->Total - PrevPtr->Total;
+    uint64 IdleDelta  = NowPtr->Idle - PrevPtr->Idle;
+    uint32 Util       = LastUtil;
+
+    /*
+    ** Counters that went backwards, as after a CPU goes offline and back,
+    ** start a new period instead of reporting a bogus value
+    */
+    if ((NowPtr->Total > PrevPtr->Total) && (NowPtr->Idle >= PrevPtr->Idle) && (IdleDelta <= TotalDelta))
+    {
+        Util = (uint32)(((TotalDelta - IdleDelta) * HS_CPU_UTILIZATION_MAX) / TotalDelta);
+    }
+
+    *PrevPtr = *NowPtr;
+
+    return Util;
+}
+
+/*
+ * --------------------------------------------------------
+ * Start the system monitor sampler task
+ * --------------------------------------------------------
+ */
+void HS_SysMonTaskInit(void)
+{
+    HS_SysMonSampler_t *SamplerPtr = &HS_AppData.SysMonSampler;
+    CFE_Status_t        Status;
+
+    SamplerPtr->TaskState = HS_STATE_DISABLED;
+
+    if (HS_SYSMON_TASK_PERIOD == 0)
+    {
+        return;
+    }
+
+    /*
+    ** /proc counts in clock ticks, so a shorter period only reads as idle or busy
+    */
+    SamplerPtr->Period = HS_SYSMON_TASK_PERIOD;
+    if ((HS_AppData.SysMonPspModuleId == 0) && (SamplerPtr->Period < HS_SYSMON_PROC_MIN_PERIOD))
+    {
+        SamplerPtr->Period = HS_SYSMON_PROC_MIN_PERIOD;
+    }
+
+    SamplerPtr->Seq            = 0;
+    SamplerPtr->Count          = 0;
+    SamplerPtr->FailCount      = 0;
+    SamplerPtr->UtilSum        = 0;
+    SamplerPtr->LastCount      = 0;
+    SamplerPtr->LastUtilSum    = 0;
+    SamplerPtr->LastUtil       = -1;
+    SamplerPtr->ContendedCount = 0;
+    SamplerPtr->RingHead       = 0;
+    SamplerPtr->RingTail       = 0;
+    SamplerPtr->LostCount      = 0;
+    SamplerPtr->BurstRun       = 0;
+    SamplerPtr->BurstLongest   = 0;
+    SamplerPtr->BurstCount     = 0;
+    SamplerPtr->SamplePeak     = 0;
+
+    /*
+    ** The task runs on a stack HS fills, so the stack monitor can measure it
+    */
+    memset(SamplerPtr->Stack, HS_STACKMON_FILL_BYTE, sizeof(SamplerPtr->Stack));
+
+    Status = CFE_ES_CreateChildTask(&SamplerPtr->TaskId, HS_SYSMON_TASK_NAME, HS_SysMonTask, SamplerPtr->Stack,
+                                    sizeof(SamplerPtr->Stack), HS_SYSMON_TASK_PRIORITY, 0);
+
+    if (Status == CFE_SUCCESS)
+    {
+        SamplerPtr->TaskState = HS_STATE_ENABLED;
+        HS_StackMonRegister(HS_SYSMON_TASK_NAME, (cpuaddr)SamplerPtr->Stack);
+    }
+    else
+    {
+        /*
+        ** Not fatal, HS keeps reading the system monitor itself
+        */
+        CFE_EVS_SendEvent(HS_SYSMON_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Creating System Monitor Sampler Task,RC=0x%08X", (unsigned int)Status);
+    }
+}
+
+/*
+ * --------------------------------------------------------
+ * System monitor sampler task entry point
+ * --------------------------------------------------------
+ */
+void HS_SysMonTask(void)
+{
+    while (OS_TaskDelay(HS_AppData.SysMonSampler.Period) == OS_SUCCESS)
+    {
+        CFE_ES_IncrementTaskCounter();
+
+        HS_SysMonTaskSample();
+    }
+
+    CFE_ES_ExitChildTask();
+}
+
+/*
+ * --------------------------------------------------------
+ * Take one sample for the sampler task
+ * --------------------------------------------------------
+ */
+void HS_SysMonTaskSample(void)
+{
+    HS_SysMonSampler_t *SamplerPtr = &HS_AppData.SysMonSampler;
+    int32               Util;
+
+    /* The read can block, so it's done before the totals are marked as being updated */
+    Util = HS_SysMonReadCpuUtilization();
+
+    SamplerPtr->Seq++;
+    HS_SYSMON_BARRIER();
+
+    if (Util < 0)
+    {
+        SamplerPtr->FailCount++;
+    }
+    else
+    {
+        SamplerPtr->UtilSum += (uint32)Util;
+        SamplerPtr->Count++;
+    }
+
+    HS_SYSMON_BARRIER();
+    SamplerPtr->Seq++;
+
+    /*
+    ** The slot is written before the head moves past it, so HS never scans
+    ** a sample that isn't there yet
+    */
+    if (Util >= 0)
+    {
+        if (Util > 0xFFFF)
+        {
+            Util = 0xFFFF;
+        }
+
+        SamplerPtr->Ring[SamplerPtr->RingHead & (HS_SYSMON_RING_DEPTH - 1)] = (uint16)Util;
+        HS_SYSMON_BARRIER();
+        SamplerPtr->RingHead++;
+    }
+}
+
+/*
+ * --------------------------------------------------------
+ * Average the samples taken since the previous call
+ * --------------------------------------------------------
+ */
+int32 HS_SysMonTaskConsume(void)
+{
+    HS_SysMonSampler_t *SamplerPtr = &HS_AppData.SysMonSampler;
+    uint32              Attempt;
+    uint32              Seq;
+    uint32              Count;
+    uint64              UtilSum;
+
+    for (Attempt = 0; Attempt < HS_SYSMON_READ_ATTEMPTS; Attempt++)
+    {
+        Seq = SamplerPtr->Seq;
+        HS_SYSMON_BARRIER();
+
+        Count   = SamplerPtr->Count;
+        UtilSum = SamplerPtr->UtilSum;
+
+        HS_SYSMON_BARRIER();
+
+        if (((Seq & 1) == 0) && (Seq == SamplerPtr->Seq))
+        {
+            if (Count == SamplerPtr->LastCount)
+            {
+                /* The sampler hasn't read the system monitor since last time */
+                SamplerPtr->LastUtil = -1;
+            }
+            else
+            {
+                SamplerPtr->LastUtil = (int32)((UtilSum - SamplerPtr->LastUtilSum) / (Count - SamplerPtr->LastCount));
+            }
+
+            SamplerPtr->LastCount   = Count;
+            SamplerPtr->LastUtilSum = UtilSum;
+
+            return SamplerPtr->LastUtil;
+        }
+    }
+
+    /*
+    ** The sampler may have been preempted by HS in the middle of an update,
+    ** so waiting could take forever; its samples are counted next interval
+    */
+    SamplerPtr->ContendedCount++;
+
+    return SamplerPtr->LastUtil;
+}
+
+/*
+ * --------------------------------------------------------
+ * Scan the sampler task ring for bursts
+ * --------------------------------------------------------
+ */
+void HS_SysMonBurstUpdate(void)
+{
+    HS_SysMonSampler_t *SamplerPtr = &HS_AppData.SysMonSampler;
+    uint16              Samples[HS_SYSMON_RING_DEPTH];
+    uint32              Head;
+    uint32              Index;
+    uint32              Valid;
+    uint16              Sample;
+
+    Head = SamplerPtr->RingHead;
+    HS_SYSMON_BARRIER();
+
+    if ((Head - SamplerPtr->RingTail) > HS_SYSMON_RING_DEPTH)
+    {
+        SamplerPtr->LostCount += (Head - SamplerPtr->RingTail) - HS_SYSMON_RING_DEPTH;
+        SamplerPtr->RingTail = Head - HS_SYSMON_RING_DEPTH;
+        SamplerPtr->BurstRun = 0;
+    }
+
+    for (Index = SamplerPtr->RingTail; Index != Head; Index++)
+    {
+        Samples[Index & (HS_SYSMON_RING_DEPTH - 1)] = SamplerPtr->Ring[Index & (HS_SYSMON_RING_DEPTH - 1)];
+    }
+
+    /*
+    ** The sampler may have lapped the copy while it was being made; a slot
+    ** is only good if the sampler hasn't since started on the sample that
+    ** replaces it
+    */
+    HS_SYSMON_BARRIER();
+    Valid = SamplerPtr->RingHead - HS_SYSMON_RING_DEPTH + 1;
+
+    if ((int32)(Valid - SamplerPtr->RingTail) > 0)
+    {
+        SamplerPtr->LostCount += Valid - SamplerPtr->RingTail;
+        SamplerPtr->RingTail = Valid;
+        SamplerPtr->BurstRun = 0;
+    }
+
+    for (Index = SamplerPtr->RingTail; (int32)(Head - Index) > 0; Index++)
+    {
+        Sample = Samples[Index & (HS_SYSMON_RING_DEPTH - 1)];
+
+        if (Sample > SamplerPtr->SamplePeak)
+        {
+            SamplerPtr->SamplePeak = Sample;
+        }
+
+        if (Sample >= HS_UTIL_BURST_THRESHOLD)
+        {
+            if (SamplerPtr->BurstRun == 0)
+            {
+                SamplerPtr->BurstCount++;
+            }
+
+            SamplerPtr->BurstRun++;
+
+            if (SamplerPtr->BurstRun > SamplerPtr->BurstLongest)
+            {
+                SamplerPtr->BurstLongest = SamplerPtr->BurstRun;
+            }
+        }
+        else
+        {
+            SamplerPtr->BurstRun = 0;
+        }
+    }
+
+    if ((int32)(Head - SamplerPtr->RingTail) > 0)
+    {
+        SamplerPtr->RingTail = Head;
+    }
+}
+
+/*
+ * --------------------------------------------------------
+ * Report the bursts of the interval
+ * --------------------------------------------------------
+ */
+void HS_SysMonBurstReport(void)
+{
+    HS_SysMonSampler_t *SamplerPtr = &HS_AppData.SysMonSampler;
+
+    HS_SysMonBurstUpdate();
+
+    HS_AppData.UtilBurstCount   = SamplerPtr->BurstCount;
+    HS_AppData.UtilBurstLongest = SamplerPtr->BurstLongest * SamplerPtr->Period;
+    HS_AppData.UtilSamplePeak   = SamplerPtr->SamplePeak;
+    HS_AppData.UtilSamplesLost  = SamplerPtr->LostCount;
+
+    SamplerPtr->BurstCount   = 0;
+    SamplerPtr->BurstLongest = 0;
+    SamplerPtr->SamplePeak   = 0;
+}
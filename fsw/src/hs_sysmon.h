@@ -23,7 +23,14 @@
  *
  * System health monitoring is inherently platform-specific and therefore should
  * be abstracted via the PSP.  This provides local access methods to obtain the
- * information from the PSP.
+ * information from the PSP, or from the Linux /proc file system on targets
+ * without a system monitor PSP module.
+ *
+ * The system monitor can also be read by a sampler child task, which hands
+ * running totals to HS through a sequence lock: the task makes the sequence
+ * odd while it updates the totals, and HS retries a read that saw an odd or
+ * changed sequence. Each sample is also written to a ring that HS scans every
+ * cycle for bursts of high utilization, which the interval average hides.
  */
 #ifndef HS_SYSMON_H
 #define HS_SYSMON_H
@@ -33,6 +40,82 @@
  ************************************************************************/
 #include "cfe.h"
 #include "hs_platform_cfg.h"
+#include "hs_mission_cfg.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Order the sampler sequence lock accesses
+ *
+ * volatile only keeps the compiler from reordering them, this also keeps
+ * the processor from doing so on multicore targets
+ */
+#ifdef __GNUC__
+#define HS_SYSMON_BARRIER() __sync_synchronize()
+#else
+#define HS_SYSMON_BARRIER()
+#endif
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief CPU time of one /proc/stat line, in kernel clock ticks
+ */
+typedef struct
+{
+    uint64 Total; /**< \brief Time spent in all states */
+    uint64 Idle;  /**< \brief Time spent idle or waiting for I/O */
+} HS_SysMonProcTimes_t;
+
+/**
+ *  \brief Linux /proc system monitor state
+ */
+typedef struct
+{
+    osal_id_t            FileId;                  /**< \brief Open stat file, undefined if not in use */
+    uint32               CoreCount;               /**< \brief Cores seen in the last sample */
+    uint32               AggregateUtil;           /**< \brief Aggregate utilization of the last sample */
+    HS_SysMonProcTimes_t Aggregate;               /**< \brief Aggregate CPU time of the last sample */
+    HS_SysMonProcTimes_t Cores[HS_MAX_CPU_CORES]; /**< \brief CPU time of each core in the last sample */
+
+    char Buf[HS_SYSTEM_MONITOR_PROC_BUF_SIZE]; /**< \brief Stat file read buffer */
+} HS_SysMonProc_t;
+
+/**
+ *  \brief System monitor sampler task state
+ */
+typedef struct
+{
+    CFE_ES_TaskId_t TaskId;    /**< \brief Sampler task ID */
+    uint32          TaskState; /**< \brief Whether the sampler task is running */
+    uint32          Period;    /**< \brief Sampling period in milliseconds */
+
+    volatile uint32 Seq;       /**< \brief Sequence lock, odd while the sampler updates the totals */
+    volatile uint32 Count;     /**< \brief Samples read since the task started */
+    volatile uint32 FailCount; /**< \brief Samples that could not be read */
+    volatile uint64 UtilSum;   /**< \brief Sum of the utilization of every sample read */
+
+    uint16          Ring[HS_SYSMON_RING_DEPTH]; /**< \brief Recent samples, saturated at 0xFFFF */
+    volatile uint32 RingHead;                   /**< \brief Samples written to the ring since the task started */
+
+    uint32 LastCount;      /**< \brief Count when HS last read the totals */
+    uint64 LastUtilSum;    /**< \brief UtilSum when HS last read the totals */
+    int32  LastUtil;       /**< \brief Utilization HS computed from the previous read */
+    uint32 ContendedCount; /**< \brief HS reads that gave up on a sampler update */
+
+    uint32 RingTail;     /**< \brief Samples HS has scanned for bursts */
+    uint32 LostCount;    /**< \brief Samples overwritten before HS scanned them */
+    uint32 BurstRun;     /**< \brief Samples in the current burst, 0 when not in one */
+    uint32 BurstLongest; /**< \brief Samples in the longest burst this interval */
+    uint32 BurstCount;   /**< \brief Bursts started this interval */
+    uint32 SamplePeak;   /**< \brief Highest sample this interval */
+
+    uint64 Stack[(HS_SYSMON_TASK_STACK_SIZE + 7) / 8]; /**< \brief Stack the sampler task runs on */
+} HS_SysMonSampler_t;
 
 /*************************************************************************
  * Exported Functions
@@ -69,7 +152,9 @@ void HS_SysMonCleanup(void);
  * \brief Read the system monitor CPU utilization
  *
  *  \par Description
- *       This function is used to read the current value of the cpu utilization
+ *       This function is used to read the current value of the cpu utilization,
+ *       which is the average of the samples taken since the previous call when
+ *       the sampler task is running
  *
  *  \par Assumptions, External Events, and Notes:
  *       The range of output is controlled by the #HS_CPU_UTILIZATION_MAX config
@@ -79,4 +164,147 @@ void HS_SysMonCleanup(void);
  */
 CFE_Status_t HS_SysMonGetCpuUtilization(void);
 
+/**
+ * \brief Open the Linux /proc CPU statistics
+ *
+ *  \par Description
+ *       Maps #HS_SYSTEM_MONITOR_PROC_DIR into the OSAL file system, opens its
+ *       stat file and takes the first sample, so the next one has a period to
+ *       measure over.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file stays open until HS_SysMonCleanup()
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t HS_SysMonProcInit(void);
+
+/**
+ * \brief Sample the Linux /proc CPU statistics
+ *
+ *  \par Description
+ *       Reads the start of the open stat file again and computes the
+ *       aggregate and per-core utilization since the previous sample.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Per-core utilization is stored in HS_AppData.UtilCpuCores, with
+ *       0xFFFFFFFF for cores that were not seen.
+ *
+ *  \return Aggregate utilization as fixed-point integer, or -1 if unknown
+ */
+int32 HS_SysMonProcSample(void);
+
+/**
+ * \brief Compute utilization between two samples
+ *
+ *  \par Description
+ *       Returns the share of the time between two samples that was not idle,
+ *       scaled to #HS_CPU_UTILIZATION_MAX, and stores the new sample.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       If no time passed, LastUtil is returned.
+ *
+ *  \param [in,out] PrevPtr  Previous sample, replaced by the new one
+ *  \param [in]     NowPtr   New sample
+ *  \param [in]     LastUtil Utilization from the previous sample
+ *
+ *  \return Utilization as fixed-point integer
+ */
+uint32 HS_SysMonProcUtil(HS_SysMonProcTimes_t *PrevPtr, const HS_SysMonProcTimes_t *NowPtr, uint32 LastUtil);
+
+/**
+ * \brief Read the system monitor CPU utilization now
+ *
+ *  \par Description
+ *       Reads the PSP device, or /proc when there is no device, and returns
+ *       the current utilization.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The PSP device read may block for a sampling period on some drivers.
+ *
+ *  \return Utilization value as fixed-point integer, or -1 if unknown
+ */
+int32 HS_SysMonReadCpuUtilization(void);
+
+/**
+ * \brief Start the system monitor sampler task
+ *
+ *  \par Description
+ *       Creates the sampler task unless #HS_SYSMON_TASK_PERIOD is 0.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once a system monitor has been found. If the task can't be
+ *       created HS keeps reading the system monitor itself.
+ */
+void HS_SysMonTaskInit(void);
+
+/**
+ * \brief System monitor sampler task entry point
+ *
+ *  \par Description
+ *       Reads the system monitor every #HS_SYSMON_TASK_PERIOD milliseconds.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Runs until its task delay fails, which happens when the task is
+ *       being deleted along with HS.
+ */
+void HS_SysMonTask(void);
+
+/**
+ * \brief Take one sample for the sampler task
+ *
+ *  \par Description
+ *       Reads the system monitor and adds the result to the totals HS reads.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the sampler task, the single writer of the totals.
+ */
+void HS_SysMonTaskSample(void);
+
+/**
+ * \brief Average the samples taken since the previous call
+ *
+ *  \par Description
+ *       Reads the sampler task totals and returns the average utilization
+ *       of the samples taken since the previous call.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Never waits on the sampler task. If the totals are being updated on
+ *       each of #HS_SYSMON_READ_ATTEMPTS reads, the previous result is
+ *       returned again.
+ *
+ *  \return Utilization value as fixed-point integer, or -1 if no sample was
+ *          read since the previous call
+ */
+int32 HS_SysMonTaskConsume(void);
+
+/**
+ * \brief Scan the sampler task ring for bursts
+ *
+ *  \par Description
+ *       Scans the samples written since the previous call for runs at or
+ *       above #HS_UTIL_BURST_THRESHOLD, and tracks the number of bursts,
+ *       the longest burst and the peak sample of the interval.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called every HS cycle while the sampler task runs. Samples the task
+ *       overwrote before they were scanned are counted as lost and end the
+ *       current burst.
+ */
+void HS_SysMonBurstUpdate(void);
+
+/**
+ * \brief Report the bursts of the interval
+ *
+ *  \par Description
+ *       Scans the latest samples, then reports the bursts of the interval
+ *       for housekeeping telemetry and starts a new interval.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A burst still in progress carries over and its full length counts
+ *       toward the next interval.
+ */
+void HS_SysMonBurstReport(void);
+
 #endif
@@ -0,0 +1,296 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to time the CFS Health and Safety (HS) cycle and its
+ *   phases
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "hs_app.h"
+#include "hs_timing.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start timing a cycle phase                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_TimingStart(uint32 Phase)
+{
+    CFE_ES_PerfLogEntry(HS_TIMING_PERF_ID(Phase));
+
+    OS_GetLocalTime(&HS_AppData.Timing.StartTime[Phase]);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stop timing a cycle phase                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_TimingStop(uint32 Phase)
+{
+    HS_PhaseTiming_t *StatsPtr = &HS_AppData.Timing.Stats.Phases[Phase];
+    OS_time_t         Now;
+    uint32            Usec;
+
+    OS_GetLocalTime(&Now);
+
+    CFE_ES_PerfLogExit(HS_TIMING_PERF_ID(Phase));
+
+    Usec = HS_TimingElapsedUsec(HS_AppData.Timing.StartTime[Phase], Now);
+
+    if ((StatsPtr->Count == 0) || (Usec < StatsPtr->MinUsec))
+    {
+        StatsPtr->MinUsec = Usec;
+    }
+
+    if (Usec > StatsPtr->MaxUsec)
+    {
+        StatsPtr->MaxUsec = Usec;
+    }
+
+    StatsPtr->Count++;
+    HS_AppData.Timing.Stats.PhaseTotalUsec[Phase] += Usec;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start timing an HS cycle                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_TimingCycleStart(CFE_Status_t RcvStatus)
+{
+    HS_TimingStats_t *StatsPtr = &HS_AppData.Timing.Stats;
+
+    OS_GetLocalTime(&HS_AppData.Timing.CycleStart);
+
+    if (RcvStatus == CFE_SUCCESS)
+    {
+        StatsPtr->WakeupCount++;
+
+        if (StatsPtr->LastWasWakeup)
+        {
+            HS_TimingAddInterval(HS_TimingElapsedUsec(StatsPtr->LastWakeup, HS_AppData.Timing.CycleStart));
+        }
+
+        StatsPtr->LastWakeup    = HS_AppData.Timing.CycleStart;
+        StatsPtr->LastWasWakeup = true;
+    }
+    else
+    {
+        /*
+        ** A missed wakeup shows up in the timeout count, not as one long interval
+        */
+        StatsPtr->TimeoutCount++;
+        StatsPtr->LastWasWakeup = false;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stop timing an HS cycle                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_TimingCycleEnd(void)
+{
+    OS_time_t Now;
+    uint32    Usec;
+
+    OS_GetLocalTime(&Now);
+
+    Usec = HS_TimingElapsedUsec(HS_AppData.Timing.CycleStart, Now);
+
+    if (Usec > HS_AppData.Timing.Stats.CycleMaxUsec)
+    {
+        HS_AppData.Timing.Stats.CycleMaxUsec = Usec;
+    }
+
+    if (Usec > ((uint32)HS_CYCLE_BUDGET * 1000))
+    {
+        HS_AppData.Timing.Stats.OverrunCount++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add a wakeup interval to the interval statistics                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_TimingAddInterval(uint32 IntervalUsec)
+{
+    HS_TimingStats_t *StatsPtr = &HS_AppData.Timing.Stats;
+    int64             DevUsec;
+
+    if (StatsPtr->IntervalCount == 0)
+    {
+        StatsPtr->IntervalMinUsec = IntervalUsec;
+        StatsPtr->IntervalMaxUsec = IntervalUsec;
+        StatsPtr->IntervalRefUsec = IntervalUsec;
+    }
+    else if (IntervalUsec < StatsPtr->IntervalMinUsec)
+    {
+        StatsPtr->IntervalMinUsec = IntervalUsec;
+    }
+    else if (IntervalUsec > StatsPtr->IntervalMaxUsec)
+    {
+        StatsPtr->IntervalMaxUsec = IntervalUsec;
+    }
+
+    /*
+    ** Summing deviations from the first interval, rather than the intervals
+    ** themselves, keeps the sum of squares from overflowing
+    */
+    DevUsec = (int64)IntervalUsec - (int64)StatsPtr->IntervalRefUsec;
+
+    StatsPtr->IntervalCount++;
+    StatsPtr->IntervalDevSum += DevUsec;
+    StatsPtr->IntervalDevSqSum += (uint64)(DevUsec * DevUsec);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute the time between two clock readings                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_TimingElapsedUsec(OS_time_t Start, OS_time_t Now)
+{
+    int64  ElapsedUsec;
+    uint32 Usec;
+
+    ElapsedUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, Start));
+
+    /*
+    ** The local clock may be set backwards in between
+    */
+    if (ElapsedUsec < 0)
+    {
+        Usec = 0;
+    }
+    else if (ElapsedUsec > 0xFFFFFFFF)
+    {
+        Usec = 0xFFFFFFFF;
+    }
+    else
+    {
+        Usec = (uint32)ElapsedUsec;
+    }
+
+    return Usec;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute an integer square root                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_TimingSqrt(uint64 Value)
+{
+    uint64 Root = 0;
+    uint64 Bit  = (uint64)1 << 62;
+
+    while (Bit > Value)
+    {
+        Bit >>= 2;
+    }
+
+    while (Bit != 0)
+    {
+        if (Value >= Root + Bit)
+        {
+            Value -= Root + Bit;
+            Root = (Root >> 1) + Bit;
+        }
+        else
+        {
+            Root >>= 1;
+        }
+
+        Bit >>= 2;
+    }
+
+    return (uint32)Root;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Clear the timing statistics                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_TimingReset(void)
+{
+    memset(&HS_AppData.Timing.Stats, 0, sizeof(HS_AppData.Timing.Stats));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy the timing statistics into a telemetry payload             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_TimingReport(HS_TimingTlm_Payload_t *PayloadPtr)
+{
+    HS_TimingStats_t *StatsPtr = &HS_AppData.Timing.Stats;
+    uint32            Phase;
+    int64             MeanDevUsec;
+    uint64            MeanDevSq;
+    uint64            MeanSqDev;
+
+    for (Phase = 0; Phase < HS_NUM_PHASES; Phase++)
+    {
+        PayloadPtr->Phases[Phase] = StatsPtr->Phases[Phase];
+
+        if (PayloadPtr->Phases[Phase].Count != 0)
+        {
+            PayloadPtr->Phases[Phase].AvgUsec =
+                (uint32)(StatsPtr->PhaseTotalUsec[Phase] / StatsPtr->Phases[Phase].Count);
+        }
+    }
+
+    PayloadPtr->WakeupCount        = StatsPtr->WakeupCount;
+    PayloadPtr->TimeoutCount       = StatsPtr->TimeoutCount;
+    PayloadPtr->OverrunCount       = StatsPtr->OverrunCount;
+    PayloadPtr->CycleMaxUsec       = StatsPtr->CycleMaxUsec;
+    PayloadPtr->IntervalCount      = StatsPtr->IntervalCount;
+    PayloadPtr->IntervalMinUsec    = StatsPtr->IntervalMinUsec;
+    PayloadPtr->IntervalMaxUsec    = StatsPtr->IntervalMaxUsec;
+    PayloadPtr->IntervalAvgUsec    = 0;
+    PayloadPtr->IntervalStdDevUsec = 0;
+
+    if (StatsPtr->IntervalCount != 0)
+    {
+        MeanDevUsec = StatsPtr->IntervalDevSum / (int64)StatsPtr->IntervalCount;
+        MeanDevSq   = (uint64)(MeanDevUsec * MeanDevUsec);
+        MeanSqDev   = StatsPtr->IntervalDevSqSum / StatsPtr->IntervalCount;
+
+        PayloadPtr->IntervalAvgUsec = (uint32)((int64)StatsPtr->IntervalRefUsec + MeanDevUsec);
+
+        /*
+        ** Variance is the mean squared deviation less the squared mean
+        ** deviation, which integer rounding can leave slightly negative
+        */
+        if (MeanSqDev > MeanDevSq)
+        {
+            PayloadPtr->IntervalStdDevUsec = HS_TimingSqrt(MeanSqDev - MeanDevSq);
+        }
+    }
+}
@@ -0,0 +1,197 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Health and Safety (HS) cycle phase timing
+ *
+ * Each phase of the HS cycle is bracketed by a performance log marker and
+ * timed with the OSAL local clock, so the cost of each phase can be seen
+ * in telemetry without a performance log capture. The arrival of each
+ * wakeup is timed as well, since jitter in the wakeup period is an early
+ * sign of an overloaded system.
+ */
+#ifndef HS_TIMING_H
+#define HS_TIMING_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "hs_msg.h"
+#include "hs_perfids.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Performance ID of a cycle phase
+ *
+ * The phase performance IDs are consecutive, in phase order.
+ */
+#define HS_TIMING_PERF_ID(Phase) (HS_TBLMGMT_PERF_ID + (Phase))
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief HS Cycle Timing Statistics, cleared by #HS_TimingReset
+ */
+typedef struct
+{
+    HS_PhaseTiming_t Phases[HS_NUM_PHASES];         /**< \brief Count, minimum and maximum of each phase */
+    uint64           PhaseTotalUsec[HS_NUM_PHASES]; /**< \brief Sum of the measured durations of each phase */
+
+    uint32 WakeupCount;  /**< \brief Cycles started by a wakeup message */
+    uint32 TimeoutCount; /**< \brief Cycles started by a wakeup timeout */
+    uint32 OverrunCount; /**< \brief Cycles that took longer than #HS_CYCLE_BUDGET */
+    uint32 CycleMaxUsec; /**< \brief Longest cycle */
+
+    OS_time_t LastWakeup;       /**< \brief Arrival of the previous wakeup */
+    bool      LastWasWakeup;    /**< \brief Previous cycle was started by a wakeup message */
+    uint32    IntervalCount;    /**< \brief Number of measured wakeup intervals */
+    uint32    IntervalMinUsec;  /**< \brief Shortest wakeup interval */
+    uint32    IntervalMaxUsec;  /**< \brief Longest wakeup interval */
+    uint32    IntervalRefUsec;  /**< \brief First wakeup interval, deviations are summed from it */
+    int64     IntervalDevSum;   /**< \brief Sum of the interval deviations from IntervalRefUsec */
+    uint64    IntervalDevSqSum; /**< \brief Sum of the squared interval deviations from IntervalRefUsec */
+} HS_TimingStats_t;
+
+/**
+ *  \brief HS Cycle Timing
+ */
+typedef struct
+{
+    OS_time_t        StartTime[HS_NUM_PHASES]; /**< \brief Start of the phase in progress */
+    OS_time_t        CycleStart;               /**< \brief Start of the cycle in progress */
+    HS_TimingStats_t Stats;                    /**< \brief Timing statistics */
+} HS_Timing_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Start timing a cycle phase
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be followed by #HS_TimingStop for the same phase
+ *
+ *  \param [in]   Phase         Cycle phase, one of the HS_PHASE_* values
+ */
+void HS_TimingStart(uint32 Phase);
+
+/**
+ * \brief Stop timing a cycle phase
+ *
+ *  \par Description
+ *       Adds the time since the matching #HS_TimingStart to the statistics
+ *       of the phase.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Phase         Cycle phase, one of the HS_PHASE_* values
+ */
+void HS_TimingStop(uint32 Phase);
+
+/**
+ * \brief Start timing an HS cycle
+ *
+ *  \par Description
+ *       Counts the cycle as a wakeup or a wakeup timeout, and adds the time
+ *       since the previous wakeup to the wakeup interval statistics when
+ *       both this cycle and the previous one were started by a wakeup.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called as soon as the wakeup pipe read returns
+ *
+ *  \param [in]   RcvStatus     Status of the wakeup pipe read
+ */
+void HS_TimingCycleStart(CFE_Status_t RcvStatus);
+
+/**
+ * \brief Stop timing an HS cycle
+ *
+ *  \par Description
+ *       Counts the cycle as an overrun if it took longer than
+ *       #HS_CYCLE_BUDGET.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_TimingCycleEnd(void);
+
+/**
+ * \brief Add a wakeup interval to the interval statistics
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   IntervalUsec  Time between two wakeups, in microseconds
+ */
+void HS_TimingAddInterval(uint32 IntervalUsec);
+
+/**
+ * \brief Compute the time between two clock readings
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Start         Earlier clock reading
+ *  \param [in]   Now           Later clock reading
+ *
+ *  \return Microseconds from Start to Now, 0 if the clock went backwards and
+ *          saturated at 0xFFFFFFFF
+ */
+uint32 HS_TimingElapsedUsec(OS_time_t Start, OS_time_t Now);
+
+/**
+ * \brief Compute an integer square root
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Value         Value to take the square root of
+ *
+ *  \return Square root of Value, rounded down
+ */
+uint32 HS_TimingSqrt(uint64 Value);
+
+/**
+ * \brief Clear the timing statistics
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_TimingReset(void);
+
+/**
+ * \brief Copy the timing statistics into a telemetry payload
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [out]  *PayloadPtr   Timing telemetry payload
+ */
+void HS_TimingReport(HS_TimingTlm_Payload_t *PayloadPtr);
+
+#endif
@@ -56,6 +56,39 @@ bool HS_AMTActionIsValid(uint16 ActionType)
     return IsValid;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify AMT Escalation Ladder                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_AMTEscalationIsValid(const HS_AMTEntry_t *EntryPtr)
+{
+    bool   LadderEnded = false;
+    uint32 RungIndex;
+
+    for (RungIndex = 0; RungIndex < HS_MAX_ESCALATION_RUNGS; RungIndex++)
+    {
+        if (!HS_AMTActionIsValid(EntryPtr->Escalation[RungIndex].ActionType))
+        {
+            return false;
+        }
+
+        if (EntryPtr->Escalation[RungIndex].ActionType == HS_AMT_ACT_NOACT)
+        {
+            LadderEnded = true;
+        }
+        else if (LadderEnded)
+        {
+            /*
+            ** A rung after the end of the ladder would never be reached
+            */
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Verify EMT Action Type                                          */
@@ -79,3 +112,26 @@ bool HS_EMTActionIsValid(uint16 ActionType)
 
     return IsValid;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Hash a table key                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_KeyHash(const char *Name, uint32 Key)
+{
+    uint32 Hash = 2166136261U;
+    uint32 i;
+
+    for (i = 0; (i < OS_MAX_API_NAME) && (Name[i] != '\0'); i++)
+    {
+        Hash = (Hash ^ (uint8)Name[i]) * 16777619U;
+    }
+
+    for (i = 0; i < sizeof(Key); i++)
+    {
+        Hash = (Hash ^ ((Key >> (i * 8)) & 0xFF)) * 16777619U;
+    }
+
+    return Hash;
+}
@@ -28,6 +28,7 @@
  * Includes
  *************************************************************************/
 #include "cfe.h"
+#include "hs_tbl.h"
 
 /**
  * \brief Verify AMT Action Type
@@ -46,6 +47,24 @@
  */
 bool HS_AMTActionIsValid(uint16 ActionType);
 
+/**
+ * \brief Verify AMT Escalation Ladder
+ *
+ *  \par Description
+ *       Checks that every escalation rung of an AMT entry has a valid
+ *       action type and that no rung follows one with no action.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] EntryPtr AMT entry to validate
+ *
+ *  \return Boolean ladder valid response
+ *  \retval true  Escalation ladder valid
+ *  \retval false Escalation ladder not valid
+ */
+bool HS_AMTEscalationIsValid(const HS_AMTEntry_t *EntryPtr);
+
 /**
  * \brief Verify EMT Action Type
  *
@@ -63,4 +82,21 @@ bool HS_AMTActionIsValid(uint16 ActionType);
  */
 bool HS_EMTActionIsValid(uint16 ActionType);
 
+/**
+ * \brief Hash a table key
+ *
+ *  \par Description
+ *       Computes a 32 bit FNV-1a hash over an application name and a
+ *       numeric key, e.g. an event ID.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       At most OS_MAX_API_NAME characters of the name are hashed.
+ *
+ *  \param[in] Name Application name
+ *  \param[in] Key  Numeric key to combine with the name
+ *
+ *  \return Hash of the name and key
+ */
+uint32 HS_KeyHash(const char *Name, uint32 Key);
+
 #endif
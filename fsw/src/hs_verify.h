@@ -73,6 +73,24 @@
 #error HS_MAX_MONITORED_APPS can not exceed 4294967295
 #endif
 
+/*
+ * Maximum number of escalation rungs
+ */
+#if HS_MAX_ESCALATION_RUNGS < 1
+#error HS_MAX_ESCALATION_RUNGS cannot be less than 1
+#elif HS_MAX_ESCALATION_RUNGS > 255
+#error HS_MAX_ESCALATION_RUNGS can not exceed 255
+#endif
+
+/*
+ * Escalation recovery check-ins
+ */
+#if HS_ESCALATION_RECOVERY_CHECKINS < 1
+#error HS_ESCALATION_RECOVERY_CHECKINS cannot be less than 1
+#elif HS_ESCALATION_RECOVERY_CHECKINS > 65535
+#error HS_ESCALATION_RECOVERY_CHECKINS can not exceed 65535
+#endif
+
 /*
  * Maximum number of critical events
  */
@@ -82,6 +100,39 @@
 #error HS_MAX_MONITORED_EVENTS can not exceed 4294967295
 #endif
 
+/*
+ * Maximum number of monitored memory pools
+ */
+#if HS_MAX_MONITORED_MEM < 1
+#error HS_MAX_MONITORED_MEM cannot be less than 1
+#elif HS_MAX_MONITORED_MEM > 255
+#error HS_MAX_MONITORED_MEM can not exceed 255
+#endif
+
+/*
+ * Maximum number of monitored messages
+ */
+#if HS_MAX_MONITORED_MSGS < 1
+#error HS_MAX_MONITORED_MSGS cannot be less than 1
+#elif HS_MAX_MONITORED_MSGS > 255
+#error HS_MAX_MONITORED_MSGS can not exceed 255
+#endif
+
+/*
+ * Memory Monitor sample period
+ */
+#if HS_MEMMON_CYCLES_PER_SAMPLE < 1
+#error HS_MEMMON_CYCLES_PER_SAMPLE cannot be less than 1
+#elif HS_MEMMON_CYCLES_PER_SAMPLE > 4294967295
+#error HS_MEMMON_CYCLES_PER_SAMPLE can not exceed 4294967295
+#endif
+
+#if HS_MAX_REGISTERED_POOLS < 1
+#error HS_MAX_REGISTERED_POOLS cannot be less than 1
+#elif HS_MAX_REGISTERED_POOLS > 255
+#error HS_MAX_REGISTERED_POOLS can not exceed 255
+#endif
+
 /*
  * JPH 2015-06-29 - Removed check of Watchdog timer values
  *
@@ -105,6 +156,28 @@
 #error HS_WAKEUP_TIMEOUT not defined as a proper SB Timeout value
 #endif
 
+/*
+ * Cycle Processing Budget
+ */
+#if HS_CYCLE_BUDGET < 1
+#error HS_CYCLE_BUDGET cannot be less than 1
+#elif HS_CYCLE_BUDGET > 4294967
+#error HS_CYCLE_BUDGET can not exceed 4294967
+#endif
+
+/*
+ * Command Handler Histogram
+ */
+#if (HS_CMD_HIST_BINS < 2) || (HS_CMD_HIST_BINS > 16)
+#error HS_CMD_HIST_BINS must be between 2 and 16
+#endif
+
+#if HS_CMD_HIST_BASE_USEC < 1
+#error HS_CMD_HIST_BASE_USEC cannot be less than 1
+#elif (HS_CMD_HIST_BASE_USEC * (1ULL << (2 * (HS_CMD_HIST_BINS - 2)))) > 4294967295
+#error HS_CMD_HIST_BASE_USEC too large for HS_CMD_HIST_BINS
+#endif
+
 /*
  * CPU Aliveness Period
  */
@@ -165,6 +238,41 @@
  * show up as an obvious run-time error so the compile-time check is redundant.
  */
 
+#if HS_CMD_PIPE_BUDGET < 1
+#error HS_CMD_PIPE_BUDGET cannot be less than 1
+#elif HS_CMD_PIPE_BUDGET > 65535
+#error HS_CMD_PIPE_BUDGET can not exceed 65535
+#endif
+
+#if HS_EVENT_PIPE_BUDGET < 1
+#error HS_EVENT_PIPE_BUDGET cannot be less than 1
+#endif
+
+/*
+ * Watchdog Task
+ */
+#if HS_WATCHDOG_TASK_PERIOD < 0
+#error HS_WATCHDOG_TASK_PERIOD can not be less than 0
+#elif HS_WATCHDOG_TASK_PERIOD >= HS_WATCHDOG_TIMEOUT_VALUE
+#error HS_WATCHDOG_TASK_PERIOD must be less than HS_WATCHDOG_TIMEOUT_VALUE
+#endif
+
+#if HS_WATCHDOG_HEARTBEAT_TIMEOUT < HS_WATCHDOG_TASK_PERIOD
+#error HS_WATCHDOG_HEARTBEAT_TIMEOUT can not be less than HS_WATCHDOG_TASK_PERIOD
+#elif HS_WATCHDOG_HEARTBEAT_TIMEOUT > 4294967295
+#error HS_WATCHDOG_HEARTBEAT_TIMEOUT can not exceed 4294967295
+#endif
+
+#if HS_WATCHDOG_TASK_STACK_SIZE < 1
+#error HS_WATCHDOG_TASK_STACK_SIZE can not be less than 1
+#endif
+
+#if HS_WATCHDOG_TASK_PRIORITY < 1
+#error HS_WATCHDOG_TASK_PRIORITY can not be less than 1
+#elif HS_WATCHDOG_TASK_PRIORITY > 255
+#error HS_WATCHDOG_TASK_PRIORITY can not exceed 255
+#endif
+
 /*
  * Reset Task Delay
  */
@@ -174,6 +282,57 @@
 #error HS_RESET_TASK_DELAY can not exceed 4294967295
 #endif
 
+/*
+ * Message Action Cooldown Length
+ */
+#if HS_MSG_ACT_COOLDOWN_MSEC < 1
+#error HS_MSG_ACT_COOLDOWN_MSEC can not be less than 1
+#elif HS_MSG_ACT_COOLDOWN_MSEC > 65537
+#error HS_MSG_ACT_COOLDOWN_MSEC can not exceed 65537
+#endif
+
+/*
+ * Message Action Queue
+ */
+#if HS_MSG_ACT_QUEUE_DEPTH < 1
+#error HS_MSG_ACT_QUEUE_DEPTH can not be less than 1
+#elif HS_MSG_ACT_QUEUE_DEPTH > 65535
+#error HS_MSG_ACT_QUEUE_DEPTH can not exceed 65535
+#endif
+
+#if HS_MSG_ACT_RATE < 1
+#error HS_MSG_ACT_RATE can not be less than 1
+#elif HS_MSG_ACT_RATE > 1000
+#error HS_MSG_ACT_RATE can not exceed 1000
+#endif
+
+#if HS_MSG_ACT_BURST < 1
+#error HS_MSG_ACT_BURST can not be less than 1
+#elif HS_MSG_ACT_BURST > 1000
+#error HS_MSG_ACT_BURST can not exceed 1000
+#endif
+
+#if HS_MSG_ACT_MAX_PENDING_STEPS < 1
+#error HS_MSG_ACT_MAX_PENDING_STEPS can not be less than 1
+#elif HS_MSG_ACT_MAX_PENDING_STEPS > 65535
+#error HS_MSG_ACT_MAX_PENDING_STEPS can not exceed 65535
+#endif
+
+/*
+ * Monitor state snapshot
+ */
+#if HS_SNAPSHOT_PERIOD < 0
+#error HS_SNAPSHOT_PERIOD can not be less than 0
+#elif HS_SNAPSHOT_PERIOD > 65535
+#error HS_SNAPSHOT_PERIOD can not exceed 65535
+#endif
+
+#if HS_SNAPSHOT_MAX_AGE < 1
+#error HS_SNAPSHOT_MAX_AGE can not be less than 1
+#elif HS_SNAPSHOT_MAX_AGE > 65535
+#error HS_SNAPSHOT_MAX_AGE can not exceed 65535
+#endif
+
 /*
  * Startup Sync Timeout
  */
@@ -197,6 +356,19 @@
 #error HS_EVENTMON_DEFAULT_STATE not defined as a supported enumerated type
 #endif
 
+/*
+ * Default Table Services Notification State
+ */
+#if (HS_TBL_NOTIFY_DEFAULT_STATE != HS_STATE_DISABLED) && (HS_TBL_NOTIFY_DEFAULT_STATE != HS_STATE_ENABLED)
+#error HS_TBL_NOTIFY_DEFAULT_STATE not defined as a supported enumerated type
+#endif
+
+#if HS_TBL_NOTIFY_POLL_CYCLES < 1
+#error HS_TBL_NOTIFY_POLL_CYCLES cannot be less than 1
+#elif HS_TBL_NOTIFY_POLL_CYCLES > 4294967295
+#error HS_TBL_NOTIFY_POLL_CYCLES can not exceed 4294967295
+#endif
+
 /*
  * Default Aliveness Indicator State
  */
@@ -211,6 +383,63 @@
 #error HS_CPUHOG_DEFAULT_STATE not defined as a supported enumerated type
 #endif
 
+/*
+ * Reported CPU cores
+ */
+#if HS_MAX_CPU_CORES < 1
+#error HS_MAX_CPU_CORES cannot be less than 1
+#elif HS_MAX_CPU_CORES > 255
+#error HS_MAX_CPU_CORES can not exceed 255
+#endif
+
+/*
+ * System monitor sampler task
+ */
+#if HS_SYSMON_TASK_PERIOD < 0
+#error HS_SYSMON_TASK_PERIOD can not be less than 0
+#elif HS_SYSMON_TASK_PERIOD > 4294967295
+#error HS_SYSMON_TASK_PERIOD can not exceed 4294967295
+#endif
+
+#if HS_SYSMON_PROC_MIN_PERIOD < 1
+#error HS_SYSMON_PROC_MIN_PERIOD cannot be less than 1
+#elif HS_SYSMON_PROC_MIN_PERIOD > 4294967295
+#error HS_SYSMON_PROC_MIN_PERIOD can not exceed 4294967295
+#endif
+
+#if HS_SYSMON_TASK_STACK_SIZE < 1
+#error HS_SYSMON_TASK_STACK_SIZE can not be less than 1
+#endif
+
+#if HS_SYSMON_TASK_PRIORITY < 1
+#error HS_SYSMON_TASK_PRIORITY can not be less than 1
+#elif HS_SYSMON_TASK_PRIORITY > 255
+#error HS_SYSMON_TASK_PRIORITY can not exceed 255
+#endif
+
+#if HS_SYSMON_READ_ATTEMPTS < 1
+#error HS_SYSMON_READ_ATTEMPTS can not be less than 1
+#elif HS_SYSMON_READ_ATTEMPTS > 255
+#error HS_SYSMON_READ_ATTEMPTS can not exceed 255
+#endif
+
+#if HS_SYSMON_RING_DEPTH < 4
+#error HS_SYSMON_RING_DEPTH can not be less than 4
+#elif HS_SYSMON_RING_DEPTH > 1024
+#error HS_SYSMON_RING_DEPTH can not exceed 1024
+#elif (HS_SYSMON_RING_DEPTH & (HS_SYSMON_RING_DEPTH - 1)) != 0
+#error HS_SYSMON_RING_DEPTH must be a power of two
+#endif
+
+/*
+ * System monitor /proc read size
+ */
+#if HS_SYSTEM_MONITOR_PROC_BUF_SIZE < 128
+#error HS_SYSTEM_MONITOR_PROC_BUF_SIZE cannot be less than 128
+#elif HS_SYSTEM_MONITOR_PROC_BUF_SIZE > 65535
+#error HS_SYSTEM_MONITOR_PROC_BUF_SIZE can not exceed 65535
+#endif
+
 /*
  * Total number of Utils per Interval
  */
@@ -229,6 +458,100 @@
 #error HS_UTIL_PER_INTERVAL_HOGGING can not exceed HS_CPU_UTILIZATION_MAX
 #endif
 
+/*
+ * Burst threshold for sampler task samples
+ */
+#if HS_UTIL_BURST_THRESHOLD < 1
+#error HS_UTIL_BURST_THRESHOLD cannot be less than 1
+#elif HS_UTIL_BURST_THRESHOLD > HS_CPU_UTILIZATION_MAX
+#error HS_UTIL_BURST_THRESHOLD can not exceed HS_CPU_UTILIZATION_MAX
+#elif HS_UTIL_BURST_THRESHOLD > 65535
+#error HS_UTIL_BURST_THRESHOLD can not exceed 65535
+#endif
+
+/*
+ * Stack Monitor
+ */
+#if HS_STACKMON_TOP_N < 1
+#error HS_STACKMON_TOP_N cannot be less than 1
+#elif HS_STACKMON_TOP_N > 255
+#error HS_STACKMON_TOP_N can not exceed 255
+#endif
+
+#if HS_MAX_REGISTERED_STACKS < 2
+#error HS_MAX_REGISTERED_STACKS cannot be less than 2
+#elif HS_MAX_REGISTERED_STACKS > 255
+#error HS_MAX_REGISTERED_STACKS can not exceed 255
+#endif
+
+#if HS_STACKMON_FILL_BYTE > 255
+#error HS_STACKMON_FILL_BYTE can not exceed 255
+#endif
+
+#if HS_STACKMON_TASKS_PER_CYCLE < 1
+#error HS_STACKMON_TASKS_PER_CYCLE cannot be less than 1
+#elif HS_STACKMON_TASKS_PER_CYCLE > 65535
+#error HS_STACKMON_TASKS_PER_CYCLE can not exceed 65535
+#endif
+
+#if HS_STACKMON_USAGE_LIMIT < 1
+#error HS_STACKMON_USAGE_LIMIT cannot be less than 1
+#elif HS_STACKMON_USAGE_LIMIT > 100
+#error HS_STACKMON_USAGE_LIMIT can not exceed 100
+#endif
+
+#if HS_STACKMON_ACTION_TYPE > (HS_STACKMON_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES)
+#error HS_STACKMON_ACTION_TYPE can not exceed HS_STACKMON_ACT_LAST_NONMSG plus HS_MAX_MSG_ACT_TYPES
+#endif
+
+/*
+ * Software Bus Monitor
+ */
+#if HS_SBMON_MAX_PIPES < 1
+#error HS_SBMON_MAX_PIPES cannot be less than 1
+#elif HS_SBMON_MAX_PIPES > 255
+#error HS_SBMON_MAX_PIPES can not exceed 255
+#endif
+
+#if HS_SBMON_PIPE_DEPTH < 1
+#error HS_SBMON_PIPE_DEPTH cannot be less than 1
+#endif
+
+#if HS_SBMON_CYCLES_PER_SAMPLE < 1
+#error HS_SBMON_CYCLES_PER_SAMPLE cannot be less than 1
+#elif HS_SBMON_CYCLES_PER_SAMPLE > 4294967295
+#error HS_SBMON_CYCLES_PER_SAMPLE can not exceed 4294967295
+#endif
+
+#if HS_SBMON_FULL_PCT < 1
+#error HS_SBMON_FULL_PCT cannot be less than 1
+#elif HS_SBMON_FULL_PCT > 100
+#error HS_SBMON_FULL_PCT can not exceed 100
+#endif
+
+#if HS_SBMON_FULL_SAMPLES < 1
+#error HS_SBMON_FULL_SAMPLES cannot be less than 1
+#elif HS_SBMON_FULL_SAMPLES > 65534
+#error HS_SBMON_FULL_SAMPLES can not exceed 65534
+#endif
+
+#if HS_SBMON_ACTION_TYPE > (HS_SBMON_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES)
+#error HS_SBMON_ACTION_TYPE can not exceed HS_SBMON_ACT_LAST_NONMSG plus HS_MAX_MSG_ACT_TYPES
+#endif
+
+/*
+ * Message Monitor pipe
+ */
+#if HS_MSGMON_PIPE_DEPTH < 1
+#error HS_MSGMON_PIPE_DEPTH cannot be less than 1
+#endif
+
+#if HS_MSGMON_MSG_LIMIT < 1
+#error HS_MSGMON_MSG_LIMIT cannot be less than 1
+#elif HS_MSGMON_MSG_LIMIT > 65535
+#error HS_MSGMON_MSG_LIMIT can not exceed 65535
+#endif
+
 /*
  * Hogging Timeout in Intervals
  */
@@ -256,6 +579,80 @@
 #error HS_UTIL_AVERAGE_NUM_INTERVAL can not exceed HS_UTIL_PEAK_NUM_INTERVAL
 #endif
 
+/*
+ * Event Monitor Lookup Hash Buckets
+ */
+#if HS_EVENTMON_HASH_BUCKETS < 1
+#error HS_EVENTMON_HASH_BUCKETS cannot be less than 1
+#elif HS_EVENTMON_HASH_BUCKETS > 65536
+#error HS_EVENTMON_HASH_BUCKETS can not exceed 65536
+#elif (HS_EVENTMON_HASH_BUCKETS & (HS_EVENTMON_HASH_BUCKETS - 1)) != 0
+#error HS_EVENTMON_HASH_BUCKETS must be a power of two
+#endif
+
+/*
+ * Message Monitor Lookup Hash Buckets
+ */
+#if HS_MSGMON_HASH_BUCKETS < 1
+#error HS_MSGMON_HASH_BUCKETS cannot be less than 1
+#elif HS_MSGMON_HASH_BUCKETS > 65536
+#error HS_MSGMON_HASH_BUCKETS can not exceed 65536
+#elif (HS_MSGMON_HASH_BUCKETS & (HS_MSGMON_HASH_BUCKETS - 1)) != 0
+#error HS_MSGMON_HASH_BUCKETS must be a power of two
+#endif
+
+/*
+ * Table Validation Duplicate Check Hash Buckets
+ */
+#if HS_VALIDATE_HASH_BUCKETS < 1
+#error HS_VALIDATE_HASH_BUCKETS cannot be less than 1
+#elif HS_VALIDATE_HASH_BUCKETS > 65536
+#error HS_VALIDATE_HASH_BUCKETS can not exceed 65536
+#elif (HS_VALIDATE_HASH_BUCKETS & (HS_VALIDATE_HASH_BUCKETS - 1)) != 0
+#error HS_VALIDATE_HASH_BUCKETS must be a power of two
+#endif
+
+/*
+ * Validation Report Entry Pairs
+ */
+#if HS_MAX_VAL_REPORT_PAIRS < 1
+#error HS_MAX_VAL_REPORT_PAIRS cannot be less than 1
+#elif HS_MAX_VAL_REPORT_PAIRS > 65535
+#error HS_MAX_VAL_REPORT_PAIRS can not exceed 65535
+#endif
+
+/*
+ * Action History Depth
+ */
+#if HS_HISTORY_DEPTH < 1
+#error HS_HISTORY_DEPTH cannot be less than 1
+#elif HS_HISTORY_DEPTH > 255
+#error HS_HISTORY_DEPTH can not exceed 255
+#endif
+
+/*
+ * Phase Performance IDs, consecutive in phase order
+ */
+#if (HS_TBLMGMT_PERF_ID + HS_PHASE_MEMMON) != HS_MEMMON_PERF_ID
+#error HS_MEMMON_PERF_ID must be HS_TBLMGMT_PERF_ID + HS_PHASE_MEMMON
+#endif
+
+#if (HS_TBLMGMT_PERF_ID + HS_PHASE_STACKMON) != HS_STACKMON_PERF_ID
+#error HS_STACKMON_PERF_ID must be HS_TBLMGMT_PERF_ID + HS_PHASE_STACKMON
+#endif
+
+#if (HS_TBLMGMT_PERF_ID + HS_PHASE_SBMON) != HS_SBMON_PERF_ID
+#error HS_SBMON_PERF_ID must be HS_TBLMGMT_PERF_ID + HS_PHASE_SBMON
+#endif
+
+#if (HS_TBLMGMT_PERF_ID + HS_PHASE_MSGMON) != HS_MSGMON_PERF_ID
+#error HS_MSGMON_PERF_ID must be HS_TBLMGMT_PERF_ID + HS_PHASE_MSGMON
+#endif
+
+#if (HS_TBLMGMT_PERF_ID + HS_NUM_PHASES - 1) != HS_MSGMON_PERF_ID
+#error HS_MSGMON_PERF_ID must be the performance ID of the last phase
+#endif
+
 #ifndef HS_MISSION_REV
 #error HS_MISSION_REV must be defined!
 #elif (HS_MISSION_REV < 0)
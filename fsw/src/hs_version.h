@@ -32,8 +32,8 @@
  */
 
 #define HS_MAJOR_VERSION 2  /**< \brief Major version number */
-#define HS_MINOR_VERSION 4  /**< \brief Minor version number */
-#define HS_REVISION      99 /**< \brief Revision number */
+#define HS_MINOR_VERSION 5  /**< \brief Minor version number */
+#define HS_REVISION      0  /**< \brief Revision number */
 
 /**\}*/
 
@@ -0,0 +1,134 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used by the CFS Health and Safety (HS) watchdog task
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "hs_app.h"
+#include "hs_watchdog.h"
+#include "hs_stackmon.h"
+#include "hs_eventids.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start the watchdog task                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_WatchdogTaskInit(void)
+{
+    CFE_Status_t Status;
+
+    HS_AppData.WatchdogTaskState = HS_STATE_DISABLED;
+
+    if (HS_AppData.WatchdogTaskPeriod == 0)
+    {
+        return;
+    }
+
+    HS_AppData.WatchdogLastHeartbeat = HS_AppData.WatchdogHeartbeat;
+    HS_AppData.WatchdogStaleMsec     = 0;
+
+    /*
+    ** The task runs on a stack HS fills, so the stack monitor can measure it
+    */
+    memset(HS_AppData.WatchdogStack, HS_STACKMON_FILL_BYTE, sizeof(HS_AppData.WatchdogStack));
+
+    Status = CFE_ES_CreateChildTask(&HS_AppData.WatchdogTaskId, HS_WATCHDOG_TASK_NAME, HS_WatchdogTask,
+                                    HS_AppData.WatchdogStack, sizeof(HS_AppData.WatchdogStack),
+                                    HS_WATCHDOG_TASK_PRIORITY, 0);
+
+    if (Status == CFE_SUCCESS)
+    {
+        HS_AppData.WatchdogTaskState = HS_STATE_ENABLED;
+        HS_StackMonRegister(HS_WATCHDOG_TASK_NAME, (cpuaddr)HS_AppData.WatchdogStack);
+    }
+    else
+    {
+        /*
+        ** Not fatal, the main loop keeps servicing the watchdog
+        */
+        CFE_EVS_SendEvent(HS_WATCHDOG_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Creating Watchdog Task,RC=0x%08X", (unsigned int)Status);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Watchdog task entry point                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_WatchdogTask(void)
+{
+    while (OS_TaskDelay(HS_AppData.WatchdogTaskPeriod) == OS_SUCCESS)
+    {
+        CFE_ES_IncrementTaskCounter();
+
+        HS_WatchdogCheck();
+    }
+
+    /*
+    ** Hand servicing back to the main loop in case HS itself keeps running
+    */
+    HS_AppData.WatchdogTaskState = HS_STATE_DISABLED;
+
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check the HS heartbeat and service the watchdog                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_WatchdogCheck(void)
+{
+    uint32 Heartbeat = HS_AppData.WatchdogHeartbeat;
+
+    if (Heartbeat != HS_AppData.WatchdogLastHeartbeat)
+    {
+        HS_AppData.WatchdogLastHeartbeat = Heartbeat;
+        HS_AppData.WatchdogStaleMsec     = 0;
+    }
+    else if (HS_AppData.WatchdogStaleMsec < HS_WATCHDOG_HEARTBEAT_TIMEOUT)
+    {
+        HS_AppData.WatchdogStaleMsec += HS_AppData.WatchdogTaskPeriod;
+
+        if (HS_AppData.WatchdogStaleMsec >= HS_WATCHDOG_HEARTBEAT_TIMEOUT)
+        {
+            CFE_EVS_SendEvent(HS_WATCHDOG_STALL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "HS main loop stalled for %u ms, watchdog no longer serviced",
+                              (unsigned int)HS_AppData.WatchdogStaleMsec);
+        }
+    }
+
+    /*
+    ** Leave the watchdog alone while HS is stalled or about to reset the processor
+    */
+    if ((HS_AppData.WatchdogStaleMsec < HS_WATCHDOG_HEARTBEAT_TIMEOUT) &&
+        (HS_AppData.ServiceWatchdogFlag == HS_STATE_ENABLED))
+    {
+        CFE_PSP_WatchdogService();
+    }
+}
@@ -0,0 +1,81 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Health and Safety (HS) watchdog task
+ *
+ * The watchdog task is a high priority child task that services the
+ * watchdog every #HS_WATCHDOG_TASK_PERIOD milliseconds, independent of how
+ * long each HS cycle takes. The HS main loop counts a heartbeat each cycle;
+ * once the heartbeat stops for #HS_WATCHDOG_HEARTBEAT_TIMEOUT milliseconds
+ * the task stops servicing the watchdog so a hung HS is still caught.
+ */
+#ifndef HS_WATCHDOG_H
+#define HS_WATCHDOG_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Start the watchdog task
+ *
+ *  \par Description
+ *       Creates the watchdog task unless #HS_WATCHDOG_TASK_PERIOD is 0.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once the watchdog has been enabled. If the task can't be
+ *       created the main loop keeps servicing the watchdog itself.
+ */
+void HS_WatchdogTaskInit(void);
+
+/**
+ * \brief Watchdog task entry point
+ *
+ *  \par Description
+ *       Checks the HS heartbeat and services the watchdog every
+ *       #HS_WATCHDOG_TASK_PERIOD milliseconds.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Runs until its task delay fails, which happens when the task is
+ *       being deleted along with HS. On the way out it hands watchdog
+ *       servicing back to the main loop.
+ */
+void HS_WatchdogTask(void);
+
+/**
+ * \brief Check the HS heartbeat and service the watchdog
+ *
+ *  \par Description
+ *       Services the watchdog if the HS main loop has completed a cycle
+ *       within the last #HS_WATCHDOG_HEARTBEAT_TIMEOUT milliseconds and
+ *       HS has not disabled servicing for a processor reset.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the watchdog task once per period.
+ */
+void HS_WatchdogCheck(void);
+
+#endif
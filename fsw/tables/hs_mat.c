@@ -57,6 +57,10 @@ typedef struct
 {
     uint16     EnableState; /**< \brief If entry contains message */
     uint16     Cooldown;    /**< \brief Maximum rate at which message can be sent */
+    uint16     Priority;    /**< \brief Send order when queued, lower values are sent first */
+    uint16     NextAction;  /**< \brief Index + 1 of the entry sent after this one, 0 ends the sequence */
+    uint16     NextDelay;   /**< \brief Time before NextAction is sent */
+    uint16     Spare;       /**< \brief Spare for alignment */
     HS_Message HsMsg;       /**< \brief HS Message/Command Entry */
 } HS_MatTableEntry_t;
 
@@ -64,39 +68,63 @@ typedef struct
 #define HS_MEMBER_SIZE(member) (sizeof(((HS_Message *)0)->member))
 
 HS_MatTableEntry_t HS_MsgActs_Tbl[HS_MAX_MSG_ACT_TYPES] = {
-    /*          EnableState               Cooldown   Message */
+    /*          EnableState               Cooldown   Priority   NextAction   NextDelay   Message */
 
     /*   0 */
     {.EnableState = HS_MAT_STATE_ENABLED,
      .Cooldown    = 10,
+     .Priority    = 0,
+     .NextAction  = 0,
+     .NextDelay   = 0,
      .HsMsg.cmd1  = {CFE_MSG_CMD_HDR_INIT(CFE_TBL_CMD_MID, HS_MEMBER_SIZE(cmd1), CFE_TBL_NOOP_CC, CFE_TBL_NOOP_CKSUM)}},
     /*   1 */
     {.EnableState = HS_MAT_STATE_ENABLED,
      .Cooldown    = 10,
+     .Priority    = 0,
+     .NextAction  = 0,
+     .NextDelay   = 0,
      .HsMsg.cmd2  = {CFE_MSG_CMD_HDR_INIT(CFE_ES_CMD_MID, HS_MEMBER_SIZE(cmd2), CFE_ES_NOOP_CC, CFE_ES_NOOP_CKSUM)}},
     /*   2 */
     {.EnableState = HS_MAT_STATE_DISABLED,
      .Cooldown    = 10,
+     .Priority    = 0,
+     .NextAction  = 0,
+     .NextDelay   = 0,
      .HsMsg.cmd1  = {CFE_MSG_CMD_HDR_INIT(CFE_TBL_CMD_MID, HS_MEMBER_SIZE(cmd1), CFE_TBL_NOOP_CC, CFE_TBL_NOOP_CKSUM)}},
     /*   3 */
     {.EnableState = HS_MAT_STATE_DISABLED,
      .Cooldown    = 10,
+     .Priority    = 0,
+     .NextAction  = 0,
+     .NextDelay   = 0,
      .HsMsg.cmd1  = {CFE_MSG_CMD_HDR_INIT(CFE_TBL_CMD_MID, HS_MEMBER_SIZE(cmd1), CFE_TBL_NOOP_CC, CFE_TBL_NOOP_CKSUM)}},
     /*   4 */
     {.EnableState = HS_MAT_STATE_DISABLED,
      .Cooldown    = 10,
+     .Priority    = 0,
+     .NextAction  = 0,
+     .NextDelay   = 0,
      .HsMsg.cmd1  = {CFE_MSG_CMD_HDR_INIT(CFE_TBL_CMD_MID, HS_MEMBER_SIZE(cmd1), CFE_TBL_NOOP_CC, CFE_TBL_NOOP_CKSUM)}},
     /*   5 */
     {.EnableState = HS_MAT_STATE_DISABLED,
      .Cooldown    = 10,
+     .Priority    = 0,
+     .NextAction  = 0,
+     .NextDelay   = 0,
      .HsMsg.cmd1  = {CFE_MSG_CMD_HDR_INIT(CFE_TBL_CMD_MID, HS_MEMBER_SIZE(cmd1), CFE_TBL_NOOP_CC, CFE_TBL_NOOP_CKSUM)}},
     /*   6 */
     {.EnableState = HS_MAT_STATE_DISABLED,
      .Cooldown    = 10,
+     .Priority    = 0,
+     .NextAction  = 0,
+     .NextDelay   = 0,
      .HsMsg.cmd1  = {CFE_MSG_CMD_HDR_INIT(CFE_TBL_CMD_MID, HS_MEMBER_SIZE(cmd1), CFE_TBL_NOOP_CC, CFE_TBL_NOOP_CKSUM)}},
     /*   7 */
     {.EnableState = HS_MAT_STATE_DISABLED,
      .Cooldown    = 10,
+     .Priority    = 0,
+     .NextAction  = 0,
+     .NextDelay   = 0,
      .HsMsg.cmd1  = {CFE_MSG_CMD_HDR_INIT(CFE_TBL_CMD_MID, HS_MEMBER_SIZE(cmd1), CFE_TBL_NOOP_CC, CFE_TBL_NOOP_CKSUM)}}
 
 };
@@ -0,0 +1,57 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  The CFS Health and Safety (HS) Message Freshness Table Definition
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "cfe.h"
+#include "hs_mission_cfg.h"
+#include "hs_tbl.h"
+#include "hs_tbldefs.h"
+#include "cfe_tbl_filedef.h"
+
+#include "cfe_msgids.h"
+
+HS_MFTEntry_t HS_MsgMon_Tbl[HS_MAX_MONITORED_MSGS] = {
+    /*          MsgId                                    MaxAgeMsec ActionType        Spare */
+
+    /*   0 */ {CFE_SB_MSGID_WRAP_VALUE(CFE_ES_HK_TLM_MID), 10000, HS_MFT_ACT_EVENT, 0},
+    /*   1 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*   2 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*   3 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*   4 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*   5 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*   6 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*   7 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*   8 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*   9 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*  10 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*  11 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*  12 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*  13 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*  14 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+    /*  15 */ {CFE_SB_MSGID_RESERVED, 0, HS_MFT_ACT_NOACT, 0},
+};
+
+CFE_TBL_FILEDEF(HS_MsgMon_Tbl, HS.MsgMon_Tbl, HS MsgMon Table, hs_mft.tbl)
@@ -0,0 +1,47 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  The CFS Health and Safety (HS) Memory Monitor Table Definition
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "cfe.h"
+#include "hs_mission_cfg.h"
+#include "hs_tbl.h"
+#include "hs_tbldefs.h"
+#include "cfe_tbl_filedef.h"
+
+HS_MMTEntry_t HS_MemMon_Tbl[HS_MAX_MONITORED_MEM] = {
+    /*          ResourceType         AppName PoolIndex MinFreeBytes MinContigPct ActionType        */
+
+    /*   0 */ {HS_MMT_TYPE_HEAP, "", 0, 65536, 10, HS_MMT_ACT_EVENT},
+    /*   1 */ {HS_MMT_TYPE_NOTYPE, "", 0, 0, 0, HS_MMT_ACT_NOACT},
+    /*   2 */ {HS_MMT_TYPE_NOTYPE, "", 0, 0, 0, HS_MMT_ACT_NOACT},
+    /*   3 */ {HS_MMT_TYPE_NOTYPE, "", 0, 0, 0, HS_MMT_ACT_NOACT},
+    /*   4 */ {HS_MMT_TYPE_NOTYPE, "", 0, 0, 0, HS_MMT_ACT_NOACT},
+    /*   5 */ {HS_MMT_TYPE_NOTYPE, "", 0, 0, 0, HS_MMT_ACT_NOACT},
+    /*   6 */ {HS_MMT_TYPE_NOTYPE, "", 0, 0, 0, HS_MMT_ACT_NOACT},
+    /*   7 */ {HS_MMT_TYPE_NOTYPE, "", 0, 0, 0, HS_MMT_ACT_NOACT},
+};
+
+CFE_TBL_FILEDEF(HS_MemMon_Tbl, HS.MemMon_Tbl, HS MemMon Table, hs_mmt.tbl)
@@ -0,0 +1,432 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Host-side benchmark of the CFS Health and Safety (HS) monitor hot paths
+ *
+ *   The monitors run against the same stubs as the unit tests, so the
+ *   times include stub overhead and are only comparable between builds
+ *   run on the same host. Each measurement is printed to stdout as one
+ *   JSON object per line, starting with '{', for regression tracking.
+ */
+
+/*
+ * Includes
+ */
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L /* for clock_gettime */
+#endif
+
+#include "hs_test_utils.h"
+#include "hs_monitors.h"
+#include "hs_cmds.h"
+#include "hs_sysmon.h"
+#include "hs_version.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdio.h>
+#include <time.h>
+
+/*
+ * Benchmark parameters
+ */
+
+/* Timed calls per measurement, can be set at build time */
+#ifndef HS_BENCH_CALLS
+#define HS_BENCH_CALLS 10000
+#endif
+
+/* Untimed calls before each measurement */
+#define HS_BENCH_WARMUP_CALLS 100
+
+/* Synthetic table sizes, each capped at the capacity of the table, which is also measured */
+const uint32 HS_Bench_Sizes[] = {1, 4, 16, 64};
+
+#define HS_BENCH_NUM_SIZES (sizeof(HS_Bench_Sizes) / sizeof(HS_Bench_Sizes[0]))
+
+/*
+ * Synthetic tables and inputs
+ */
+HS_AMTEntry_t          HS_Bench_AMTable[HS_MAX_MONITORED_APPS];
+HS_EMTEntry_t          HS_Bench_EMTable[HS_MAX_MONITORED_EVENTS];
+HS_XCTEntry_t          HS_Bench_XCTable[HS_MAX_EXEC_CNT_SLOTS];
+CFE_EVS_LongEventTlm_t HS_Bench_Event;
+uint32                 HS_Bench_ExecutionCounter;
+
+typedef void (*HS_Bench_Call_t)(void);
+typedef void (*HS_Bench_Setup_t)(uint32 Entries);
+
+/*
+ * Helper functions
+ */
+
+static uint64 HS_Bench_NowNsec(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return ((uint64)Now.tv_sec * 1000000000) + (uint64)Now.tv_nsec;
+}
+
+/* Every call reports a new execution count, so monitored apps look healthy */
+static void HS_Bench_GetAppInfoHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_ES_AppInfo_t *AppInfo = UT_Hook_GetArgValueByName(Context, "AppInfo", CFE_ES_AppInfo_t *);
+
+    HS_Bench_ExecutionCounter++;
+    AppInfo->ExecutionCounter = HS_Bench_ExecutionCounter;
+}
+
+/* Times one function with the current tables and prints the result */
+static double HS_Bench_Run(const char *Function, const char *Mix, uint32 Entries, HS_Bench_Call_t Call)
+{
+    uint32 i;
+    uint64 Start;
+    uint64 Elapsed;
+    double NsecPerCall;
+
+    for (i = 0; i < HS_BENCH_WARMUP_CALLS; i++)
+    {
+        Call();
+    }
+
+    Start = HS_Bench_NowNsec();
+
+    for (i = 0; i < HS_BENCH_CALLS; i++)
+    {
+        Call();
+    }
+
+    Elapsed     = HS_Bench_NowNsec() - Start;
+    NsecPerCall = (double)Elapsed / HS_BENCH_CALLS;
+
+    printf("{\"function\":\"%s\",\"mix\":\"%s\",\"entries\":%lu,\"calls\":%lu,\"ns_per_call\":%.1f,"
+           "\"ns_per_entry\":%.1f}\n",
+           Function, Mix, (unsigned long)Entries, (unsigned long)HS_BENCH_CALLS, NsecPerCall, NsecPerCall / Entries);
+    fflush(stdout);
+
+    UtAssert_True(Elapsed > 0, "%s %s, %lu entries: %.1f ns per call", Function, Mix, (unsigned long)Entries,
+                  NsecPerCall);
+
+    return NsecPerCall;
+}
+
+/*
+ * Times one function over the synthetic table sizes, then prints the cost
+ * of each added entry, the slope between the smallest and largest size
+ */
+static void HS_Bench_Sweep(const char *Function, const char *Mix, uint32 MaxEntries, HS_Bench_Setup_t Setup,
+                           HS_Bench_Call_t Call)
+{
+    uint32 SizeIndex;
+    uint32 Entries;
+    uint32 FirstEntries     = 0;
+    uint32 LastEntries      = 0;
+    double FirstNsecPerCall = 0;
+    double LastNsecPerCall  = 0;
+
+    for (SizeIndex = 0; SizeIndex < HS_BENCH_NUM_SIZES; SizeIndex++)
+    {
+        Entries = HS_Bench_Sizes[SizeIndex];
+        if (Entries > MaxEntries)
+        {
+            Entries = MaxEntries;
+        }
+
+        if (Entries != LastEntries)
+        {
+            Setup(Entries);
+            LastNsecPerCall = HS_Bench_Run(Function, Mix, Entries, Call);
+            LastEntries     = Entries;
+
+            if (FirstEntries == 0)
+            {
+                FirstEntries     = Entries;
+                FirstNsecPerCall = LastNsecPerCall;
+            }
+        }
+    }
+
+    if (LastEntries != MaxEntries)
+    {
+        Setup(MaxEntries);
+        LastNsecPerCall = HS_Bench_Run(Function, Mix, MaxEntries, Call);
+        LastEntries     = MaxEntries;
+    }
+
+    if (LastEntries > FirstEntries)
+    {
+        printf("{\"function\":\"%s\",\"mix\":\"%s\",\"ns_per_added_entry\":%.2f}\n", Function, Mix,
+               (LastNsecPerCall - FirstNsecPerCall) / (LastEntries - FirstEntries));
+        fflush(stdout);
+    }
+}
+
+static void HS_Bench_SetupApps(uint32 Entries, const char *Mix)
+{
+    uint32 i;
+
+    memset(HS_Bench_AMTable, 0, sizeof(HS_Bench_AMTable));
+    memset(HS_AppData.AppMonState, 0, sizeof(HS_AppData.AppMonState));
+
+    for (i = 0; i < Entries; i++)
+    {
+        snprintf(HS_Bench_AMTable[i].AppName, sizeof(HS_Bench_AMTable[i].AppName), "BENCH_APP_%lu", (unsigned long)i);
+        HS_Bench_AMTable[i].CycleCount = 0xFFFF;
+        HS_Bench_AMTable[i].ActionType = HS_AMT_ACT_EVENT;
+
+        HS_AppData.AppMonState[i].CheckInCountdown = HS_Bench_AMTable[i].CycleCount;
+    }
+
+    HS_AppData.AMTablePtr = HS_Bench_AMTable;
+    HS_Test_CompileRuntime();
+
+    UT_ResetState(UT_KEY(CFE_ES_GetAppInfo));
+    if (strcmp(Mix, "healthy") == 0)
+    {
+        UT_SetHandlerFunction(UT_KEY(CFE_ES_GetAppInfo), HS_Bench_GetAppInfoHandler, NULL);
+    }
+}
+
+static void HS_Bench_SetupAppsHealthy(uint32 Entries)
+{
+    HS_Bench_SetupApps(Entries, "healthy");
+}
+
+/* Execution counts never change, so every App counts down toward its action */
+static void HS_Bench_SetupAppsStalled(uint32 Entries)
+{
+    HS_Bench_SetupApps(Entries, "stalled");
+}
+
+/*
+ * All entries share one hash bucket, so the chain walked for an event in
+ * that bucket grows with the table
+ */
+static void HS_Bench_SetupEvents(uint32 Entries, uint16 EventID, const char *AppName)
+{
+    uint32 i;
+
+    memset(HS_Bench_EMTable, 0, sizeof(HS_Bench_EMTable));
+    memset(&HS_Bench_Event, 0, sizeof(HS_Bench_Event));
+
+    for (i = 0; i < Entries; i++)
+    {
+        strncpy(HS_Bench_EMTable[i].AppName, "BENCH_APP", sizeof(HS_Bench_EMTable[i].AppName) - 1);
+        HS_Bench_EMTable[i].EventID = (uint16)(1 + (i * HS_EVENTMON_HASH_BUCKETS));
+
+        /* Message Actions are disabled, so a match takes no action */
+        HS_Bench_EMTable[i].ActionType = HS_EMT_ACT_LAST_NONMSG + 1;
+    }
+
+    HS_AppData.EMTablePtr   = HS_Bench_EMTable;
+    HS_AppData.MsgActsState = HS_STATE_DISABLED;
+    HS_Test_CompileRuntime();
+
+    strncpy(HS_Bench_Event.Payload.PacketID.AppName, AppName, sizeof(HS_Bench_Event.Payload.PacketID.AppName) - 1);
+    HS_Bench_Event.Payload.PacketID.EventID = EventID;
+}
+
+/* An event from a bucket with no entries */
+static void HS_Bench_SetupEventsMiss(uint32 Entries)
+{
+    HS_Bench_SetupEvents(Entries, 0, "BENCH_APP");
+}
+
+/*
+ * An event with the ID of the last entry of the chain but from another App,
+ * so every entry is visited and none matches
+ */
+static void HS_Bench_SetupEventsChain(uint32 Entries)
+{
+    HS_Bench_SetupEvents(Entries, (uint16)(1 + ((Entries - 1) * HS_EVENTMON_HASH_BUCKETS)), "OTHER_APP");
+}
+
+/* An event that matches the last entry of the chain */
+static void HS_Bench_SetupEventsMatch(uint32 Entries)
+{
+    HS_Bench_SetupEvents(Entries, (uint16)(1 + ((Entries - 1) * HS_EVENTMON_HASH_BUCKETS)), "BENCH_APP");
+}
+
+static void HS_Bench_SetupHk(uint32 EventEntries, uint32 ExecEntries)
+{
+    uint32 i;
+
+    HS_Bench_SetupEvents(EventEntries, 0, "BENCH_APP");
+
+    memset(HS_Bench_XCTable, 0, sizeof(HS_Bench_XCTable));
+
+    for (i = 0; i < ExecEntries; i++)
+    {
+        snprintf(HS_Bench_XCTable[i].ResourceName, sizeof(HS_Bench_XCTable[i].ResourceName), "BENCH_TASK_%lu",
+                 (unsigned long)i);
+        HS_Bench_XCTable[i].ResourceType = HS_XCT_TYPE_APP_MAIN;
+    }
+
+    HS_AppData.XCTablePtr    = HS_Bench_XCTable;
+    HS_AppData.ExeCountState = HS_STATE_ENABLED;
+}
+
+/* Invalid event monitor entries are counted by name lookup */
+static void HS_Bench_SetupHkEvents(uint32 Entries)
+{
+    HS_Bench_SetupHk(Entries, 0);
+}
+
+/* Each execution counter slot is read by task lookup */
+static void HS_Bench_SetupHkExecCounts(uint32 Entries)
+{
+    HS_Bench_SetupHk(0, Entries);
+}
+
+/*
+ * Every table full, with healthy apps, and an event budget of events that
+ * walk the whole hash chain
+ */
+static void HS_Bench_SetupCycle(void)
+{
+    HS_Bench_SetupApps(HS_MAX_MONITORED_APPS, "healthy");
+    HS_Bench_SetupHk(HS_MAX_MONITORED_EVENTS, HS_MAX_EXEC_CNT_SLOTS);
+
+    HS_Bench_Event.Payload.PacketID.EventID = (uint16)(1 + ((HS_MAX_MONITORED_EVENTS - 1) * HS_EVENTMON_HASH_BUCKETS));
+    strncpy(HS_Bench_Event.Payload.PacketID.AppName, "OTHER_APP", sizeof(HS_Bench_Event.Payload.PacketID.AppName) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_SysMonGetCpuUtilization), 0);
+}
+
+static void HS_Bench_CallCycle(void)
+{
+    uint32 i;
+
+    HS_MonitorApplications();
+
+    for (i = 0; i < HS_EVENT_PIPE_BUDGET; i++)
+    {
+        HS_MonitorEvent(&HS_Bench_Event);
+    }
+
+    HS_MonitorUtilization();
+    HS_SendHkCmd(&UT_CmdBuf.SendHkCmd);
+}
+
+static void HS_Bench_CallMonitorEvent(void)
+{
+    HS_MonitorEvent(&HS_Bench_Event);
+}
+
+static void HS_Bench_CallSendHk(void)
+{
+    HS_SendHkCmd(&UT_CmdBuf.SendHkCmd);
+}
+
+/*
+ * Benchmark cases
+ */
+
+void HS_Bench_Setup(void)
+{
+    HS_Test_Setup();
+
+    /* Benchmarks send far more events than the unit test context can hold */
+    UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), NULL, NULL);
+
+    HS_AppData.CurrentAppMonState   = HS_STATE_ENABLED;
+    HS_AppData.CurrentEventMonState = HS_STATE_ENABLED;
+}
+
+void HS_Bench_MonitorApplications(void)
+{
+    HS_Bench_Sweep("HS_MonitorApplications", "healthy", HS_MAX_MONITORED_APPS, HS_Bench_SetupAppsHealthy,
+                   HS_MonitorApplications);
+    HS_Bench_Sweep("HS_MonitorApplications", "stalled", HS_MAX_MONITORED_APPS, HS_Bench_SetupAppsStalled,
+                   HS_MonitorApplications);
+}
+
+void HS_Bench_MonitorEvent(void)
+{
+    HS_Bench_Sweep("HS_MonitorEvent", "miss", HS_MAX_MONITORED_EVENTS, HS_Bench_SetupEventsMiss,
+                   HS_Bench_CallMonitorEvent);
+    HS_Bench_Sweep("HS_MonitorEvent", "chain", HS_MAX_MONITORED_EVENTS, HS_Bench_SetupEventsChain,
+                   HS_Bench_CallMonitorEvent);
+    HS_Bench_Sweep("HS_MonitorEvent", "match", HS_MAX_MONITORED_EVENTS, HS_Bench_SetupEventsMatch,
+                   HS_Bench_CallMonitorEvent);
+}
+
+void HS_Bench_MonitorUtilization(void)
+{
+    /* The whole peak window is scanned every call, so its size is the entry count */
+    UT_SetDefaultReturnValue(UT_KEY(HS_SysMonGetCpuUtilization), 0);
+    HS_Bench_Run("HS_MonitorUtilization", "idle", HS_UTIL_PEAK_NUM_INTERVAL, HS_MonitorUtilization);
+
+    HS_AppData.CurrentCPUHogState = HS_STATE_ENABLED;
+    HS_AppData.MaxCPUHoggingTime  = 0xFFFFFFFF;
+    UT_SetDefaultReturnValue(UT_KEY(HS_SysMonGetCpuUtilization), HS_CPU_UTILIZATION_MAX);
+    HS_Bench_Run("HS_MonitorUtilization", "hogging", HS_UTIL_PEAK_NUM_INTERVAL, HS_MonitorUtilization);
+}
+
+void HS_Bench_SendHkCmd(void)
+{
+    HS_Bench_Sweep("HS_SendHkCmd", "events", HS_MAX_MONITORED_EVENTS, HS_Bench_SetupHkEvents, HS_Bench_CallSendHk);
+    HS_Bench_Sweep("HS_SendHkCmd", "execcounts", HS_MAX_EXEC_CNT_SLOTS, HS_Bench_SetupHkExecCounts,
+                   HS_Bench_CallSendHk);
+}
+
+/*
+ * The monitors of one HS cycle with every table at capacity, where the
+ * entry count is the total of the AMT, EMT and XCT
+ */
+void HS_Bench_Cycle(void)
+{
+    HS_Bench_SetupCycle();
+    HS_Bench_Run("HS_Cycle", "full", HS_MAX_MONITORED_APPS + HS_MAX_MONITORED_EVENTS + HS_MAX_EXEC_CNT_SLOTS,
+                 HS_Bench_CallCycle);
+}
+
+/*
+ * Register the benchmark cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    printf("{\"benchmark\":\"hs\",\"version\":\"%d.%d.%d\",\"calls\":%lu,\"warmup_calls\":%d}\n", HS_MAJOR_VERSION,
+           HS_MINOR_VERSION, HS_REVISION, (unsigned long)HS_BENCH_CALLS, HS_BENCH_WARMUP_CALLS);
+
+    /* Capacities and memory footprint of this build */
+    printf("{\"max_apps\":%lu,\"max_events\":%lu,\"max_exec_cnt_slots\":%lu,\"max_msg_acts\":%lu,"
+           "\"app_data_bytes\":%lu,\"amt_bytes\":%lu,\"emt_bytes\":%lu,\"xct_bytes\":%lu,\"mat_bytes\":%lu}\n",
+           (unsigned long)HS_MAX_MONITORED_APPS, (unsigned long)HS_MAX_MONITORED_EVENTS,
+           (unsigned long)HS_MAX_EXEC_CNT_SLOTS, (unsigned long)HS_MAX_MSG_ACT_TYPES,
+           (unsigned long)sizeof(HS_AppData_t),
+           (unsigned long)(sizeof(HS_AMTEntry_t) * HS_MAX_MONITORED_APPS),
+           (unsigned long)(sizeof(HS_EMTEntry_t) * HS_MAX_MONITORED_EVENTS),
+           (unsigned long)(sizeof(HS_XCTEntry_t) * HS_MAX_EXEC_CNT_SLOTS),
+           (unsigned long)(sizeof(HS_MATEntry_t) * HS_MAX_MSG_ACT_TYPES));
+
+    UtTest_Add(HS_Bench_MonitorApplications, HS_Bench_Setup, HS_Test_TearDown, "HS_Bench_MonitorApplications");
+    UtTest_Add(HS_Bench_MonitorEvent, HS_Bench_Setup, HS_Test_TearDown, "HS_Bench_MonitorEvent");
+    UtTest_Add(HS_Bench_MonitorUtilization, HS_Bench_Setup, HS_Test_TearDown, "HS_Bench_MonitorUtilization");
+    UtTest_Add(HS_Bench_SendHkCmd, HS_Bench_Setup, HS_Test_TearDown, "HS_Bench_SendHkCmd");
+    UtTest_Add(HS_Bench_Cycle, HS_Bench_Setup, HS_Test_TearDown, "HS_Bench_Cycle");
+}
@@ -0,0 +1,500 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Event storm generator and replay tool for the CFS Health and Safety
+ *   (HS) Event Monitor
+ *
+ *   Each simulated HS cycle puts events into a model of the event pipe,
+ *   which holds #HS_EVENT_PIPE_DEPTH messages and drops the rest like the
+ *   Software Bus would, then runs the real HS_ProcessCommands to read and
+ *   monitor them against the EMT built into this tool. Events come from a
+ *   seeded random stream swept over a range of rates, or from a replay file
+ *   named by the HS_STORM_REPLAY environment variable, with one event per
+ *   line as "<cycle> <app name> <event ID> [long|short]".
+ *
+ *   Other settings are read from the environment: HS_STORM_SEED,
+ *   HS_STORM_CYCLES, HS_STORM_HZ (HS cycles per second), HS_STORM_MATCH_PCT
+ *   (percent of generated events that hit an EMT entry) and
+ *   HS_STORM_SHORT_PCT (percent sent in the short format). Results are
+ *   printed to stdout as one JSON object per line. Times include the stub
+ *   overhead of the unit test framework, and Message Action cooldowns don't
+ *   expire since the stubbed clock doesn't move.
+ */
+
+/*
+ * Includes
+ */
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L /* for clock_gettime */
+#endif
+
+#include "hs_test_utils.h"
+#include "hs_app.h"
+#include "hs_monitors.h"
+#include "hs_msgacts.h"
+#include "hs_history.h"
+#include "hs_version.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Storm parameters
+ */
+
+/* Defaults for the settings read from the environment */
+#define HS_STORM_DEFAULT_SEED      1
+#define HS_STORM_DEFAULT_CYCLES    1000
+#define HS_STORM_DEFAULT_HZ        1
+#define HS_STORM_DEFAULT_MATCH_PCT 25
+#define HS_STORM_DEFAULT_SHORT_PCT 50
+
+/* Mean events per cycle of the generated sweep */
+const uint32 HS_Storm_Rates[] = {4, 16, 32, 64, 256};
+
+#define HS_STORM_NUM_RATES (sizeof(HS_Storm_Rates) / sizeof(HS_Storm_Rates[0]))
+
+/* Event IDs of generated events that aren't aimed at an EMT entry */
+#define HS_STORM_NOISE_EVENT_IDS 256
+
+/* App name of generated events when the EMT names no apps */
+#define HS_STORM_NOISE_APP_NAME "STORM_APP"
+
+/*
+ * One message in the event pipe model, with the cycle it was sent in
+ */
+typedef struct
+{
+    union
+    {
+        CFE_SB_Buffer_t         Buf;
+        CFE_EVS_LongEventTlm_t  LongEvent;
+        CFE_EVS_ShortEventTlm_t ShortEvent;
+    } Msg;
+    uint32 SentCycle;
+} HS_Storm_Slot_t;
+
+/*
+ * Results of one storm
+ */
+typedef struct
+{
+    uint32 Sent;
+    uint32 Dropped;
+    uint32 Monitored;
+    uint32 Matches;
+    uint32 Actions;
+    uint32 BudgetCycles;
+    uint64 LatencyTotalCycles;
+    uint32 LatencyMaxCycles;
+    uint64 ProcessNsec;
+} HS_Storm_Result_t;
+
+/*
+ * The EMT linked into this tool from the table source
+ */
+extern HS_EMTEntry_t HS_EventMon_Tbl[HS_MAX_MONITORED_EVENTS];
+
+/*
+ * Storm state
+ */
+HS_MATEntry_t     HS_Storm_MATable[HS_MAX_MSG_ACT_TYPES];
+HS_Storm_Slot_t   HS_Storm_Pipe[HS_EVENT_PIPE_DEPTH];
+HS_Storm_Slot_t   HS_Storm_Delivered;
+uint32            HS_Storm_PipeHead;
+uint32            HS_Storm_PipeCount;
+uint32            HS_Storm_Cycle;
+uint32            HS_Storm_DeliveredCycle;
+uint32            HS_Storm_Random;
+HS_Storm_Result_t HS_Storm_Result;
+
+/*
+ * Helper functions
+ */
+
+static uint64 HS_Storm_NowNsec(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return ((uint64)Now.tv_sec * 1000000000) + (uint64)Now.tv_nsec;
+}
+
+static uint32 HS_Storm_GetSetting(const char *Name, uint32 Default)
+{
+    const char *Value = getenv(Name);
+
+    if ((Value == NULL) || (*Value == '\0'))
+    {
+        return Default;
+    }
+
+    return (uint32)strtoul(Value, NULL, 0);
+}
+
+/* xorshift32, so a seed gives the same storm on any host */
+static uint32 HS_Storm_Rand(uint32 Range)
+{
+    HS_Storm_Random ^= HS_Storm_Random << 13;
+    HS_Storm_Random ^= HS_Storm_Random >> 17;
+    HS_Storm_Random ^= HS_Storm_Random << 5;
+
+    return HS_Storm_Random % Range;
+}
+
+/* Puts an event in the pipe model, or counts it as dropped when the pipe is full */
+static void HS_Storm_Send(const char *AppName, uint16 EventID, bool IsShort)
+{
+    HS_Storm_Slot_t *SlotPtr;
+
+    HS_Storm_Result.Sent++;
+
+    if (HS_Storm_PipeCount == HS_EVENT_PIPE_DEPTH)
+    {
+        HS_Storm_Result.Dropped++;
+        return;
+    }
+
+    SlotPtr = &HS_Storm_Pipe[(HS_Storm_PipeHead + HS_Storm_PipeCount) % HS_EVENT_PIPE_DEPTH];
+    HS_Storm_PipeCount++;
+
+    memset(&SlotPtr->Msg, 0, sizeof(SlotPtr->Msg));
+    SlotPtr->SentCycle = HS_Storm_Cycle;
+
+    /* Both formats start with the same packet ID, which is all the Event Monitor reads */
+    if (IsShort)
+    {
+        strncpy(SlotPtr->Msg.ShortEvent.Payload.PacketID.AppName, AppName,
+                sizeof(SlotPtr->Msg.ShortEvent.Payload.PacketID.AppName) - 1);
+        SlotPtr->Msg.ShortEvent.Payload.PacketID.EventID = EventID;
+    }
+    else
+    {
+        strncpy(SlotPtr->Msg.LongEvent.Payload.PacketID.AppName, AppName,
+                sizeof(SlotPtr->Msg.LongEvent.Payload.PacketID.AppName) - 1);
+        SlotPtr->Msg.LongEvent.Payload.PacketID.EventID = EventID;
+        snprintf(SlotPtr->Msg.LongEvent.Payload.Message, sizeof(SlotPtr->Msg.LongEvent.Payload.Message),
+                 "Storm event %lu", (unsigned long)HS_Storm_Result.Sent);
+    }
+}
+
+/*
+ * Hands HS the oldest message in the pipe model; like the software bus, the
+ * buffer stays valid until the next read, so HS can hold it past its budget
+ */
+static void HS_Storm_ReceiveBufferHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t **BufPtr = UT_Hook_GetArgValueByName(Context, "BufPtr", CFE_SB_Buffer_t **);
+    int32             Status = CFE_SB_NO_MESSAGE;
+
+    if (HS_Storm_PipeCount != 0)
+    {
+        HS_Storm_Delivered      = HS_Storm_Pipe[HS_Storm_PipeHead];
+        *BufPtr                 = &HS_Storm_Delivered.Msg.Buf;
+        HS_Storm_DeliveredCycle = HS_Storm_Delivered.SentCycle;
+
+        HS_Storm_PipeHead = (HS_Storm_PipeHead + 1) % HS_EVENT_PIPE_DEPTH;
+        HS_Storm_PipeCount--;
+
+        Status = CFE_SUCCESS;
+    }
+    else
+    {
+        *BufPtr = NULL;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
+/* A match is recorded in the history before its action, so the event being monitored is the last one delivered */
+static void HS_Storm_HistoryRecordHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 Latency = HS_Storm_Cycle - HS_Storm_DeliveredCycle;
+
+    HS_Storm_Result.Matches++;
+    HS_Storm_Result.LatencyTotalCycles += Latency;
+
+    if (Latency > HS_Storm_Result.LatencyMaxCycles)
+    {
+        HS_Storm_Result.LatencyMaxCycles = Latency;
+    }
+}
+
+/* Resets HS and the pipe model before a storm */
+static void HS_Storm_Reset(void)
+{
+    uint32 i;
+
+    HS_Test_Setup();
+
+    /* Storms send far more events than the unit test context can hold */
+    UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), NULL, NULL);
+
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), HS_Storm_ReceiveBufferHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(HS_HistoryRecord), HS_Storm_HistoryRecordHandler, NULL);
+
+    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
+    {
+        HS_Storm_MATable[i].EnableState = HS_MAT_STATE_NOEVENT;
+    }
+
+    HS_AppData.EMTablePtr           = HS_EventMon_Tbl;
+    HS_AppData.MATablePtr           = HS_Storm_MATable;
+    HS_AppData.CurrentEventMonState = HS_STATE_ENABLED;
+    HS_AppData.MsgActsState         = HS_STATE_ENABLED;
+    HS_Test_CompileRuntime();
+
+    memset(&HS_Storm_Result, 0, sizeof(HS_Storm_Result));
+    HS_Storm_PipeHead  = 0;
+    HS_Storm_PipeCount = 0;
+    HS_Storm_Cycle     = 0;
+}
+
+/* Events not monitored yet, including one HS read past its budget and held */
+static uint32 HS_Storm_Backlog(void)
+{
+    return HS_Storm_PipeCount + (HS_AppData.EventHeldBufPtr != NULL);
+}
+
+/* Runs one HS cycle over what is in the pipe model */
+static void HS_Storm_ProcessCycle(void)
+{
+    uint32 EventsBefore = HS_AppData.EventsMonitoredCount;
+    uint32 BudgetBefore = HS_AppData.CmdStatsPkt.Payload.EventBudgetCount;
+    uint64 Start;
+
+    Start = HS_Storm_NowNsec();
+    HS_ProcessCommands();
+    HS_Storm_Result.ProcessNsec += HS_Storm_NowNsec() - Start;
+
+    HS_Storm_Result.Monitored += HS_AppData.EventsMonitoredCount - EventsBefore;
+    HS_Storm_Result.BudgetCycles += HS_AppData.CmdStatsPkt.Payload.EventBudgetCount - BudgetBefore;
+
+    HS_Storm_Cycle++;
+}
+
+static void HS_Storm_Report(const char *Mode, uint32 Rate, uint32 Cycles, uint32 Hz)
+{
+    HS_Storm_Result_t *ResultPtr = &HS_Storm_Result;
+    double             Seconds   = (double)Cycles / Hz;
+
+    ResultPtr->Actions = UT_GetStubCount(UT_KEY(HS_MsgActEnqueue)) + UT_GetStubCount(UT_KEY(CFE_ES_RestartApp)) +
+                         UT_GetStubCount(UT_KEY(CFE_ES_DeleteApp)) + UT_GetStubCount(UT_KEY(CFE_ES_ResetCFE));
+
+    printf("{\"mode\":\"%s\",\"rate_per_cycle\":%lu,\"cycles\":%lu,\"sent\":%lu,\"dropped\":%lu,\"monitored\":%lu,"
+           "\"backlog\":%lu,\"budget_cycles\":%lu,\"matches\":%lu,\"actions\":%lu,\"sent_per_sec\":%.1f,"
+           "\"monitored_per_sec\":%.1f,\"match_latency_avg_cycles\":%.2f,\"match_latency_max_cycles\":%lu,"
+           "\"ns_per_event\":%.1f}\n",
+           Mode, (unsigned long)Rate, (unsigned long)Cycles, (unsigned long)ResultPtr->Sent,
+           (unsigned long)ResultPtr->Dropped, (unsigned long)ResultPtr->Monitored, (unsigned long)HS_Storm_Backlog(),
+           (unsigned long)ResultPtr->BudgetCycles, (unsigned long)ResultPtr->Matches, (unsigned long)ResultPtr->Actions,
+           ResultPtr->Sent / Seconds, ResultPtr->Monitored / Seconds,
+           ResultPtr->Matches ? (double)ResultPtr->LatencyTotalCycles / ResultPtr->Matches : 0.0,
+           (unsigned long)ResultPtr->LatencyMaxCycles,
+           ResultPtr->Monitored ? (double)ResultPtr->ProcessNsec / ResultPtr->Monitored : 0.0);
+    fflush(stdout);
+
+    UtAssert_True(ResultPtr->Monitored + ResultPtr->Dropped + HS_Storm_Backlog() == ResultPtr->Sent,
+                  "%s storm, %lu per cycle: %lu of %lu events dropped", Mode, (unsigned long)Rate,
+                  (unsigned long)ResultPtr->Dropped, (unsigned long)ResultPtr->Sent);
+}
+
+/*
+ * Storm cases
+ */
+
+/*
+ * Sweeps generated storms over the rates, each event either aimed at an
+ * EMT entry or noise from one of the apps the EMT names
+ */
+void HS_Storm_Generated(void)
+{
+    uint32 Seed     = HS_Storm_GetSetting("HS_STORM_SEED", HS_STORM_DEFAULT_SEED);
+    uint32 Cycles   = HS_Storm_GetSetting("HS_STORM_CYCLES", HS_STORM_DEFAULT_CYCLES);
+    uint32 Hz       = HS_Storm_GetSetting("HS_STORM_HZ", HS_STORM_DEFAULT_HZ);
+    uint32 MatchPct = HS_Storm_GetSetting("HS_STORM_MATCH_PCT", HS_STORM_DEFAULT_MATCH_PCT);
+    uint32 ShortPct = HS_Storm_GetSetting("HS_STORM_SHORT_PCT", HS_STORM_DEFAULT_SHORT_PCT);
+    uint32 Named[HS_MAX_MONITORED_EVENTS];
+    uint32 NamedCount = 0;
+    uint32 RateIndex;
+    uint32 Rate;
+    uint32 Count;
+    uint32 i;
+    uint32 TableIndex;
+
+    if (getenv("HS_STORM_REPLAY") != NULL)
+    {
+        UtAssert_MIR("Replaying HS_STORM_REPLAY, generated storms skipped");
+        return;
+    }
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        if (HS_EventMon_Tbl[i].AppName[0] != '\0')
+        {
+            Named[NamedCount++] = i;
+        }
+    }
+
+    for (RateIndex = 0; RateIndex < HS_STORM_NUM_RATES; RateIndex++)
+    {
+        Rate = HS_Storm_Rates[RateIndex];
+
+        HS_Storm_Reset();
+        HS_Storm_Random = (Seed != 0) ? Seed : HS_STORM_DEFAULT_SEED;
+
+        while (HS_Storm_Cycle < Cycles)
+        {
+            /* Bursty arrivals, from half to one and a half times the mean rate */
+            Count = (Rate / 2) + HS_Storm_Rand(Rate + 1);
+
+            for (i = 0; i < Count; i++)
+            {
+                if (NamedCount == 0)
+                {
+                    HS_Storm_Send(HS_STORM_NOISE_APP_NAME, (uint16)HS_Storm_Rand(HS_STORM_NOISE_EVENT_IDS),
+                                  HS_Storm_Rand(100) < ShortPct);
+                }
+                else
+                {
+                    TableIndex = Named[HS_Storm_Rand(NamedCount)];
+
+                    if (HS_Storm_Rand(100) < MatchPct)
+                    {
+                        HS_Storm_Send(HS_EventMon_Tbl[TableIndex].AppName, HS_EventMon_Tbl[TableIndex].EventID,
+                                      HS_Storm_Rand(100) < ShortPct);
+                    }
+                    else
+                    {
+                        HS_Storm_Send(HS_EventMon_Tbl[TableIndex].AppName,
+                                      (uint16)HS_Storm_Rand(HS_STORM_NOISE_EVENT_IDS), HS_Storm_Rand(100) < ShortPct);
+                    }
+                }
+            }
+
+            HS_Storm_ProcessCycle();
+        }
+
+        HS_Storm_Report("generated", Rate, Cycles, Hz);
+    }
+}
+
+/*
+ * Replays a captured event log, running HS cycles until the last event
+ * has been sent and the pipe is empty
+ */
+void HS_Storm_Replay(void)
+{
+    const char *  FileName = getenv("HS_STORM_REPLAY");
+    uint32        Hz       = HS_Storm_GetSetting("HS_STORM_HZ", HS_STORM_DEFAULT_HZ);
+    FILE *        FilePtr;
+    char          Line[256];
+    char          AppName[64];
+    char          Format[8];
+    unsigned long Cycle;
+    unsigned int  EventID;
+    int           Fields;
+    uint32        LineCount = 0;
+
+    if (FileName == NULL)
+    {
+        UtAssert_MIR("HS_STORM_REPLAY not set, replay skipped");
+        return;
+    }
+
+    FilePtr = fopen(FileName, "r");
+    if (FilePtr == NULL)
+    {
+        UtAssert_Failed("Could not open replay file %s", FileName);
+        return;
+    }
+
+    HS_Storm_Reset();
+
+    while (fgets(Line, sizeof(Line), FilePtr) != NULL)
+    {
+        LineCount++;
+
+        if ((Line[0] == '#') || (Line[strspn(Line, " \t\r\n")] == '\0'))
+        {
+            continue;
+        }
+
+        Format[0] = '\0';
+        Fields    = sscanf(Line, "%lu %63s %u %7s", &Cycle, AppName, &EventID, Format);
+        if (Fields < 3)
+        {
+            UtAssert_Failed("%s:%lu: expected \"<cycle> <app name> <event ID> [long|short]\"", FileName,
+                            (unsigned long)LineCount);
+            continue;
+        }
+
+        /* Events are sorted by cycle, so run HS up to the cycle of this one */
+        while (HS_Storm_Cycle < Cycle)
+        {
+            HS_Storm_ProcessCycle();
+        }
+
+        HS_Storm_Send(AppName, (uint16)EventID, strcmp(Format, "short") == 0);
+    }
+
+    fclose(FilePtr);
+
+    do
+    {
+        HS_Storm_ProcessCycle();
+    } while (HS_Storm_Backlog() != 0);
+
+    HS_Storm_Report("replay", 0, HS_Storm_Cycle, Hz);
+}
+
+/*
+ * Register the storm cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    uint32 i;
+    uint32 ActiveCount = 0;
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        if (HS_EventMon_Tbl[i].ActionType != HS_EMT_ACT_NOACT)
+        {
+            ActiveCount++;
+        }
+    }
+
+    printf("{\"storm\":\"hs\",\"version\":\"%d.%d.%d\",\"pipe_depth\":%d,\"pipe_budget\":%d,\"emt_active\":%lu}\n",
+           HS_MAJOR_VERSION, HS_MINOR_VERSION, HS_REVISION, HS_EVENT_PIPE_DEPTH, HS_EVENT_PIPE_BUDGET,
+           (unsigned long)ActiveCount);
+
+    UtTest_Add(HS_Storm_Generated, NULL, HS_Test_TearDown, "HS_Storm_Generated");
+    UtTest_Add(HS_Storm_Replay, NULL, HS_Test_TearDown, "HS_Storm_Replay");
+}
@@ -0,0 +1,41 @@
+##################################################################
+#
+# HS scaling report
+#
+# Runs the benchmark built at each capacity point and collects the
+# JSON lines they print into one report. Invoked by the
+# hs-scaling-report target with:
+#
+#   BENCHMARKS - benchmark executables, separated by "|"
+#   REPORT     - path of the report to write
+#
+##################################################################
+
+string(REPLACE "|" ";" BENCHMARK_LIST "${BENCHMARKS}")
+
+file(WRITE "${REPORT}" "")
+
+foreach(BENCHMARK ${BENCHMARK_LIST})
+
+  message(STATUS "Running ${BENCHMARK}")
+
+  execute_process(
+    COMMAND "${BENCHMARK}"
+    OUTPUT_VARIABLE BENCHMARK_OUTPUT
+    RESULT_VARIABLE BENCHMARK_RESULT
+  )
+
+  if(NOT BENCHMARK_RESULT EQUAL 0)
+    message(FATAL_ERROR "${BENCHMARK} failed: ${BENCHMARK_RESULT}")
+  endif()
+
+  # Keep only the JSON lines, the rest is unit test framework output
+  string(REGEX MATCHALL "{[^\n]*}" BENCHMARK_LINES "${BENCHMARK_OUTPUT}")
+
+  foreach(LINE ${BENCHMARK_LINES})
+    file(APPEND "${REPORT}" "${LINE}\n")
+  endforeach()
+
+endforeach()
+
+message(STATUS "Wrote ${REPORT}")
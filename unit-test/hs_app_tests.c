@@ -185,6 +185,9 @@ void HS_AppMain_Test_NominalWaitForStartupSync(void)
     UtAssert_STUB_COUNT(CFE_ES_WaitForStartupSync, 1);
     UtAssert_UINT32_EQ(UT_WaitForStartupSyncTimeout, HS_STARTUP_SYNC_TIMEOUT);
 
+    /* Watchdog task started once the watchdog is enabled */
+    UtAssert_STUB_COUNT(HS_WatchdogTaskInit, 1);
+
     /* 1 event message that we don't care about in this test */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
@@ -210,6 +213,10 @@ void HS_AppMain_Test_NominalRcvMsgSuccess(void)
     /* Verify results */
     UtAssert_True(HS_AppData.EventsMonitoredCount == 1, "HS_AppData.EventsMonitoredCount == 1");
 
+    /* The cycle was timed */
+    UtAssert_STUB_COUNT(HS_TimingCycleStart, 1);
+    UtAssert_STUB_COUNT(HS_TimingCycleEnd, 1);
+
     /* 1 event message that we don't care about in this test */
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -301,6 +308,9 @@ void HS_AppMain_Test_NominalRcvMsgError(void)
     /* Verify results */
     UtAssert_True(HS_AppData.EventsMonitoredCount == 1, "HS_AppData.EventsMonitoredCount == 1");
 
+    /* No cycle was run, so none was timed */
+    UtAssert_STUB_COUNT(HS_TimingCycleStart, 0);
+
     /* Verify results */
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_INIT_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -617,6 +627,11 @@ void HS_AppInit_Test_Nominal(void)
     UtAssert_UINT16_EQ(HS_AppData.CDSData.ResetsPerformed, 0);
     UtAssert_UINT16_EQ(HS_AppData.CDSData.MaxResets, 0);
 
+    UtAssert_STUB_COUNT(HS_MsgActQueueInit, 1);
+    UtAssert_STUB_COUNT(HS_LadderInit, 1);
+    UtAssert_STUB_COUNT(HS_HistoryInit, 1);
+    UtAssert_STUB_COUNT(HS_SnapshotInit, 1);
+
     /* 1 event message that we don't care about in this test */
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -1146,6 +1161,7 @@ void HS_SbInit_Test_Nominal(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
     UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
     UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
 
     /* Execute the function being tested */
     UtAssert_INT32_EQ(HS_SbInit(), CFE_SUCCESS);
@@ -1154,6 +1170,8 @@ void HS_SbInit_Test_Nominal(void)
     UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(HS_AppData.CmdPipe, PipeId));
     UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(HS_AppData.EventPipe, PipeId));
     UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(HS_AppData.WakeupPipe, PipeId));
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(HS_AppData.MsgMonPipe, PipeId));
+    UtAssert_STUB_COUNT(HS_SbMonInit, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -1272,6 +1290,39 @@ void HS_SbInit_Test_CreateSBWakeupPipe(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_SbInit_Test_CreateSBMsgMonPipeError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Creating SB MsgMon Pipe,RC=0x%%08X");
+
+    CFE_SB_PipeId_t PipeId = HS_UT_PIPEID_1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+
+    /* Set CFE_SB_CreatePipe to return -1 on fourth call, to generate error HS_CR_MSGMON_PIPE_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 4, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_SbInit(), -1);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(HS_AppData.WakeupPipe, PipeId));
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(HS_AppData.MsgMonPipe));
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CR_MSGMON_PIPE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 0);
+}
+
 void HS_SbInit_Test_SubscribeHKRequestError(void)
 {
     int32 strCmpResult;
@@ -1383,6 +1434,29 @@ void HS_SbInit_Test_SubscribeWakeupError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_SbInit_Test_SbMonInitError(void)
+{
+    CFE_SB_PipeId_t PipeId = HS_UT_PIPEID_1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+
+    /* The software bus monitor reports its own errors, and HS runs without it */
+    UT_SetDeferredRetcode(UT_KEY(HS_SbMonInit), 1, -1);
+    HS_AppData.SbMon.State = HS_STATE_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_SbInit(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(HS_AppData.WakeupPipe, PipeId));
+    UtAssert_UINT32_EQ(HS_AppData.SbMon.State, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(HS_SbMonInit, 1);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void HS_TblInit_Test_Nominal(void)
 {
     CFE_Status_t Result;
@@ -1560,9 +1634,15 @@ void HS_TblInit_Test_LoadExeCountTableError(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[6].EventID, HS_MMT_LD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[7].EventID, HS_MFT_LD_ERR_EID);
+
+    /* AppMon State table address can't be set either */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[8].EventID, HS_AMS_REG_ERR_EID);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 6, "CFE_EVS_SendEvent was called %u time(s), expected 6",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 9, "CFE_EVS_SendEvent was called %u time(s), expected 9",
                   call_count_CFE_EVS_SendEvent);
 }
 
@@ -1689,6 +1769,252 @@ void HS_TblInit_Test_LoadMsgActsTableError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_TblInit_Test_RegisterMemMonTableError(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Registering MemMon Table,RC=0x%%08X");
+
+    /* Set CFE_TBL_Register to return -1 on fifth call, to generate error HS_MMT_REG_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 5, -1);
+
+    /* Same return value as default, but bypasses default hook function to make test easier to write */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MMT_REG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_TblInit_Test_LoadMemMonTableError(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Loading MemMon Table,RC=0x%%08X");
+
+    /* Set CFE_TBL_Load to fail on fifth call, to generate error HS_MMT_LD_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Load), 5, -1);
+
+    HS_AppData.MemMonState = HS_STATE_ENABLED;
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_True(HS_AppData.MemMonState == HS_STATE_DISABLED, "HS_AppData.MemMonState == HS_STATE_DISABLED");
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].FreeBytes, HS_MEMMON_INVALID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MMT_LD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_TblInit_Test_RegisterMsgMonTableError(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Registering MsgMon Table,RC=0x%%08X");
+
+    /* Set CFE_TBL_Register to return -1 on sixth call, to generate error HS_MFT_REG_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 6, -1);
+
+    /* Same return value as default, but bypasses default hook function to make test easier to write */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MFT_REG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void HS_TblInit_Test_LoadMsgMonTableError(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Loading MsgMon Table,RC=0x%%08X");
+
+    /* Set CFE_TBL_Load to fail on sixth call, to generate error HS_MFT_LD_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Load), 6, -1);
+
+    HS_AppData.MsgMonState = HS_STATE_ENABLED;
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_True(HS_AppData.MsgMonState == HS_STATE_DISABLED, "HS_AppData.MsgMonState == HS_STATE_DISABLED");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MFT_LD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void HS_TblInit_Test_NotifyEnabled(void)
+{
+    CFE_Status_t Result;
+
+    HS_AppData.TblNotifyState = HS_STATE_ENABLED;
+
+    /* Same return value as default, but bypasses default hook function to make test easier to write */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_STUB_COUNT(CFE_TBL_NotifyByMessage, 7);
+    UtAssert_UINT32_EQ(HS_AppData.TblNotifyMask, HS_TBL_NOTIFY_ALL);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_TblNotifyRegister_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    HS_TblNotifyRegister(HS_AppData.EMTableHandle, HS_TBL_NOTIFY_EMT);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_NotifyByMessage, 1);
+    UtAssert_UINT32_EQ(HS_AppData.TblNotifyMask, HS_TBL_NOTIFY_EMT);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void HS_TblNotifyRegister_Test_Error(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error Registering Table Notification 0x%%02X,RC=0x%%08X");
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_NotifyByMessage), 1, -1);
+
+    /* Execute the function being tested */
+    HS_TblNotifyRegister(HS_AppData.MATableHandle, HS_TBL_NOTIFY_MAT);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.TblNotifyMask, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_TBL_NOTIFY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void HS_AMSTableInit_Test_Nominal(void)
+{
+    HS_AppData.TblNotifyState = HS_STATE_ENABLED;
+
+    /* Execute the function being tested */
+    HS_AMSTableInit();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Register, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_NotifyByMessage, 1);
+    UtAssert_UINT32_EQ(HS_AppData.TblNotifyMask, HS_TBL_NOTIFY_AMS);
+    UtAssert_True(HS_AppData.AMSTableHandle != CFE_TBL_BAD_TABLE_HANDLE,
+                  "HS_AppData.AMSTableHandle != CFE_TBL_BAD_TABLE_HANDLE");
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void HS_AMSTableInit_Test_RegisterError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error Registering AppMon State Table,RC=0x%%08X");
+
+    HS_AppData.TblNotifyState = HS_STATE_ENABLED;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 1, -1);
+
+    /* Execute the function being tested */
+    HS_AMSTableInit();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_NotifyByMessage, 0);
+    UtAssert_True(HS_AppData.AMSTableHandle == CFE_TBL_BAD_TABLE_HANDLE,
+                  "HS_AppData.AMSTableHandle == CFE_TBL_BAD_TABLE_HANDLE");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMS_REG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void HS_AMSTableInit_Test_LoadError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Load), 1, -1);
+
+    /* Execute the function being tested */
+    HS_AMSTableInit();
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.AMSTableHandle == CFE_TBL_BAD_TABLE_HANDLE,
+                  "HS_AppData.AMSTableHandle == CFE_TBL_BAD_TABLE_HANDLE");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMS_REG_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void HS_ProcessMain_Test(void)
 {
     CFE_Status_t Result;
@@ -1703,10 +2029,6 @@ void HS_ProcessMain_Test(void)
     /* Causes HS_ProcessCommands to return CFE_SUCCESS, which is then returned from HS_ProcessMain */
     UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
 
-    HS_AppData.MsgActCooldown[0]                        = 2;
-    HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] = 2;
-    HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] = 2;
-
     HS_AppData.CurrentAppMonState    = HS_STATE_ENABLED;
     HS_AppData.CurrentAlivenessState = HS_STATE_ENABLED;
     HS_AppData.AlivenessCounter      = HS_CPU_ALIVE_PERIOD;
@@ -1718,17 +2040,20 @@ void HS_ProcessMain_Test(void)
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
-    /* Check first, middle, and last element */
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 1, "HS_AppData.MsgActCooldown[0] == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] == 1,
-                  "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 1,
-                  "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 1");
     UtAssert_True(HS_AppData.AlivenessCounter == 0, "HS_AppData.AlivenessCounter == 0");
 
     /* Ensure the watchdog was serviced when flag is HS_STATE_ENABLED */
     UtAssert_STUB_COUNT(CFE_PSP_WatchdogService, 1);
 
+    /* Ensure queued Message Actions were sent */
+    UtAssert_STUB_COUNT(HS_MsgActQueueDrain, 1);
+    UtAssert_STUB_COUNT(HS_SnapshotSave, 1);
+
+    /* Table management, CPU utilization, AppMon, both command phases, Message Actions and task stacks were timed */
+    UtAssert_STUB_COUNT(HS_TimingStart, 7);
+    UtAssert_STUB_COUNT(HS_TimingStop, 7);
+    UtAssert_STUB_COUNT(HS_MonitorStacks, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -1749,10 +2074,6 @@ void HS_ProcessMain_Test_MonStateDisabled(void)
     /* Causes HS_ProcessCommands to return CFE_SUCCESS, which is then returned from HS_ProcessMain */
     UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
 
-    HS_AppData.MsgActCooldown[0]                        = 2;
-    HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] = 2;
-    HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] = 2;
-
     HS_AppData.CurrentAppMonState    = HS_STATE_ENABLED;
     HS_AppData.CurrentAlivenessState = HS_STATE_ENABLED;
     HS_AppData.AlivenessCounter      = HS_CPU_ALIVE_PERIOD;
@@ -1767,12 +2088,6 @@ void HS_ProcessMain_Test_MonStateDisabled(void)
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
-    /* Check first, middle, and last element */
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 1, "HS_AppData.MsgActCooldown[0] == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] == 1,
-                  "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 1,
-                  "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 1");
     UtAssert_True(HS_AppData.AlivenessCounter == 0, "HS_AppData.AlivenessCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -1795,10 +2110,6 @@ void HS_ProcessMain_Test_AlivenessDisabled(void)
     /* Causes HS_ProcessCommands to return CFE_SUCCESS, which is then returned from HS_ProcessMain */
     UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
 
-    HS_AppData.MsgActCooldown[0]                        = 2;
-    HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] = 2;
-    HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] = 2;
-
     HS_AppData.CurrentAppMonState    = HS_STATE_ENABLED;
     HS_AppData.CurrentAlivenessState = HS_STATE_ENABLED;
     HS_AppData.AlivenessCounter      = HS_CPU_ALIVE_PERIOD;
@@ -1811,12 +2122,6 @@ void HS_ProcessMain_Test_AlivenessDisabled(void)
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
-    /* Check first, middle, and last element */
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 1, "HS_AppData.MsgActCooldown[0] == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] == 1,
-                  "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 1,
-                  "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 1");
     UtAssert_True(HS_AppData.AlivenessCounter == HS_CPU_ALIVE_PERIOD,
                   "HS_AppData.AlivenessCounter == HS_CPU_ALIVE_PERIOD");
 
@@ -1840,10 +2145,6 @@ void HS_ProcessMain_Test_WatchdogDisabled(void)
     /* Causes HS_ProcessCommands to return CFE_SUCCESS, which is then returned from HS_ProcessMain */
     UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
 
-    HS_AppData.MsgActCooldown[0]                        = 2;
-    HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] = 2;
-    HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] = 2;
-
     HS_AppData.CurrentAppMonState    = HS_STATE_ENABLED;
     HS_AppData.CurrentAlivenessState = HS_STATE_ENABLED;
     HS_AppData.AlivenessCounter      = HS_CPU_ALIVE_PERIOD;
@@ -1857,12 +2158,6 @@ void HS_ProcessMain_Test_WatchdogDisabled(void)
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
-    /* Check first, middle, and last element */
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 1, "HS_AppData.MsgActCooldown[0] == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] == 1,
-                  "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 1,
-                  "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 1");
     UtAssert_True(HS_AppData.AlivenessCounter == 0, "HS_AppData.AlivenessCounter == 0");
 
     /* Ensure the watchdog was not serviced when flag is HS_STATE_DISABLED */
@@ -1874,14 +2169,153 @@ void HS_ProcessMain_Test_WatchdogDisabled(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_ProcessMain_Test_WatchdogTask(void)
+{
+    CFE_Status_t Result;
+
+    HS_AMTEntry_t AMTable;
+
+    HS_AppData.AMTablePtr = &AMTable;
+
+    /* Prevents error messages in call to HS_AcquirePointers */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Causes HS_ProcessCommands to return CFE_SUCCESS, which is then returned from HS_ProcessMain */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    HS_AppData.ServiceWatchdogFlag = HS_STATE_ENABLED;
+    HS_AppData.WatchdogTaskState   = HS_STATE_ENABLED;
+    HS_AppData.WatchdogHeartbeat   = 5;
+
+    /* Execute the function being tested */
+    Result = HS_ProcessMain();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+
+    /* The watchdog task services the watchdog, the main loop only counts a heartbeat */
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogHeartbeat, 6);
+    UtAssert_STUB_COUNT(CFE_PSP_WatchdogService, 0);
+}
+
+void HS_ProcessMain_Test_SysMonSampler(void)
+{
+    CFE_Status_t Result;
+
+    HS_AMTEntry_t AMTable;
+
+    HS_AppData.AMTablePtr = &AMTable;
+
+    /* Prevents error messages in call to HS_AcquirePointers */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Causes HS_ProcessCommands to return CFE_SUCCESS, which is then returned from HS_ProcessMain */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    /* No sampler task, no ring to scan */
+    Result = HS_ProcessMain();
+
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(HS_SysMonBurstUpdate, 0);
+
+    /* The sampler task ring is scanned every cycle, not just once per interval */
+    HS_AppData.SysMonSampler.TaskState = HS_STATE_ENABLED;
+
+    Result = HS_ProcessMain();
+
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(HS_SysMonBurstUpdate, 1);
+}
+
+void HS_ProcessMain_Test_MemMon(void)
+{
+    CFE_Status_t Result;
+
+    HS_AMTEntry_t AMTable;
+
+    HS_AppData.AMTablePtr = &AMTable;
+
+    /* Prevents error messages in call to HS_AcquirePointers */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Causes HS_ProcessCommands to return CFE_SUCCESS, which is then returned from HS_ProcessMain */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    /* Disabled, memory is never checked */
+    Result = HS_ProcessMain();
+
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(HS_MonitorMemory, 0);
+
+    /* Checked on the first cycle, then once every HS_MEMMON_CYCLES_PER_SAMPLE cycles */
+    HS_AppData.MemMonState = HS_STATE_ENABLED;
+
+    Result = HS_ProcessMain();
+
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(HS_MonitorMemory, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MemMonCycleCounter, HS_MEMMON_CYCLES_PER_SAMPLE - 1);
+
+    HS_AppData.MemMonCycleCounter = 1;
+
+    HS_ProcessMain();
+    UtAssert_STUB_COUNT(HS_MonitorMemory, 1);
+
+    HS_ProcessMain();
+    UtAssert_STUB_COUNT(HS_MonitorMemory, 2);
+}
+
+void HS_ProcessMain_Test_SbMon(void)
+{
+    HS_AMTEntry_t AMTable;
+
+    HS_AppData.AMTablePtr = &AMTable;
+
+    /* Prevents error messages in call to HS_AcquirePointers */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Causes HS_ProcessCommands to return CFE_SUCCESS, which is then returned from HS_ProcessMain */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    /* Not run until the software bus monitor is initialized */
+    UtAssert_INT32_EQ(HS_ProcessMain(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(HS_SbMonCycle, 0);
+
+    HS_AppData.SbMon.State = HS_STATE_ENABLED;
+
+    UtAssert_INT32_EQ(HS_ProcessMain(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(HS_SbMonCycle, 1);
+}
+
+void HS_ProcessMain_Test_MsgMon(void)
+{
+    HS_AMTEntry_t AMTable;
+
+    HS_AppData.AMTablePtr = &AMTable;
+
+    /* Prevents error messages in call to HS_AcquirePointers */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Causes HS_ProcessCommands to return CFE_SUCCESS, which is then returned from HS_ProcessMain */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    /* Not run while the Message Freshness table isn't loaded */
+    UtAssert_INT32_EQ(HS_ProcessMain(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(HS_MonitorMessages, 0);
+
+    HS_AppData.MsgMonState = HS_STATE_ENABLED;
+
+    /* Checked every cycle, in its own timing phase */
+    UtAssert_INT32_EQ(HS_ProcessMain(), CFE_SUCCESS);
+    UtAssert_INT32_EQ(HS_ProcessMain(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(HS_MonitorMessages, 2);
+}
+
 void HS_ProcessCommands_Test(void)
 {
     CFE_Status_t  Result;
     uint32        i;
-    uint8         call_count_CFE_SB_ReceiveBuffer = 0;
-    uint8         call_count_HS_AppPipe           = 0;
     HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
-    uint8         call_count_HS_MonitorEvent;
 
     HS_AppData.CurrentEventMonState = HS_STATE_ENABLED;
     HS_AppData.EMTablePtr           = EMTable;
@@ -1894,45 +2328,33 @@ void HS_ProcessCommands_Test(void)
         HS_AppData.EMTablePtr[i].EventID = -1;
     }
 
-    /* Causes CFE_SB_RcvMsg to alternate returning CFE_SUCCESS and CFE_SB_NO_MESSAGE, to reach all code branches. */
-    HS_APP_TEST_CFE_SB_RcvMsgHookCount = 0;
-    CFE_SB_Buffer_t *dummy_BufPtr[4];
-    CFE_SB_Buffer_t  dummy_Buf[4];
+    /* One event, then an empty event pipe */
+    CFE_SB_Buffer_t *dummy_BufPtr[2];
+    CFE_SB_Buffer_t  dummy_Buf[2];
     dummy_BufPtr[0] = &dummy_Buf[0];
     dummy_BufPtr[1] = &dummy_Buf[1];
-    dummy_BufPtr[2] = &dummy_Buf[2];
-    dummy_BufPtr[3] = &dummy_Buf[3];
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), dummy_BufPtr, sizeof(dummy_BufPtr), false);
     UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), UT_UpdatedDefaultHandler_CFE_SB_ReceiveBuffer, NULL);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_NO_MESSAGE);
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_NO_MESSAGE);
-    /* UT_SetHookFunction(UT_KEY(CFE_SB_ReceiveBuffer), HS_APP_TEST_CFE_SB_RcvMsgHook, NULL); */
-
-    /* Causes check for non-null buffer pointer to succeed */
-    /* UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &Packet, sizeof(Packet), false); */
 
     /* Execute the function being tested */
     Result = HS_ProcessCommands();
 
     /* Verify results */
-    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
-    UtAssert_True(HS_AppData.EventsMonitoredCount == 1, "HS_AppData.EventsMonitoredCount == 1");
-
-    call_count_CFE_SB_ReceiveBuffer = UT_GetStubCount(UT_KEY(CFE_SB_ReceiveBuffer));
-
-    UtAssert_True(call_count_CFE_SB_ReceiveBuffer == 4, "CFE_SB_ReceiveBuffer was called %u time(s), expected 4",
-                  call_count_CFE_SB_ReceiveBuffer);
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_UINT32_EQ(HS_AppData.EventsMonitoredCount, 1);
 
-    call_count_HS_AppPipe = UT_GetStubCount(UT_KEY(HS_AppPipe));
+    /* The command pipe is read first, and the normal lane is drained after the events */
+    UtAssert_STUB_COUNT(HS_CmdPipeRead, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+    UtAssert_STUB_COUNT(HS_MonitorEvent, 1);
+    UtAssert_STUB_COUNT(HS_CmdLaneDrain, 1);
 
-    UtAssert_True(call_count_HS_AppPipe == 1, "HS_AppPipe was called %u time(s), expected 1", call_count_HS_AppPipe);
-
-    call_count_HS_MonitorEvent = UT_GetStubCount(UT_KEY(HS_MonitorEvent));
-
-    UtAssert_True(call_count_HS_MonitorEvent == 1, "HS_MonitorEvent was called %u time(s), expected 1",
-                  call_count_HS_MonitorEvent);
+    /* The command pipe, event pipe and normal lane phases were timed */
+    UtAssert_STUB_COUNT(HS_TimingStart, 3);
+    UtAssert_STUB_COUNT(HS_TimingStop, 3);
 
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.EventBudgetCount, 0);
     UtAssert_True(HS_AppData.CmdErrCount == 0, "HS_AppData.CmdErrCount == 0");
 }
 
@@ -1940,8 +2362,6 @@ void HS_ProcessCommands_Test_NullMsgPtr(void)
 {
     CFE_Status_t  Result;
     uint32        i;
-    uint8         call_count_CFE_SB_ReceiveBuffer = 0;
-    uint8         call_count_HS_AppPipe           = 0;
     HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
 
     HS_AppData.CurrentEventMonState = HS_STATE_ENABLED;
@@ -1955,29 +2375,122 @@ void HS_ProcessCommands_Test_NullMsgPtr(void)
         HS_AppData.EMTablePtr[i].EventID = -1;
     }
 
-    /* Causes CFE_SB_RcvMsg to alternate returning CFE_SUCCESS and CFE_SB_NO_MESSAGE, to reach all code branches. */
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_NO_MESSAGE);
+    /* A success without a buffer, then an error */
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_TIME_OUT);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_TIME_OUT);
 
     /* Execute the function being tested */
     Result = HS_ProcessCommands();
 
     /* Verify results */
-    UtAssert_True(Result == CFE_SB_TIME_OUT, "Result == CFE_SB_TIME_OUT");
-    UtAssert_True(HS_AppData.EventsMonitoredCount == 0, "HS_AppData.EventsMonitoredCount == 0");
+    UtAssert_INT32_EQ(Result, CFE_SB_TIME_OUT);
+    UtAssert_UINT32_EQ(HS_AppData.EventsMonitoredCount, 0);
 
-    call_count_CFE_SB_ReceiveBuffer = UT_GetStubCount(UT_KEY(CFE_SB_ReceiveBuffer));
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+    UtAssert_STUB_COUNT(HS_MonitorEvent, 0);
 
-    UtAssert_True(call_count_CFE_SB_ReceiveBuffer == 4, "CFE_SB_ReceiveBuffer was called %u time(s), expected 4",
-                  call_count_CFE_SB_ReceiveBuffer);
+    /* Commands already read still get processed */
+    UtAssert_STUB_COUNT(HS_CmdLaneDrain, 1);
 
-    call_count_HS_AppPipe = UT_GetStubCount(UT_KEY(HS_AppPipe));
+    UtAssert_True(HS_AppData.CmdErrCount == 0, "HS_AppData.CmdErrCount == 0");
+}
 
-    UtAssert_True(call_count_HS_AppPipe == 0, "HS_AppPipe was called %u time(s), expected 0", call_count_HS_AppPipe);
+void HS_ProcessCommands_Test_EventBudget(void)
+{
+    uint32           i;
+    HS_EMTEntry_t    EMTable[HS_MAX_MONITORED_EVENTS];
+    CFE_SB_Buffer_t *dummy_BufPtr[HS_EVENT_PIPE_BUDGET + 1];
+    CFE_SB_Buffer_t  dummy_Buf[HS_EVENT_PIPE_BUDGET + 1];
 
-    UtAssert_True(HS_AppData.CmdErrCount == 0, "HS_AppData.CmdErrCount == 0");
+    HS_AppData.CurrentEventMonState = HS_STATE_ENABLED;
+    HS_AppData.EMTablePtr           = EMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        HS_AppData.EMTablePtr[i].EventID = -1;
+    }
+
+    /* One more event than the budget */
+    for (i = 0; i < HS_EVENT_PIPE_BUDGET + 1; i++)
+    {
+        dummy_BufPtr[i] = &dummy_Buf[i];
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), dummy_BufPtr, sizeof(dummy_BufPtr), false);
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), UT_UpdatedDefaultHandler_CFE_SB_ReceiveBuffer, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_ProcessCommands(), CFE_SUCCESS);
+
+    /* Verify results, one more event was read to see that the budget left it waiting */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, HS_EVENT_PIPE_BUDGET + 1);
+    UtAssert_STUB_COUNT(HS_MonitorEvent, HS_EVENT_PIPE_BUDGET);
+    UtAssert_ADDRESS_EQ(HS_AppData.EventHeldBufPtr, &dummy_Buf[HS_EVENT_PIPE_BUDGET]);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.EventBudgetCount, 1);
+
+    /* The normal lane is not held up by the rest of the events */
+    UtAssert_STUB_COUNT(HS_CmdLaneDrain, 1);
+
+    /* The held event is the first one monitored next cycle */
+    UT_ResetState(UT_KEY(CFE_SB_ReceiveBuffer));
+    UT_ResetState(UT_KEY(HS_MonitorEvent));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    UtAssert_INT32_EQ(HS_ProcessCommands(), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_STUB_COUNT(HS_MonitorEvent, 1);
+    UtAssert_NULL(HS_AppData.EventHeldBufPtr);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.EventBudgetCount, 1);
+}
+
+void HS_ProcessCommands_Test_EventBudgetEmpty(void)
+{
+    uint32           i;
+    HS_EMTEntry_t    EMTable[HS_MAX_MONITORED_EVENTS];
+    CFE_SB_Buffer_t *dummy_BufPtr[HS_EVENT_PIPE_BUDGET];
+    CFE_SB_Buffer_t  dummy_Buf[HS_EVENT_PIPE_BUDGET];
+
+    HS_AppData.CurrentEventMonState = HS_STATE_ENABLED;
+    HS_AppData.EMTablePtr           = EMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        HS_AppData.EMTablePtr[i].EventID = -1;
+    }
+
+    /* Exactly a budget of events */
+    for (i = 0; i < HS_EVENT_PIPE_BUDGET; i++)
+    {
+        dummy_BufPtr[i] = &dummy_Buf[i];
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), dummy_BufPtr, sizeof(dummy_BufPtr), false);
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), UT_UpdatedDefaultHandler_CFE_SB_ReceiveBuffer, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), HS_EVENT_PIPE_BUDGET + 1, CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_ProcessCommands(), CFE_SUCCESS);
+
+    /* Verify results, nothing was left waiting */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, HS_EVENT_PIPE_BUDGET + 1);
+    UtAssert_STUB_COUNT(HS_MonitorEvent, HS_EVENT_PIPE_BUDGET);
+    UtAssert_NULL(HS_AppData.EventHeldBufPtr);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.EventBudgetCount, 0);
+}
+
+void HS_ProcessCommands_Test_CmdPipeError(void)
+{
+    HS_AppData.CurrentEventMonState = HS_STATE_ENABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_CmdPipeRead), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_ProcessCommands(), -1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 0);
+    UtAssert_STUB_COUNT(HS_CmdLaneDrain, 1);
 }
 
 /*
@@ -2025,12 +2538,15 @@ void UtTest_Setup(void)
     UtTest_Add(HS_SbInit_Test_CreateSBEventPipeError, HS_Test_Setup, HS_Test_TearDown,
                "HS_SbInit_Test_CreateSBEventPipeError");
     UtTest_Add(HS_SbInit_Test_CreateSBWakeupPipe, HS_Test_Setup, HS_Test_TearDown, "HS_SbInit_Test_CreateSBWakeupPipe");
+    UtTest_Add(HS_SbInit_Test_CreateSBMsgMonPipeError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SbInit_Test_CreateSBMsgMonPipeError");
     UtTest_Add(HS_SbInit_Test_SubscribeHKRequestError, HS_Test_Setup, HS_Test_TearDown,
                "HS_SbInit_Test_SubscribeHKRequestError");
     UtTest_Add(HS_SbInit_Test_SubscribeGndCmdsError, HS_Test_Setup, HS_Test_TearDown,
                "HS_SbInit_Test_SubscribeGndCmdsError");
     UtTest_Add(HS_SbInit_Test_SubscribeWakeupError, HS_Test_Setup, HS_Test_TearDown,
                "HS_SbInit_Test_SubscribeWakeupError");
+    UtTest_Add(HS_SbInit_Test_SbMonInitError, HS_Test_Setup, HS_Test_TearDown, "HS_SbInit_Test_SbMonInitError");
 
     UtTest_Add(HS_TblInit_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_TblInit_Test_Nominal");
     UtTest_Add(HS_TblInit_Test_RegisterAppMonTableError, HS_Test_Setup, HS_Test_TearDown,
@@ -2049,6 +2565,23 @@ void UtTest_Setup(void)
                "HS_TblInit_Test_LoadEventMonTableError");
     UtTest_Add(HS_TblInit_Test_LoadMsgActsTableError, HS_Test_Setup, HS_Test_TearDown,
                "HS_TblInit_Test_LoadMsgActsTableError");
+    UtTest_Add(HS_TblInit_Test_RegisterMemMonTableError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblInit_Test_RegisterMemMonTableError");
+    UtTest_Add(HS_TblInit_Test_LoadMemMonTableError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblInit_Test_LoadMemMonTableError");
+    UtTest_Add(HS_TblInit_Test_RegisterMsgMonTableError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblInit_Test_RegisterMsgMonTableError");
+    UtTest_Add(HS_TblInit_Test_LoadMsgMonTableError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblInit_Test_LoadMsgMonTableError");
+    UtTest_Add(HS_TblInit_Test_NotifyEnabled, HS_Test_Setup, HS_Test_TearDown, "HS_TblInit_Test_NotifyEnabled");
+
+    UtTest_Add(HS_TblNotifyRegister_Test_Nominal, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblNotifyRegister_Test_Nominal");
+    UtTest_Add(HS_TblNotifyRegister_Test_Error, HS_Test_Setup, HS_Test_TearDown, "HS_TblNotifyRegister_Test_Error");
+    UtTest_Add(HS_AMSTableInit_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_AMSTableInit_Test_Nominal");
+    UtTest_Add(HS_AMSTableInit_Test_RegisterError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AMSTableInit_Test_RegisterError");
+    UtTest_Add(HS_AMSTableInit_Test_LoadError, HS_Test_Setup, HS_Test_TearDown, "HS_AMSTableInit_Test_LoadError");
 
     UtTest_Add(HS_ProcessMain_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ProcessMain_Test");
     UtTest_Add(HS_ProcessMain_Test_MonStateDisabled, HS_Test_Setup, HS_Test_TearDown,
@@ -2057,8 +2590,20 @@ void UtTest_Setup(void)
                "HS_ProcessMain_Test_AlivenessDisabled");
     UtTest_Add(HS_ProcessMain_Test_WatchdogDisabled, HS_Test_Setup, HS_Test_TearDown,
                "HS_ProcessMain_Test_WatchdogDisabled");
+    UtTest_Add(HS_ProcessMain_Test_WatchdogTask, HS_Test_Setup, HS_Test_TearDown, "HS_ProcessMain_Test_WatchdogTask");
+    UtTest_Add(HS_ProcessMain_Test_SysMonSampler, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ProcessMain_Test_SysMonSampler");
+    UtTest_Add(HS_ProcessMain_Test_MemMon, HS_Test_Setup, HS_Test_TearDown, "HS_ProcessMain_Test_MemMon");
+    UtTest_Add(HS_ProcessMain_Test_SbMon, HS_Test_Setup, HS_Test_TearDown, "HS_ProcessMain_Test_SbMon");
+    UtTest_Add(HS_ProcessMain_Test_MsgMon, HS_Test_Setup, HS_Test_TearDown, "HS_ProcessMain_Test_MsgMon");
 
     UtTest_Add(HS_ProcessCommands_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ProcessCommands_Test");
     UtTest_Add(HS_ProcessCommands_Test_NullMsgPtr, HS_Test_Setup, HS_Test_TearDown,
                "HS_ProcessCommands_Test_NullMsgPtr");
+    UtTest_Add(HS_ProcessCommands_Test_EventBudget, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ProcessCommands_Test_EventBudget");
+    UtTest_Add(HS_ProcessCommands_Test_EventBudgetEmpty, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ProcessCommands_Test_EventBudgetEmpty");
+    UtTest_Add(HS_ProcessCommands_Test_CmdPipeError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ProcessCommands_Test_CmdPipeError");
 }
@@ -32,6 +32,7 @@
 
 #include <unistd.h>
 #include <stdlib.h>
+#include <string.h>
 #include "cfe.h"
 #include "cfe_msgids.h"
 
@@ -52,6 +53,13 @@ int32 HS_CMDS_TEST_CFE_ES_GetTaskInfoHook(void *UserObj, int32 StubRetcode, uint
     return CFE_SUCCESS;
 }
 
+void HS_CMDS_TEST_CFE_TIME_GetMETHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *Now = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, *Now);
+}
+
 void HS_SendHkCmd_Test_InvalidEventMon(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
@@ -91,6 +99,9 @@ void HS_SendHkCmd_Test_InvalidEventMon(void)
     HS_AppData.EventsMonitoredCount    = 9;
     HS_AppData.MsgActExec              = 10;
 
+    HS_AppData.MsgActQueue.QueuedCount     = 11;
+    HS_AppData.MsgActQueue.SuppressedCount = 12;
+
     for (TableIndex = 0; TableIndex <= ((HS_MAX_MONITORED_APPS - 1) / HS_BITS_PER_APPMON_ENABLE); TableIndex++)
     {
         HS_AppData.AppMonEnables[TableIndex] = TableIndex;
@@ -111,6 +122,8 @@ void HS_SendHkCmd_Test_InvalidEventMon(void)
     UtAssert_True(PayloadPtr->MaxResets == 8, "PayloadPtr->MaxResets == 8");
     UtAssert_True(PayloadPtr->EventsMonitoredCount == 9, "PayloadPtr->EventsMonitoredCount == 9");
     UtAssert_True(PayloadPtr->MsgActExec == 10, "PayloadPtr->MsgActExec == 10");
+    UtAssert_UINT32_EQ(PayloadPtr->MsgActQueued, 11);
+    UtAssert_UINT32_EQ(PayloadPtr->MsgActSuppressed, 12);
     UtAssert_True(PayloadPtr->InvalidEventMonCount == 1, "PayloadPtr->InvalidEventMonCount == 1");
 
     /* Check first, middle, and last element */
@@ -126,6 +139,11 @@ void HS_SendHkCmd_Test_InvalidEventMon(void)
                   "((HS_MAX_MONITORED_APPS -1) / HS_BITS_PER_APPMON_ENABLE] == (HS_MAX_MONITORED_APPS -1) / "
                   "HS_BITS_PER_APPMON_ENABLE");
 
+    /* Phase timing and command statistics packets are sent along with housekeeping */
+    UtAssert_STUB_COUNT(HS_TimingReport, 1);
+    UtAssert_STUB_COUNT(HS_CmdLaneReport, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 3);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
@@ -179,12 +197,20 @@ void HS_SendHkCmd_Test_AllFlagsEnabled(void)
     HS_AppData.AppMonLoaded   = HS_STATE_ENABLED;
     HS_AppData.EventMonLoaded = HS_STATE_ENABLED;
     HS_AppData.CDSState       = HS_STATE_ENABLED;
+    HS_AppData.MemMonState    = HS_STATE_ENABLED;
+    HS_AppData.MsgMonState    = HS_STATE_ENABLED;
+
+    HS_AppData.MemMon[HS_MAX_MONITORED_MEM - 1].FreeBytes = 11;
+    HS_AppData.StackMon.Reported[0].HighWaterBytes        = 12;
+    HS_AppData.MsgMon[HS_MAX_MONITORED_MSGS - 1].AgeMsec  = 13;
 
     ExpectedStatusFlags |= HS_LOADED_XCT;
     ExpectedStatusFlags |= HS_LOADED_MAT;
     ExpectedStatusFlags |= HS_LOADED_AMT;
     ExpectedStatusFlags |= HS_LOADED_EMT;
     ExpectedStatusFlags |= HS_CDS_IN_USE;
+    ExpectedStatusFlags |= HS_LOADED_MMT;
+    ExpectedStatusFlags |= HS_LOADED_MFT;
 
     /* Execute the function being tested */
     HS_SendHkCmd(&UT_CmdBuf.SendHkCmd);
@@ -204,6 +230,9 @@ void HS_SendHkCmd_Test_AllFlagsEnabled(void)
     UtAssert_True(PayloadPtr->InvalidEventMonCount == 0, "PayloadPtr->InvalidEventMonCount == 0");
 
     UtAssert_True(PayloadPtr->StatusFlags == ExpectedStatusFlags, "PayloadPtr->StatusFlags == ExpectedStatusFlags");
+    UtAssert_UINT32_EQ(PayloadPtr->MemMon[HS_MAX_MONITORED_MEM - 1].FreeBytes, 11);
+    UtAssert_UINT32_EQ(PayloadPtr->StackTop[0].HighWaterBytes, 12);
+    UtAssert_UINT32_EQ(PayloadPtr->MsgMon[HS_MAX_MONITORED_MSGS - 1].AgeMsec, 13);
 
     /* Check first, middle, and last element */
     UtAssert_True(PayloadPtr->AppMonEnables[0] == 0, "PayloadPtr->AppMonEnables[0] == 0");
@@ -276,9 +305,6 @@ void HS_SendHkCmd_Test_ResourceTypeAppMain(void)
     HS_AppData.ExeCountState              = HS_STATE_ENABLED;
     HS_AppData.XCTablePtr[0].ResourceType = HS_XCT_TYPE_APP_MAIN;
 
-    /* Causes line "Status = CFE_ES_GetTaskInfo(&TaskInfo, TaskId)" to be reached */
-    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetIdByName), 1, OS_SUCCESS);
-
     /* Sets TaskInfo.ExecutionCounter to 5, returns CFE_SUCCESS, goes to line "ExeCount = TaskInfo.ExecutionCounter" */
     TaskInfo.ExecutionCounter = 5;
     UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskInfo), &TaskInfo, sizeof(TaskInfo), false);
@@ -316,6 +342,10 @@ void HS_SendHkCmd_Test_ResourceTypeAppMain(void)
 
     UtAssert_True(PayloadPtr->ExeCounts[0] == 5, "PayloadPtr->ExeCounts[0] == 5");
 
+    /* The task IDs resolved when the table was compiled are used */
+    UtAssert_STUB_COUNT(HS_RuntimeResolveXC, 0);
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskIDByName, 0);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
@@ -373,13 +403,13 @@ void HS_SendHkCmd_Test_ResourceTypeAppChild(void)
     HS_AppData.ExeCountState              = HS_STATE_ENABLED;
     HS_AppData.XCTablePtr[0].ResourceType = HS_XCT_TYPE_APP_CHILD;
 
-    /* Causes line "Status = CFE_ES_GetTaskInfo(&TaskInfo, TaskId)" to be reached */
-    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetIdByName), 1, OS_SUCCESS);
+    /* The cached task ID is stale, so the task is looked up again by name */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskInfo), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(HS_RuntimeResolveXC), 1, true);
 
-    /* Sets TaskInfo.ExecutionCounter to 5, returns CFE_SUCCESS, goes to line "ExeCount = TaskInfo.ExecutionCounter" */
+    /* Sets TaskInfo.ExecutionCounter to 5 on the second read */
     TaskInfo.ExecutionCounter = 5;
     UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskInfo), &TaskInfo, sizeof(TaskInfo), false);
-    UT_SetHookFunction(UT_KEY(CFE_ES_GetTaskInfo), HS_CMDS_TEST_CFE_ES_GetTaskInfoHook, &TaskInfo);
 
     /* Execute the function being tested */
     HS_SendHkCmd(&UT_CmdBuf.SendHkCmd);
@@ -412,6 +442,7 @@ void HS_SendHkCmd_Test_ResourceTypeAppChild(void)
                   "HS_BITS_PER_APPMON_ENABLE");
 
     UtAssert_True(PayloadPtr->ExeCounts[0] == 5, "PayloadPtr->ExeCounts[0] == 5");
+    UtAssert_STUB_COUNT(HS_RuntimeResolveXC, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -426,7 +457,6 @@ void HS_SendHkCmd_Test_ResourceTypeAppChildTaskIdError(void)
     HS_EMTEntry_t     EMTable[HS_MAX_MONITORED_EVENTS];
     HS_XCTEntry_t     XCTable[HS_MAX_EXEC_CNT_SLOTS];
     uint32            TableIndex;
-    CFE_ES_TaskInfo_t TaskInfo;
     int               i;
 
     HS_HkTlm_Payload_t *PayloadPtr;
@@ -470,14 +500,8 @@ void HS_SendHkCmd_Test_ResourceTypeAppChildTaskIdError(void)
     HS_AppData.ExeCountState              = HS_STATE_ENABLED;
     HS_AppData.XCTablePtr[0].ResourceType = HS_XCT_TYPE_APP_CHILD;
 
-    /* Causes line "Status = CFE_ES_GetTaskInfo(&TaskInfo, TaskId)" to be skipped */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskIDByName), 1, -1);
-
-    /* Sets TaskInfo.ExecutionCounter to 5, returns CFE_SUCCESS, goes to line "ExeCount = TaskInfo.ExecutionCounter" */
-    TaskInfo.ExecutionCounter = 5;
-    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskInfo), &TaskInfo, sizeof(TaskInfo), false);
-    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskInfo), &TaskInfo, sizeof(TaskInfo), false);
-    UT_SetHookFunction(UT_KEY(CFE_ES_GetTaskInfo), HS_CMDS_TEST_CFE_ES_GetTaskInfoHook, &TaskInfo);
+    /* The cached task IDs are stale and the tasks can't be found by name */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetTaskInfo), -1);
 
     /* Execute the function being tested */
     HS_SendHkCmd(&UT_CmdBuf.SendHkCmd);
@@ -510,6 +534,8 @@ void HS_SendHkCmd_Test_ResourceTypeAppChildTaskIdError(void)
                   "HS_BITS_PER_APPMON_ENABLE");
 
     UtAssert_True(PayloadPtr->ExeCounts[0] == HS_INVALID_EXECOUNT, "PayloadPtr->ExeCounts[0] == HS_INVALID_EXECOUNT");
+    UtAssert_STUB_COUNT(HS_RuntimeResolveXC, HS_MAX_EXEC_CNT_SLOTS);
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskInfo, HS_MAX_EXEC_CNT_SLOTS);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -567,11 +593,10 @@ void HS_SendHkCmd_Test_ResourceTypeAppChildTaskInfoError(void)
     HS_AppData.ExeCountState              = HS_STATE_ENABLED;
     HS_AppData.XCTablePtr[0].ResourceType = HS_XCT_TYPE_APP_CHILD;
 
-    /* Causes line "Status = CFE_ES_GetTaskInfo(&TaskInfo, TaskId)" to be skipped */
-    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetIdByName), 1, OS_SUCCESS);
-
-    /* Sets CFE_ES_GetTaskInfo to return an error and bypass "ExeCount = TaskInfo.ExecutionCounter" */
+    /* The task is found again by name, but its info still can't be read */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskInfo), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskInfo), 2, -1);
+    UT_SetDeferredRetcode(UT_KEY(HS_RuntimeResolveXC), 1, true);
 
     /* Execute the function being tested */
     HS_SendHkCmd(&UT_CmdBuf.SendHkCmd);
@@ -604,6 +629,7 @@ void HS_SendHkCmd_Test_ResourceTypeAppChildTaskInfoError(void)
                   "HS_BITS_PER_APPMON_ENABLE");
 
     UtAssert_True(PayloadPtr->ExeCounts[0] == HS_INVALID_EXECOUNT, "PayloadPtr->ExeCounts[0] == HS_INVALID_EXECOUNT");
+    UtAssert_STUB_COUNT(HS_RuntimeResolveXC, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -844,8 +870,8 @@ void HS_SendHkCmd_Test_ResourceTypeISRGenCounterError(void)
     HS_AppData.ExeCountState              = HS_STATE_ENABLED;
     HS_AppData.XCTablePtr[0].ResourceType = HS_XCT_TYPE_ISR;
 
-    /* Set CFE_ES_GetGenCounterIDByName to return error and skip CFE_ES_GetGenCount(TaskId, &ExeCount) */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetGenCounterIDByName), -1);
+    /* The cached counter IDs are stale and the counters can't be found by name */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetGenCount), -1);
 
     /* Execute the function being tested */
     HS_SendHkCmd(&UT_CmdBuf.SendHkCmd);
@@ -878,6 +904,7 @@ void HS_SendHkCmd_Test_ResourceTypeISRGenCounterError(void)
                   "HS_BITS_PER_APPMON_ENABLE");
 
     UtAssert_True(PayloadPtr->ExeCounts[0] == HS_INVALID_EXECOUNT, "PayloadPtr->ExeCounts[0] == HS_INVALID_EXECOUNT");
+    UtAssert_STUB_COUNT(HS_RuntimeResolveXC, HS_MAX_EXEC_CNT_SLOTS);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -1049,6 +1076,13 @@ void HS_ResetCmd_Test(void)
 
 void HS_ResetCounters_Test(void)
 {
+    HS_AppData.MsgActQueue.QueuedCount     = 1;
+    HS_AppData.MsgActQueue.SuppressedCount = 2;
+
+    HS_AppData.CmdStatsPkt.Payload.Codes[HS_NOOP_CC].AcceptCount = 3;
+    HS_AppData.CmdStatsPkt.Payload.HandlerHist[0]                = 4;
+    HS_AppData.CmdLane.LatencyTotalUsec[HS_CMD_LANE_NORMAL]      = 5;
+
     /* Execute the function being tested */
     HS_ResetCounters();
 
@@ -1057,6 +1091,11 @@ void HS_ResetCounters_Test(void)
     UtAssert_True(HS_AppData.CmdErrCount == 0, "HS_AppData.CmdErrCount == 0");
     UtAssert_True(HS_AppData.EventsMonitoredCount == 0, "HS_AppData.EventsMonitoredCount == 0");
     UtAssert_True(HS_AppData.MsgActExec == 0, "HS_AppData.MsgActExec == 0");
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.QueuedCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.SuppressedCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Codes[HS_NOOP_CC].AcceptCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.HandlerHist[0], 0);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.LatencyTotalUsec[HS_CMD_LANE_NORMAL], 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -1715,6 +1754,265 @@ void HS_SetMaxResetsCmd_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_ManageTablesCmd_Test_Nominal(void)
+{
+    UT_CmdBuf.ManageTablesCmd.Payload.Parameter = HS_TBL_NOTIFY_AMT | HS_TBL_NOTIFY_XCT;
+
+    HS_AppData.TblManagePending = HS_TBL_NOTIFY_EMT;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_ManageTablesCmd(&UT_CmdBuf.ManageTablesCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.TblManagePending, HS_TBL_NOTIFY_AMT | HS_TBL_NOTIFY_EMT | HS_TBL_NOTIFY_XCT);
+    UtAssert_UINT32_EQ(HS_AppData.CmdCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CmdErrCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void HS_ManageTablesCmd_Test_InvalidParameter(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Invalid manage tables request: Parameter = 0x%%08X");
+
+    /* No table */
+    UT_CmdBuf.ManageTablesCmd.Payload.Parameter = 0;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_ManageTablesCmd(&UT_CmdBuf.ManageTablesCmd), CFE_SUCCESS);
+
+    /* Unknown table */
+    UT_CmdBuf.ManageTablesCmd.Payload.Parameter = HS_TBL_NOTIFY_AMT | 0x100;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_ManageTablesCmd(&UT_CmdBuf.ManageTablesCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.TblManagePending, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CmdErrCount, 2);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MANAGE_TABLES_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void HS_SendHistoryCmd_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_SendHistoryCmd(&UT_CmdBuf.SendHistoryCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.CmdCount, 1);
+    UtAssert_STUB_COUNT(HS_HistoryReport, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SEND_HISTORY_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void HS_ResetTimingCmd_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_ResetTimingCmd(&UT_CmdBuf.ResetTimingCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.CmdCount, 1);
+    UtAssert_STUB_COUNT(HS_TimingReset, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_RESET_TIMING_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void HS_RegisterPoolCmd_Test_Nominal(void)
+{
+    HS_RegisterPool_Payload_t *PayloadPtr = &UT_CmdBuf.RegisterPoolCmd.Payload;
+    HS_RuntimeBuf_t *          RuntimePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MMT);
+
+    RuntimePtr->MMTable[0].ResourceType = HS_MMT_TYPE_POOL;
+    RuntimePtr->MMTable[1].ResourceType = HS_MMT_TYPE_HEAP;
+
+    strncpy(PayloadPtr->AppName, "AppName", sizeof(PayloadPtr->AppName) - 1);
+    PayloadPtr->PoolIndex  = 3;
+    PayloadPtr->PoolHandle = 0x1234;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_RegisterPoolCmd(&UT_CmdBuf.RegisterPoolCmd), CFE_SUCCESS);
+
+    /* Verify results, the first free slot was taken and only pool entries were resolved again */
+    UtAssert_STRINGBUF_EQ(HS_AppData.PoolReg[0].AppName, sizeof(HS_AppData.PoolReg[0].AppName), "AppName", -1);
+    UtAssert_UINT32_EQ(HS_AppData.PoolReg[0].PoolIndex, 3);
+    UtAssert_BOOL_TRUE(
+        CFE_RESOURCEID_TEST_EQUAL(HS_AppData.PoolReg[0].PoolHandle, CFE_ResourceId_FromInteger(0x1234)));
+    UtAssert_STUB_COUNT(HS_RuntimeResolveMM, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdCount, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_REGISTER_POOL_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void HS_RegisterPoolCmd_Test_Replace(void)
+{
+    HS_RegisterPool_Payload_t *PayloadPtr = &UT_CmdBuf.RegisterPoolCmd.Payload;
+
+    /* The pool was registered before the application restarted */
+    strncpy(HS_AppData.PoolReg[1].AppName, "AppName", sizeof(HS_AppData.PoolReg[1].AppName) - 1);
+    HS_AppData.PoolReg[1].PoolIndex  = 3;
+    HS_AppData.PoolReg[1].PoolHandle = CFE_ResourceId_FromInteger(0x1000);
+
+    strncpy(PayloadPtr->AppName, "AppName", sizeof(PayloadPtr->AppName) - 1);
+    PayloadPtr->PoolIndex  = 3;
+    PayloadPtr->PoolHandle = 0x2000;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_RegisterPoolCmd(&UT_CmdBuf.RegisterPoolCmd), CFE_SUCCESS);
+
+    /* Verify results, the handle was replaced instead of taking the free slot before it */
+    UtAssert_BOOL_TRUE(
+        CFE_RESOURCEID_TEST_EQUAL(HS_AppData.PoolReg[1].PoolHandle, CFE_ResourceId_FromInteger(0x2000)));
+    UtAssert_UINT32_EQ(HS_AppData.PoolReg[0].AppName[0], '\0');
+    UtAssert_UINT32_EQ(HS_AppData.CmdCount, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_REGISTER_POOL_DBG_EID);
+}
+
+void HS_RegisterPoolCmd_Test_Errors(void)
+{
+    HS_RegisterPool_Payload_t *PayloadPtr = &UT_CmdBuf.RegisterPoolCmd.Payload;
+    uint32                     RegIndex;
+
+    /* No application name */
+    PayloadPtr->PoolIndex  = 3;
+    PayloadPtr->PoolHandle = 0x1234;
+
+    UtAssert_INT32_EQ(HS_RegisterPoolCmd(&UT_CmdBuf.RegisterPoolCmd), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(HS_AppData.CmdErrCount, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_REGISTER_POOL_ERR_EID);
+
+    /* Not a memory pool */
+    strncpy(PayloadPtr->AppName, "AppName", sizeof(PayloadPtr->AppName) - 1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetMemPoolStats), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    UtAssert_INT32_EQ(HS_RegisterPoolCmd(&UT_CmdBuf.RegisterPoolCmd), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(HS_AppData.CmdErrCount, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_REGISTER_POOL_ERR_EID);
+
+    /* Every registration in use by other pools */
+    for (RegIndex = 0; RegIndex < HS_MAX_REGISTERED_POOLS; RegIndex++)
+    {
+        strncpy(HS_AppData.PoolReg[RegIndex].AppName, "OtherApp", sizeof(HS_AppData.PoolReg[RegIndex].AppName) - 1);
+        HS_AppData.PoolReg[RegIndex].PoolIndex = RegIndex;
+    }
+
+    UtAssert_INT32_EQ(HS_RegisterPoolCmd(&UT_CmdBuf.RegisterPoolCmd), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(HS_AppData.CmdErrCount, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, HS_REGISTER_POOL_ERR_EID);
+
+    /* Nothing was registered */
+    UtAssert_UINT32_EQ(HS_AppData.CmdCount, 0);
+    UtAssert_STUB_COUNT(HS_RuntimeResolveMM, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+}
+
+void HS_RegisterStackCmd_Test_Nominal(void)
+{
+    HS_RegisterStack_Payload_t *PayloadPtr = &UT_CmdBuf.RegisterStackCmd.Payload;
+
+    strncpy(PayloadPtr->TaskName, "TaskName", sizeof(PayloadPtr->TaskName) - 1);
+    strncpy(PayloadPtr->StackSymbol, "TaskStack", sizeof(PayloadPtr->StackSymbol) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_StackMonRegister), true);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_RegisterStackCmd(&UT_CmdBuf.RegisterStackCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_SymbolLookup, 1);
+    UtAssert_STUB_COUNT(HS_StackMonRegister, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdCount, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_REGISTER_STACK_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void HS_RegisterStackCmd_Test_Errors(void)
+{
+    HS_RegisterStack_Payload_t *PayloadPtr = &UT_CmdBuf.RegisterStackCmd.Payload;
+
+    /* No task name */
+    strncpy(PayloadPtr->StackSymbol, "TaskStack", sizeof(PayloadPtr->StackSymbol) - 1);
+
+    UtAssert_INT32_EQ(HS_RegisterStackCmd(&UT_CmdBuf.RegisterStackCmd), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(HS_AppData.CmdErrCount, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_REGISTER_STACK_ERR_EID);
+
+    /* Symbol not found */
+    strncpy(PayloadPtr->TaskName, "TaskName", sizeof(PayloadPtr->TaskName) - 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_SymbolLookup), 1, OS_ERROR);
+
+    UtAssert_INT32_EQ(HS_RegisterStackCmd(&UT_CmdBuf.RegisterStackCmd), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(HS_AppData.CmdErrCount, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_REGISTER_STACK_ERR_EID);
+
+    /* Every registration in use */
+    UT_SetDefaultReturnValue(UT_KEY(HS_StackMonRegister), false);
+
+    UtAssert_INT32_EQ(HS_RegisterStackCmd(&UT_CmdBuf.RegisterStackCmd), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(HS_AppData.CmdErrCount, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, HS_REGISTER_STACK_ERR_EID);
+
+    /* Only the last one got as far as registering */
+    UtAssert_STUB_COUNT(HS_StackMonRegister, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+}
+
+void HS_TblManageNeeded_Test(void)
+{
+    /* Never compiled, always managed */
+    UtAssert_BOOL_TRUE(HS_TblManageNeeded(HS_TBL_NOTIFY_AMT, HS_AppData.AMTableHandle, false));
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 0);
+
+    /* Polled, nothing pending */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_SUCCESS);
+    UtAssert_BOOL_FALSE(HS_TblManageNeeded(HS_TBL_NOTIFY_AMT, HS_AppData.AMTableHandle, true));
+
+    /* Polled, update pending */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_UPDATE_PENDING);
+    UtAssert_BOOL_TRUE(HS_TblManageNeeded(HS_TBL_NOTIFY_AMT, HS_AppData.AMTableHandle, true));
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 2);
+
+    /* Notified, nothing pending */
+    HS_AppData.TblNotifyMask       = HS_TBL_NOTIFY_ALL;
+    HS_AppData.TblPollCycleCounter = 1;
+    UtAssert_BOOL_FALSE(HS_TblManageNeeded(HS_TBL_NOTIFY_EMT, HS_AppData.EMTableHandle, true));
+
+    /* Notified, pending is consumed */
+    HS_AppData.TblManagePending = HS_TBL_NOTIFY_EMT | HS_TBL_NOTIFY_MAT;
+    UtAssert_BOOL_TRUE(HS_TblManageNeeded(HS_TBL_NOTIFY_EMT, HS_AppData.EMTableHandle, true));
+    UtAssert_UINT32_EQ(HS_AppData.TblManagePending, HS_TBL_NOTIFY_MAT);
+    UtAssert_BOOL_FALSE(HS_TblManageNeeded(HS_TBL_NOTIFY_EMT, HS_AppData.EMTableHandle, true));
+
+    /* Table Services is not asked about notified tables between polls */
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 2);
+
+    /* Poll due, a load whose notification was lost is still found */
+    HS_AppData.TblPollCycleCounter = 0;
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_UPDATE_PENDING);
+    UtAssert_BOOL_TRUE(HS_TblManageNeeded(HS_TBL_NOTIFY_EMT, HS_AppData.EMTableHandle, true));
+    UtAssert_BOOL_FALSE(HS_TblManageNeeded(HS_TBL_NOTIFY_EMT, HS_AppData.EMTableHandle, true));
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 4);
+}
+
 void HS_AcquirePointers_Test_Nominal(void)
 {
     HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
@@ -1751,9 +2049,9 @@ void HS_AcquirePointers_Test_ErrorsWithAppMonLoadedAndEventMonLoadedEnabled(void
     snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Error getting EventMon Table address, RC=0x%%08X, Event Monitoring Disabled");
     snprintf(ExpectedEventString[2], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting MsgActs Table address, RC=0x%%08X");
+             "Error getting %%s Table address, RC=0x%%08X");
     snprintf(ExpectedEventString[3], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting ExeCount Table address, RC=0x%%08X");
+             "Error getting %%s Table address, RC=0x%%08X");
 
     HS_AppData.AppMonLoaded         = HS_STATE_ENABLED;
     HS_AppData.EventMonLoaded       = HS_STATE_ENABLED;
@@ -1826,9 +2124,9 @@ void HS_AcquirePointers_Test_ErrorsWithCurrentAppMonAndCurrentEventMonEnabled2(v
     snprintf(ExpectedEventString[2], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Error Unsubscribing from short-format Events,RC=0x%%08X");
     snprintf(ExpectedEventString[3], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting MsgActs Table address, RC=0x%%08X");
+             "Error getting %%s Table address, RC=0x%%08X");
     snprintf(ExpectedEventString[4], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting ExeCount Table address, RC=0x%%08X");
+             "Error getting %%s Table address, RC=0x%%08X");
 
     HS_AppData.AppMonLoaded         = HS_STATE_DISABLED;
     HS_AppData.EventMonLoaded       = HS_STATE_DISABLED;
@@ -1912,9 +2210,9 @@ void HS_AcquirePointers_Test_ErrorsWithCurrentAppMonAndCurrentEventMonEnabled(vo
     snprintf(ExpectedEventString[2], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Error Unsubscribing from long-format Events,RC=0x%%08X");
     snprintf(ExpectedEventString[3], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting MsgActs Table address, RC=0x%%08X");
+             "Error getting %%s Table address, RC=0x%%08X");
     snprintf(ExpectedEventString[4], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting ExeCount Table address, RC=0x%%08X");
+             "Error getting %%s Table address, RC=0x%%08X");
 
     HS_AppData.AppMonLoaded         = HS_STATE_DISABLED;
     HS_AppData.EventMonLoaded       = HS_STATE_DISABLED;
@@ -2108,6 +2406,247 @@ void HS_AcquirePointers_Test_ErrorsWithCurrentAppMonLoadedDisabledAndCurrentAppM
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_AcquirePointers_Test_CompiledNoPendingAction(void)
+{
+    /* Each table is checked in its own active buffer */
+    HS_AppData.RuntimeActiveMask         = HS_TBL_NOTIFY_AMT;
+    HS_AppData.RuntimeBuf[1].AMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].EMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MATCompiled = true;
+    HS_AppData.RuntimeBuf[0].XCTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MFTCompiled = true;
+
+    /* Table Services reports nothing pending for any table */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 7);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 0);
+    UtAssert_STUB_COUNT(HS_RuntimeSwap, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_AcquirePointers_Test_CompiledUpdatePending(void)
+{
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    HS_AppData.RuntimeBuf[0].AMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].EMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MATCompiled = true;
+    HS_AppData.RuntimeBuf[0].XCTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MFTCompiled = true;
+
+    /* Every table has an update pending which Manage then applies */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+
+    HS_AppData.CurrentAppMonState = HS_STATE_DISABLED;
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 7);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 6);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 6);
+    UtAssert_STUB_COUNT(HS_RuntimeCompileAMT, 1);
+    UtAssert_STUB_COUNT(HS_RuntimeCompileEMT, 1);
+    UtAssert_STUB_COUNT(HS_RuntimeCompileMAT, 1);
+    UtAssert_STUB_COUNT(HS_RuntimeCompileXCT, 1);
+    UtAssert_STUB_COUNT(HS_RuntimeCompileMMT, 1);
+    UtAssert_STUB_COUNT(HS_RuntimeCompileMFT, 1);
+    UtAssert_STUB_COUNT(HS_RuntimeStage, 6);
+    UtAssert_STUB_COUNT(HS_RuntimeSwap, 1);
+
+    UtAssert_True(HS_AppData.AppMonLoaded == HS_STATE_ENABLED, "HS_AppData.AppMonLoaded == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.EventMonLoaded == HS_STATE_ENABLED, "HS_AppData.EventMonLoaded == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.MsgActsState == HS_STATE_ENABLED, "HS_AppData.MsgActsState == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.ExeCountState == HS_STATE_ENABLED, "HS_AppData.ExeCountState == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.MemMonState == HS_STATE_ENABLED, "HS_AppData.MemMonState == HS_STATE_ENABLED");
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].FreeBytes, HS_MEMMON_INVALID);
+    UtAssert_True(HS_AppData.MsgMonState == HS_STATE_ENABLED, "HS_AppData.MsgMonState == HS_STATE_ENABLED");
+    UtAssert_STUB_COUNT(HS_MsgMonSubscribe, 1);
+}
+
+void HS_AcquirePointers_Test_CompiledNotified(void)
+{
+    HS_AppData.RuntimeBuf[0].AMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].EMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MATCompiled = true;
+    HS_AppData.RuntimeBuf[0].XCTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MFTCompiled = true;
+
+    HS_AppData.TblNotifyMask       = HS_TBL_NOTIFY_ALL;
+    HS_AppData.TblManagePending    = HS_TBL_NOTIFY_MAT;
+    HS_AppData.TblPollCycleCounter = 2;
+
+    /* Dump pending, which does not change the table contents */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+    UtAssert_STUB_COUNT(HS_RuntimeCompileMAT, 0);
+    UtAssert_STUB_COUNT(HS_RuntimeSwap, 0);
+    UtAssert_STUB_COUNT(HS_MsgActQueueFlush, 0);
+    UtAssert_UINT32_EQ(HS_AppData.TblManagePending, 0);
+
+    /* Nothing pending on the next cycle */
+    HS_AcquirePointers();
+
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* Then the status of every table is checked */
+    HS_AcquirePointers();
+
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 7);
+    UtAssert_UINT32_EQ(HS_AppData.TblPollCycleCounter, HS_TBL_NOTIFY_POLL_CYCLES - 1);
+}
+
+void HS_AcquirePointers_Test_AppMonStateDump(void)
+{
+    HS_AppData.RuntimeBuf[0].AMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].EMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MATCompiled = true;
+    HS_AppData.RuntimeBuf[0].XCTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MMTCompiled = true;
+    HS_AppData.RuntimeBuf[0].MFTCompiled = true;
+
+    HS_AppData.TblNotifyMask    = HS_TBL_NOTIFY_ALL;
+    HS_AppData.TblManagePending = HS_TBL_NOTIFY_AMS;
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 0);
+    UtAssert_UINT32_EQ(HS_AppData.TblManagePending, 0);
+
+    /* Never managed if the table failed to register */
+    HS_AppData.AMSTableHandle   = CFE_TBL_BAD_TABLE_HANDLE;
+    HS_AppData.TblManagePending = HS_TBL_NOTIFY_AMS;
+
+    HS_AcquirePointers();
+
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_UINT32_EQ(HS_AppData.TblManagePending, HS_TBL_NOTIFY_AMS);
+}
+
+void HS_AcquirePointers_Test_MemMonError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error getting %%s Table address, RC=0x%%08X");
+
+    HS_AppData.MemMonState = HS_STATE_ENABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), -1);
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.MemMonState == HS_STATE_DISABLED, "HS_AppData.MemMonState == HS_STATE_DISABLED");
+    UtAssert_STUB_COUNT(HS_RuntimeCompileMMT, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MEMMON_GETADDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    /* Only reported while enabled */
+    HS_AcquirePointers();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_AcquirePointers_Test_MsgMonError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error getting %%s Table address, RC=0x%%08X");
+
+    HS_AppData.MsgMonState = HS_STATE_ENABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), -1);
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.MsgMonState == HS_STATE_DISABLED, "HS_AppData.MsgMonState == HS_STATE_DISABLED");
+    UtAssert_STUB_COUNT(HS_RuntimeCompileMFT, 0);
+    UtAssert_STUB_COUNT(HS_MsgMonSubscribe, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MSGMON_GETADDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    /* Only reported while enabled */
+    HS_AcquirePointers();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_AcquirePointers_Test_FirstCompileRefresh(void)
+{
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    AMTable[0].CycleCount = 10;
+    AMTable[0].ActionType = HS_AMT_ACT_EVENT;
+
+    /* Tables that were never compiled are compiled even without an update */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results, every table with status is refreshed the same way */
+    UtAssert_STUB_COUNT(HS_RuntimeSwap, 1);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CheckInCountdown, 10);
+    UtAssert_STUB_COUNT(HS_MsgActQueueFlush, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].FreeBytes, HS_MEMMON_INVALID);
+    UtAssert_STUB_COUNT(HS_MsgMonSubscribe, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void HS_AppMonStatusRefresh_Test_CycleCountZero(void)
 {
     HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
@@ -2140,15 +2679,15 @@ void HS_AppMonStatusRefresh_Test_CycleCountZero(void)
     UtAssert_True(HS_AppData.AppMonEnables[(HS_MAX_MONITORED_APPS - 1) / HS_BITS_PER_APPMON_ENABLE] == 0,
                   "((HS_MAX_MONITORED_APPS -1) / HS_BITS_PER_APPMON_ENABLE] == 0");
 
-    UtAssert_True(HS_AppData.AppMonLastExeCount[0] == 0, "HS_AppData.AppMonLastExeCount[0] == 0");
-    UtAssert_True(HS_AppData.AppMonLastExeCount[HS_MAX_MONITORED_APPS / 2] == 0,
-                  "HS_AppData.AppMonLastExeCount[HS_MAX_MONITORED_APPS / 2] == 0");
-    UtAssert_UINT32_EQ(HS_AppData.AppMonLastExeCount[HS_MAX_MONITORED_APPS - 1], 0);
+    UtAssert_True(HS_AppData.AppMonState[0].LastExeCount == 0, "HS_AppData.AppMonState[0].LastExeCount == 0");
+    UtAssert_True(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].LastExeCount == 0,
+                  "HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].LastExeCount == 0");
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS - 1].LastExeCount, 0);
 
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[HS_MAX_MONITORED_APPS / 2] == 0,
-                  "HS_AppData.AppMonCheckInCountdown[HS_MAX_MONITORED_APPS / 2] == 0");
-    UtAssert_UINT16_EQ(HS_AppData.AppMonCheckInCountdown[HS_MAX_MONITORED_APPS - 1], 0);
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
+    UtAssert_True(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].CheckInCountdown == 0,
+                  "HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].CheckInCountdown == 0");
+    UtAssert_UINT16_EQ(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS - 1].CheckInCountdown, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -2188,21 +2727,59 @@ void HS_AppMonStatusRefresh_Test_ActionTypeNOACT(void)
     UtAssert_True(HS_AppData.AppMonEnables[(HS_MAX_MONITORED_APPS - 1) / HS_BITS_PER_APPMON_ENABLE] == 0,
                   "((HS_MAX_MONITORED_APPS -1) / HS_BITS_PER_APPMON_ENABLE] == 0");
 
-    UtAssert_True(HS_AppData.AppMonLastExeCount[0] == 0, "HS_AppData.AppMonLastExeCount[0] == 0");
-    UtAssert_True(HS_AppData.AppMonLastExeCount[HS_MAX_MONITORED_APPS / 2] == 0,
-                  "HS_AppData.AppMonLastExeCount[HS_MAX_MONITORED_APPS / 2] == 0");
-    UtAssert_UINT32_EQ(HS_AppData.AppMonLastExeCount[HS_MAX_MONITORED_APPS - 1], 0);
+    UtAssert_True(HS_AppData.AppMonState[0].LastExeCount == 0, "HS_AppData.AppMonState[0].LastExeCount == 0");
+    UtAssert_True(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].LastExeCount == 0,
+                  "HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].LastExeCount == 0");
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS - 1].LastExeCount, 0);
 
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[HS_MAX_MONITORED_APPS / 2] == 0,
-                  "HS_AppData.AppMonCheckInCountdown[HS_MAX_MONITORED_APPS / 2] == 0");
-    UtAssert_UINT16_EQ(HS_AppData.AppMonCheckInCountdown[HS_MAX_MONITORED_APPS - 1], 0);
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
+    UtAssert_True(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].CheckInCountdown == 0,
+                  "HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].CheckInCountdown == 0");
+    UtAssert_UINT16_EQ(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS - 1].CheckInCountdown, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_AppMonStatusRefresh_Test_Escalation(void)
+{
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+    uint32        i;
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
+    {
+        HS_AppData.CDSLadders.Ladder[i].AppHash = 5;
+    }
+
+    AMTable[0].ActionType               = HS_AMT_ACT_EVENT;
+    AMTable[0].CycleCount               = 1;
+    AMTable[0].Escalation[0].ActionType = HS_AMT_ACT_APP_RESTART;
+    AMTable[1].ActionType               = HS_AMT_ACT_EVENT;
+    AMTable[1].CycleCount               = 1;
+
+    /* Entry 0 keeps its position, entry 1 no longer has the rung, entry 2 now monitors another App */
+    HS_AppData.CDSLadders.Ladder[0].Rung          = 1;
+    HS_AppData.CDSLadders.Ladder[1].Rung          = 1;
+    HS_AppData.CDSLadders.Ladder[2].AppHash       = 6;
+    HS_AppData.AppMonState[0].RecoveryCheckIns = 3;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_KeyHash), 5);
+
+    /* Execute the function being tested */
+    HS_AppMonStatusRefresh();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].EscalationRung, 1);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].RecoveryCheckIns, 0);
+
+    UtAssert_STUB_COUNT(HS_SetCDSLadder, 2);
+}
+
 void HS_AppMonStatusRefresh_Test_ElseCase(void)
 {
     HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
@@ -2227,16 +2804,19 @@ void HS_AppMonStatusRefresh_Test_ElseCase(void)
     HS_AppMonStatusRefresh();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonLastExeCount[0] == 0, "HS_AppData.AppMonLastExeCount[0] == 0");
-    UtAssert_True(HS_AppData.AppMonLastExeCount[HS_MAX_MONITORED_APPS / 2] == 0,
-                  "HS_AppData.AppMonLastExeCount[HS_MAX_MONITORED_APPS / 2] == 0");
-    UtAssert_UINT32_EQ(HS_AppData.AppMonLastExeCount[HS_MAX_MONITORED_APPS - 1], 0);
-
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 1, "HS_AppData.AppMonCheckInCountdown[0] == 1");
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[HS_MAX_MONITORED_APPS / 2] == (HS_MAX_MONITORED_APPS / 2) + 1,
-                  "HS_AppData.AppMonCheckInCountdown[HS_MAX_MONITORED_APPS / 2] == (HS_MAX_MONITORED_APPS / 2) + 1");
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[HS_MAX_MONITORED_APPS - 1] == (HS_MAX_MONITORED_APPS - 1) + 1,
-                  "HS_AppData.AppMonCheckInCountdown[HS_MAX_MONITORED_APPS] == (HS_MAX_MONITORED_APPS - 1) + 1");
+    UtAssert_True(HS_AppData.AppMonState[0].LastExeCount == 0, "HS_AppData.AppMonState[0].LastExeCount == 0");
+    UtAssert_True(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].LastExeCount == 0,
+                  "HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].LastExeCount == 0");
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS - 1].LastExeCount, 0);
+
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 1, "HS_AppData.AppMonState[0].CheckInCountdown == 1");
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS / 2].CheckInCountdown,
+                       (HS_MAX_MONITORED_APPS / 2) + 1);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS - 1].CheckInCountdown,
+                       (HS_MAX_MONITORED_APPS - 1) + 1);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[HS_MAX_MONITORED_APPS - 1].CycleCount, HS_MAX_MONITORED_APPS);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CyclesSinceCheckIn, 0);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].MaxCyclesSinceCheckIn, 0);
 
     /* Check first, middle, and last element */
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0xFFFFFFFF, "HS_AppData.AppMonEnables[0] == 0xFFFFFFFF");
@@ -2254,13 +2834,53 @@ void HS_AppMonStatusRefresh_Test_ElseCase(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_MemMonStatusRefresh_Test(void)
+{
+    HS_AppData.MemMon[0].LowWaterBytes = 5;
+    HS_AppData.MemMonFlags[0]          = HS_MEMMON_LIMIT_CROSSED | HS_MEMMON_READ_FAILED;
+    HS_AppData.MemMonCycleCounter      = 3;
+
+    /* Execute the function being tested */
+    HS_MemMonStatusRefresh();
+
+    /* Verify results, the new table is sampled on the next cycle */
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].FreeBytes, HS_MEMMON_INVALID);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].LowWaterBytes, HS_MEMMON_INVALID);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].LargestFreeBlock, HS_MEMMON_INVALID);
+    UtAssert_UINT32_EQ(HS_AppData.MemMonFlags[0], 0);
+    UtAssert_UINT32_EQ(HS_AppData.MemMonCycleCounter, 0);
+}
+
+void HS_MsgMonStatusRefresh_Test(void)
+{
+    CFE_TIME_SysTime_t Now = {100, 0};
+
+    HS_AppData.MsgMon[0].ArrivalCount = 5;
+    HS_AppData.MsgMon[0].AgeMsec      = 6;
+    HS_AppData.MsgMonFlags[0]         = HS_MSGMON_STALE;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_GetMET), HS_CMDS_TEST_CFE_TIME_GetMETHandler, &Now);
+
+    /* Execute the function being tested */
+    HS_MsgMonStatusRefresh();
+
+    /* Verify results, every entry's age restarts now */
+    UtAssert_UINT32_EQ(HS_AppData.MsgMon[0].ArrivalCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMon[0].AgeMsec, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMonFlags[0], 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMonLastArrival[0].Seconds, 100);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMonLastArrival[HS_MAX_MONITORED_MSGS - 1].Seconds, 100);
+    UtAssert_STUB_COUNT(HS_MsgMonSubscribe, 1);
+}
+
 void HS_MsgActsStatusRefresh_Test(void)
 {
     uint32 i;
 
     for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
     {
-        HS_AppData.MsgActCooldown[i] = 1 + i;
+        HS_AppData.MsgActReadyTime[i].Seconds    = 1 + i;
+        HS_AppData.MsgActReadyTime[i].Subseconds = 1 + i;
     }
 
     /* Execute the function being tested */
@@ -2269,14 +2889,12 @@ void HS_MsgActsStatusRefresh_Test(void)
     /* Verify results */
     for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
     {
-        /* Check first, middle, and last element */
-        UtAssert_True(HS_AppData.MsgActCooldown[0] == 0, "HS_AppData.MsgActCooldown[0] == 0");
-        UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] == 0,
-                      "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES / 2] == 0");
-        UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 0,
-                      "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES -1] == 0");
+        UtAssert_UINT32_EQ(HS_AppData.MsgActReadyTime[i].Seconds, 0);
+        UtAssert_UINT32_EQ(HS_AppData.MsgActReadyTime[i].Subseconds, 0);
     }
 
+    UtAssert_STUB_COUNT(HS_MsgActQueueFlush, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
@@ -2346,6 +2964,19 @@ void UtTest_Setup(void)
 
     UtTest_Add(HS_SetMaxResetsCmd_Test, HS_Test_Setup, HS_Test_TearDown, "HS_SetMaxResetsCmd_Test");
 
+    UtTest_Add(HS_ManageTablesCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_ManageTablesCmd_Test_Nominal");
+    UtTest_Add(HS_ManageTablesCmd_Test_InvalidParameter, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ManageTablesCmd_Test_InvalidParameter");
+    UtTest_Add(HS_SendHistoryCmd_Test, HS_Test_Setup, HS_Test_TearDown, "HS_SendHistoryCmd_Test");
+    UtTest_Add(HS_ResetTimingCmd_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ResetTimingCmd_Test");
+    UtTest_Add(HS_RegisterPoolCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_RegisterPoolCmd_Test_Nominal");
+    UtTest_Add(HS_RegisterPoolCmd_Test_Replace, HS_Test_Setup, HS_Test_TearDown, "HS_RegisterPoolCmd_Test_Replace");
+    UtTest_Add(HS_RegisterPoolCmd_Test_Errors, HS_Test_Setup, HS_Test_TearDown, "HS_RegisterPoolCmd_Test_Errors");
+    UtTest_Add(HS_RegisterStackCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_RegisterStackCmd_Test_Nominal");
+    UtTest_Add(HS_RegisterStackCmd_Test_Errors, HS_Test_Setup, HS_Test_TearDown, "HS_RegisterStackCmd_Test_Errors");
+
+    UtTest_Add(HS_TblManageNeeded_Test, HS_Test_Setup, HS_Test_TearDown, "HS_TblManageNeeded_Test");
+
     UtTest_Add(HS_AcquirePointers_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_AcquirePointers_Test_Nominal");
     UtTest_Add(HS_AcquirePointers_Test_ErrorsWithAppMonLoadedAndEventMonLoadedEnabled, HS_Test_Setup, HS_Test_TearDown,
                "HS_AcquirePointers_Test_ErrorsWithAppMonLoadedAndEventMonLoadedEnabled");
@@ -2359,13 +2990,32 @@ void UtTest_Setup(void)
     UtTest_Add(HS_AcquirePointers_Test_ErrorsWithCurrentAppMonLoadedDisabledAndCurrentAppMonStateDisabled,
                HS_Test_Setup, HS_Test_TearDown,
                "HS_AcquirePointers_Test_ErrorsWithCurrentAppMonLoadedDisabledAndCurrentAppMonStateDisabled");
+    UtTest_Add(HS_AcquirePointers_Test_CompiledNoPendingAction, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AcquirePointers_Test_CompiledNoPendingAction");
+    UtTest_Add(HS_AcquirePointers_Test_CompiledUpdatePending, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AcquirePointers_Test_CompiledUpdatePending");
+    UtTest_Add(HS_AcquirePointers_Test_CompiledNotified, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AcquirePointers_Test_CompiledNotified");
+    UtTest_Add(HS_AcquirePointers_Test_AppMonStateDump, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AcquirePointers_Test_AppMonStateDump");
+    UtTest_Add(HS_AcquirePointers_Test_MemMonError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AcquirePointers_Test_MemMonError");
+    UtTest_Add(HS_AcquirePointers_Test_MsgMonError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AcquirePointers_Test_MsgMonError");
+    UtTest_Add(HS_AcquirePointers_Test_FirstCompileRefresh, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AcquirePointers_Test_FirstCompileRefresh");
 
     UtTest_Add(HS_AppMonStatusRefresh_Test_CycleCountZero, HS_Test_Setup, HS_Test_TearDown,
                "HS_AppMonStatusRefresh_Test_CycleCountZero");
     UtTest_Add(HS_AppMonStatusRefresh_Test_ActionTypeNOACT, HS_Test_Setup, HS_Test_TearDown,
                "HS_AppMonStatusRefresh_Test_ActionTypeNOACT");
+    UtTest_Add(HS_AppMonStatusRefresh_Test_Escalation, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AppMonStatusRefresh_Test_Escalation");
     UtTest_Add(HS_AppMonStatusRefresh_Test_ElseCase, HS_Test_Setup, HS_Test_TearDown,
                "HS_AppMonStatusRefresh_Test_ElseCase");
 
+    UtTest_Add(HS_MemMonStatusRefresh_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MemMonStatusRefresh_Test");
+    UtTest_Add(HS_MsgMonStatusRefresh_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MsgMonStatusRefresh_Test");
+
     UtTest_Add(HS_MsgActsStatusRefresh_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MsgActsStatusRefresh_Test");
 }
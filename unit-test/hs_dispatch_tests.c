@@ -39,12 +39,24 @@
 /*
  * Helper functions
  */
+
+/* Enough for a full command pipe read, plus the extra gets of some paths */
+#define HS_DISPATCH_TEST_MSG_COPIES (HS_CMD_PIPE_BUDGET + 2)
+
 static void HS_Dispatch_Test_SetupMsg(CFE_SB_MsgId_t MsgId, CFE_MSG_FcnCode_t FcnCode, size_t MsgSize)
 {
     /* Note some paths get the MsgId/FcnCode multiple times, so register accordingly, just in case */
-    CFE_SB_MsgId_t    RegMsgId[2]   = {MsgId, MsgId};
-    CFE_MSG_FcnCode_t RegFcnCode[2] = {FcnCode, FcnCode};
-    size_t            RegMsgSize[2] = {MsgSize, MsgSize};
+    CFE_SB_MsgId_t    RegMsgId[HS_DISPATCH_TEST_MSG_COPIES];
+    CFE_MSG_FcnCode_t RegFcnCode[HS_DISPATCH_TEST_MSG_COPIES];
+    size_t            RegMsgSize[HS_DISPATCH_TEST_MSG_COPIES];
+    uint32            i;
+
+    for (i = 0; i < HS_DISPATCH_TEST_MSG_COPIES; i++)
+    {
+        RegMsgId[i]   = MsgId;
+        RegFcnCode[i] = FcnCode;
+        RegMsgSize[i] = MsgSize;
+    }
 
     UT_ResetState(UT_KEY(CFE_MSG_GetMsgId));
     UT_ResetState(UT_KEY(CFE_MSG_GetFcnCode));
@@ -55,6 +67,24 @@ static void HS_Dispatch_Test_SetupMsg(CFE_SB_MsgId_t MsgId, CFE_MSG_FcnCode_t Fc
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), RegMsgSize, sizeof(RegMsgSize), true);
 }
 
+static int32 HS_Dispatch_Test_DisableAppMonHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                                const UT_StubContext_t *Context)
+{
+    uint32 *EnableCountPtr = UserObj;
+
+    *EnableCountPtr = UT_GetStubCount(UT_KEY(HS_EnableAppMonCmd));
+
+    return StubRetcode;
+}
+
+static void HS_Dispatch_Test_ReceiveBufferHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                  const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t **BufPtr = UT_Hook_GetArgValueByName(Context, "BufPtr", CFE_SB_Buffer_t **);
+
+    *BufPtr = &UT_CmdBuf.Buf;
+}
+
 /*
  * Function Definitions
  */
@@ -129,6 +159,9 @@ void HS_AppPipe_Test_Noop(void)
 
     /* Should NOT have invoked the handler this time */
     UtAssert_STUB_COUNT(HS_NoopCmd, 1);
+
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Codes[HS_NOOP_CC].AcceptCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Codes[HS_NOOP_CC].RejectCount, 1);
 }
 
 void HS_AppPipe_Test_Reset(void)
@@ -336,6 +369,99 @@ void HS_AppPipe_Test_DisableCPUHog(void)
     UtAssert_STUB_COUNT(HS_DisableCpuHogCmd, 1);
 }
 
+void HS_AppPipe_Test_ManageTables(void)
+{
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_MANAGE_TABLES_CC,
+                              sizeof(UT_CmdBuf.ManageTablesCmd));
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+    UtAssert_STUB_COUNT(HS_ManageTablesCmd, 1);
+
+    /* Now with an invalid size */
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_MANAGE_TABLES_CC, 1);
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Should NOT have invoked the handler */
+    UtAssert_STUB_COUNT(HS_ManageTablesCmd, 1);
+}
+
+void HS_AppPipe_Test_SendHistory(void)
+{
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_SEND_HISTORY_CC, sizeof(UT_CmdBuf.SendHistoryCmd));
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+    UtAssert_STUB_COUNT(HS_SendHistoryCmd, 1);
+
+    /* Now with an invalid size */
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_SEND_HISTORY_CC, 1);
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Should NOT have invoked the handler */
+    UtAssert_STUB_COUNT(HS_SendHistoryCmd, 1);
+}
+
+void HS_AppPipe_Test_ResetTiming(void)
+{
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_RESET_TIMING_CC, sizeof(UT_CmdBuf.ResetTimingCmd));
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+    UtAssert_STUB_COUNT(HS_ResetTimingCmd, 1);
+
+    /* Now with an invalid size */
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_RESET_TIMING_CC, 1);
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Should NOT have invoked the handler */
+    UtAssert_STUB_COUNT(HS_ResetTimingCmd, 1);
+}
+
+void HS_AppPipe_Test_RegisterPool(void)
+{
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_REGISTER_POOL_CC,
+                              sizeof(UT_CmdBuf.RegisterPoolCmd));
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+    UtAssert_STUB_COUNT(HS_RegisterPoolCmd, 1);
+
+    /* Now with an invalid size */
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_REGISTER_POOL_CC, 1);
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Should NOT have invoked the handler */
+    UtAssert_STUB_COUNT(HS_RegisterPoolCmd, 1);
+}
+
+void HS_AppPipe_Test_RegisterStack(void)
+{
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_REGISTER_STACK_CC,
+                              sizeof(UT_CmdBuf.RegisterStackCmd));
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+    UtAssert_STUB_COUNT(HS_RegisterStackCmd, 1);
+
+    /* Now with an invalid size */
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_REGISTER_STACK_CC, 1);
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Should NOT have invoked the handler */
+    UtAssert_STUB_COUNT(HS_RegisterStackCmd, 1);
+}
+
 void HS_AppPipe_Test_InvalidCC(void)
 {
     HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), 99, sizeof(UT_CmdBuf));
@@ -364,6 +490,264 @@ void HS_AppPipe_Test_InvalidMID(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void HS_DispatchCmd_Test_Stats(void)
+{
+    HS_CmdCodeStats_t *StatsPtr = &HS_AppData.CmdStatsPkt.Payload.Codes[HS_NOOP_CC];
+
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_NOOP_CC, sizeof(UT_CmdBuf.NoopCmd));
+    UT_SetDefaultReturnValue(UT_KEY(HS_TimingElapsedUsec), 100);
+
+    /* Execute the function being tested */
+    HS_DispatchCmd(&UT_CmdBuf.Buf, &HS_CmdDispatchTable[HS_NOOP_CC], StatsPtr);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(HS_NoopCmd, 1);
+    UtAssert_UINT32_EQ(StatsPtr->AcceptCount, 1);
+    UtAssert_UINT32_EQ(StatsPtr->RejectCount, 0);
+    UtAssert_UINT32_EQ(StatsPtr->MaxUsec, 100);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.HandlerHist[HS_CmdHistBin(100)], 1);
+
+    /* A quicker run leaves the maximum alone */
+    UT_SetDefaultReturnValue(UT_KEY(HS_TimingElapsedUsec), 0);
+
+    HS_DispatchCmd(&UT_CmdBuf.Buf, &HS_CmdDispatchTable[HS_NOOP_CC], StatsPtr);
+
+    UtAssert_UINT32_EQ(StatsPtr->AcceptCount, 2);
+    UtAssert_UINT32_EQ(StatsPtr->MaxUsec, 100);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.HandlerHist[0], 1);
+}
+
+void HS_DispatchCmd_Test_NoStats(void)
+{
+    uint32 Bin;
+
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_SEND_HK_MID), 0, sizeof(UT_CmdBuf.SendHkCmd));
+
+    /* Execute the function being tested */
+    HS_DispatchCmd(&UT_CmdBuf.Buf, &HS_SendHkDispatchEntry, NULL);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(HS_SendHkCmd, 1);
+    UtAssert_STUB_COUNT(HS_TimingElapsedUsec, 0);
+
+    for (Bin = 0; Bin < HS_CMD_HIST_BINS; Bin++)
+    {
+        UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.HandlerHist[Bin], 0);
+    }
+}
+
+void HS_CmdHistBin_Test(void)
+{
+    UtAssert_UINT32_EQ(HS_CmdHistBin(0), 0);
+    UtAssert_UINT32_EQ(HS_CmdHistBin(HS_CMD_HIST_BASE_USEC - 1), 0);
+    UtAssert_UINT32_EQ(HS_CmdHistBin(HS_CMD_HIST_BASE_USEC), 1);
+    UtAssert_UINT32_EQ(HS_CmdHistBin(HS_CMD_HIST_BASE_USEC * 4), 2);
+    UtAssert_UINT32_EQ(HS_CmdHistBin(0xFFFFFFFF), HS_CMD_HIST_BINS - 1);
+}
+
+void HS_CmdDispatchTable_Test(void)
+{
+    CFE_MSG_FcnCode_t CommandCode;
+
+    /* Every command code has a handler and at least a command header */
+    for (CommandCode = 0; CommandCode < HS_NUM_CMD_CODES; CommandCode++)
+    {
+        UtAssert_NOT_NULL(HS_CmdDispatchTable[CommandCode].Handler);
+        UtAssert_True(HS_CmdDispatchTable[CommandCode].ExpectedLength >= sizeof(CFE_MSG_CommandHeader_t),
+                      "Command code %d length %lu", (int)CommandCode,
+                      (unsigned long)HS_CmdDispatchTable[CommandCode].ExpectedLength);
+
+        /* Commands that wait in the normal lane must fit in a slot */
+        UtAssert_True(HS_CmdDispatchTable[CommandCode].ExpectedLength <= sizeof(HS_CmdLaneSlot_t),
+                      "Command code %d fits in a normal lane slot", (int)CommandCode);
+    }
+}
+
+void HS_CmdPipeRead_Test_Lanes(void)
+{
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), HS_Dispatch_Test_ReceiveBufferHandler, NULL);
+
+    /* A priority command is processed as soon as it is read */
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_DISABLE_CPU_HOG_CC,
+                              sizeof(UT_CmdBuf.DisableCpuHogCmd));
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_CmdPipeRead(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(HS_DisableCpuHogCmd, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Lanes[HS_CMD_LANE_PRIORITY].Count, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.Count, 0);
+
+    /* Other commands wait in the normal lane */
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_NOOP_CC, sizeof(UT_CmdBuf.NoopCmd));
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 3, CFE_SB_NO_MESSAGE);
+
+    UtAssert_INT32_EQ(HS_CmdPipeRead(), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(HS_NoopCmd, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.Count, 2);
+
+    /* Until the lane is drained */
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_NOOP_CC, sizeof(UT_CmdBuf.NoopCmd));
+
+    HS_CmdLaneDrain();
+
+    UtAssert_STUB_COUNT(HS_NoopCmd, 2);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Lanes[HS_CMD_LANE_NORMAL].Count, 2);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.Count, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.CmdBudgetCount, 0);
+}
+
+void HS_CmdPipeRead_Test_Budget(void)
+{
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_NOOP_CC, sizeof(UT_CmdBuf.NoopCmd));
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), HS_Dispatch_Test_ReceiveBufferHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_CmdPipeRead(), CFE_SUCCESS);
+
+    /* Verify results, one more message was read to see that the budget left it waiting */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, HS_CMD_PIPE_BUDGET + 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.Count, HS_CMD_PIPE_BUDGET);
+    UtAssert_ADDRESS_EQ(HS_AppData.CmdLane.HeldBufPtr, &UT_CmdBuf.Buf);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.CmdBudgetCount, 1);
+
+    /* The pipe was not found empty, so latency is still measured from the last time it was */
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+
+    /* The held message is the first one of the next read */
+    HS_AppData.CmdLane.Count = 0;
+    UT_ResetState(UT_KEY(CFE_SB_ReceiveBuffer));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    UtAssert_INT32_EQ(HS_CmdPipeRead(), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.Count, 1);
+    UtAssert_NULL(HS_AppData.CmdLane.HeldBufPtr);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.CmdBudgetCount, 1);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 1);
+}
+
+void HS_CmdPipeRead_Test_BudgetEmpty(void)
+{
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_NOOP_CC, sizeof(UT_CmdBuf.NoopCmd));
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), HS_Dispatch_Test_ReceiveBufferHandler, NULL);
+
+    /* Exactly a budget of messages */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), HS_CMD_PIPE_BUDGET + 1, CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_CmdPipeRead(), CFE_SUCCESS);
+
+    /* Verify results, nothing was left waiting */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, HS_CMD_PIPE_BUDGET + 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.Count, HS_CMD_PIPE_BUDGET);
+    UtAssert_NULL(HS_AppData.CmdLane.HeldBufPtr);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.CmdBudgetCount, 0);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 1);
+}
+
+void HS_CmdPipeRead_Test_Order(void)
+{
+    CFE_MSG_FcnCode_t FcnCodes[4];
+    uint32            EnableCount = 0;
+
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_ENABLE_APP_MON_CC,
+                              sizeof(UT_CmdBuf.EnableAppMonCmd));
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), HS_Dispatch_Test_ReceiveBufferHandler, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 3, CFE_SB_NO_MESSAGE);
+
+    /*
+     * An ENABLE followed by a priority DISABLE: the lane check of each,
+     * then both dispatched from the normal lane in the order they were read
+     */
+    FcnCodes[0] = HS_ENABLE_APP_MON_CC;
+    FcnCodes[1] = HS_DISABLE_APP_MON_CC;
+    FcnCodes[2] = HS_ENABLE_APP_MON_CC;
+    FcnCodes[3] = HS_DISABLE_APP_MON_CC;
+
+    UT_ResetState(UT_KEY(CFE_MSG_GetFcnCode));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), FcnCodes, sizeof(FcnCodes), true);
+    UT_SetHookFunction(UT_KEY(HS_DisableAppMonCmd), HS_Dispatch_Test_DisableAppMonHook, &EnableCount);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_CmdPipeRead(), CFE_SUCCESS);
+
+    /* Verify results, the DISABLE waits behind the ENABLE instead of draining the lane early */
+    UtAssert_STUB_COUNT(HS_EnableAppMonCmd, 0);
+    UtAssert_STUB_COUNT(HS_DisableAppMonCmd, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.Count, 2);
+
+    HS_CmdLaneDrain();
+
+    /* The ENABLE sent first took effect first */
+    UtAssert_STUB_COUNT(HS_EnableAppMonCmd, 1);
+    UtAssert_STUB_COUNT(HS_DisableAppMonCmd, 1);
+    UtAssert_UINT32_EQ(EnableCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.Count, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Lanes[HS_CMD_LANE_NORMAL].Count, 2);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Lanes[HS_CMD_LANE_PRIORITY].Count, 0);
+}
+
+void HS_CmdPipeRead_Test_Error(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_CmdPipeRead(), -1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.Count, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.CmdBudgetCount, 0);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+}
+
+void HS_CmdLaneDispatch_Test(void)
+{
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_NOOP_CC, sizeof(UT_CmdBuf.NoopCmd));
+
+    /* Execute the function being tested */
+    UT_SetDefaultReturnValue(UT_KEY(HS_TimingElapsedUsec), 1500);
+    HS_CmdLaneDispatch(&UT_CmdBuf.Buf, HS_CMD_LANE_NORMAL);
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_TimingElapsedUsec), 500);
+    HS_CmdLaneDispatch(&UT_CmdBuf.Buf, HS_CMD_LANE_NORMAL);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(HS_NoopCmd, 2);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Lanes[HS_CMD_LANE_NORMAL].Count, 2);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Lanes[HS_CMD_LANE_NORMAL].LatencyMaxUsec, 1500);
+    UtAssert_UINT32_EQ(HS_AppData.CmdLane.LatencyTotalUsec[HS_CMD_LANE_NORMAL], 2000);
+
+    HS_CmdLaneReport();
+
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Lanes[HS_CMD_LANE_NORMAL].LatencyAvgUsec, 1000);
+    UtAssert_UINT32_EQ(HS_AppData.CmdStatsPkt.Payload.Lanes[HS_CMD_LANE_PRIORITY].LatencyAvgUsec, 0);
+}
+
+void HS_IsPriorityCmd_Test(void)
+{
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_SEND_HK_MID), 0, sizeof(UT_CmdBuf.SendHkCmd));
+    UtAssert_BOOL_TRUE(HS_IsPriorityCmd(&UT_CmdBuf.Buf));
+
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_DISABLE_APP_MON_CC, sizeof(UT_CmdBuf));
+    UtAssert_BOOL_TRUE(HS_IsPriorityCmd(&UT_CmdBuf.Buf));
+
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), HS_ENABLE_APP_MON_CC, sizeof(UT_CmdBuf));
+    UtAssert_BOOL_FALSE(HS_IsPriorityCmd(&UT_CmdBuf.Buf));
+
+    /* Invalid messages go in the normal lane, where they are reported */
+    HS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HS_CMD_MID), 99, sizeof(UT_CmdBuf));
+    UtAssert_BOOL_FALSE(HS_IsPriorityCmd(&UT_CmdBuf.Buf));
+
+    HS_Dispatch_Test_SetupMsg(CFE_SB_INVALID_MSG_ID, HS_DISABLE_APP_MON_CC, sizeof(UT_CmdBuf));
+    UtAssert_BOOL_FALSE(HS_IsPriorityCmd(&UT_CmdBuf.Buf));
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -385,6 +769,23 @@ void UtTest_Setup(void)
     UtTest_Add(HS_AppPipe_Test_SetMaxResets, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_SetMaxResets");
     UtTest_Add(HS_AppPipe_Test_EnableCPUHog, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_EnableCPUHog");
     UtTest_Add(HS_AppPipe_Test_DisableCPUHog, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_DisableCPUHog");
+    UtTest_Add(HS_AppPipe_Test_ManageTables, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_ManageTables");
+    UtTest_Add(HS_AppPipe_Test_SendHistory, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_SendHistory");
+    UtTest_Add(HS_AppPipe_Test_ResetTiming, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_ResetTiming");
+    UtTest_Add(HS_AppPipe_Test_RegisterPool, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_RegisterPool");
+    UtTest_Add(HS_AppPipe_Test_RegisterStack, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_RegisterStack");
     UtTest_Add(HS_AppPipe_Test_InvalidCC, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_InvalidCC");
     UtTest_Add(HS_AppPipe_Test_InvalidMID, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_InvalidMID");
+
+    UtTest_Add(HS_DispatchCmd_Test_Stats, HS_Test_Setup, HS_Test_TearDown, "HS_DispatchCmd_Test_Stats");
+    UtTest_Add(HS_DispatchCmd_Test_NoStats, HS_Test_Setup, HS_Test_TearDown, "HS_DispatchCmd_Test_NoStats");
+    UtTest_Add(HS_CmdHistBin_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CmdHistBin_Test");
+    UtTest_Add(HS_CmdDispatchTable_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CmdDispatchTable_Test");
+    UtTest_Add(HS_CmdPipeRead_Test_Lanes, HS_Test_Setup, HS_Test_TearDown, "HS_CmdPipeRead_Test_Lanes");
+    UtTest_Add(HS_CmdPipeRead_Test_Budget, HS_Test_Setup, HS_Test_TearDown, "HS_CmdPipeRead_Test_Budget");
+    UtTest_Add(HS_CmdPipeRead_Test_BudgetEmpty, HS_Test_Setup, HS_Test_TearDown, "HS_CmdPipeRead_Test_BudgetEmpty");
+    UtTest_Add(HS_CmdPipeRead_Test_Order, HS_Test_Setup, HS_Test_TearDown, "HS_CmdPipeRead_Test_Order");
+    UtTest_Add(HS_CmdPipeRead_Test_Error, HS_Test_Setup, HS_Test_TearDown, "HS_CmdPipeRead_Test_Error");
+    UtTest_Add(HS_CmdLaneDispatch_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CmdLaneDispatch_Test");
+    UtTest_Add(HS_IsPriorityCmd_Test, HS_Test_Setup, HS_Test_TearDown, "HS_IsPriorityCmd_Test");
 }
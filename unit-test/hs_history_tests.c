@@ -0,0 +1,302 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "hs_history.h"
+#include "hs_app.h"
+#include "hs_eventids.h"
+#include "hs_tbldefs.h"
+#include "hs_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+HS_HistoryBlock_t HS_HISTORY_TEST_Restored;
+
+int32 HS_HISTORY_TEST_CFE_ES_RestoreFromCDSHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                                const UT_StubContext_t *Context)
+{
+    HS_HistoryBlock_t *BlockPtr = UT_Hook_GetArgValueByName(Context, "RestoreToMemory", HS_HistoryBlock_t *);
+
+    *BlockPtr = HS_HISTORY_TEST_Restored;
+
+    return StubRetcode;
+}
+
+void HS_HISTORY_TEST_Setup(void)
+{
+    HS_Test_Setup();
+
+    /* A stored block with a good header, the CRC stub returns 0 */
+    memset(&HS_HISTORY_TEST_Restored, 0, sizeof(HS_HISTORY_TEST_Restored));
+    HS_HISTORY_TEST_Restored.Header.Depth    = HS_HISTORY_DEPTH;
+    HS_HISTORY_TEST_Restored.Header.SlotSize = sizeof(HS_HistorySlot_t);
+
+    HS_AppData.CDSState = HS_STATE_ENABLED;
+}
+
+void Test_HS_HistoryInit_New(void)
+{
+    /* Test function for:
+     * void HS_HistoryInit(void)
+     */
+
+    HS_AppData.History.NextSlot = 3;
+
+    HS_HistoryInit();
+
+    /* The new block is stored empty, once */
+    UtAssert_UINT32_EQ(HS_AppData.History.CDSState, HS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSequence, 1);
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSlot, 0);
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Header.Depth, HS_HISTORY_DEPTH);
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Header.SlotSize, sizeof(HS_HistorySlot_t));
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, 1);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_HS_HistoryInit_Restore(void)
+{
+    /* Test function for:
+     * void HS_HistoryInit(void)
+     */
+
+    HS_HISTORY_TEST_Restored.Slots[0].Entry.Sequence                    = 5;
+    HS_HISTORY_TEST_Restored.Slots[1].Entry.Sequence                    = 6;
+    HS_HISTORY_TEST_Restored.Slots[HS_HISTORY_DEPTH - 1].Entry.Sequence = 9;
+    HS_HISTORY_TEST_Restored.Slots[HS_HISTORY_DEPTH - 1].Crc            = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetHookFunction(UT_KEY(CFE_ES_RestoreFromCDS), HS_HISTORY_TEST_CFE_ES_RestoreFromCDSHook, NULL);
+
+    HS_HistoryInit();
+
+    /* The corrupt newest entry is dropped, recording resumes after entry 1 */
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Slots[0].Entry.Sequence, 5);
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Slots[HS_HISTORY_DEPTH - 1].Entry.Sequence, 0);
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSequence, 7);
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSlot, 2);
+    UtAssert_UINT32_EQ(HS_AppData.History.CDSState, HS_STATE_ENABLED);
+
+    /* The cleared slot is stored with the rest of the block */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_HISTORY_CORRUPT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void Test_HS_HistoryInit_RestoreIntact(void)
+{
+    /* Test function for:
+     * void HS_HistoryInit(void)
+     */
+
+    HS_HISTORY_TEST_Restored.Slots[3].Entry.Sequence = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetHookFunction(UT_KEY(CFE_ES_RestoreFromCDS), HS_HISTORY_TEST_CFE_ES_RestoreFromCDSHook, NULL);
+
+    HS_HistoryInit();
+
+    /* Nothing to store back */
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSequence, 3);
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSlot, 4);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_HS_HistoryInit_BadHeader(void)
+{
+    /* Test function for:
+     * void HS_HistoryInit(void)
+     */
+
+    HS_HISTORY_TEST_Restored.Header.Depth            = HS_HISTORY_DEPTH + 1;
+    HS_HISTORY_TEST_Restored.Slots[0].Entry.Sequence = 5;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetHookFunction(UT_KEY(CFE_ES_RestoreFromCDS), HS_HISTORY_TEST_CFE_ES_RestoreFromCDSHook, NULL);
+
+    HS_HistoryInit();
+
+    /* A block stored with another layout is dropped and rewritten */
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Slots[0].Entry.Sequence, 0);
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Header.Depth, HS_HISTORY_DEPTH);
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSequence, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_HISTORY_CORRUPT_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Same for a block that can't be restored */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RestoreFromCDS), -1);
+
+    HS_HistoryInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.History.CDSState, HS_STATE_ENABLED);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_HISTORY_CORRUPT_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void Test_HS_HistoryInit_RegisterError(void)
+{
+    /* Test function for:
+     * void HS_HistoryInit(void)
+     */
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), -1);
+
+    HS_HistoryInit();
+
+    /* The history is kept in memory only */
+    UtAssert_UINT32_EQ(HS_AppData.History.CDSState, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_HISTORY_CDS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* No CDS at all */
+    HS_AppData.CDSState = HS_STATE_DISABLED;
+
+    HS_HistoryInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.History.CDSState, HS_STATE_DISABLED);
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSequence, 1);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, 1);
+}
+
+void Test_HS_HistoryRecord(void)
+{
+    /* Test function for:
+     * void HS_HistoryRecord(uint8 Table, uint16 Row, uint16 ActionType)
+     */
+    uint32 i;
+
+    HS_AppData.History.CDSState     = HS_STATE_ENABLED;
+    HS_AppData.History.NextSequence = 1;
+
+    HS_HistoryRecord(HS_TBL_NOTIFY_AMT, 4, HS_AMT_ACT_APP_RESTART);
+
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Slots[0].Entry.Sequence, 1);
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Slots[0].Entry.Table, HS_TBL_NOTIFY_AMT);
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Slots[0].Entry.Row, 4);
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Slots[0].Entry.ActionType, HS_AMT_ACT_APP_RESTART);
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSlot, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+
+    /* The ring wraps over the oldest entry */
+    for (i = 0; i < HS_HISTORY_DEPTH; i++)
+    {
+        HS_HistoryRecord(HS_TBL_NOTIFY_EMT, i, HS_EMT_ACT_APP_DELETE);
+    }
+
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Slots[0].Entry.Sequence, HS_HISTORY_DEPTH + 1);
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Slots[0].Entry.Table, HS_TBL_NOTIFY_EMT);
+    UtAssert_UINT32_EQ(HS_AppData.History.Block.Slots[1].Entry.Sequence, 2);
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSlot, 1);
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSequence, HS_HISTORY_DEPTH + 2);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, HS_HISTORY_DEPTH + 1);
+
+    /* Not stored without a CDS */
+    HS_AppData.History.CDSState = HS_STATE_DISABLED;
+
+    HS_HistoryRecord(HS_TBL_NOTIFY_AMT, 0, HS_AMT_ACT_EVENT);
+
+    UtAssert_UINT32_EQ(HS_AppData.History.NextSequence, HS_HISTORY_DEPTH + 3);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, HS_HISTORY_DEPTH + 1);
+}
+
+void Test_HS_HistorySlotCrc(void)
+{
+    /* Test function for:
+     * uint32 HS_HistorySlotCrc(const HS_HistorySlot_t *SlotPtr)
+     */
+    HS_HistorySlot_t Slot;
+
+    memset(&Slot, 0, sizeof(Slot));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x1234);
+
+    UtAssert_UINT32_EQ(HS_HistorySlotCrc(&Slot), 0x1234);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+void Test_HS_HistoryReport(void)
+{
+    /* Test function for:
+     * void HS_HistoryReport(HS_HistoryTlm_Payload_t *PayloadPtr)
+     */
+    HS_HistoryTlm_Payload_t Payload;
+    uint32                  i;
+
+    memset(&Payload, 0xFF, sizeof(Payload));
+
+    /* Empty history */
+    HS_HistoryReport(&Payload);
+
+    UtAssert_UINT32_EQ(Payload.EntryCount, 0);
+    UtAssert_UINT32_EQ(Payload.Entries[0].Sequence, 0);
+
+    /* Wrapped history is reported oldest first */
+    HS_AppData.History.NextSequence = 1;
+    for (i = 0; i < HS_HISTORY_DEPTH + 1; i++)
+    {
+        HS_HistoryRecord(HS_TBL_NOTIFY_AMT, i, HS_AMT_ACT_EVENT);
+    }
+
+    HS_HistoryReport(&Payload);
+
+    UtAssert_UINT32_EQ(Payload.EntryCount, HS_HISTORY_DEPTH);
+    UtAssert_UINT32_EQ(Payload.Entries[0].Sequence, 2);
+    UtAssert_UINT32_EQ(Payload.Entries[0].Row, 1);
+    UtAssert_UINT32_EQ(Payload.Entries[HS_HISTORY_DEPTH - 1].Sequence, HS_HISTORY_DEPTH + 1);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_HS_HistoryInit_New, HS_HISTORY_TEST_Setup, HS_Test_TearDown, "Test_HS_HistoryInit_New");
+    UtTest_Add(Test_HS_HistoryInit_Restore, HS_HISTORY_TEST_Setup, HS_Test_TearDown, "Test_HS_HistoryInit_Restore");
+    UtTest_Add(Test_HS_HistoryInit_RestoreIntact, HS_HISTORY_TEST_Setup, HS_Test_TearDown,
+               "Test_HS_HistoryInit_RestoreIntact");
+    UtTest_Add(Test_HS_HistoryInit_BadHeader, HS_HISTORY_TEST_Setup, HS_Test_TearDown,
+               "Test_HS_HistoryInit_BadHeader");
+    UtTest_Add(Test_HS_HistoryInit_RegisterError, HS_HISTORY_TEST_Setup, HS_Test_TearDown,
+               "Test_HS_HistoryInit_RegisterError");
+    UtTest_Add(Test_HS_HistoryRecord, HS_HISTORY_TEST_Setup, HS_Test_TearDown, "Test_HS_HistoryRecord");
+    UtTest_Add(Test_HS_HistorySlotCrc, HS_HISTORY_TEST_Setup, HS_Test_TearDown, "Test_HS_HistorySlotCrc");
+    UtTest_Add(Test_HS_HistoryReport, HS_HISTORY_TEST_Setup, HS_Test_TearDown, "Test_HS_HistoryReport");
+}
@@ -23,6 +23,7 @@
 
 #include "hs_monitors.h"
 #include "hs_sysmon.h"
+#include "hs_history.h"
 #include "hs_test_utils.h"
 #include "hs_msgids.h"
 
@@ -54,6 +55,60 @@ int32 HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1(void *UserObj, int32 StubRetcode,
     return CFE_SUCCESS;
 }
 
+int32 HS_MONITORS_TEST_CFE_TIME_AddHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *Cooldown = UserObj;
+
+    *Cooldown = UT_Hook_GetArgValueByName(Context, "Time2", CFE_TIME_SysTime_t);
+
+    return StubRetcode;
+}
+
+int32 HS_MONITORS_TEST_HS_HistoryRecordHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                             const UT_StubContext_t *Context)
+{
+    uint16 *ActionType = UserObj;
+
+    *ActionType = UT_Hook_GetArgValueByName(Context, "ActionType", uint16);
+
+    return StubRetcode;
+}
+
+void HS_MONITORS_TEST_CFE_TIME_SubtractHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *Elapsed = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, *Elapsed);
+}
+
+void HS_MONITORS_TEST_OS_HeapGetInfoHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_heap_prop_t *HeapProp = UT_Hook_GetArgValueByName(Context, "heap_prop", OS_heap_prop_t *);
+    int32           Status   = OS_SUCCESS;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    if (Status == OS_SUCCESS)
+    {
+        memcpy(HeapProp, UserObj, sizeof(*HeapProp));
+    }
+}
+
+void HS_MONITORS_TEST_CFE_ES_GetMemPoolStatsHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                    const UT_StubContext_t *Context)
+{
+    CFE_ES_MemPoolStats_t *BufPtr = UT_Hook_GetArgValueByName(Context, "BufPtr", CFE_ES_MemPoolStats_t *);
+    int32                  Status = CFE_SUCCESS;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    if (Status == CFE_SUCCESS)
+    {
+        memcpy(BufPtr, UserObj, sizeof(*BufPtr));
+    }
+}
+
 void HS_MonitorApplications_Test_AppNameNotFound(void)
 {
     HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
@@ -66,9 +121,9 @@ void HS_MonitorApplications_Test_AppNameNotFound(void)
     HS_AppData.AMTablePtr = AMTable;
 
     /* Element 0 will run through logic with action and not expired */
-    HS_AppData.AMTablePtr[0].ActionType  = -1;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
+    HS_AppData.AMTablePtr[0].ActionType        = -1;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
 
     /* Element 1 has action but expired */
     HS_AppData.AMTablePtr[1].ActionType = -1;
@@ -78,6 +133,8 @@ void HS_MonitorApplications_Test_AppNameNotFound(void)
     /* Set CFE_ES_GetAppIDByName to fail on first call, to generate error HS_APPMON_APPNAME_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, -1);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
@@ -103,15 +160,17 @@ void HS_MonitorApplications_Test_AppNameNotFoundDebugEvent(void)
 
     HS_AppData.AMTablePtr = AMTable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = -1;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 2;
+    HS_AppData.AMTablePtr[0].ActionType        = -1;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 2;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
     /* Set CFE_ES_GetAppIDByName to fail on first call, to generate error HS_APPMON_APPNAME_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, -1);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
@@ -133,10 +192,10 @@ void HS_MonitorApplications_Test_GetExeCountFailure(void)
 
     HS_AppData.AMTablePtr = AMTable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = -1;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 2;
+    HS_AppData.AMTablePtr[0].ActionType        = -1;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 2;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -145,20 +204,67 @@ void HS_MonitorApplications_Test_GetExeCountFailure(void)
     UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppInfo), &AppInfo, sizeof(AppInfo), false);
     UT_SetHookFunction(UT_KEY(CFE_ES_GetAppInfo), HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1, &AppInfo);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 2, "HS_AppData.AppMonCheckInCountdown[0] == 2");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 2, "HS_AppData.AppMonState[0].CheckInCountdown == 2");
 
     /* Execution count does not get updated from AppInfo */
-    UtAssert_True(HS_AppData.AppMonLastExeCount[0] == 0, "HS_AppData.AppMonLastExeCount[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].LastExeCount == 0, "HS_AppData.AppMonState[0].LastExeCount == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_MonitorApplications_Test_CheckInStats(void)
+{
+    HS_AMTEntry_t    AMTable[HS_MAX_MONITORED_APPS];
+    CFE_ES_AppInfo_t AppInfo;
+
+    memset(AMTable, 0, sizeof(AMTable));
+    memset(&AppInfo, 0, sizeof(AppInfo));
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_EVENT;
+    HS_AppData.AMTablePtr[0].CycleCount        = 10;
+    HS_AppData.AppMonState[0].CheckInCountdown = 10;
+    HS_AppData.AppMonState[0].LastExeCount     = 5;
+
+    strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
+
+    AppInfo.ExecutionCounter = 5;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppInfo), &AppInfo, sizeof(AppInfo), false);
+
+    HS_Test_CompileRuntime();
+
+    /* Execute the function being tested, app does not check in for two cycles */
+    HS_MonitorApplications();
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppInfo), &AppInfo, sizeof(AppInfo), false);
+    HS_MonitorApplications();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CheckInCountdown, 8);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CyclesSinceCheckIn, 2);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].MaxCyclesSinceCheckIn, 2);
+
+    /* App checks in, the worst gap is kept */
+    AppInfo.ExecutionCounter = 6;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppInfo), &AppInfo, sizeof(AppInfo), false);
+    HS_MonitorApplications();
+
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CheckInCountdown, 10);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].LastExeCount, 6);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CyclesSinceCheckIn, 0);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].MaxCyclesSinceCheckIn, 2);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void HS_MonitorApplications_Test_ProcessorResetError(void)
 {
     HS_AMTEntry_t    AMTable[HS_MAX_MONITORED_APPS];
@@ -176,11 +282,11 @@ void HS_MonitorApplications_Test_ProcessorResetError(void)
 
     HS_AppData.AMTablePtr = AMTable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_PROC_RESET;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_PROC_RESET;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -192,12 +298,14 @@ void HS_MonitorApplications_Test_ProcessorResetError(void)
     HS_AppData.CDSData.MaxResets       = 10;
     HS_AppData.CDSData.ResetsPerformed = 1;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0 %u",
-                  HS_AppData.AppMonCheckInCountdown[0]);
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0 %u",
+                  HS_AppData.AppMonState[0].CheckInCountdown);
     UtAssert_UINT32_EQ(HS_AppData.AppMonEnables[0], 0);
     UtAssert_True(HS_AppData.ServiceWatchdogFlag == HS_STATE_DISABLED,
                   "HS_AppData.ServiceWatchdogFlag == HS_STATE_DISABLED");
@@ -225,6 +333,7 @@ void HS_MonitorApplications_Test_ProcessorResetActionLimitError(void)
     CFE_ES_AppInfo_t AppInfo;
     int32            strCmpResult;
     char             ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    uint16           RecordedAction = 0xFFFF;
 
     memset(AMTable, 0, sizeof(AMTable));
 
@@ -235,11 +344,11 @@ void HS_MonitorApplications_Test_ProcessorResetActionLimitError(void)
 
     HS_AppData.AMTablePtr = AMTable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_PROC_RESET;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_PROC_RESET;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -251,11 +360,15 @@ void HS_MonitorApplications_Test_ProcessorResetActionLimitError(void)
     HS_AppData.CDSData.MaxResets       = 10;
     HS_AppData.CDSData.ResetsPerformed = 11;
 
+    UT_SetHookFunction(UT_KEY(HS_HistoryRecord), HS_MONITORS_TEST_HS_HistoryRecordHook, &RecordedAction);
+
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0, "HS_AppData.AppMonEnables[0] == 0");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_PROC_ERR_EID);
@@ -277,6 +390,10 @@ void HS_MonitorApplications_Test_ProcessorResetActionLimitError(void)
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
+
+    /* Recorded as no action, since no reset was performed */
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 1);
+    UtAssert_UINT32_EQ(RecordedAction, HS_AMT_ACT_NOACT);
 }
 
 void HS_MonitorApplications_Test_RestartAppErrorsGetAppInfoSuccess(void)
@@ -295,11 +412,11 @@ void HS_MonitorApplications_Test_RestartAppErrorsGetAppInfoSuccess(void)
 
     HS_AppData.AMTablePtr = AMTable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_APP_RESTART;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_APP_RESTART;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -312,11 +429,13 @@ void HS_MonitorApplications_Test_RestartAppErrorsGetAppInfoSuccess(void)
     /* Prevents "failure to get an execution counter" */
     UT_SetHookFunction(UT_KEY(CFE_ES_GetAppInfo), HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1, &AppInfo);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0, "HS_AppData.AppMonEnables[0] == 0");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_RESTART_ERR_EID);
@@ -355,11 +474,11 @@ void HS_MonitorApplications_Test_RestartAppErrorsGetAppInfoNotSuccess(void)
 
     HS_AppData.AMTablePtr = AMTable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_APP_RESTART;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_APP_RESTART;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
 
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
@@ -369,11 +488,13 @@ void HS_MonitorApplications_Test_RestartAppErrorsGetAppInfoNotSuccess(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, -1);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_RestartApp), 1, -1);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0, "HS_AppData.AppMonEnables[0] == 0");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_RESTART_ERR_EID);
@@ -405,11 +526,11 @@ void HS_MonitorApplications_Test_RestartAppRestartSuccess(void)
 
     HS_AppData.AMTablePtr = AMTable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_APP_RESTART;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_APP_RESTART;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
 
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, CFE_SUCCESS);
@@ -419,11 +540,13 @@ void HS_MonitorApplications_Test_RestartAppRestartSuccess(void)
     /* Set CFE_ES_GetAppInfo to succeed on first call and avoid error HS_APPMON_NOT_RESTARTED_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_RestartApp), 1, CFE_SUCCESS);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0, "HS_AppData.AppMonEnables[0] == 0");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_RESTART_ERR_EID);
@@ -448,11 +571,11 @@ void HS_MonitorApplications_Test_FailError(void)
 
     HS_AppData.AMTablePtr = AMTable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_EVENT;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_EVENT;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -461,12 +584,15 @@ void HS_MonitorApplications_Test_FailError(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0, "HS_AppData.AppMonEnables[0] == 0");
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_FAIL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
@@ -501,9 +627,9 @@ void HS_MonitorApplications_Test_MsgActsNOACT(void)
 
     HS_AppData.AMTablePtr[0].ActionType =
         HS_AMT_ACT_NOACT; /* Causes most of the function to be skipped, due to first if-statement */
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
-    HS_AppData.MsgActsState              = HS_STATE_ENABLED;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
+    HS_AppData.MsgActsState                    = HS_STATE_ENABLED;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -512,13 +638,14 @@ void HS_MonitorApplications_Test_MsgActsNOACT(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
-    HS_AppData.AppMonLastExeCount[0] = 3;
+    HS_AppData.AppMonState[0].LastExeCount = 3;
 
     HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.MsgActCooldown[0]         = 0; /* (HS_AMT_ACT_LAST_NONMSG + 1) - HS_AMT_ACT_LAST_NONMSG - 1 = 0 */
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
     HS_AppData.MATablePtr[0].Cooldown    = 1;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
@@ -548,9 +675,9 @@ void HS_MonitorApplications_Test_MsgActsNOACTDisabled(void)
 
     HS_AppData.AMTablePtr[0].ActionType =
         HS_AMT_ACT_NOACT; /* Causes most of the function to be skipped, due to first if-statement */
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
-    HS_AppData.MsgActsState              = HS_STATE_DISABLED;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
+    HS_AppData.MsgActsState                    = HS_STATE_DISABLED;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -559,13 +686,14 @@ void HS_MonitorApplications_Test_MsgActsNOACTDisabled(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
-    HS_AppData.AppMonLastExeCount[0] = 3;
+    HS_AppData.AppMonState[0].LastExeCount = 3;
 
     HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.MsgActCooldown[0]         = 0; /* (HS_AMT_ACT_LAST_NONMSG + 1) - HS_AMT_ACT_LAST_NONMSG - 1 = 0 */
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
     HS_AppData.MATablePtr[0].Cooldown    = 1;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
@@ -598,12 +726,12 @@ void HS_MonitorApplications_Test_MsgActsErrorDefault(void)
     HS_AppData.AMTablePtr = AMTable;
     HS_AppData.MATablePtr = MATable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_LAST_NONMSG + 1;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
-    HS_AppData.MsgActsState              = HS_STATE_ENABLED;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_LAST_NONMSG + 1;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
+    HS_AppData.MsgActsState                    = HS_STATE_ENABLED;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -612,19 +740,20 @@ void HS_MonitorApplications_Test_MsgActsErrorDefault(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
-    HS_AppData.MsgActCooldown[0]         = 0; /* (HS_AMT_ACT_LAST_NONMSG + 1) - HS_AMT_ACT_LAST_NONMSG - 1 = 0 */
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
     HS_AppData.MATablePtr[0].Cooldown    = 1;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0, "HS_AppData.AppMonEnables[0] == 0");
 
-    UtAssert_True(HS_AppData.MsgActExec == 1, "HS_AppData.MsgActExec == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 1, "HS_AppData.MsgActCooldown[0] == 1");
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_MSGACTS_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
@@ -657,12 +786,12 @@ void HS_MonitorApplications_Test_MsgActsErrorDisabled(void)
     HS_AppData.AMTablePtr = AMTable;
     HS_AppData.MATablePtr = MATable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
-    HS_AppData.MsgActsState              = HS_STATE_ENABLED;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
+    HS_AppData.MsgActsState                    = HS_STATE_ENABLED;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -671,19 +800,20 @@ void HS_MonitorApplications_Test_MsgActsErrorDisabled(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
-    HS_AppData.MsgActCooldown[0]         = 0; /* (HS_AMT_ACT_LAST_NONMSG + 1) - HS_AMT_ACT_LAST_NONMSG - 1 = 0 */
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
     HS_AppData.MATablePtr[0].Cooldown    = 1;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0, "HS_AppData.AppMonEnables[0] == 0");
 
-    UtAssert_True(HS_AppData.MsgActExec == 0, "HS_AppData.MsgActExec == 0");
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 0, "HS_AppData.MsgActCooldown[0] == 0");
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -708,12 +838,12 @@ void HS_MonitorApplications_Test_MsgActsErrorDefaultCoolDown(void)
     HS_AppData.AMTablePtr = AMTable;
     HS_AppData.MATablePtr = MATable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_LAST_NONMSG + 1;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
-    HS_AppData.MsgActsState              = HS_STATE_ENABLED;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_LAST_NONMSG + 1;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
+    HS_AppData.MsgActsState                    = HS_STATE_ENABLED;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -722,19 +852,23 @@ void HS_MonitorApplications_Test_MsgActsErrorDefaultCoolDown(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
-    HS_AppData.MsgActCooldown[0]         = 1; /* (HS_AMT_ACT_LAST_NONMSG + 1) - HS_AMT_ACT_LAST_NONMSG - 1 = 0 */
+    /* Message action is still cooling down */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_LT_B);
+
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
     HS_AppData.MATablePtr[0].Cooldown    = 0;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0, "HS_AppData.AppMonEnables[0] == 0");
 
-    UtAssert_True(HS_AppData.MsgActExec == 0, "HS_AppData.MsgActExec == 0");
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 1, "HS_AppData.MsgActCooldown[0] == 1");
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -759,12 +893,12 @@ void HS_MonitorApplications_Test_MsgActsErrorDefaultDisabled(void)
     HS_AppData.AMTablePtr = AMTable;
     HS_AppData.MATablePtr = MATable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_LAST_NONMSG + 1;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
-    HS_AppData.MsgActsState              = HS_STATE_ENABLED;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_LAST_NONMSG + 1;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
+    HS_AppData.MsgActsState                    = HS_STATE_ENABLED;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -773,19 +907,20 @@ void HS_MonitorApplications_Test_MsgActsErrorDefaultDisabled(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
-    HS_AppData.MsgActCooldown[0]         = 0; /* (HS_AMT_ACT_LAST_NONMSG + 1) - HS_AMT_ACT_LAST_NONMSG - 1 = 0 */
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_DISABLED;
     HS_AppData.MATablePtr[0].Cooldown    = 0;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0, "HS_AppData.AppMonEnables[0] == 0");
 
-    UtAssert_True(HS_AppData.MsgActExec == 0, "HS_AppData.MsgActExec == 0s");
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 0, "HS_AppData.MsgActCooldown[0] == 0");
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -810,12 +945,12 @@ void HS_MonitorApplications_Test_MsgActsErrorDefaultNoEvent(void)
     HS_AppData.AMTablePtr = AMTable;
     HS_AppData.MATablePtr = MATable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_LAST_NONMSG + 1;
-    HS_AppData.AppMonCheckInCountdown[0] = 1;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
-    HS_AppData.MsgActsState              = HS_STATE_ENABLED;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_LAST_NONMSG + 1;
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
+    HS_AppData.MsgActsState                    = HS_STATE_ENABLED;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -824,19 +959,20 @@ void HS_MonitorApplications_Test_MsgActsErrorDefaultNoEvent(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
-    HS_AppData.MsgActCooldown[0]         = 0; /* (HS_AMT_ACT_LAST_NONMSG + 1) - HS_AMT_ACT_LAST_NONMSG - 1 = 0 */
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_NOEVENT;
     HS_AppData.MATablePtr[0].Cooldown    = 1;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 0, "HS_AppData.AppMonCheckInCountdown[0] == 0");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 0, "HS_AppData.AppMonState[0].CheckInCountdown == 0");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 0, "HS_AppData.AppMonEnables[0] == 0");
 
-    UtAssert_True(HS_AppData.MsgActExec == 1, "HS_AppData.MsgActExec == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 1, "HS_AppData.MsgActCooldown[0] == 1");
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -852,11 +988,11 @@ void HS_MonitorApplications_CheckInCountdownNotZero(void)
 
     HS_AppData.AMTablePtr = AMTable;
 
-    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_EVENT;
-    HS_AppData.AppMonCheckInCountdown[0] = 2;
-    HS_AppData.AppMonLastExeCount[0]     = 0;
-    HS_AppData.AppMonEnables[0]          = 1;
-    HS_AppData.AMTablePtr[0].CycleCount  = 1;
+    HS_AppData.AMTablePtr[0].ActionType        = HS_AMT_ACT_EVENT;
+    HS_AppData.AppMonState[0].CheckInCountdown = 2;
+    HS_AppData.AppMonState[0].LastExeCount     = 0;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.AMTablePtr[0].CycleCount        = 1;
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
@@ -865,11 +1001,13 @@ void HS_MonitorApplications_CheckInCountdownNotZero(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppInfo), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorApplications();
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonCheckInCountdown[0] == 1, "HS_AppData.AppMonCheckInCountdown[0] == 1");
+    UtAssert_True(HS_AppData.AppMonState[0].CheckInCountdown == 1, "HS_AppData.AppMonState[0].CheckInCountdown == 1");
     UtAssert_True(HS_AppData.AppMonEnables[0] == 1, "HS_AppData.AppMonEnables[0] == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -877,6 +1015,171 @@ void HS_MonitorApplications_CheckInCountdownNotZero(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_MonitorApplications_Test_Escalate(void)
+{
+    HS_AMTEntry_t    AMTable[HS_MAX_MONITORED_APPS];
+    CFE_ES_AppInfo_t AppInfo;
+
+    memset(AMTable, 0, sizeof(AMTable));
+    memset(&AppInfo, 0, sizeof(AppInfo));
+
+    HS_AppData.AMTablePtr     = AMTable;
+    HS_AppData.LadderCDSState = HS_STATE_ENABLED;
+
+    HS_AppData.AMTablePtr[0].ActionType                = HS_AMT_ACT_EVENT;
+    HS_AppData.AMTablePtr[0].CycleCount                = 1;
+    HS_AppData.AMTablePtr[0].Escalation[0].ActionType  = HS_AMT_ACT_APP_RESTART;
+    HS_AppData.AMTablePtr[0].Escalation[0].DwellCycles = 5;
+    HS_AppData.AppMonState[0].CheckInCountdown         = 1;
+    HS_AppData.AppMonEnables[0]                        = 1;
+
+    strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppInfo), &AppInfo, sizeof(AppInfo), false);
+
+    HS_Test_CompileRuntime();
+
+    /* Execute the function being tested */
+    HS_MonitorApplications();
+
+    /* Verify results, the base action is taken and the next rung gets its dwell time */
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[0].Rung, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[0].RungNot, (uint16)~1);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].EscalationRung, 1);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CheckInCountdown, 5);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonEnables[0], 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_ESCALATE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_APPMON_FAIL_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_ES_RestartApp, 0);
+}
+
+void HS_MonitorApplications_Test_EscalatedAction(void)
+{
+    HS_AMTEntry_t    AMTable[HS_MAX_MONITORED_APPS];
+    CFE_ES_AppInfo_t AppInfo;
+
+    memset(AMTable, 0, sizeof(AMTable));
+    memset(&AppInfo, 0, sizeof(AppInfo));
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    HS_AppData.AMTablePtr[0].ActionType               = HS_AMT_ACT_EVENT;
+    HS_AppData.AMTablePtr[0].CycleCount               = 3;
+    HS_AppData.AMTablePtr[0].Escalation[0].ActionType = HS_AMT_ACT_APP_RESTART;
+    HS_AppData.AMTablePtr[0].Escalation[1].ActionType = HS_AMT_ACT_EVENT;
+    HS_AppData.AppMonState[0].CheckInCountdown        = 1;
+    HS_AppData.AppMonEnables[0]                       = 1;
+    HS_AppData.CDSLadders.Ladder[0].Rung                 = 1;
+    HS_AppData.CDSLadders.Ladder[0].RungNot              = (uint16)~1;
+
+    strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppInfo), &AppInfo, sizeof(AppInfo), false);
+
+    HS_Test_CompileRuntime();
+
+    /* Execute the function being tested */
+    HS_MonitorApplications();
+
+    /* Verify results, the first rung's action is taken and a dwell of 0 falls back to CycleCount */
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[0].Rung, 2);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CheckInCountdown, 3);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonEnables[0], 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_APPMON_RESTART_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_ES_RestartApp, 1);
+}
+
+void HS_MonitorApplications_Test_EscalationTop(void)
+{
+    HS_AMTEntry_t    AMTable[HS_MAX_MONITORED_APPS];
+    CFE_ES_AppInfo_t AppInfo;
+    uint32           i;
+
+    memset(AMTable, 0, sizeof(AMTable));
+    memset(&AppInfo, 0, sizeof(AppInfo));
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    HS_AppData.AMTablePtr[0].ActionType = HS_AMT_ACT_APP_RESTART;
+    HS_AppData.AMTablePtr[0].CycleCount = 1;
+    for (i = 0; i < HS_MAX_ESCALATION_RUNGS; i++)
+    {
+        HS_AppData.AMTablePtr[0].Escalation[i].ActionType = HS_AMT_ACT_EVENT;
+    }
+    HS_AppData.AppMonState[0].CheckInCountdown = 1;
+    HS_AppData.AppMonEnables[0]                = 1;
+    HS_AppData.CDSLadders.Ladder[0].Rung          = HS_MAX_ESCALATION_RUNGS;
+    HS_AppData.CDSLadders.Ladder[0].RungNot       = (uint16)~HS_MAX_ESCALATION_RUNGS;
+
+    strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppInfo), &AppInfo, sizeof(AppInfo), false);
+
+    HS_Test_CompileRuntime();
+
+    /* Execute the function being tested */
+    HS_MonitorApplications();
+
+    /* Verify results, the top rung's action is taken and monitoring stops */
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[0].Rung, HS_MAX_ESCALATION_RUNGS);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CheckInCountdown, 0);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonEnables[0], 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_FAIL_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
+void HS_MonitorApplications_Test_EscalationRecovered(void)
+{
+    HS_AMTEntry_t    AMTable[HS_MAX_MONITORED_APPS];
+    CFE_ES_AppInfo_t AppInfo;
+
+    memset(AMTable, 0, sizeof(AMTable));
+    memset(&AppInfo, 0, sizeof(AppInfo));
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    HS_AppData.AMTablePtr[0].ActionType               = HS_AMT_ACT_EVENT;
+    HS_AppData.AMTablePtr[0].CycleCount               = 10;
+    HS_AppData.AMTablePtr[0].Escalation[0].ActionType = HS_AMT_ACT_APP_RESTART;
+    HS_AppData.AppMonState[0].CheckInCountdown        = 10;
+    HS_AppData.AppMonState[0].RecoveryCheckIns        = HS_ESCALATION_RECOVERY_CHECKINS - 2;
+    HS_AppData.CDSLadders.Ladder[0].Rung                 = 1;
+    HS_AppData.CDSLadders.Ladder[0].RungNot              = (uint16)~1;
+
+    strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
+
+    HS_Test_CompileRuntime();
+
+    /* Execute the function being tested, the App checks in but has not yet recovered */
+    AppInfo.ExecutionCounter = 1;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppInfo), &AppInfo, sizeof(AppInfo), false);
+    HS_MonitorApplications();
+
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].RecoveryCheckIns, HS_ESCALATION_RECOVERY_CHECKINS - 1);
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[0].Rung, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* The next check-in puts it back at the bottom of the ladder */
+    AppInfo.ExecutionCounter = 2;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppInfo), &AppInfo, sizeof(AppInfo), false);
+    HS_MonitorApplications();
+
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[0].Rung, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[0].RungNot, (uint16)~0);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].EscalationRung, 0);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].RecoveryCheckIns, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_RECOVERED_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void HS_MonitorEvent_Test_AppName(void)
 {
     HS_EMTEntry_t          EMTable[HS_MAX_MONITORED_APPS];
@@ -907,6 +1210,8 @@ void HS_MonitorEvent_Test_AppName(void)
     /* Active table entry where event doesn't match */
     HS_AppData.EMTablePtr[1].ActionType = HS_EMT_ACT_PROC_RESET;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -950,6 +1255,8 @@ void HS_MonitorEvent_Test_ProcErrorReset(void)
     strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
     strncpy(Packet.Payload.PacketID.AppName, "AppName", 10);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -972,6 +1279,8 @@ void HS_MonitorEvent_Test_ProcErrorReset(void)
 
     UtAssert_True(HS_AppData.ServiceWatchdogFlag == HS_STATE_DISABLED,
                   "HS_AppData.ServiceWatchdogFlag == HS_STATE_DISABLED");
+
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 1);
 }
 
 void HS_MonitorEvent_Test_ProcErrorNoReset(void)
@@ -981,6 +1290,7 @@ void HS_MonitorEvent_Test_ProcErrorNoReset(void)
     CFE_EVS_LongEventTlm_t Packet;
     int32                  strCmpResult;
     char                   ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    uint16                 RecordedAction = 0xFFFF;
 
     memset(EMTable, 0, sizeof(EMTable));
     memset(MATable, 0, sizeof(MATable));
@@ -1007,6 +1317,10 @@ void HS_MonitorEvent_Test_ProcErrorNoReset(void)
     strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
     strncpy(Packet.Payload.PacketID.AppName, "AppName", 10);
 
+    UT_SetHookFunction(UT_KEY(HS_HistoryRecord), HS_MONITORS_TEST_HS_HistoryRecordHook, &RecordedAction);
+
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -1030,6 +1344,10 @@ void HS_MonitorEvent_Test_ProcErrorNoReset(void)
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
+
+    /* Recorded as no action, since no reset was performed */
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 1);
+    UtAssert_UINT32_EQ(RecordedAction, HS_EMT_ACT_NOACT);
 }
 
 void HS_MonitorEvent_Test_AppRestartErrors(void)
@@ -1066,6 +1384,8 @@ void HS_MonitorEvent_Test_AppRestartErrors(void)
     /* Set CFE_ES_RestartApp to return -1, in order to generate error message HS_EVENTMON_NOT_RESTARTED_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_RestartApp), 1, -1);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -1123,6 +1443,8 @@ void HS_MonitorEvent_Test_OnlySecondAppRestartError(void)
     /* Set CFE_ES_GetAppIDByName to return -1, in order to generate error message HS_EVENTMON_NOT_RESTARTED_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, -1);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -1172,6 +1494,8 @@ void HS_MonitorEvent_Test_NoSecondAppRestartError(void)
     /* Set CFE_ES_GetAppIDByName to succeed on first call and bypass error HS_EVENTMON_NOT_RESTARTED_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -1223,6 +1547,8 @@ void HS_MonitorEvent_Test_DeleteErrors(void)
     /* Set CFE_ES_DeleteApp to return -1, in order to generate error message HS_EVENTMON_NOT_DELETED_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteApp), 1, -1);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -1280,6 +1606,8 @@ void HS_MonitorEvent_Test_OnlySecondDeleteError(void)
     /* Set CFE_ES_GetAppIDByName to fail on first call, to generate error HS_EVENTMON_NOT_DELETED_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, -1);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -1329,6 +1657,8 @@ void HS_MonitorEvent_Test_NoSecondDeleteError(void)
     /* Set CFE_ES_GetAppIDByName to succeed on first call and bypass error HS_EVENTMON_NOT_DELETED_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_SUCCESS);
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -1379,10 +1709,11 @@ void HS_MonitorEvent_Test_MsgActsError(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteApp), 1, -1);
 
     HS_AppData.MsgActsState              = HS_STATE_ENABLED;
-    HS_AppData.MsgActCooldown[0]         = 0;
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
     HS_AppData.MATablePtr[0].Cooldown    = 5;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -1395,8 +1726,8 @@ void HS_MonitorEvent_Test_MsgActsError(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(HS_AppData.MsgActExec == 1, "HS_AppData.MsgActExec == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 5, "HS_AppData.MsgActCooldown[0] == 5");
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -1430,20 +1761,66 @@ void HS_MonitorEvent_Test_MsgActsErrorNoEvent(void)
     /* Set CFE_ES_DeleteApp to return -1, in order to generate error message HS_EVENTMON_NOT_DELETED_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteApp), 1, -1);
 
-    HS_AppData.MsgActsState      = HS_STATE_ENABLED;
-    HS_AppData.MsgActCooldown[0] = 0;
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
 
     /* take branch to avoid HS_EVENTMON_MSGACTS_ERR_EID event error */
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_NOEVENT;
 
     HS_AppData.MATablePtr[0].Cooldown = 5;
 
+    HS_Test_CompileRuntime();
+
+    /* Execute the function being tested */
+    HS_MonitorEvent(&Packet);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 1);
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 1);
+}
+
+void HS_MonitorEvent_Test_MsgActsCoolingDown(void)
+{
+    HS_EMTEntry_t          EMTable[HS_MAX_MONITORED_APPS];
+    HS_MATEntry_t          MATable[HS_MAX_MSG_ACT_TYPES];
+    CFE_EVS_LongEventTlm_t Packet;
+
+    memset(EMTable, 0, sizeof(EMTable));
+    memset(MATable, 0, sizeof(MATable));
+
+    CFE_MSG_Init((CFE_MSG_Message_t *)&Packet, CFE_SB_ValueToMsgId(HS_CMD_MID), sizeof(CFE_EVS_LongEventTlm_t));
+
+    Packet.Payload.PacketID.EventID = 3;
+
+    HS_AppData.EMTablePtr = EMTable;
+    HS_AppData.MATablePtr = MATable;
+
+    HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_LAST_NONMSG + 1;
+    HS_AppData.EMTablePtr[0].EventID    = Packet.Payload.PacketID.EventID;
+
+    strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
+    strncpy(Packet.Payload.PacketID.AppName, "AppName", 10);
+
+    HS_AppData.MsgActsState              = HS_STATE_ENABLED;
+    HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
+    HS_AppData.MATablePtr[0].Cooldown    = 5;
+
+    /* The message action is still cooling down from an earlier match */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Compare), 1, CFE_TIME_A_LT_B);
+
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
     /* Verify results */
-    UtAssert_True(HS_AppData.MsgActExec == 1, "HS_AppData.MsgActExec == 1");
-    UtAssert_True(HS_AppData.MsgActCooldown[0] == 5, "HS_AppData.MsgActCooldown[0] == 5");
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 0);
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
 }
 
 void HS_MonitorEvent_Test_MsgActsDefaultDisabled(void)
@@ -1473,8 +1850,9 @@ void HS_MonitorEvent_Test_MsgActsDefaultDisabled(void)
     /* Set CFE_ES_DeleteApp to return -1, in order to generate error message HS_EVENTMON_NOT_DELETED_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteApp), 1, -1);
 
-    HS_AppData.MsgActsState      = HS_STATE_ENABLED;
-    HS_AppData.MsgActCooldown[0] = 0;
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+
+    HS_Test_CompileRuntime();
 
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
@@ -1512,8 +1890,9 @@ void HS_MonitorEvent_Test_MsgActsDefaultGreaterLastNonMsg(void)
     /* Set CFE_ES_DeleteApp to return -1, in order to generate error message HS_EVENTMON_NOT_DELETED_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteApp), 1, -1);
 
-    HS_AppData.MsgActsState      = HS_STATE_ENABLED;
-    HS_AppData.MsgActCooldown[0] = 0;
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+
+    HS_Test_CompileRuntime();
 
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
@@ -1548,8 +1927,10 @@ void HS_MonitorEvent_Test_MsgActsDefaultLessMaxActTypes(void)
     strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
     strncpy(Packet.Payload.PacketID.AppName, "AppName", 10);
 
-    HS_AppData.MsgActsState      = HS_STATE_DISABLED;
-    HS_AppData.MsgActCooldown[0] = 1;
+    HS_AppData.MsgActsState = HS_STATE_DISABLED;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_LT_B);
+
+    HS_Test_CompileRuntime();
 
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
@@ -1586,7 +1967,8 @@ void HS_MonitorEvent_Test_MsgActsDefaultMaxActTypes(void)
     strncpy(Packet.Payload.PacketID.AppName, "AppName", 10);
 
     HS_AppData.MsgActsState                = HS_STATE_ENABLED;
-    HS_AppData.MsgActCooldown[MsgActIndex] = 0;
+
+    HS_Test_CompileRuntime();
 
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
@@ -1622,14 +2004,16 @@ void HS_MonitorEvent_Test_MsgActsCoolDown(void)
     strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
     strncpy(Packet.Payload.PacketID.AppName, "AppName", 10);
 
-    HS_AppData.MsgActsState      = HS_STATE_ENABLED;
-    HS_AppData.MsgActCooldown[0] = 1;
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_LT_B);
 
     /* take branch to avoid "Send the message if off cooldown and not disabled" */
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_NOEVENT;
 
     HS_AppData.MATablePtr[0].Cooldown = 5;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -1663,14 +2047,15 @@ void HS_MonitorEvent_Test_MsgActsMATDisabled(void)
     strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
     strncpy(Packet.Payload.PacketID.AppName, "AppName", 10);
 
-    HS_AppData.MsgActsState      = HS_STATE_ENABLED;
-    HS_AppData.MsgActCooldown[0] = 0;
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
 
     /* take branch to avoid "Send the message if off cooldown and not disabled" */
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_DISABLED;
 
     HS_AppData.MATablePtr[0].Cooldown = 5;
 
+    HS_Test_CompileRuntime();
+
     /* Execute the function being tested */
     HS_MonitorEvent(&Packet);
 
@@ -1830,30 +2215,486 @@ void HS_MonitorUtilization_Test_LowUtilIndex(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void HS_ValidateAMTable_Test_UnusedTableEntryCycleCountZero(void)
+void HS_MonitorMemory_Test_Event(void)
 {
-    int32         Result;
-    uint32        i;
-    int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+    HS_MMTEntry_t  MMTable[HS_MAX_MONITORED_MEM];
+    OS_heap_prop_t HeapProp;
 
-    memset(AMTable, 0, sizeof(AMTable));
+    memset(MMTable, 0, sizeof(MMTable));
+    memset(&HeapProp, 0, sizeof(HeapProp));
+    memset(HS_AppData.MemMon, 0xFF, sizeof(HS_AppData.MemMon));
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
+    HS_AppData.MMTablePtr = MMTable;
 
-    HS_AppData.AMTablePtr = AMTable;
+    MMTable[1].ResourceType = HS_MMT_TYPE_HEAP;
+    MMTable[1].MinFreeBytes = 1000;
+    MMTable[1].ActionType   = HS_MMT_ACT_EVENT;
 
-    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
-    {
-        HS_AppData.AMTablePtr[i].ActionType = 99;
-        HS_AppData.AMTablePtr[i].CycleCount = 0;
-        HS_AppData.AMTablePtr[i].NullTerm   = 0;
-    }
+    HeapProp.free_bytes         = 500;
+    HeapProp.largest_free_block = 400;
 
-    /* Execute the function being tested */
-    Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
+    UT_SetHandlerFunction(UT_KEY(OS_HeapGetInfo), HS_MONITORS_TEST_OS_HeapGetInfoHandler, &HeapProp);
+
+    HS_Test_CompileRuntime();
+
+    /* Execute the function being tested */
+    HS_MonitorMemory();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MEMMON_FAIL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[1].FreeBytes, 500);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[1].LowWaterBytes, 500);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[1].LargestFreeBlock, 400);
+    UtAssert_UINT32_EQ(HS_AppData.MemMonFlags[1], HS_MEMMON_LIMIT_CROSSED);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].FreeBytes, HS_MEMMON_INVALID);
+    UtAssert_STUB_COUNT(OS_HeapGetInfo, 1);
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 1);
+
+    /* Still below the limit, the action is not taken again */
+    HeapProp.free_bytes = 600;
+    HS_MonitorMemory();
+
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[1].FreeBytes, 600);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[1].LowWaterBytes, 500);
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 1);
+
+    /* Back within limits re-arms the action */
+    HeapProp.free_bytes         = 2000;
+    HeapProp.largest_free_block = 2000;
+    HS_MonitorMemory();
+
+    UtAssert_UINT32_EQ(HS_AppData.MemMonFlags[1], 0);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[1].LowWaterBytes, 500);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_MonitorMemory_Test_FragmentedMsgActs(void)
+{
+    HS_MMTEntry_t         MMTable[HS_MAX_MONITORED_MEM];
+    HS_MATEntry_t         MATable[HS_MAX_MSG_ACT_TYPES];
+    CFE_ES_MemPoolStats_t PoolStats;
+
+    memset(MMTable, 0, sizeof(MMTable));
+    memset(MATable, 0, sizeof(MATable));
+    memset(&PoolStats, 0, sizeof(PoolStats));
+    memset(HS_AppData.MemMon, 0xFF, sizeof(HS_AppData.MemMon));
+
+    HS_AppData.MMTablePtr = MMTable;
+    HS_AppData.MATablePtr = MATable;
+
+    MMTable[0].ResourceType = HS_MMT_TYPE_POOL;
+    MMTable[0].MinContigPct = 50;
+    MMTable[0].ActionType   = HS_MMT_ACT_LAST_NONMSG + 1;
+
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+    MATable[0].EnableState  = HS_MAT_STATE_ENABLED;
+
+    PoolStats.NumFreeBytes            = 1000;
+    PoolStats.BlockStats[0].BlockSize = 100;
+    PoolStats.BlockStats[0].NumFree   = 20;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetMemPoolStats), HS_MONITORS_TEST_CFE_ES_GetMemPoolStatsHandler,
+                          &PoolStats);
+
+    HS_Test_CompileRuntime();
+
+    /* Execute the function being tested */
+    HS_MonitorMemory();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MEMMON_MSGACTS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].FreeBytes, 3000);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].LargestFreeBlock, 1000);
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_MonitorMemory_Test_MsgActsDisabled(void)
+{
+    HS_MMTEntry_t  MMTable[HS_MAX_MONITORED_MEM];
+    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
+    OS_heap_prop_t HeapProp;
+
+    memset(MMTable, 0, sizeof(MMTable));
+    memset(MATable, 0, sizeof(MATable));
+    memset(&HeapProp, 0, sizeof(HeapProp));
+
+    HS_AppData.MMTablePtr = MMTable;
+    HS_AppData.MATablePtr = MATable;
+
+    MMTable[0].ResourceType = HS_MMT_TYPE_HEAP;
+    MMTable[0].MinFreeBytes = 1000;
+    MMTable[0].ActionType   = HS_MMT_ACT_LAST_NONMSG + 1;
+    MMTable[1].ResourceType = HS_MMT_TYPE_HEAP;
+    MMTable[1].MinFreeBytes = 1000;
+    MMTable[1].ActionType   = HS_MMT_ACT_LAST_NONMSG + 1 + HS_MAX_MSG_ACT_TYPES;
+    MMTable[2].ResourceType = HS_MMT_TYPE_HEAP;
+    MMTable[2].MinFreeBytes = 1000;
+    MMTable[2].ActionType   = HS_MMT_ACT_NOACT;
+
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+    MATable[0].EnableState  = HS_MAT_STATE_DISABLED;
+
+    UT_SetHandlerFunction(UT_KEY(OS_HeapGetInfo), HS_MONITORS_TEST_OS_HeapGetInfoHandler, &HeapProp);
+
+    HS_Test_CompileRuntime();
+
+    /* Execute the function being tested */
+    HS_MonitorMemory();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 0);
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_MonitorMemory_Test_ReadError(void)
+{
+    HS_MMTEntry_t         MMTable[HS_MAX_MONITORED_MEM];
+    CFE_ES_MemPoolStats_t PoolStats;
+
+    memset(MMTable, 0, sizeof(MMTable));
+    memset(&PoolStats, 0, sizeof(PoolStats));
+
+    HS_AppData.MMTablePtr = MMTable;
+
+    MMTable[0].ResourceType = HS_MMT_TYPE_POOL;
+    MMTable[0].MinFreeBytes = 1000;
+    MMTable[0].ActionType   = HS_MMT_ACT_EVENT;
+
+    PoolStats.NumFreeBytes = 2000;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetMemPoolStats), HS_MONITORS_TEST_CFE_ES_GetMemPoolStatsHandler,
+                          &PoolStats);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetMemPoolStats), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetMemPoolStats), 2, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    HS_Test_CompileRuntime();
+
+    /* Execute the function being tested */
+    HS_MonitorMemory();
+    HS_MonitorMemory();
+
+    /* Verify results, the failure is only reported once */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MEMMON_READ_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].FreeBytes, HS_MEMMON_INVALID);
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].LargestFreeBlock, HS_MEMMON_INVALID);
+    UtAssert_UINT32_EQ(HS_AppData.MemMonFlags[0], HS_MEMMON_READ_FAILED);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* A successful read clears the failure */
+    HS_MonitorMemory();
+
+    UtAssert_UINT32_EQ(HS_AppData.MemMon[0].FreeBytes, 2000);
+    UtAssert_UINT32_EQ(HS_AppData.MemMonFlags[0], 0);
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 0);
+}
+
+void HS_MemMonRead_Test_Pool(void)
+{
+    HS_MMTEntry_t         MMTable[HS_MAX_MONITORED_MEM];
+    CFE_ES_MemPoolStats_t PoolStats;
+    uint32                FreeBytes   = 0;
+    uint32                LargestFree = 0;
+
+    memset(MMTable, 0, sizeof(MMTable));
+    memset(&PoolStats, 0, sizeof(PoolStats));
+
+    HS_AppData.MMTablePtr = MMTable;
+
+    MMTable[0].ResourceType = HS_MMT_TYPE_POOL;
+    strncpy(MMTable[0].AppName, "AppName", sizeof(MMTable[0].AppName) - 1);
+
+    PoolStats.NumFreeBytes            = 100;
+    PoolStats.BlockStats[0].BlockSize = 512;
+    PoolStats.BlockStats[0].NumFree   = 2;
+    PoolStats.BlockStats[1].BlockSize = 4096;
+    PoolStats.BlockStats[1].NumFree   = 0;
+    PoolStats.BlockStats[2].BlockSize = 256;
+    PoolStats.BlockStats[2].NumFree   = 1;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetMemPoolStats), HS_MONITORS_TEST_CFE_ES_GetMemPoolStatsHandler,
+                          &PoolStats);
+
+    HS_Test_CompileRuntime();
+    HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MMT)->MMPoolId[0] = CFE_ResourceId_FromInteger(0x40000);
+
+    /* Execute the function being tested, empty buckets don't count */
+    UtAssert_INT32_EQ(HS_MemMonRead(0, &FreeBytes, &LargestFree), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(FreeBytes, 100 + 1024 + 256);
+    UtAssert_UINT32_EQ(LargestFree, 512);
+
+    /* Saturates below the invalid value */
+    PoolStats.BlockStats[1].NumFree = 0x100000;
+    UtAssert_INT32_EQ(HS_MemMonRead(0, &FreeBytes, &LargestFree), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(FreeBytes, HS_MEMMON_INVALID - 1);
+    UtAssert_UINT32_EQ(LargestFree, 4096);
+
+    /* Errors are passed back */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetMemPoolStats), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(HS_MemMonRead(0, &FreeBytes, &LargestFree), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+}
+
+void HS_MemMonRead_Test_Heap(void)
+{
+    HS_MMTEntry_t  MMTable[HS_MAX_MONITORED_MEM];
+    OS_heap_prop_t HeapProp;
+    uint32         FreeBytes   = 0;
+    uint32         LargestFree = 0;
+
+    memset(MMTable, 0, sizeof(MMTable));
+    memset(&HeapProp, 0, sizeof(HeapProp));
+
+    HS_AppData.MMTablePtr = MMTable;
+
+    MMTable[0].ResourceType = HS_MMT_TYPE_HEAP;
+
+    HeapProp.free_bytes         = 8192;
+    HeapProp.largest_free_block = 2048;
+
+    UT_SetHandlerFunction(UT_KEY(OS_HeapGetInfo), HS_MONITORS_TEST_OS_HeapGetInfoHandler, &HeapProp);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_MemMonRead(0, &FreeBytes, &LargestFree), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(FreeBytes, 8192);
+    UtAssert_UINT32_EQ(LargestFree, 2048);
+    UtAssert_STUB_COUNT(CFE_ES_GetMemPoolStats, 0);
+
+    /* Errors are passed back */
+    UT_SetDeferredRetcode(UT_KEY(OS_HeapGetInfo), 1, OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(HS_MemMonRead(0, &FreeBytes, &LargestFree), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void HS_MonitorMessages_Test_Arrival(void)
+{
+    HS_MFTEntry_t  MFTable[HS_MAX_MONITORED_MSGS];
+    CFE_SB_MsgId_t MsgIds[2];
+
+    memset(MFTable, 0, sizeof(MFTable));
+
+    HS_AppData.MFTablePtr = MFTable;
+
+    /* Entries 0 and 1 share a hash bucket */
+    MFTable[0].MsgId      = CFE_SB_ValueToMsgId(0x1801);
+    MFTable[0].MaxAgeMsec = 1000;
+    MFTable[0].ActionType = HS_MFT_ACT_EVENT;
+    MFTable[1].MsgId      = CFE_SB_ValueToMsgId(0x1801 + HS_MSGMON_HASH_BUCKETS);
+    MFTable[1].MaxAgeMsec = 1000;
+    MFTable[1].ActionType = HS_MFT_ACT_EVENT;
+
+    HS_AppData.MsgMonFlags[1] = HS_MSGMON_STALE;
+
+    HS_Test_CompileRuntime();
+
+    /* The second entry arrives, then a message in the same bucket that isn't monitored */
+    MsgIds[0] = MFTable[1].MsgId;
+    MsgIds[1] = CFE_SB_ValueToMsgId(0x1801 + (2 * HS_MSGMON_HASH_BUCKETS));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIds, sizeof(MsgIds), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 3, CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    HS_MonitorMessages();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 3);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 2);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMon[0].ArrivalCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMon[1].ArrivalCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMonFlags[1], 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMon[1].AgeMsec, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 2);
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_MonitorMessages_Test_Stale(void)
+{
+    HS_MFTEntry_t      MFTable[HS_MAX_MONITORED_MSGS];
+    CFE_TIME_SysTime_t Elapsed;
+    int32              strCmpResult;
+    char               ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    memset(MFTable, 0, sizeof(MFTable));
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Message Monitor: MID 0x%%08X: Age = %%u ms, Max = %%u ms: Action: Event Only");
+
+    HS_AppData.MFTablePtr = MFTable;
+
+    MFTable[2].MsgId      = CFE_SB_ValueToMsgId(0x1801);
+    MFTable[2].MaxAgeMsec = 1000;
+    MFTable[2].ActionType = HS_MFT_ACT_EVENT;
+
+    Elapsed.Seconds    = 2;
+    Elapsed.Subseconds = 0x80000000;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), HS_MONITORS_TEST_CFE_TIME_SubtractHandler, &Elapsed);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 500000);
+
+    /* Execute the function being tested */
+    HS_MonitorMessages();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MSGMON_STALE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgMon[2].AgeMsec, 2500);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMonFlags[2], HS_MSGMON_STALE);
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 1);
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 1);
+
+    /* Still stale, the action is not taken again and very old ages saturate */
+    Elapsed.Seconds = 0xFFFFFFFF / 1000;
+    HS_MonitorMessages();
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgMon[2].AgeMsec, 0xFFFFFFFF);
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_MonitorMessages_Test_MsgActs(void)
+{
+    HS_MFTEntry_t      MFTable[HS_MAX_MONITORED_MSGS];
+    HS_MATEntry_t      MATable[HS_MAX_MSG_ACT_TYPES];
+    CFE_TIME_SysTime_t Elapsed;
+
+    memset(MFTable, 0, sizeof(MFTable));
+    memset(MATable, 0, sizeof(MATable));
+
+    HS_AppData.MFTablePtr = MFTable;
+    HS_AppData.MATablePtr = MATable;
+
+    MFTable[0].MsgId      = CFE_SB_ValueToMsgId(0x1801);
+    MFTable[0].MaxAgeMsec = 1000;
+    MFTable[0].ActionType = HS_MFT_ACT_LAST_NONMSG + 1;
+    MFTable[1].MsgId      = CFE_SB_ValueToMsgId(0x1802);
+    MFTable[1].MaxAgeMsec = 1000;
+    MFTable[1].ActionType = HS_MFT_ACT_LAST_NONMSG + 1 + HS_MAX_MSG_ACT_TYPES;
+    MFTable[2].MsgId      = CFE_SB_ValueToMsgId(0x1803);
+    MFTable[2].MaxAgeMsec = 1000;
+    MFTable[2].ActionType = HS_MFT_ACT_NOACT;
+
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+    MATable[0].EnableState  = HS_MAT_STATE_ENABLED;
+
+    Elapsed.Seconds    = 5;
+    Elapsed.Subseconds = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), HS_MONITORS_TEST_CFE_TIME_SubtractHandler, &Elapsed);
+
+    /* Execute the function being tested */
+    HS_MonitorMessages();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MSGMON_MSGACTS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(HS_HistoryRecord, 1);
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMon[0].AgeMsec, 5000);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_MsgMonSubscribe_Test(void)
+{
+    HS_MFTEntry_t MFTable[HS_MAX_MONITORED_MSGS];
+
+    memset(MFTable, 0, sizeof(MFTable));
+
+    HS_AppData.MFTablePtr = MFTable;
+
+    /* Subscriptions from the previous table */
+    HS_AppData.MsgMonSubscribed[0]   = CFE_SB_ValueToMsgId(0x1901);
+    HS_AppData.MsgMonSubscribed[1]   = CFE_SB_ValueToMsgId(0x1902);
+    HS_AppData.MsgMonSubscribedCount = 2;
+
+    MFTable[0].MsgId      = CFE_SB_ValueToMsgId(0x1801);
+    MFTable[0].MaxAgeMsec = 1000;
+    MFTable[2].MsgId      = CFE_SB_ValueToMsgId(0x1802);
+    MFTable[2].MaxAgeMsec = 1000;
+    MFTable[3].MsgId      = CFE_SB_ValueToMsgId(0x1803);
+    MFTable[3].MaxAgeMsec = 1000;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_SubscribeEx), 2, -1);
+
+    /* Execute the function being tested */
+    HS_MsgMonSubscribe();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 2);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, 3);
+    UtAssert_UINT32_EQ(HS_AppData.MsgMonSubscribedCount, 2);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(HS_AppData.MsgMonSubscribed[0], MFTable[0].MsgId));
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(HS_AppData.MsgMonSubscribed[1], MFTable[3].MsgId));
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MSGMON_SUB_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_ValidateAMTable_Test_UnusedTableEntryCycleCountZero(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
+    {
+        HS_AppData.AMTablePtr[i].ActionType = 99;
+        HS_AppData.AMTablePtr[i].CycleCount = 0;
+        HS_AppData.AMTablePtr[i].NullTerm   = 0;
+    }
+
+    /* Execute the function being tested */
+    Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
 
     /* Verify results */
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_INF_EID);
@@ -2038,11 +2879,11 @@ void HS_ValidateAMTable_Test_EntryGood(void)
         HS_AppData.AMTablePtr[i].ActionType = HS_AMT_ACT_LAST_NONMSG;
         HS_AppData.AMTablePtr[i].CycleCount = 1;
         HS_AppData.AMTablePtr[i].NullTerm   = 0;
+        snprintf(HS_AppData.AMTablePtr[i].AppName, OS_MAX_API_NAME, "AppName%u", (unsigned int)i);
     }
 
-    strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
-
     UT_SetDefaultReturnValue(UT_KEY(HS_AMTActionIsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(HS_AMTEscalationIsValid), true);
 
     /* Execute the function being tested */
     Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
@@ -2063,6 +2904,99 @@ void HS_ValidateAMTable_Test_EntryGood(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_ValidateAMTable_Test_Duplicates(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "AppMon verify err: Entry = %%d, Err = %%d, Action = %%d, App = %%s, "
+             "First Entry = %%d, First Action = %%d");
+
+    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
+    {
+        AMTable[i].ActionType = HS_AMT_ACT_NOACT;
+    }
+
+    /* Entry 2 duplicates entry 0, entry 3 conflicts with entry 1 */
+    strncpy(AMTable[0].AppName, "AppName", OS_MAX_API_NAME);
+    AMTable[0].ActionType = HS_AMT_ACT_EVENT;
+    AMTable[0].CycleCount = 1;
+    strncpy(AMTable[1].AppName, "OtherApp", OS_MAX_API_NAME);
+    AMTable[1].ActionType = HS_AMT_ACT_EVENT;
+    AMTable[1].CycleCount = 1;
+    strncpy(AMTable[2].AppName, "AppName", OS_MAX_API_NAME);
+    AMTable[2].ActionType = HS_AMT_ACT_EVENT;
+    AMTable[2].CycleCount = 5;
+    strncpy(AMTable[3].AppName, "OtherApp", OS_MAX_API_NAME);
+    AMTable[3].ActionType = HS_AMT_ACT_APP_RESTART;
+    AMTable[3].CycleCount = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_AMTActionIsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(HS_AMTEscalationIsValid), true);
+
+    /* Execute the function being tested */
+    Result = HS_ValidateAMTable(AMTable);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, HS_AMTVAL_ERR_DUP);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_DUP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_AMTVAL_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Table, HS_TBL_NOTIFY_AMT);
+    UtAssert_INT32_EQ(HS_AppData.ValReportPkt.Payload.Result, HS_AMTVAL_ERR_DUP);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.GoodCount, 2);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.BadCount, 2);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.PairCount, 2);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[0].Entry, 2);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[0].FirstEntry, 0);
+    UtAssert_INT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[0].Result, HS_AMTVAL_ERR_DUP);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[1].Entry, 3);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[1].FirstEntry, 1);
+    UtAssert_INT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[1].Result, HS_AMTVAL_ERR_CON);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void HS_ValidateAMTable_Test_BadEscalation(void)
+{
+    int32         Result;
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    strncpy(AMTable[0].AppName, "AppName", OS_MAX_API_NAME);
+    AMTable[0].ActionType = HS_AMT_ACT_EVENT;
+    AMTable[0].CycleCount = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_AMTActionIsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(HS_AMTEscalationIsValid), false);
+
+    /* Execute the function being tested */
+    Result = HS_ValidateAMTable(AMTable);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, HS_AMTVAL_ERR_ESC);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_AMTVAL_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.BadCount, 1);
+}
+
 void HS_ValidateAMTable_Test_Null(void)
 {
     int32 Result;
@@ -2287,7 +3221,7 @@ void HS_ValidateEMTable_Test_EntryGood(void)
     for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
     {
         HS_AppData.EMTablePtr[i].ActionType = HS_EMT_ACT_LAST_NONMSG;
-        HS_AppData.EMTablePtr[i].EventID    = 1;
+        HS_AppData.EMTablePtr[i].EventID    = 1 + i;
         HS_AppData.EMTablePtr[i].NullTerm   = 0;
     }
 
@@ -2314,13 +3248,76 @@ void HS_ValidateEMTable_Test_EntryGood(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void HS_ValidateEMTable_Test_Null(void)
+void HS_ValidateEMTable_Test_Duplicates(void)
 {
-    int32 Result;
-    int32 strCmpResult;
-    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+
+    memset(EMTable, 0, sizeof(EMTable));
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "EventMon verify err: Entry = %%d, Err = %%d, Action = %%d, ID = %%d App = %%s, "
+             "First Entry = %%d, First Action = %%d");
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        EMTable[i].ActionType = HS_EMT_ACT_NOACT;
+    }
+
+    /* Same app with different event IDs and same event ID from different apps are good */
+    strncpy(EMTable[0].AppName, "AppName", OS_MAX_API_NAME);
+    EMTable[0].EventID    = 1;
+    EMTable[0].ActionType = HS_EMT_ACT_APP_RESTART;
+    strncpy(EMTable[1].AppName, "AppName", OS_MAX_API_NAME);
+    EMTable[1].EventID    = 2;
+    EMTable[1].ActionType = HS_EMT_ACT_APP_RESTART;
+    strncpy(EMTable[2].AppName, "OtherApp", OS_MAX_API_NAME);
+    EMTable[2].EventID    = 1;
+    EMTable[2].ActionType = HS_EMT_ACT_APP_RESTART;
+
+    /* Entry 3 conflicts with entry 0 */
+    strncpy(EMTable[3].AppName, "AppName", OS_MAX_API_NAME);
+    EMTable[3].EventID    = 1;
+    EMTable[3].ActionType = HS_EMT_ACT_PROC_RESET;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_EMTActionIsValid), true);
+
+    /* Execute the function being tested */
+    Result = HS_ValidateEMTable(EMTable);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, HS_EMTVAL_ERR_CON);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_DUP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_EMTVAL_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Table, HS_TBL_NOTIFY_EMT);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.GoodCount, 3);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.BadCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.PairCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[0].Entry, 3);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[0].FirstEntry, 0);
+    UtAssert_INT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[0].Result, HS_EMTVAL_ERR_CON);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void HS_ValidateEMTable_Test_Null(void)
+{
+    int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Error in EM Table Validation. Table is null.");
 
     /* Execute the function being tested */
@@ -2342,6 +3339,124 @@ void HS_ValidateEMTable_Test_Null(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_ValReportAddPair_Test_Overflow(void)
+{
+    uint32 i;
+
+    HS_ValReportInit(HS_TBL_NOTIFY_EMT);
+
+    /* Execute the function being tested */
+    for (i = 0; i < HS_MAX_VAL_REPORT_PAIRS + 2; i++)
+    {
+        HS_ValReportAddPair(i + 1, 0, HS_EMTVAL_ERR_DUP);
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Table, HS_TBL_NOTIFY_EMT);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.PairCount, HS_MAX_VAL_REPORT_PAIRS + 2);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[HS_MAX_VAL_REPORT_PAIRS - 1].Entry,
+                       HS_MAX_VAL_REPORT_PAIRS);
+
+    /* Pair count saturates */
+    HS_AppData.ValReportPkt.Payload.PairCount = 0xFFFF;
+    HS_ValReportAddPair(1, 0, HS_EMTVAL_ERR_DUP);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.PairCount, 0xFFFF);
+}
+
+void HS_MsgActReady_Test(void)
+{
+    /* Still cooling down */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Compare), 1, CFE_TIME_A_LT_B);
+    UtAssert_BOOL_FALSE(HS_MsgActReady(0));
+
+    /* Cooldown expires exactly now, or has already expired */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Compare), 1, CFE_TIME_EQUAL);
+    UtAssert_BOOL_TRUE(HS_MsgActReady(0));
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Compare), 1, CFE_TIME_A_GT_B);
+    UtAssert_BOOL_TRUE(HS_MsgActReady(HS_MAX_MSG_ACT_TYPES - 1));
+
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 3);
+}
+
+void HS_MsgActStartCooldown_Test(void)
+{
+    HS_MATEntry_t      MATable[HS_MAX_MSG_ACT_TYPES];
+    CFE_TIME_SysTime_t Cooldown;
+
+    memset(MATable, 0, sizeof(MATable));
+    memset(&Cooldown, 0, sizeof(Cooldown));
+
+    HS_AppData.MATablePtr = MATable;
+
+    HS_AppData.MATablePtr[1].Cooldown = 3;
+
+    UT_SetHookFunction(UT_KEY(CFE_TIME_Add), HS_MONITORS_TEST_CFE_TIME_AddHook, &Cooldown);
+
+    /* Execute the function being tested */
+    HS_MsgActStartCooldown(1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Cooldown.Seconds, (3 * HS_MSG_ACT_COOLDOWN_MSEC) / 1000);
+    UtAssert_STUB_COUNT(CFE_TIME_Micro2SubSecs, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 1);
+}
+
+void HS_MsgActTrigger_Test(void)
+{
+    HS_MATEntry_t MATable[HS_MAX_MSG_ACT_TYPES];
+
+    memset(MATable, 0, sizeof(MATable));
+
+    HS_AppData.MATablePtr = MATable;
+
+    MATable[0].EnableState = HS_MAT_STATE_ENABLED;
+    MATable[1].EnableState = HS_MAT_STATE_DISABLED;
+
+    /* Message Actions disabled */
+    HS_AppData.MsgActsState = HS_STATE_DISABLED;
+    UtAssert_BOOL_FALSE(HS_MsgActTrigger(0));
+
+    /* Index out of range, or entry disabled */
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+    UtAssert_BOOL_FALSE(HS_MsgActTrigger(HS_MAX_MSG_ACT_TYPES));
+    UtAssert_BOOL_FALSE(HS_MsgActTrigger(1));
+
+    UtAssert_STUB_COUNT(CFE_TIME_Compare, 0);
+
+    /* Still cooling down */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Compare), 1, CFE_TIME_A_LT_B);
+    UtAssert_BOOL_FALSE(HS_MsgActTrigger(0));
+
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 0);
+
+    /* Off cooldown, queued and cooldown started */
+    MATable[0].EnableState = HS_MAT_STATE_NOEVENT;
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Compare), 1, CFE_TIME_A_GT_B);
+    UtAssert_BOOL_TRUE(HS_MsgActTrigger(0));
+
+    UtAssert_STUB_COUNT(HS_MsgActEnqueue, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void HS_ValReportSend_Test(void)
+{
+    HS_ValReportInit(HS_TBL_NOTIFY_AMT);
+
+    /* Execute the function being tested */
+    HS_ValReportSend(HS_AMTVAL_ERR_CON, 1, 2, 3);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(HS_AppData.ValReportPkt.Payload.Result, HS_AMTVAL_ERR_CON);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.GoodCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.BadCount, 2);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.UnusedCount, 3);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
 void HS_ValidateXCTable_Test_UnusedTableEntry(void)
 {
     int32         Result;
@@ -2367,192 +3482,459 @@ void HS_ValidateXCTable_Test_UnusedTableEntry(void)
     Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_ValidateXCTable_Test_BufferNotNull(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
+
+    memset(XCTable, 0, sizeof(XCTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "ExeCount verify err: Entry = %%d, Err = %%d, Type = %%d, Name = %%s");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.XCTablePtr = XCTable;
+
+    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
+    {
+        HS_AppData.XCTablePtr[i].ResourceType = 99;
+        HS_AppData.XCTablePtr[i].NullTerm     = 1;
+    }
+
+    strncpy(HS_AppData.XCTablePtr[0].ResourceName, "ResourceName", OS_MAX_API_NAME);
+
+    /* Execute the function being tested */
+    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_XCTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == HS_XCTVAL_ERR_NUL, "Result == HS_XCTVAL_ERR_NUL");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_ValidateXCTable_Test_ResourceTypeNotValid(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
+
+    memset(XCTable, 0, sizeof(XCTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "ExeCount verify err: Entry = %%d, Err = %%d, Type = %%d, Name = %%s");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.XCTablePtr = XCTable;
+
+    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
+    {
+        HS_AppData.XCTablePtr[i].ResourceType = 99;
+        HS_AppData.XCTablePtr[i].NullTerm     = 0;
+    }
+
+    /* take all branches for "Resource Type is not valid" */
+    HS_AppData.XCTablePtr[0].ResourceType = HS_XCT_TYPE_APP_MAIN;
+    HS_AppData.XCTablePtr[1].ResourceType = HS_XCT_TYPE_APP_CHILD;
+    HS_AppData.XCTablePtr[2].ResourceType = HS_XCT_TYPE_DEVICE;
+    HS_AppData.XCTablePtr[3].ResourceType = HS_XCT_TYPE_ISR;
+
+    strncpy(HS_AppData.XCTablePtr[0].ResourceName, "ResourceName", OS_MAX_API_NAME);
+
+    /* Execute the function being tested */
+    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_XCTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == HS_XCTVAL_ERR_TYPE, "Result == HS_XCTVAL_ERR_TYPE");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_ValidateXCTable_Test_EntryGood(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
+
+    memset(XCTable, 0, sizeof(XCTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.XCTablePtr = XCTable;
+
+    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
+    {
+        HS_AppData.XCTablePtr[i].ResourceType = HS_XCT_TYPE_APP_MAIN;
+        HS_AppData.XCTablePtr[i].NullTerm     = 0;
+    }
+
+    /* Execute the function being tested */
+    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_ValidateXCTable_Test_Null(void)
+{
+    int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error in XC Table Validation. Table is null.");
+
+    /* Execute the function being tested */
+    Result = HS_ValidateXCTable(NULL);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XC_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_ValidateMMTable_Test_EntryGood(void)
+{
+    int32         Result;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_MMTEntry_t MMTable[HS_MAX_MONITORED_MEM];
+
+    memset(MMTable, 0, sizeof(MMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "MemMon verify results: good = %%d, bad = %%d, unused = %%d");
+
+    MMTable[0].ResourceType = HS_MMT_TYPE_POOL;
+    MMTable[0].MinContigPct = 100;
+    MMTable[0].ActionType   = HS_MMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES;
+    memset(MMTable[0].AppName, 'A', sizeof(MMTable[0].AppName) - 1);
+    MMTable[1].ResourceType = HS_MMT_TYPE_HEAP;
+    MMTable[1].ActionType   = HS_MMT_ACT_EVENT;
+
+    /* Execute the function being tested */
+    Result = HS_ValidateMMTable(MMTable);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_ValidateMMTable_Test_EntryErrors(void)
+{
+    int32         Result;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_MMTEntry_t MMTable[HS_MAX_MONITORED_MEM];
+
+    memset(MMTable, 0, sizeof(MMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "MemMon verify err: Entry = %%d, Err = %%d, Type = %%d, Action = %%d, Pct = %%d");
+
+    /* Only the first error is reported */
+    MMTable[0].ResourceType = 99;
+    MMTable[1].ResourceType = HS_MMT_TYPE_HEAP;
+    MMTable[1].ActionType   = HS_MMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
+    MMTable[2].ResourceType = HS_MMT_TYPE_POOL;
+    MMTable[2].MinContigPct = 101;
+    MMTable[3].ResourceType = HS_MMT_TYPE_POOL;
+
+    /* Execute the function being tested */
+    Result = HS_ValidateMMTable(MMTable);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MMTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
         strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MMTVAL_INF_EID);
+
+    UtAssert_True(Result == HS_MMTVAL_ERR_TYPE, "Result == HS_MMTVAL_ERR_TYPE");
+
+    /* Each check on its own */
+    MMTable[0].ResourceType = HS_MMT_TYPE_NOTYPE;
+    UtAssert_INT32_EQ(HS_ValidateMMTable(MMTable), HS_MMTVAL_ERR_ACT);
+
+    MMTable[1].ResourceType = HS_MMT_TYPE_NOTYPE;
+    UtAssert_INT32_EQ(HS_ValidateMMTable(MMTable), HS_MMTVAL_ERR_PCT);
+
+    /* Pools need an application name, empty or unterminated */
+    MMTable[2].ResourceType = HS_MMT_TYPE_NOTYPE;
+    UtAssert_INT32_EQ(HS_ValidateMMTable(MMTable), HS_MMTVAL_ERR_NAME);
+
+    memset(MMTable[3].AppName, 'A', sizeof(MMTable[3].AppName));
+    UtAssert_INT32_EQ(HS_ValidateMMTable(MMTable), HS_MMTVAL_ERR_NAME);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 10, "CFE_EVS_SendEvent was called %u time(s), expected 10",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_ValidateMMTable_Test_Null(void)
+{
+    int32 Result;
+
+    /* Execute the function being tested */
+    Result = HS_ValidateMMTable(NULL);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MM_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 }
 
-void HS_ValidateXCTable_Test_BufferNotNull(void)
+void HS_ValidateMFTable_Test_EntryGood(void)
 {
     int32         Result;
-    uint32        i;
     int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
-
-    memset(XCTable, 0, sizeof(XCTable));
+    char          ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_MFTEntry_t MFTable[HS_MAX_MONITORED_MSGS];
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify err: Entry = %%d, Err = %%d, Type = %%d, Name = %%s");
-    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
+    memset(MFTable, 0, sizeof(MFTable));
 
-    HS_AppData.XCTablePtr = XCTable;
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "MsgMon verify results: good = %%d, bad = %%d, unused = %%d");
 
-    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
-    {
-        HS_AppData.XCTablePtr[i].ResourceType = 99;
-        HS_AppData.XCTablePtr[i].NullTerm     = 1;
-    }
+    MFTable[0].MsgId      = CFE_SB_ValueToMsgId(0x1801);
+    MFTable[0].MaxAgeMsec = 1000;
+    MFTable[0].ActionType = HS_MFT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES;
+    MFTable[1].MsgId      = CFE_SB_ValueToMsgId(0x1801 + HS_VALIDATE_HASH_BUCKETS);
+    MFTable[1].MaxAgeMsec = 1;
+    MFTable[1].ActionType = HS_MFT_ACT_EVENT;
 
-    strncpy(HS_AppData.XCTablePtr[0].ResourceName, "ResourceName", OS_MAX_API_NAME);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
 
     /* Execute the function being tested */
-    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
+    Result = HS_ValidateMFTable(MFTable);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MFTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_XCTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-
-    strCmpResult =
-        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
-    UtAssert_True(Result == HS_XCTVAL_ERR_NUL, "Result == HS_XCTVAL_ERR_NUL");
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Table, HS_TBL_NOTIFY_MFT);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.GoodCount, 2);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.UnusedCount, HS_MAX_MONITORED_MSGS - 2);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 }
 
-void HS_ValidateXCTable_Test_ResourceTypeNotValid(void)
+void HS_ValidateMFTable_Test_EntryErrors(void)
 {
     int32         Result;
-    uint32        i;
     int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
-
-    memset(XCTable, 0, sizeof(XCTable));
-
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify err: Entry = %%d, Err = %%d, Type = %%d, Name = %%s");
-    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
+    char          ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_MFTEntry_t MFTable[HS_MAX_MONITORED_MSGS];
 
-    HS_AppData.XCTablePtr = XCTable;
+    memset(MFTable, 0, sizeof(MFTable));
 
-    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
-    {
-        HS_AppData.XCTablePtr[i].ResourceType = 99;
-        HS_AppData.XCTablePtr[i].NullTerm     = 0;
-    }
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "MsgMon verify err: Entry = %%d, Err = %%d, MID = 0x%%08X, Action = %%d");
 
-    /* take all branches for "Resource Type is not valid" */
-    HS_AppData.XCTablePtr[0].ResourceType = HS_XCT_TYPE_APP_MAIN;
-    HS_AppData.XCTablePtr[1].ResourceType = HS_XCT_TYPE_APP_CHILD;
-    HS_AppData.XCTablePtr[2].ResourceType = HS_XCT_TYPE_DEVICE;
-    HS_AppData.XCTablePtr[3].ResourceType = HS_XCT_TYPE_ISR;
+    /* Only the first error is reported */
+    MFTable[0].MsgId      = CFE_SB_INVALID_MSG_ID;
+    MFTable[0].MaxAgeMsec = 1000;
+    MFTable[1].MsgId      = CFE_SB_ValueToMsgId(0x1801);
+    MFTable[1].MaxAgeMsec = 1000;
+    MFTable[1].ActionType = HS_MFT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
 
-    strncpy(HS_AppData.XCTablePtr[0].ResourceName, "ResourceName", OS_MAX_API_NAME);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_IsValidMsgId), 1, false);
 
     /* Execute the function being tested */
-    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
+    Result = HS_ValidateMFTable(MFTable);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MFTVAL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_XCTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-
-    strCmpResult =
-        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MFTVAL_INF_EID);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+    UtAssert_True(Result == HS_MFTVAL_ERR_ID, "Result == HS_MFTVAL_ERR_ID");
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.BadCount, 2);
 
-    UtAssert_True(Result == HS_XCTVAL_ERR_TYPE, "Result == HS_XCTVAL_ERR_TYPE");
+    /* The action check on its own */
+    MFTable[0].MaxAgeMsec = 0;
+    UtAssert_INT32_EQ(HS_ValidateMFTable(MFTable), HS_MFTVAL_ERR_ACT);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 4, "CFE_EVS_SendEvent was called %u time(s), expected 4",
                   call_count_CFE_EVS_SendEvent);
 }
 
-void HS_ValidateXCTable_Test_EntryGood(void)
+void HS_ValidateMFTable_Test_Duplicates(void)
 {
     int32         Result;
-    uint32        i;
     int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
+    char          ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_MFTEntry_t MFTable[HS_MAX_MONITORED_MSGS];
 
-    memset(XCTable, 0, sizeof(XCTable));
+    memset(MFTable, 0, sizeof(MFTable));
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "MsgMon verify err: Entry = %%d, Err = %%d, MID = 0x%%08X, First Entry = %%d");
 
-    HS_AppData.XCTablePtr = XCTable;
+    /* Entries 0 and 1 share a validation hash bucket, entry 2 repeats entry 1 */
+    MFTable[0].MsgId      = CFE_SB_ValueToMsgId(0x1801);
+    MFTable[0].MaxAgeMsec = 1000;
+    MFTable[1].MsgId      = CFE_SB_ValueToMsgId(0x1801 + HS_VALIDATE_HASH_BUCKETS);
+    MFTable[1].MaxAgeMsec = 1000;
+    MFTable[2].MsgId      = CFE_SB_ValueToMsgId(0x1801 + HS_VALIDATE_HASH_BUCKETS);
+    MFTable[2].MaxAgeMsec = 500;
 
-    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
-    {
-        HS_AppData.XCTablePtr[i].ResourceType = HS_XCT_TYPE_APP_MAIN;
-        HS_AppData.XCTablePtr[i].NullTerm     = 0;
-    }
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
 
     /* Execute the function being tested */
-    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
+    Result = HS_ValidateMFTable(MFTable);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(Result, HS_MFTVAL_ERR_DUP);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MFTVAL_DUP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
-    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MFTVAL_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Table, HS_TBL_NOTIFY_MFT);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.GoodCount, 2);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.BadCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.PairCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[0].Entry, 2);
+    UtAssert_UINT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[0].FirstEntry, 1);
+    UtAssert_INT32_EQ(HS_AppData.ValReportPkt.Payload.Pairs[0].Result, HS_MFTVAL_ERR_DUP);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
 }
 
-void HS_ValidateXCTable_Test_Null(void)
+void HS_ValidateMFTable_Test_Null(void)
 {
     int32 Result;
-    int32 strCmpResult;
-    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error in XC Table Validation. Table is null.");
 
     /* Execute the function being tested */
-    Result = HS_ValidateXCTable(NULL);
+    Result = HS_ValidateMFTable(NULL);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XC_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MF_TBL_NULL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
     UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -2781,6 +4163,42 @@ void HS_ValidateMATable_Test_LengthTooHigh(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_ValidateMATable_Test_BadSequence(void)
+{
+    int32          Result;
+    uint32         i;
+    CFE_SB_MsgId_t TestMsgId;
+    size_t         MsgSize;
+    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
+
+    memset(MATable, 0, sizeof(MATable));
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    MsgSize   = sizeof(HS_NoopCmd_t);
+
+    HS_AppData.MATablePtr = MATable;
+
+    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
+    {
+        HS_AppData.MATablePtr[i].EnableState = HS_MAT_STATE_ENABLED;
+
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+    }
+
+    /* Entry 1 links past the end of the table */
+    HS_AppData.MATablePtr[1].NextAction = HS_MAX_MSG_ACT_TYPES + 1;
+
+    /* Execute the function being tested */
+    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MATVAL_INF_EID);
+    UtAssert_INT32_EQ(Result, HS_MATVAL_ERR_NXT);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
 void HS_ValidateMATable_Test_EntryGood(void)
 {
     int32          Result;
@@ -2828,6 +4246,71 @@ void HS_ValidateMATable_Test_EntryGood(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void HS_ValidateMASequences_Test(void)
+{
+    HS_MATEntry_t MATable[HS_MAX_MSG_ACT_TYPES];
+    uint8         SeqState[HS_MAX_MSG_ACT_TYPES];
+    uint32        i;
+
+    memset(MATable, 0, sizeof(MATable));
+
+    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
+    {
+        MATable[i].EnableState = HS_MAT_STATE_ENABLED;
+    }
+
+    /* No sequence */
+    HS_ValidateMASequences(MATable, SeqState);
+    UtAssert_UINT32_EQ(SeqState[0], HS_MASEQ_GOOD);
+    UtAssert_UINT32_EQ(SeqState[HS_MAX_MSG_ACT_TYPES - 1], HS_MASEQ_GOOD);
+
+    /* 0 -> 2 -> last, which ends the sequence */
+    MATable[0].NextAction = 3;
+    MATable[2].NextAction = HS_MAX_MSG_ACT_TYPES;
+    HS_ValidateMASequences(MATable, SeqState);
+    UtAssert_UINT32_EQ(SeqState[0], HS_MASEQ_GOOD);
+    UtAssert_UINT32_EQ(SeqState[2], HS_MASEQ_GOOD);
+
+    /* Last links out of the table, which every entry leading to it shares */
+    MATable[HS_MAX_MSG_ACT_TYPES - 1].NextAction = HS_MAX_MSG_ACT_TYPES + 1;
+    HS_ValidateMASequences(MATable, SeqState);
+    UtAssert_UINT32_EQ(SeqState[0], HS_MASEQ_BAD);
+    UtAssert_UINT32_EQ(SeqState[1], HS_MASEQ_GOOD);
+    UtAssert_UINT32_EQ(SeqState[2], HS_MASEQ_BAD);
+    UtAssert_UINT32_EQ(SeqState[HS_MAX_MSG_ACT_TYPES - 1], HS_MASEQ_BAD);
+
+    /* Last links back to 2, which loops */
+    MATable[HS_MAX_MSG_ACT_TYPES - 1].NextAction = 3;
+    HS_ValidateMASequences(MATable, SeqState);
+    UtAssert_UINT32_EQ(SeqState[0], HS_MASEQ_BAD);
+    UtAssert_UINT32_EQ(SeqState[2], HS_MASEQ_BAD);
+    UtAssert_UINT32_EQ(SeqState[HS_MAX_MSG_ACT_TYPES - 1], HS_MASEQ_BAD);
+
+    /* An entry can't follow itself */
+    MATable[1].NextAction = 2;
+    HS_ValidateMASequences(MATable, SeqState);
+    UtAssert_UINT32_EQ(SeqState[1], HS_MASEQ_BAD);
+
+    /* Steps must be enabled, with or without an event */
+    memset(MATable, 0, sizeof(MATable));
+    MATable[0].EnableState = HS_MAT_STATE_ENABLED;
+    MATable[0].NextAction  = 2;
+    MATable[1].EnableState = HS_MAT_STATE_NOEVENT;
+    MATable[1].NextAction  = 4;
+    MATable[2].EnableState = HS_MAT_STATE_ENABLED;
+    MATable[2].NextAction  = 2;
+    MATable[3].EnableState = HS_MAT_STATE_ENABLED;
+    HS_ValidateMASequences(MATable, SeqState);
+    UtAssert_UINT32_EQ(SeqState[0], HS_MASEQ_GOOD);
+    UtAssert_UINT32_EQ(SeqState[2], HS_MASEQ_GOOD);
+
+    MATable[3].EnableState = HS_MAT_STATE_DISABLED;
+    HS_ValidateMASequences(MATable, SeqState);
+    UtAssert_UINT32_EQ(SeqState[0], HS_MASEQ_BAD);
+    UtAssert_UINT32_EQ(SeqState[1], HS_MASEQ_BAD);
+    UtAssert_UINT32_EQ(SeqState[2], HS_MASEQ_BAD);
+}
+
 void HS_ValidateMATable_Test_Null(void)
 {
     int32 Result;
@@ -2879,6 +4362,177 @@ void HS_SetCDSData_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+int32 HS_MONITORS_TEST_CFE_ES_RestoreFromCDSHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                                 const UT_StubContext_t *Context)
+{
+    HS_CDSLadders_t *LaddersPtr = UT_Hook_GetArgValueByName(Context, "RestoreToMemory", HS_CDSLadders_t *);
+
+    memcpy(LaddersPtr, UserObj, sizeof(*LaddersPtr));
+
+    return StubRetcode;
+}
+
+void HS_LadderInit_Test_New(void)
+{
+    HS_AppData.CDSState                     = HS_STATE_ENABLED;
+    HS_AppData.CDSLadders.Ladder[2].Rung    = 1;
+    HS_AppData.CDSLadders.Ladder[2].AppHash = 5;
+
+    /* Execute the function being tested */
+    HS_LadderInit();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.LadderCDSState, HS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[2].Rung, 0);
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[2].AppHash, 0);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, 1);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void HS_LadderInit_Test_Restore(void)
+{
+    HS_CDSLadders_t Stored;
+    uint32          TableIndex;
+
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++)
+    {
+        Stored.Ladder[TableIndex].AppHash = 0;
+        Stored.Ladder[TableIndex].Rung    = 0;
+        Stored.Ladder[TableIndex].RungNot = (uint16)~0;
+    }
+    Stored.Ladder[1].AppHash = 7;
+    Stored.Ladder[1].Rung    = 2;
+    Stored.Ladder[1].RungNot = (uint16)~2;
+
+    HS_AppData.CDSState = HS_STATE_ENABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetHookFunction(UT_KEY(CFE_ES_RestoreFromCDS), HS_MONITORS_TEST_CFE_ES_RestoreFromCDSHook, &Stored);
+
+    /* Execute the function being tested */
+    HS_LadderInit();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.LadderCDSState, HS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[1].AppHash, 7);
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[1].Rung, 2);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void HS_LadderInit_Test_Corrupt(void)
+{
+    HS_CDSLadders_t Stored;
+
+    memset(&Stored, 0, sizeof(Stored));
+
+    HS_AppData.CDSState                   = HS_STATE_ENABLED;
+    HS_AppData.CDSData.ResetsPerformed    = 2;
+    HS_AppData.CDSData.ResetsPerformedNot = (uint16)~2;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetHookFunction(UT_KEY(CFE_ES_RestoreFromCDS), HS_MONITORS_TEST_CFE_ES_RestoreFromCDSHook, &Stored);
+
+    /* Execute the function being tested */
+    HS_LadderInit();
+
+    /* Verify results, the reset counts are left alone */
+    UtAssert_BOOL_FALSE(HS_CDSLaddersCorrupt());
+    UtAssert_UINT32_EQ(HS_AppData.CDSData.ResetsPerformed, 2);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CDS_CORRUPT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void HS_LadderInit_Test_RestoreError(void)
+{
+    HS_AppData.CDSState = HS_STATE_ENABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RestoreFromCDS), -1);
+
+    /* Execute the function being tested */
+    HS_LadderInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(HS_CDSLaddersCorrupt());
+    UtAssert_UINT32_EQ(HS_AppData.LadderCDSState, HS_STATE_ENABLED);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CDS_RESTORE_ERR_EID);
+}
+
+void HS_LadderInit_Test_RegisterError(void)
+{
+    HS_AppData.CDSState = HS_STATE_ENABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), -1);
+
+    /* Execute the function being tested */
+    HS_LadderInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(HS_CDSLaddersCorrupt());
+    UtAssert_UINT32_EQ(HS_AppData.LadderCDSState, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
+void HS_LadderInit_Test_NoCDS(void)
+{
+    HS_AppData.CDSState = HS_STATE_DISABLED;
+
+    /* Execute the function being tested */
+    HS_LadderInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(HS_CDSLaddersCorrupt());
+    UtAssert_UINT32_EQ(HS_AppData.LadderCDSState, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
+void HS_SetCDSLadder_Test(void)
+{
+    HS_AppData.LadderCDSState                  = HS_STATE_ENABLED;
+    HS_AppData.AppMonState[1].RecoveryCheckIns = 4;
+
+    /* Execute the function being tested */
+    HS_SetCDSLadder(1, 0x12345678, 2);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[1].AppHash, 0x12345678);
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[1].Rung, 2);
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[1].RungNot, (uint16)~2);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[1].EscalationRung, 2);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[1].RecoveryCheckIns, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+
+    /* Not stored without a CDS */
+    HS_AppData.LadderCDSState = HS_STATE_DISABLED;
+    HS_SetCDSLadder(1, 0x12345678, 0);
+
+    UtAssert_UINT32_EQ(HS_AppData.CDSLadders.Ladder[1].Rung, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+}
+
+void HS_CDSLaddersCorrupt_Test(void)
+{
+    HS_AppData.CDSData.MaxResets = 3;
+
+    /* Execute the function being tested, after a clean initialization */
+    HS_InitCDSLadders();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(HS_CDSLaddersCorrupt());
+    UtAssert_UINT32_EQ(HS_AppData.CDSData.MaxResets, 3);
+
+    HS_AppData.CDSLadders.Ladder[HS_MAX_MONITORED_APPS - 1].Rung = 1;
+    UtAssert_BOOL_TRUE(HS_CDSLaddersCorrupt());
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -2890,6 +4544,8 @@ void UtTest_Setup(void)
                "HS_MonitorApplications_Test_AppNameNotFoundDebugEvent");
     UtTest_Add(HS_MonitorApplications_Test_GetExeCountFailure, HS_Test_Setup, HS_Test_TearDown,
                "HS_MonitorApplications_Test_GetExeCountFailure");
+    UtTest_Add(HS_MonitorApplications_Test_CheckInStats, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorApplications_Test_CheckInStats");
     UtTest_Add(HS_MonitorApplications_Test_ProcessorResetError, HS_Test_Setup, HS_Test_TearDown,
                "HS_MonitorApplications_Test_ProcessorResetError");
     UtTest_Add(HS_MonitorApplications_Test_ProcessorResetActionLimitError, HS_Test_Setup, HS_Test_TearDown,
@@ -2918,6 +4574,14 @@ void UtTest_Setup(void)
                "HS_MonitorApplications_Test_MsgActsErrorDefaultNoEvent");
     UtTest_Add(HS_MonitorApplications_CheckInCountdownNotZero, HS_Test_Setup, HS_Test_TearDown,
                "HS_MonitorApplications_CheckInCountdownNotZero");
+    UtTest_Add(HS_MonitorApplications_Test_Escalate, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorApplications_Test_Escalate");
+    UtTest_Add(HS_MonitorApplications_Test_EscalatedAction, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorApplications_Test_EscalatedAction");
+    UtTest_Add(HS_MonitorApplications_Test_EscalationTop, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorApplications_Test_EscalationTop");
+    UtTest_Add(HS_MonitorApplications_Test_EscalationRecovered, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorApplications_Test_EscalationRecovered");
 
     UtTest_Add(HS_MonitorEvent_Test_AppName, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorEvent_Test_AppName");
     UtTest_Add(HS_MonitorEvent_Test_ProcErrorReset, HS_Test_Setup, HS_Test_TearDown,
@@ -2938,6 +4602,8 @@ void UtTest_Setup(void)
     UtTest_Add(HS_MonitorEvent_Test_MsgActsError, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorEvent_Test_MsgActsError");
     UtTest_Add(HS_MonitorEvent_Test_MsgActsErrorNoEvent, HS_Test_Setup, HS_Test_TearDown,
                "HS_MonitorEvent_Test_MsgActsErrorNoEvent");
+    UtTest_Add(HS_MonitorEvent_Test_MsgActsCoolingDown, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorEvent_Test_MsgActsCoolingDown");
     UtTest_Add(HS_MonitorEvent_Test_MsgActsCoolDown, HS_Test_Setup, HS_Test_TearDown,
                "HS_MonitorEvent_Test_MsgActsCoolDown");
     UtTest_Add(HS_MonitorEvent_Test_MsgActsMATDisabled, HS_Test_Setup, HS_Test_TearDown,
@@ -2966,6 +4632,20 @@ void UtTest_Setup(void)
     UtTest_Add(HS_MonitorUtilization_Test_LowUtilIndex, HS_Test_Setup, HS_Test_TearDown,
                "HS_MonitorUtilization_Test_LowUtilIndex");
 
+    UtTest_Add(HS_MonitorMemory_Test_Event, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorMemory_Test_Event");
+    UtTest_Add(HS_MonitorMemory_Test_FragmentedMsgActs, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorMemory_Test_FragmentedMsgActs");
+    UtTest_Add(HS_MonitorMemory_Test_MsgActsDisabled, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorMemory_Test_MsgActsDisabled");
+    UtTest_Add(HS_MonitorMemory_Test_ReadError, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorMemory_Test_ReadError");
+    UtTest_Add(HS_MemMonRead_Test_Pool, HS_Test_Setup, HS_Test_TearDown, "HS_MemMonRead_Test_Pool");
+    UtTest_Add(HS_MemMonRead_Test_Heap, HS_Test_Setup, HS_Test_TearDown, "HS_MemMonRead_Test_Heap");
+
+    UtTest_Add(HS_MonitorMessages_Test_Arrival, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorMessages_Test_Arrival");
+    UtTest_Add(HS_MonitorMessages_Test_Stale, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorMessages_Test_Stale");
+    UtTest_Add(HS_MonitorMessages_Test_MsgActs, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorMessages_Test_MsgActs");
+    UtTest_Add(HS_MsgMonSubscribe_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MsgMonSubscribe_Test");
+
     UtTest_Add(HS_ValidateAMTable_Test_UnusedTableEntryCycleCountZero, HS_Test_Setup, HS_Test_TearDown,
                "HS_ValidateAMTable_Test_UnusedTableEntryCycleCountZero");
     UtTest_Add(HS_ValidateAMTable_Test_UnusedTableEntryActionTypeNOACT, HS_Test_Setup, HS_Test_TearDown,
@@ -2975,6 +4655,10 @@ void UtTest_Setup(void)
     UtTest_Add(HS_ValidateAMTable_Test_ActionTypeNotValid, HS_Test_Setup, HS_Test_TearDown,
                "HS_ValidateAMTable_Test_ActionTypeNotValid");
     UtTest_Add(HS_ValidateAMTable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateAMTable_Test_EntryGood");
+    UtTest_Add(HS_ValidateAMTable_Test_Duplicates, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateAMTable_Test_Duplicates");
+    UtTest_Add(HS_ValidateAMTable_Test_BadEscalation, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateAMTable_Test_BadEscalation");
     UtTest_Add(HS_ValidateAMTable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateAMTable_Test_Null");
 
     UtTest_Add(HS_ValidateEMTable_Test_UnusedTableEntryEventIDZero, HS_Test_Setup, HS_Test_TearDown,
@@ -2986,8 +4670,17 @@ void UtTest_Setup(void)
     UtTest_Add(HS_ValidateEMTable_Test_ActionTypeNotValid, HS_Test_Setup, HS_Test_TearDown,
                "HS_ValidateEMTable_Test_ActionTypeNotValid");
     UtTest_Add(HS_ValidateEMTable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateEMTable_Test_EntryGood");
+    UtTest_Add(HS_ValidateEMTable_Test_Duplicates, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateEMTable_Test_Duplicates");
     UtTest_Add(HS_ValidateEMTable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateEMTable_Test_Null");
 
+    UtTest_Add(HS_ValReportAddPair_Test_Overflow, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValReportAddPair_Test_Overflow");
+    UtTest_Add(HS_ValReportSend_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ValReportSend_Test");
+    UtTest_Add(HS_MsgActReady_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MsgActReady_Test");
+    UtTest_Add(HS_MsgActStartCooldown_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MsgActStartCooldown_Test");
+    UtTest_Add(HS_MsgActTrigger_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MsgActTrigger_Test");
+
     UtTest_Add(HS_ValidateXCTable_Test_UnusedTableEntry, HS_Test_Setup, HS_Test_TearDown,
                "HS_ValidateXCTable_Test_UnusedTableEntry");
     UtTest_Add(HS_ValidateXCTable_Test_BufferNotNull, HS_Test_Setup, HS_Test_TearDown,
@@ -2997,6 +4690,18 @@ void UtTest_Setup(void)
     UtTest_Add(HS_ValidateXCTable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateXCTable_Test_EntryGood");
     UtTest_Add(HS_ValidateXCTable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateXCTable_Test_Null");
 
+    UtTest_Add(HS_ValidateMMTable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateMMTable_Test_EntryGood");
+    UtTest_Add(HS_ValidateMMTable_Test_EntryErrors, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateMMTable_Test_EntryErrors");
+    UtTest_Add(HS_ValidateMMTable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateMMTable_Test_Null");
+
+    UtTest_Add(HS_ValidateMFTable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateMFTable_Test_EntryGood");
+    UtTest_Add(HS_ValidateMFTable_Test_EntryErrors, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateMFTable_Test_EntryErrors");
+    UtTest_Add(HS_ValidateMFTable_Test_Duplicates, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateMFTable_Test_Duplicates");
+    UtTest_Add(HS_ValidateMFTable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateMFTable_Test_Null");
+
     UtTest_Add(HS_ValidateMATable_Test_UnusedTableEntry, HS_Test_Setup, HS_Test_TearDown,
                "HS_ValidateMATable_Test_UnusedTableEntry");
     UtTest_Add(HS_ValidateMATable_Test_InvalidEnableState, HS_Test_Setup, HS_Test_TearDown,
@@ -3005,8 +4710,20 @@ void UtTest_Setup(void)
                "HS_ValidateMATable_Test_MessageIDTooHigh");
     UtTest_Add(HS_ValidateMATable_Test_LengthTooHigh, HS_Test_Setup, HS_Test_TearDown,
                "HS_ValidateMATable_Test_LengthTooHigh");
+    UtTest_Add(HS_ValidateMATable_Test_BadSequence, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateMATable_Test_BadSequence");
     UtTest_Add(HS_ValidateMATable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateMATable_Test_EntryGood");
     UtTest_Add(HS_ValidateMATable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateMATable_Test_Null");
+    UtTest_Add(HS_ValidateMASequences_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateMASequences_Test");
 
     UtTest_Add(HS_SetCDSData_Test, HS_Test_Setup, HS_Test_TearDown, "HS_SetCDSData_Test");
+    UtTest_Add(HS_LadderInit_Test_New, HS_Test_Setup, HS_Test_TearDown, "HS_LadderInit_Test_New");
+    UtTest_Add(HS_LadderInit_Test_Restore, HS_Test_Setup, HS_Test_TearDown, "HS_LadderInit_Test_Restore");
+    UtTest_Add(HS_LadderInit_Test_Corrupt, HS_Test_Setup, HS_Test_TearDown, "HS_LadderInit_Test_Corrupt");
+    UtTest_Add(HS_LadderInit_Test_RestoreError, HS_Test_Setup, HS_Test_TearDown, "HS_LadderInit_Test_RestoreError");
+    UtTest_Add(HS_LadderInit_Test_RegisterError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_LadderInit_Test_RegisterError");
+    UtTest_Add(HS_LadderInit_Test_NoCDS, HS_Test_Setup, HS_Test_TearDown, "HS_LadderInit_Test_NoCDS");
+    UtTest_Add(HS_SetCDSLadder_Test, HS_Test_Setup, HS_Test_TearDown, "HS_SetCDSLadder_Test");
+    UtTest_Add(HS_CDSLaddersCorrupt_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CDSLaddersCorrupt_Test");
 }
@@ -0,0 +1,359 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "hs_msgacts.h"
+#include "hs_monitors.h"
+#include "hs_app.h"
+#include "hs_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define HS_MSGACTS_TEST_FULL (HS_MSG_ACT_BURST * HS_MSG_ACT_TOKEN_UNITS)
+
+HS_MATEntry_t HS_MSGACTS_TEST_MATable[HS_MAX_MSG_ACT_TYPES];
+
+void HS_MSGACTS_TEST_CFE_TIME_SubtractHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *Elapsed = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, *Elapsed);
+}
+
+int32 HS_MSGACTS_TEST_CFE_TIME_AddHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *Delay = UserObj;
+
+    *Delay = UT_Hook_GetArgValueByName(Context, "Time2", CFE_TIME_SysTime_t);
+
+    return StubRetcode;
+}
+
+void HS_MSGACTS_TEST_HS_MsgActTriggerHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 MsgActsIndex = UT_Hook_GetArgValueByName(Context, "MsgActsIndex", uint32);
+    bool   Triggered    = true;
+
+    HS_MsgActEnqueue(MsgActsIndex);
+
+    UT_Stub_SetReturnValue(FuncKey, Triggered);
+}
+
+void HS_MSGACTS_TEST_Setup(void)
+{
+    HS_Test_Setup();
+
+    memset(HS_MSGACTS_TEST_MATable, 0, sizeof(HS_MSGACTS_TEST_MATable));
+    HS_AppData.MATablePtr = HS_MSGACTS_TEST_MATable;
+}
+
+void Test_HS_MsgActQueueInit(void)
+{
+    /* Test function for:
+     * void HS_MsgActQueueInit(void)
+     */
+
+    HS_AppData.MsgActQueue.Count           = 3;
+    HS_AppData.MsgActQueue.Tokens          = 0;
+    HS_AppData.MsgActQueue.QueuedCount     = 4;
+    HS_AppData.MsgActQueue.SuppressedCount = 5;
+
+    HS_MsgActQueueInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Count, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Tokens, HS_MSGACTS_TEST_FULL);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.QueuedCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.SuppressedCount, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 1);
+}
+
+void Test_HS_MsgActEnqueue_Order(void)
+{
+    /* Test function for:
+     * void HS_MsgActEnqueue(uint32 MsgActsIndex)
+     */
+
+    HS_MSGACTS_TEST_MATable[0].Priority = 2;
+    HS_MSGACTS_TEST_MATable[1].Priority = 0;
+    HS_MSGACTS_TEST_MATable[2].Priority = 2;
+    HS_MSGACTS_TEST_MATable[3].Priority = 1;
+
+    HS_MsgActEnqueue(0);
+    HS_MsgActEnqueue(1);
+    HS_MsgActEnqueue(2);
+    HS_MsgActEnqueue(3);
+
+    /* Next to send is last; equal priorities keep their queued order */
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Count, 4);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Entries[3], 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Entries[2], 3);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Entries[1], 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Entries[0], 2);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.QueuedCount, 4);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.SuppressedCount, 0);
+}
+
+void Test_HS_MsgActEnqueue_Full(void)
+{
+    /* Test function for:
+     * void HS_MsgActEnqueue(uint32 MsgActsIndex)
+     */
+
+    uint32 i;
+
+    HS_MSGACTS_TEST_MATable[0].Priority = 5;
+    HS_MSGACTS_TEST_MATable[1].Priority = 3;
+    HS_MSGACTS_TEST_MATable[2].Priority = 5;
+
+    /* Fill with a single less urgent action followed by more urgent ones */
+    HS_MsgActEnqueue(0);
+    for (i = 1; i < HS_MSG_ACT_QUEUE_DEPTH; i++)
+    {
+        HS_MsgActEnqueue(1);
+    }
+
+    /* No more urgent than the least urgent queued action, so it is suppressed */
+    HS_MsgActEnqueue(2);
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Count, HS_MSG_ACT_QUEUE_DEPTH);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Entries[0], 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.QueuedCount, HS_MSG_ACT_QUEUE_DEPTH);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.SuppressedCount, 1);
+
+    /* More urgent, so the least urgent queued action makes room */
+    HS_MsgActEnqueue(1);
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Count, HS_MSG_ACT_QUEUE_DEPTH);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Entries[0], 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.QueuedCount, HS_MSG_ACT_QUEUE_DEPTH + 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.SuppressedCount, 2);
+}
+
+void Test_HS_MsgActQueueDrain(void)
+{
+    /* Test function for:
+     * void HS_MsgActQueueDrain(void)
+     */
+
+    HS_MSGACTS_TEST_MATable[1].Priority = 1;
+
+    HS_MsgActEnqueue(0);
+    HS_MsgActEnqueue(1);
+    HS_MsgActEnqueue(2);
+
+    /* Tokens for two sends, and no time has passed */
+    HS_AppData.MsgActQueue.Tokens = (2 * HS_MSG_ACT_TOKEN_UNITS) + 1;
+
+    HS_MsgActQueueDrain();
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Count, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Entries[0], 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Tokens, 1);
+
+    /* Empty bucket sends nothing */
+    HS_MsgActQueueDrain();
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 2);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Count, 1);
+}
+
+void Test_HS_MsgActQueueDrain_Sequence(void)
+{
+    /* Test function for:
+     * void HS_MsgActQueueDrain(void)
+     */
+
+    HS_MSGACTS_TEST_MATable[0].NextAction  = 2;
+    HS_MSGACTS_TEST_MATable[1].EnableState = HS_MAT_STATE_ENABLED;
+
+    UT_SetHandlerFunction(UT_KEY(HS_MsgActTrigger), HS_MSGACTS_TEST_HS_MsgActTriggerHandler, NULL);
+
+    HS_MsgActEnqueue(0);
+    HS_AppData.MsgActQueue.Tokens = HS_MSGACTS_TEST_FULL;
+
+    HS_MsgActQueueDrain();
+
+    /* Sending the first action schedules the next one */
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.StepCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Steps[0].MsgActsIndex, 1);
+
+    /* Due on the next cycle */
+    HS_MsgActQueueDrain();
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 2);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.StepCount, 0);
+    UtAssert_STUB_COUNT(HS_MsgActTrigger, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+}
+
+void Test_HS_MsgActQueueFlush(void)
+{
+    /* Test function for:
+     * void HS_MsgActQueueFlush(void)
+     */
+
+    HS_MsgActEnqueue(0);
+    HS_MsgActEnqueue(1);
+    HS_AppData.MsgActQueue.StepCount       = 2;
+    HS_AppData.MsgActQueue.SuppressedCount = 1;
+
+    HS_MsgActQueueFlush();
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Count, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.StepCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.SuppressedCount, 5);
+}
+
+void Test_HS_MsgActRefillTokens(void)
+{
+    /* Test function for:
+     * void HS_MsgActRefillTokens(void)
+     */
+
+    CFE_TIME_SysTime_t Elapsed;
+
+    memset(&Elapsed, 0, sizeof(Elapsed));
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), HS_MSGACTS_TEST_CFE_TIME_SubtractHandler, &Elapsed);
+
+    /* Partial second adds tokens at the configured rate */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 250000);
+    HS_AppData.MsgActQueue.Tokens = 0;
+
+    HS_MsgActRefillTokens();
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Tokens, 250 * HS_MSG_ACT_RATE);
+
+    /* Never more than a full bucket */
+    Elapsed.Seconds = HS_MSG_ACT_BURST - 1;
+    HS_AppData.MsgActQueue.Tokens = HS_MSGACTS_TEST_FULL - 1;
+
+    HS_MsgActRefillTokens();
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Tokens, HS_MSGACTS_TEST_FULL);
+
+    /* Long quiet period fills the bucket */
+    Elapsed.Seconds = 0xFFFFFFFF;
+    HS_AppData.MsgActQueue.Tokens = 0;
+
+    HS_MsgActRefillTokens();
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Tokens, HS_MSGACTS_TEST_FULL);
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 3);
+}
+
+void Test_HS_MsgActScheduleNext(void)
+{
+    /* Test function for:
+     * void HS_MsgActScheduleNext(uint32 MsgActsIndex)
+     */
+
+    CFE_TIME_SysTime_t Delay;
+    uint32             i;
+
+    memset(&Delay, 0, sizeof(Delay));
+    UT_SetHookFunction(UT_KEY(CFE_TIME_Add), HS_MSGACTS_TEST_CFE_TIME_AddHook, &Delay);
+
+    /* End of sequence */
+    HS_MsgActScheduleNext(0);
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.StepCount, 0);
+
+    /* Next step waits out its compiled delay */
+    HS_MSGACTS_TEST_MATable[1].NextAction                            = 3;
+    HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MAT)->MANextDelay[1].Seconds = 2;
+
+    HS_MsgActScheduleNext(1);
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.StepCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Steps[0].MsgActsIndex, 2);
+    UtAssert_UINT32_EQ(Delay.Seconds, 2);
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 1);
+
+    /* No free step slots ends the sequence */
+    for (i = 1; i < HS_MSG_ACT_MAX_PENDING_STEPS; i++)
+    {
+        HS_MsgActScheduleNext(1);
+    }
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.SuppressedCount, 0);
+
+    HS_MsgActScheduleNext(1);
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.StepCount, HS_MSG_ACT_MAX_PENDING_STEPS);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.SuppressedCount, 1);
+}
+
+void Test_HS_MsgActStepsDue(void)
+{
+    /* Test function for:
+     * void HS_MsgActStepsDue(void)
+     */
+
+    HS_AppData.MsgActQueue.Steps[0].MsgActsIndex = 1;
+    HS_AppData.MsgActQueue.Steps[1].MsgActsIndex = 2;
+    HS_AppData.MsgActQueue.Steps[2].MsgActsIndex = 3;
+    HS_AppData.MsgActQueue.StepCount             = 3;
+
+    /* First step isn't due yet, the rest are */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Compare), 1, CFE_TIME_A_LT_B);
+
+    /* One due step is triggered, the other can't be */
+    UT_SetDeferredRetcode(UT_KEY(HS_MsgActTrigger), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(HS_MsgActTrigger), 2, false);
+
+    HS_MsgActStepsDue();
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.StepCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.Steps[0].MsgActsIndex, 1);
+
+    /* A step that can't be triggered ends its sequence */
+    UtAssert_STUB_COUNT(HS_MsgActTrigger, 2);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActQueue.SuppressedCount, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Compare, 3);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_HS_MsgActQueueInit, HS_MSGACTS_TEST_Setup, HS_Test_TearDown, "Test_HS_MsgActQueueInit");
+    UtTest_Add(Test_HS_MsgActEnqueue_Order, HS_MSGACTS_TEST_Setup, HS_Test_TearDown, "Test_HS_MsgActEnqueue_Order");
+    UtTest_Add(Test_HS_MsgActEnqueue_Full, HS_MSGACTS_TEST_Setup, HS_Test_TearDown, "Test_HS_MsgActEnqueue_Full");
+    UtTest_Add(Test_HS_MsgActQueueDrain, HS_MSGACTS_TEST_Setup, HS_Test_TearDown, "Test_HS_MsgActQueueDrain");
+    UtTest_Add(Test_HS_MsgActQueueDrain_Sequence, HS_MSGACTS_TEST_Setup, HS_Test_TearDown,
+               "Test_HS_MsgActQueueDrain_Sequence");
+    UtTest_Add(Test_HS_MsgActQueueFlush, HS_MSGACTS_TEST_Setup, HS_Test_TearDown, "Test_HS_MsgActQueueFlush");
+    UtTest_Add(Test_HS_MsgActRefillTokens, HS_MSGACTS_TEST_Setup, HS_Test_TearDown, "Test_HS_MsgActRefillTokens");
+    UtTest_Add(Test_HS_MsgActScheduleNext, HS_MSGACTS_TEST_Setup, HS_Test_TearDown, "Test_HS_MsgActScheduleNext");
+    UtTest_Add(Test_HS_MsgActStepsDue, HS_MSGACTS_TEST_Setup, HS_Test_TearDown, "Test_HS_MsgActStepsDue");
+}
@@ -0,0 +1,417 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "hs_runtime.h"
+#include "hs_app.h"
+#include "hs_tbldefs.h"
+#include "hs_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+void Test_HS_RuntimeInit(void)
+{
+    /* Test function for:
+     * void HS_RuntimeInit(void)
+     */
+
+    HS_AppData.RuntimeActiveMask           = HS_TBL_NOTIFY_ALL;
+    HS_AppData.RuntimeStagedMask           = HS_TBL_NOTIFY_AMT;
+    HS_AppData.RuntimeBuf[0].AMTCompiled   = true;
+    HS_AppData.RuntimeBuf[1].EMActiveCount = 5;
+
+    HS_RuntimeInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeActiveMask, 0);
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeStagedMask, 0);
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeBuf[0].AMTCompiled, false);
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeBuf[1].EMActiveCount, 0);
+    UtAssert_ADDRESS_EQ(HS_AppData.AMTablePtr, HS_AppData.RuntimeBuf[0].AMTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.EMTablePtr, HS_AppData.RuntimeBuf[0].EMTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.MATablePtr, HS_AppData.RuntimeBuf[0].MATable);
+    UtAssert_ADDRESS_EQ(HS_AppData.XCTablePtr, HS_AppData.RuntimeBuf[0].XCTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.MMTablePtr, HS_AppData.RuntimeBuf[0].MMTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.MFTablePtr, HS_AppData.RuntimeBuf[0].MFTable);
+}
+
+void Test_HS_RuntimeStage(void)
+{
+    /* Test function for:
+     * HS_RuntimeBuf_t *HS_RuntimeStage(uint8 TblFlag)
+     */
+
+    HS_RuntimeInit();
+    HS_AppData.RuntimeActiveMask           = HS_TBL_NOTIFY_EMT;
+    HS_AppData.RuntimeBuf[0].AMTCompiled   = true;
+    HS_AppData.RuntimeBuf[0].AMActiveCount = 3;
+
+    /* Each table stages into its own inactive buffer */
+    UtAssert_ADDRESS_EQ(HS_RuntimeStage(HS_TBL_NOTIFY_AMT), &HS_AppData.RuntimeBuf[1]);
+    UtAssert_ADDRESS_EQ(HS_RuntimeStage(HS_TBL_NOTIFY_EMT), &HS_AppData.RuntimeBuf[0]);
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeStagedMask, HS_TBL_NOTIFY_AMT | HS_TBL_NOTIFY_EMT);
+
+    /* Nothing is copied from the active buffer */
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeBuf[1].AMTCompiled, false);
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeBuf[1].AMActiveCount, 0);
+}
+
+void Test_HS_RuntimeSwap(void)
+{
+    /* Test function for:
+     * void HS_RuntimeSwap(void)
+     */
+
+    HS_RuntimeInit();
+
+    /* Nothing staged, nothing swapped */
+    HS_RuntimeSwap();
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeActiveMask, 0);
+    UtAssert_ADDRESS_EQ(HS_AppData.AMTablePtr, HS_AppData.RuntimeBuf[0].AMTable);
+
+    /* Only the staged table changes buffer */
+    HS_RuntimeStage(HS_TBL_NOTIFY_AMT);
+    HS_RuntimeSwap();
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeActiveMask, HS_TBL_NOTIFY_AMT);
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeStagedMask, 0);
+    UtAssert_ADDRESS_EQ(HS_AppData.AMTablePtr, HS_AppData.RuntimeBuf[1].AMTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.EMTablePtr, HS_AppData.RuntimeBuf[0].EMTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.MATablePtr, HS_AppData.RuntimeBuf[0].MATable);
+    UtAssert_ADDRESS_EQ(HS_AppData.XCTablePtr, HS_AppData.RuntimeBuf[0].XCTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.MMTablePtr, HS_AppData.RuntimeBuf[0].MMTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.MFTablePtr, HS_AppData.RuntimeBuf[0].MFTable);
+
+    /* All the other tables */
+    HS_RuntimeStage(HS_TBL_NOTIFY_ALL & ~HS_TBL_NOTIFY_AMT);
+    HS_RuntimeSwap();
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeActiveMask, HS_TBL_NOTIFY_ALL);
+    UtAssert_ADDRESS_EQ(HS_AppData.AMTablePtr, HS_AppData.RuntimeBuf[1].AMTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.EMTablePtr, HS_AppData.RuntimeBuf[1].EMTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.MATablePtr, HS_AppData.RuntimeBuf[1].MATable);
+    UtAssert_ADDRESS_EQ(HS_AppData.XCTablePtr, HS_AppData.RuntimeBuf[1].XCTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.MMTablePtr, HS_AppData.RuntimeBuf[1].MMTable);
+    UtAssert_ADDRESS_EQ(HS_AppData.MFTablePtr, HS_AppData.RuntimeBuf[1].MFTable);
+
+    /* And back again */
+    HS_RuntimeStage(HS_TBL_NOTIFY_AMT);
+    HS_RuntimeSwap();
+    UtAssert_UINT32_EQ(HS_AppData.RuntimeActiveMask, HS_TBL_NOTIFY_ALL & ~HS_TBL_NOTIFY_AMT);
+    UtAssert_ADDRESS_EQ(HS_AppData.AMTablePtr, HS_AppData.RuntimeBuf[0].AMTable);
+}
+
+void Test_HS_RuntimeCompileAMT(void)
+{
+    /* Test function for:
+     * void HS_RuntimeCompileAMT(HS_RuntimeBuf_t *BufPtr, const HS_AMTEntry_t *TblPtr)
+     */
+
+    HS_AMTEntry_t    AMTable[HS_MAX_MONITORED_APPS];
+    HS_RuntimeBuf_t *BufPtr = &HS_AppData.RuntimeBuf[1];
+    uint32           i;
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
+    {
+        AMTable[i].ActionType = HS_AMT_ACT_NOACT;
+    }
+
+    AMTable[0].ActionType                         = HS_AMT_ACT_EVENT;
+    AMTable[HS_MAX_MONITORED_APPS - 1].ActionType = HS_AMT_ACT_APP_RESTART;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x1234);
+
+    HS_RuntimeCompileAMT(BufPtr, AMTable);
+
+    UtAssert_MemCmp(BufPtr->AMTable, AMTable, sizeof(AMTable), "AppMon table copied");
+    UtAssert_UINT32_EQ(BufPtr->AMActiveCount, 2);
+    UtAssert_UINT32_EQ(BufPtr->AMActiveList[0], 0);
+    UtAssert_UINT32_EQ(BufPtr->AMActiveList[1], HS_MAX_MONITORED_APPS - 1);
+    UtAssert_UINT32_EQ(BufPtr->AMTCrc, 0x1234);
+    UtAssert_UINT32_EQ(BufPtr->AMTCompiled, true);
+
+    /* Empty table */
+    AMTable[0].ActionType                         = HS_AMT_ACT_NOACT;
+    AMTable[HS_MAX_MONITORED_APPS - 1].ActionType = HS_AMT_ACT_NOACT;
+
+    HS_RuntimeCompileAMT(BufPtr, AMTable);
+
+    UtAssert_UINT32_EQ(BufPtr->AMActiveCount, 0);
+}
+
+void Test_HS_RuntimeCompileEMT(void)
+{
+    /* Test function for:
+     * void HS_RuntimeCompileEMT(HS_RuntimeBuf_t *BufPtr, const HS_EMTEntry_t *TblPtr)
+     */
+
+    HS_EMTEntry_t    EMTable[HS_MAX_MONITORED_EVENTS];
+    HS_RuntimeBuf_t *BufPtr = &HS_AppData.RuntimeBuf[1];
+    uint32           Link;
+    uint32           i;
+
+    memset(EMTable, 0, sizeof(EMTable));
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        EMTable[i].ActionType = HS_EMT_ACT_NOACT;
+    }
+
+    /* Two entries in the same bucket, plus one without an action */
+    EMTable[0].ActionType = HS_EMT_ACT_PROC_RESET;
+    EMTable[0].EventID    = 3;
+    EMTable[1].ActionType = HS_EMT_ACT_NOACT;
+    EMTable[1].EventID    = 3;
+    EMTable[2].ActionType = HS_EMT_ACT_APP_RESTART;
+    EMTable[2].EventID    = 3 + HS_EVENTMON_HASH_BUCKETS;
+
+    /* Stale index from a previous compile */
+    BufPtr->EMHashHead[HS_RUNTIME_EVENT_HASH(4)] = 1;
+
+    HS_RuntimeCompileEMT(BufPtr, EMTable);
+
+    UtAssert_MemCmp(BufPtr->EMTable, EMTable, sizeof(EMTable), "EventMon table copied");
+    UtAssert_UINT32_EQ(BufPtr->EMActiveCount, 2);
+    UtAssert_UINT32_EQ(BufPtr->EMTCompiled, true);
+
+    /* Chain is in table order and skips entries without an action */
+    Link = BufPtr->EMHashHead[HS_RUNTIME_EVENT_HASH(3)];
+    UtAssert_UINT32_EQ(Link, 1);
+    Link = BufPtr->EMHashNext[Link - 1];
+    UtAssert_UINT32_EQ(Link, 3);
+    Link = BufPtr->EMHashNext[Link - 1];
+    UtAssert_UINT32_EQ(Link, 0);
+
+    UtAssert_UINT32_EQ(BufPtr->EMHashHead[HS_RUNTIME_EVENT_HASH(4)], 0);
+}
+
+void Test_HS_RuntimeCompileMAT(void)
+{
+    /* Test function for:
+     * void HS_RuntimeCompileMAT(HS_RuntimeBuf_t *BufPtr, const HS_MATEntry_t *TblPtr)
+     */
+
+    HS_MATEntry_t    MATable[HS_MAX_MSG_ACT_TYPES];
+    HS_RuntimeBuf_t *BufPtr = &HS_AppData.RuntimeBuf[1];
+
+    memset(MATable, 0, sizeof(MATable));
+    MATable[0].EnableState = HS_MAT_STATE_ENABLED;
+    MATable[0].Cooldown    = 5;
+    MATable[0].NextAction  = 2;
+    MATable[0].NextDelay   = 3;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x5678);
+
+    HS_RuntimeCompileMAT(BufPtr, MATable);
+
+    UtAssert_MemCmp(BufPtr->MATable, MATable, sizeof(MATable), "Message Actions table copied");
+    UtAssert_UINT32_EQ(BufPtr->MATCrc, 0x5678);
+    UtAssert_UINT32_EQ(BufPtr->MANextDelay[0].Seconds, (3 * HS_MSG_ACT_COOLDOWN_MSEC) / 1000);
+    UtAssert_UINT32_EQ(BufPtr->MANextDelay[1].Seconds, 0);
+    UtAssert_UINT32_EQ(BufPtr->MATCompiled, true);
+}
+
+void Test_HS_RuntimeCompileXCT(void)
+{
+    /* Test function for:
+     * void HS_RuntimeCompileXCT(HS_RuntimeBuf_t *BufPtr, const HS_XCTEntry_t *TblPtr)
+     */
+
+    HS_XCTEntry_t    XCTable[HS_MAX_EXEC_CNT_SLOTS];
+    HS_RuntimeBuf_t *BufPtr = &HS_AppData.RuntimeBuf[1];
+
+    memset(XCTable, 0, sizeof(XCTable));
+    XCTable[0].ResourceType = HS_XCT_TYPE_APP_MAIN;
+    XCTable[1].ResourceType = HS_XCT_TYPE_DEVICE;
+
+    HS_RuntimeCompileXCT(BufPtr, XCTable);
+
+    UtAssert_MemCmp(BufPtr->XCTable, XCTable, sizeof(XCTable), "Execution Counters table copied");
+    UtAssert_UINT32_EQ(BufPtr->XCTCompiled, true);
+
+    /* Every slot is resolved, only the ones in use look anything up */
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskIDByName, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetGenCounterIDByName, 1);
+}
+
+void Test_HS_RuntimeResolveXC(void)
+{
+    /* Test function for:
+     * bool HS_RuntimeResolveXC(HS_RuntimeBuf_t *BufPtr, uint32 TableIndex)
+     */
+
+    HS_RuntimeBuf_t *BufPtr = &HS_AppData.RuntimeBuf[1];
+
+    /* Tasks */
+    BufPtr->XCTable[0].ResourceType = HS_XCT_TYPE_APP_CHILD;
+    UtAssert_BOOL_TRUE(HS_RuntimeResolveXC(BufPtr, 0));
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskIDByName, 1);
+
+    /* Counters */
+    BufPtr->XCTable[0].ResourceType = HS_XCT_TYPE_ISR;
+    UtAssert_BOOL_TRUE(HS_RuntimeResolveXC(BufPtr, 0));
+    UtAssert_STUB_COUNT(CFE_ES_GetGenCounterIDByName, 1);
+
+    /* Not found */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetGenCounterIDByName), 1, -1);
+    UtAssert_BOOL_FALSE(HS_RuntimeResolveXC(BufPtr, 0));
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(BufPtr->XCCounterId[0], CFE_ES_COUNTERID_UNDEFINED));
+
+    /* Unused slots never resolve */
+    BufPtr->XCTable[0].ResourceType = HS_XCT_TYPE_NOTYPE;
+    UtAssert_BOOL_FALSE(HS_RuntimeResolveXC(BufPtr, 0));
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskIDByName, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetGenCounterIDByName, 2);
+}
+
+void Test_HS_RuntimeResolveMM(void)
+{
+    /* Test function for:
+     * bool HS_RuntimeResolveMM(HS_RuntimeBuf_t *BufPtr, uint32 TableIndex)
+     */
+
+    HS_RuntimeBuf_t *BufPtr = &HS_AppData.RuntimeBuf[1];
+
+    BufPtr->MMTable[0].ResourceType = HS_MMT_TYPE_POOL;
+    BufPtr->MMTable[0].PoolIndex    = 1;
+    strncpy(BufPtr->MMTable[0].AppName, "AppName", sizeof(BufPtr->MMTable[0].AppName) - 1);
+
+    /* Nothing registered */
+    BufPtr->MMPoolId[0] = CFE_ResourceId_FromInteger(0x1234);
+    UtAssert_BOOL_FALSE(HS_RuntimeResolveMM(BufPtr, 0));
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(BufPtr->MMPoolId[0], CFE_ES_MEMHANDLE_UNDEFINED));
+
+    /* Same application, other index */
+    strncpy(HS_AppData.PoolReg[0].AppName, "AppName", sizeof(HS_AppData.PoolReg[0].AppName) - 1);
+    HS_AppData.PoolReg[0].PoolIndex  = 0;
+    HS_AppData.PoolReg[0].PoolHandle = CFE_ResourceId_FromInteger(0x1000);
+    UtAssert_BOOL_FALSE(HS_RuntimeResolveMM(BufPtr, 0));
+
+    /* Same index, other application */
+    strncpy(HS_AppData.PoolReg[1].AppName, "OtherApp", sizeof(HS_AppData.PoolReg[1].AppName) - 1);
+    HS_AppData.PoolReg[1].PoolIndex  = 1;
+    HS_AppData.PoolReg[1].PoolHandle = CFE_ResourceId_FromInteger(0x2000);
+    UtAssert_BOOL_FALSE(HS_RuntimeResolveMM(BufPtr, 0));
+
+    /* Registered */
+    strncpy(HS_AppData.PoolReg[HS_MAX_REGISTERED_POOLS - 1].AppName, "AppName",
+            sizeof(HS_AppData.PoolReg[0].AppName) - 1);
+    HS_AppData.PoolReg[HS_MAX_REGISTERED_POOLS - 1].PoolIndex  = 1;
+    HS_AppData.PoolReg[HS_MAX_REGISTERED_POOLS - 1].PoolHandle = CFE_ResourceId_FromInteger(0x3000);
+    UtAssert_BOOL_TRUE(HS_RuntimeResolveMM(BufPtr, 0));
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(BufPtr->MMPoolId[0], CFE_ResourceId_FromInteger(0x3000)));
+}
+
+void Test_HS_RuntimeCompileMMT(void)
+{
+    /* Test function for:
+     * void HS_RuntimeCompileMMT(HS_RuntimeBuf_t *BufPtr, const HS_MMTEntry_t *TblPtr)
+     */
+
+    HS_MMTEntry_t    MMTable[HS_MAX_MONITORED_MEM];
+    HS_RuntimeBuf_t *BufPtr = &HS_AppData.RuntimeBuf[1];
+
+    memset(MMTable, 0, sizeof(MMTable));
+    MMTable[0].ResourceType                        = HS_MMT_TYPE_HEAP;
+    MMTable[HS_MAX_MONITORED_MEM - 1].ResourceType = HS_MMT_TYPE_POOL;
+    MMTable[HS_MAX_MONITORED_MEM - 1].PoolIndex    = 2;
+    strncpy(MMTable[HS_MAX_MONITORED_MEM - 1].AppName, "AppName", sizeof(MMTable[0].AppName) - 1);
+
+    /* The pool was registered before the table was loaded */
+    strncpy(HS_AppData.PoolReg[0].AppName, "AppName", sizeof(HS_AppData.PoolReg[0].AppName) - 1);
+    HS_AppData.PoolReg[0].PoolIndex  = 2;
+    HS_AppData.PoolReg[0].PoolHandle = CFE_ResourceId_FromInteger(0x1234);
+
+    HS_RuntimeCompileMMT(BufPtr, MMTable);
+
+    UtAssert_MemCmp(BufPtr->MMTable, MMTable, sizeof(MMTable), "Memory Monitor table copied");
+    UtAssert_UINT32_EQ(BufPtr->MMActiveCount, 2);
+    UtAssert_UINT32_EQ(BufPtr->MMActiveList[0], 0);
+    UtAssert_UINT32_EQ(BufPtr->MMActiveList[1], HS_MAX_MONITORED_MEM - 1);
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(BufPtr->MMPoolId[0], CFE_ES_MEMHANDLE_UNDEFINED));
+    UtAssert_BOOL_TRUE(
+        CFE_RESOURCEID_TEST_EQUAL(BufPtr->MMPoolId[HS_MAX_MONITORED_MEM - 1], CFE_ResourceId_FromInteger(0x1234)));
+    UtAssert_UINT32_EQ(BufPtr->MMTCompiled, true);
+}
+
+void Test_HS_RuntimeCompileMFT(void)
+{
+    /* Test function for:
+     * void HS_RuntimeCompileMFT(HS_RuntimeBuf_t *BufPtr, const HS_MFTEntry_t *TblPtr)
+     */
+
+    HS_MFTEntry_t    MFTable[HS_MAX_MONITORED_MSGS];
+    HS_RuntimeBuf_t *BufPtr = &HS_AppData.RuntimeBuf[1];
+    uint32           Link;
+
+    memset(MFTable, 0, sizeof(MFTable));
+
+    /* Two entries in the same bucket, plus one that is unused */
+    MFTable[0].MsgId      = CFE_SB_ValueToMsgId(3);
+    MFTable[0].MaxAgeMsec = 1000;
+    MFTable[1].MsgId      = CFE_SB_ValueToMsgId(3);
+    MFTable[1].MaxAgeMsec = 0;
+    MFTable[2].MsgId      = CFE_SB_ValueToMsgId(3 + HS_MSGMON_HASH_BUCKETS);
+    MFTable[2].MaxAgeMsec = 2000;
+
+    /* Stale index from a previous compile */
+    BufPtr->MFHashHead[HS_RUNTIME_MSGID_HASH(CFE_SB_ValueToMsgId(4))] = 1;
+
+    HS_RuntimeCompileMFT(BufPtr, MFTable);
+
+    UtAssert_MemCmp(BufPtr->MFTable, MFTable, sizeof(MFTable), "Message Freshness table copied");
+    UtAssert_UINT32_EQ(BufPtr->MFActiveCount, 2);
+    UtAssert_UINT32_EQ(BufPtr->MFTCompiled, true);
+
+    /* Chain is in table order and skips unused entries */
+    Link = BufPtr->MFHashHead[HS_RUNTIME_MSGID_HASH(CFE_SB_ValueToMsgId(3))];
+    UtAssert_UINT32_EQ(Link, 1);
+    Link = BufPtr->MFHashNext[Link - 1];
+    UtAssert_UINT32_EQ(Link, 3);
+    Link = BufPtr->MFHashNext[Link - 1];
+    UtAssert_UINT32_EQ(Link, 0);
+
+    UtAssert_UINT32_EQ(BufPtr->MFHashHead[HS_RUNTIME_MSGID_HASH(CFE_SB_ValueToMsgId(4))], 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_HS_RuntimeInit, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeInit");
+    UtTest_Add(Test_HS_RuntimeStage, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeStage");
+    UtTest_Add(Test_HS_RuntimeSwap, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeSwap");
+    UtTest_Add(Test_HS_RuntimeCompileAMT, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeCompileAMT");
+    UtTest_Add(Test_HS_RuntimeCompileEMT, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeCompileEMT");
+    UtTest_Add(Test_HS_RuntimeCompileMAT, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeCompileMAT");
+    UtTest_Add(Test_HS_RuntimeCompileXCT, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeCompileXCT");
+    UtTest_Add(Test_HS_RuntimeResolveXC, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeResolveXC");
+    UtTest_Add(Test_HS_RuntimeResolveMM, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeResolveMM");
+    UtTest_Add(Test_HS_RuntimeCompileMMT, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeCompileMMT");
+    UtTest_Add(Test_HS_RuntimeCompileMFT, HS_Test_Setup, HS_Test_TearDown, "Test_HS_RuntimeCompileMFT");
+}
@@ -0,0 +1,376 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/*
+ * Includes
+ */
+
+#include "hs_sbmon.h"
+#include "hs_app.h"
+#include "hs_test_utils.h"
+#include "hs_msgids.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "cfe.h"
+#include "cfe_msgids.h"
+
+/* Pipe the SB statistics in these tests report */
+#define HS_SBMON_TEST_PIPEID_2 CFE_SB_PIPEID_C(CFE_RESOURCEID_WRAP(2))
+
+void HS_SBMON_TEST_CFE_SB_ReceiveBufferHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t **BufPtr = UT_Hook_GetArgValueByName(Context, "BufPtr", CFE_SB_Buffer_t **);
+
+    /* The pipe is empty once the queued buffers are used up */
+    if (UT_Stub_CopyToLocal(UT_KEY(CFE_SB_ReceiveBuffer), BufPtr, sizeof(*BufPtr)) < sizeof(*BufPtr))
+    {
+        *BufPtr = NULL;
+    }
+}
+
+void HS_SBMON_TEST_CFE_SB_GetPipeIdByNameHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_PipeId_t *PipeIdPtr = UT_Hook_GetArgValueByName(Context, "PipeIdPtr", CFE_SB_PipeId_t *);
+    const char *     PipeName  = UT_Hook_GetArgValueByName(Context, "PipeName", const char *);
+    CFE_Status_t     Status    = CFE_SB_BAD_ARGUMENT;
+
+    /* Only "PIPE_2" exists */
+    if (strcmp(PipeName, "PIPE_2") == 0)
+    {
+        *PipeIdPtr = HS_SBMON_TEST_PIPEID_2;
+    }
+    else
+    {
+        UT_Stub_SetReturnValue(FuncKey, Status);
+    }
+}
+
+void Test_HS_SbMonInit(void)
+{
+    CFE_SB_PipeId_t PipeId = HS_UT_PIPEID_1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_SbMonInit(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(HS_AppData.SbMon.Pipe, PipeId));
+    UtAssert_UINT32_EQ(HS_AppData.SbMon.State, HS_STATE_ENABLED);
+    UtAssert_ADDRESS_EQ(HS_AppData.SbMon.PipeNames, HS_SbMonPipeNames);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 2);
+    UtAssert_STUB_COUNT(CFE_MSG_SetFcnCode, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_HS_SbMonInit_CreatePipeError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Creating SB Monitor Pipe,RC=0x%%08X");
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_SbMonInit(), -1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.SbMon.State, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CR_SBMON_PIPE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void Test_HS_SbMonInit_SubscribeError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Subscribing to SB Telemetry,RC=0x%%08X");
+
+    /* Fail the SB housekeeping subscription */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 2, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_SbMonInit(), -1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.SbMon.State, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 2);
+    UtAssert_STUB_COUNT(CFE_SB_DeletePipe, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SUB_SBMON_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void Test_HS_SbMonCycle(void)
+{
+    CFE_SB_StatsTlm_t        Stats;
+    CFE_SB_HousekeepingTlm_t Hk;
+    CFE_SB_Buffer_t *        Buffers[3];
+    CFE_SB_MsgId_t           MsgIds[3];
+    size_t                   Sizes[3];
+
+    memset(&Stats, 0, sizeof(Stats));
+    memset(&Hk, 0, sizeof(Hk));
+
+    HS_AppData.SbMon.PipeNames = HS_SbMonPipeNames;
+
+    /* SB statistics, SB housekeeping, then SB statistics that are too short */
+    Buffers[0] = (CFE_SB_Buffer_t *)&Stats;
+    MsgIds[0]  = CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID);
+    Sizes[0]   = sizeof(Stats);
+    Buffers[1] = (CFE_SB_Buffer_t *)&Hk;
+    MsgIds[1]  = CFE_SB_ValueToMsgId(CFE_SB_HK_TLM_MID);
+    Sizes[1]   = sizeof(Hk);
+    Buffers[2] = (CFE_SB_Buffer_t *)&Stats;
+    MsgIds[2]  = CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID);
+    Sizes[2]   = sizeof(Hk);
+
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), HS_SBMON_TEST_CFE_SB_ReceiveBufferHandler, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), Buffers, sizeof(Buffers), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIds, sizeof(MsgIds), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Sizes, sizeof(Sizes), false);
+
+    /* Execute the function being tested */
+    HS_SbMonCycle();
+
+    /* Verify results, the statistics sent a packet and were requested again */
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.SampleCount, 1);
+    UtAssert_BOOL_TRUE(HS_AppData.SbMon.HkReceived);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 4);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_UINT32_EQ(HS_AppData.SbMon.CycleCounter, HS_SBMON_CYCLES_PER_SAMPLE - 1);
+
+    /* Nothing received, and no request until the counter runs out */
+    HS_SbMonCycle();
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2 + (HS_SBMON_CYCLES_PER_SAMPLE == 1));
+}
+
+void Test_HS_SbMonProcessStats_AllPipes(void)
+{
+    CFE_SB_StatsTlm_t Stats;
+
+    memset(&Stats, 0, sizeof(Stats));
+
+    HS_AppData.SbMon.PipeNames = HS_SbMonPipeNames;
+
+    /* Pipes in use have a depth, entries in between are unused */
+    Stats.Payload.PipeDepthStats[1].PipeId            = HS_UT_PIPEID_1;
+    Stats.Payload.PipeDepthStats[1].MaxQueueDepth     = 10;
+    Stats.Payload.PipeDepthStats[1].CurrentQueueDepth = 2;
+    Stats.Payload.PipeDepthStats[1].PeakQueueDepth    = 5;
+    Stats.Payload.PipeDepthStats[3].PipeId            = HS_SBMON_TEST_PIPEID_2;
+    Stats.Payload.PipeDepthStats[3].MaxQueueDepth     = 4;
+    Stats.Payload.PipeDepthStats[3].CurrentQueueDepth = 4;
+
+    /* Execute the function being tested */
+    HS_SbMonProcessStats(&Stats);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].PipeId, CFE_RESOURCEID_TO_ULONG(HS_UT_PIPEID_1));
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].CurrentDepth, 2);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].PeakDepth, 5);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].MaxDepth, 10);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[1].PipeId, CFE_RESOURCEID_TO_ULONG(HS_SBMON_TEST_PIPEID_2));
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.PipeCount, 2);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.FullCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.SampleCount, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* A pipe deleted since the last sample clears its entry */
+    Stats.Payload.PipeDepthStats[3].MaxQueueDepth = 0;
+
+    HS_SbMonProcessStats(&Stats);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[1].PipeId, 0);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.PipeCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.FullCount, 0);
+}
+
+void Test_HS_SbMonProcessStats_NamedPipes(void)
+{
+    const char *const PipeNames[] = {"PIPE_1", "PIPE_2", NULL};
+    CFE_SB_StatsTlm_t Stats;
+
+    memset(&Stats, 0, sizeof(Stats));
+
+    HS_AppData.SbMon.PipeNames = PipeNames;
+
+    Stats.Payload.PipeDepthStats[0].PipeId            = HS_UT_PIPEID_1;
+    Stats.Payload.PipeDepthStats[0].MaxQueueDepth     = 10;
+    Stats.Payload.PipeDepthStats[2].PipeId            = HS_SBMON_TEST_PIPEID_2;
+    Stats.Payload.PipeDepthStats[2].MaxQueueDepth     = 8;
+    Stats.Payload.PipeDepthStats[2].CurrentQueueDepth = 3;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_GetPipeIdByName), HS_SBMON_TEST_CFE_SB_GetPipeIdByNameHandler, NULL);
+
+    /* Execute the function being tested */
+    HS_SbMonProcessStats(&Stats);
+
+    /* Verify results, entries follow the names and unknown pipes are empty */
+    UtAssert_STUB_COUNT(CFE_SB_GetPipeIdByName, 2);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].PipeId, 0);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[1].PipeId, CFE_RESOURCEID_TO_ULONG(HS_SBMON_TEST_PIPEID_2));
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[1].CurrentDepth, 3);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.PipeCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.SampleCount, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void Test_HS_SbMonProcessHk(void)
+{
+    CFE_SB_HousekeepingTlm_t Hk;
+
+    memset(&Hk, 0, sizeof(Hk));
+
+    Hk.Payload.PipeOverflowErrorCounter = 65534;
+    Hk.Payload.MsgLimitErrorCounter     = 7;
+
+    /* Execute the function being tested, drops before HS started don't count */
+    HS_SbMonProcessHk(&Hk);
+
+    UtAssert_BOOL_TRUE(HS_AppData.SbMon.HkReceived);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.OverflowCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.MsgLimitCount, 0);
+
+    /* The SB counters wrap */
+    Hk.Payload.PipeOverflowErrorCounter = 2;
+    Hk.Payload.MsgLimitErrorCounter     = 10;
+
+    HS_SbMonProcessHk(&Hk);
+
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.OverflowCount, 4);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.MsgLimitCount, 3);
+}
+
+void Test_HS_SbMonUpdatePipe_Full(void)
+{
+    CFE_SB_PipeDepthStats_t Depth;
+    uint32                  Sample;
+    int32                   strCmpResult;
+    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "SB Monitor: Pipe %%s: Depth %%u of %%u for %%u samples: Action: Event Only");
+
+    memset(&Depth, 0, sizeof(Depth));
+
+    Depth.PipeId            = HS_UT_PIPEID_1;
+    Depth.MaxQueueDepth     = 100;
+    Depth.CurrentQueueDepth = HS_SBMON_FULL_PCT;
+
+    /* Execute the function being tested, the pipe stays near full */
+    for (Sample = 1; Sample < HS_SBMON_FULL_SAMPLES; Sample++)
+    {
+        HS_SbMonUpdatePipe(0, &Depth);
+    }
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT32_EQ(HS_AppData.SbMon.Pipes[0].FullCount, HS_SBMON_FULL_SAMPLES - 1);
+
+    HS_SbMonUpdatePipe(0, &Depth);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SBMON_FULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    /* Not acted on again while it stays near full */
+    HS_SbMonUpdatePipe(0, &Depth);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Draining resets the count */
+    Depth.CurrentQueueDepth = 0;
+
+    HS_SbMonUpdatePipe(0, &Depth);
+    UtAssert_UINT32_EQ(HS_AppData.SbMon.Pipes[0].FullCount, 0);
+    UtAssert_INT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].DepthGrowth, -HS_SBMON_FULL_PCT);
+}
+
+void Test_HS_SbMonUpdatePipe_NewPipe(void)
+{
+    CFE_SB_PipeDepthStats_t Depth;
+
+    memset(&Depth, 0, sizeof(Depth));
+
+    Depth.PipeId            = HS_UT_PIPEID_1;
+    Depth.MaxQueueDepth     = 10;
+    Depth.CurrentQueueDepth = 2;
+
+    /* Execute the function being tested, the first sample has no growth */
+    HS_SbMonUpdatePipe(0, &Depth);
+
+    UtAssert_INT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].DepthGrowth, 0);
+
+    Depth.CurrentQueueDepth = 5;
+
+    HS_SbMonUpdatePipe(0, &Depth);
+    UtAssert_INT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].DepthGrowth, 3);
+
+    /* A different pipe in the entry starts over */
+    Depth.PipeId = HS_SBMON_TEST_PIPEID_2;
+
+    HS_SbMonUpdatePipe(0, &Depth);
+    UtAssert_INT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].DepthGrowth, 0);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].PipeId, CFE_RESOURCEID_TO_ULONG(HS_SBMON_TEST_PIPEID_2));
+
+    /* No statistics clears the entry */
+    HS_SbMonUpdatePipe(0, NULL);
+    UtAssert_UINT32_EQ(HS_AppData.SbMonPkt.Payload.Pipes[0].MaxDepth, 0);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(HS_AppData.SbMon.Pipes[0].PipeId));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_HS_SbMonInit, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SbMonInit");
+    UtTest_Add(Test_HS_SbMonInit_CreatePipeError, HS_Test_Setup, HS_Test_TearDown,
+               "Test_HS_SbMonInit_CreatePipeError");
+    UtTest_Add(Test_HS_SbMonInit_SubscribeError, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SbMonInit_SubscribeError");
+    UtTest_Add(Test_HS_SbMonCycle, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SbMonCycle");
+    UtTest_Add(Test_HS_SbMonProcessStats_AllPipes, HS_Test_Setup, HS_Test_TearDown,
+               "Test_HS_SbMonProcessStats_AllPipes");
+    UtTest_Add(Test_HS_SbMonProcessStats_NamedPipes, HS_Test_Setup, HS_Test_TearDown,
+               "Test_HS_SbMonProcessStats_NamedPipes");
+    UtTest_Add(Test_HS_SbMonProcessHk, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SbMonProcessHk");
+    UtTest_Add(Test_HS_SbMonUpdatePipe_Full, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SbMonUpdatePipe_Full");
+    UtTest_Add(Test_HS_SbMonUpdatePipe_NewPipe, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SbMonUpdatePipe_NewPipe");
+}
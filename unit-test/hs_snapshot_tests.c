@@ -0,0 +1,398 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "hs_snapshot.h"
+#include "hs_app.h"
+#include "hs_eventids.h"
+#include "hs_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+void HS_SNAPSHOT_TEST_CFE_TIME_SubtractHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *Age = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, *Age);
+}
+
+int32 HS_SNAPSHOT_TEST_CFE_ES_RestoreFromCDSHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                                 const UT_StubContext_t *Context)
+{
+    void *RestorePtr = UT_Hook_GetArgValueByName(Context, "RestoreToMemory", void *);
+
+    /* Sections are restored in order, CallCount starts at 1 */
+    if (CallCount == 1)
+    {
+        HS_SnapshotAppMon_t *AppMonPtr = RestorePtr;
+
+        AppMonPtr->Header.TableCrc                 = 0x1234;
+        AppMonPtr->AppMonState[0].CheckInCountdown = 7;
+        AppMonPtr->AppMonEnables[0]                = 1;
+    }
+    else if (CallCount == 2)
+    {
+        HS_SnapshotUtil_t *UtilPtr = RestorePtr;
+
+        UtilPtr->UtilCpuPeak = 9000;
+    }
+    else
+    {
+        /* Saved with a different Message Actions table */
+        HS_SnapshotMsgAct_t *MsgActPtr = RestorePtr;
+
+        MsgActPtr->Header.TableCrc            = 0x5678;
+        MsgActPtr->MsgActReadyTime[0].Seconds = 100;
+    }
+
+    return CFE_SUCCESS;
+}
+
+void HS_SNAPSHOT_TEST_Setup(void)
+{
+    HS_Test_Setup();
+
+    HS_AppData.CDSState       = HS_STATE_ENABLED;
+    HS_AppData.SnapshotPeriod = 10;
+
+    /* HS has already started since the last reset */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetGenCounterIDByName), CFE_SUCCESS);
+}
+
+void Test_HS_SnapshotInit_New(void)
+{
+    /* Test function for:
+     * void HS_SnapshotInit(void)
+     */
+
+    HS_AppData.Snapshot.NextSection = 2;
+
+    HS_SnapshotInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.CDSState, HS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.Countdown, HS_AppData.SnapshotPeriod);
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.NextSection, 0);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, HS_SNAPSHOT_NUM_SECTIONS);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterGenCounter, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_HS_SnapshotInit_Restore(void)
+{
+    /* Test function for:
+     * void HS_SnapshotInit(void)
+     */
+
+    HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_AMT)->AMTCrc = 0x1234;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetHookFunction(UT_KEY(CFE_ES_RestoreFromCDS), HS_SNAPSHOT_TEST_CFE_ES_RestoreFromCDSHook, NULL);
+
+    HS_SnapshotInit();
+
+    /* AppMon and CPU utilization are restored, the cooldowns belong to another table */
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CheckInCountdown, 7);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonEnables[0], 1);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCpuPeak, 9000);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActReadyTime[0].Seconds, 0);
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.CDSState, HS_STATE_ENABLED);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SNAPSHOT_RESTORE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* A failed restore is not applied but still reported */
+    UT_ResetState(UT_KEY(CFE_ES_RestoreFromCDS));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RestoreFromCDS), -1);
+    HS_AppData.UtilCpuPeak = 0;
+
+    HS_SnapshotInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.UtilCpuPeak, 0);
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.CDSState, HS_STATE_ENABLED);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_SNAPSHOT_RESTORE_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void Test_HS_SnapshotInit_Reset(void)
+{
+    /* Test function for:
+     * void HS_SnapshotInit(void)
+     */
+
+    HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_AMT)->AMTCrc = 0x1234;
+
+    /* First start since a reset */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetGenCounterIDByName), CFE_ES_ERR_NAME_NOT_FOUND);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetHookFunction(UT_KEY(CFE_ES_RestoreFromCDS), HS_SNAPSHOT_TEST_CFE_ES_RestoreFromCDSHook, NULL);
+
+    HS_SnapshotInit();
+
+    /* The blocks are kept for the next save, but nothing is restored */
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[0].CheckInCountdown, 0);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCpuPeak, 0);
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.CDSState, HS_STATE_ENABLED);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, HS_SNAPSHOT_NUM_SECTIONS);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterGenCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SNAPSHOT_RESTORE_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Disabled by a period of 0 */
+    HS_AppData.SnapshotPeriod = 0;
+
+    HS_SnapshotInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.CDSState, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, HS_SNAPSHOT_NUM_SECTIONS);
+    UtAssert_STUB_COUNT(CFE_ES_GetGenCounterIDByName, 1);
+}
+
+void Test_HS_SnapshotInit_RegisterError(void)
+{
+    /* Test function for:
+     * void HS_SnapshotInit(void)
+     */
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDS), 2, -1);
+
+    HS_SnapshotInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.CDSState, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, 2);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SNAPSHOT_CDS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* No CDS at all */
+    HS_AppData.CDSState = HS_STATE_DISABLED;
+
+    HS_SnapshotInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.CDSState, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, 2);
+}
+
+void Test_HS_SnapshotSave(void)
+{
+    /* Test function for:
+     * void HS_SnapshotSave(void)
+     */
+    uint32 i;
+
+    HS_AppData.Snapshot.CDSState  = HS_STATE_ENABLED;
+    HS_AppData.Snapshot.Countdown = 1;
+
+    HS_AppData.AppMonState[0].CheckInCountdown             = 3;
+    HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_AMT)->AMTCrc = 0x1234;
+
+    HS_SnapshotSave();
+
+    /* AppMon section saved first */
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.AppMon.AppMonState[0].CheckInCountdown, 3);
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.AppMon.Header.TableCrc, 0x1234);
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.NextSection, HS_SNAPSHOT_UTIL);
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.Countdown, HS_AppData.SnapshotPeriod);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+
+    /* Nothing until the period has passed */
+    HS_AppData.UtilCpuPeak = 5000;
+    for (i = 1; i < HS_AppData.SnapshotPeriod; i++)
+    {
+        HS_SnapshotSave();
+    }
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+
+    HS_SnapshotSave();
+
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.Util.UtilCpuPeak, 5000);
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.NextSection, HS_SNAPSHOT_MSGACT);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 2);
+
+    /* Not saved without a CDS */
+    HS_AppData.Snapshot.CDSState  = HS_STATE_DISABLED;
+    HS_AppData.Snapshot.Countdown = 1;
+
+    HS_SnapshotSave();
+
+    UtAssert_UINT32_EQ(HS_AppData.Snapshot.Countdown, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 2);
+}
+
+void Test_HS_SnapshotSection(void)
+{
+    /* Test function for:
+     * HS_SnapshotHeader_t *HS_SnapshotSection(uint32 Section, size_t *SizePtr)
+     */
+    size_t Size;
+
+    UtAssert_ADDRESS_EQ(HS_SnapshotSection(HS_SNAPSHOT_APPMON, &Size), &HS_AppData.Snapshot.AppMon.Header);
+    UtAssert_UINT32_EQ(Size, sizeof(HS_SnapshotAppMon_t));
+
+    UtAssert_ADDRESS_EQ(HS_SnapshotSection(HS_SNAPSHOT_UTIL, &Size), &HS_AppData.Snapshot.Util.Header);
+    UtAssert_UINT32_EQ(Size, sizeof(HS_SnapshotUtil_t));
+
+    UtAssert_ADDRESS_EQ(HS_SnapshotSection(HS_SNAPSHOT_MSGACT, &Size), &HS_AppData.Snapshot.MsgAct.Header);
+    UtAssert_UINT32_EQ(Size, sizeof(HS_SnapshotMsgAct_t));
+}
+
+void Test_HS_SnapshotTableCrc(void)
+{
+    /* Test function for:
+     * uint32 HS_SnapshotTableCrc(uint32 Section)
+     */
+
+    /* Each table's CRC comes from its own active buffer */
+    HS_AppData.RuntimeActiveMask    = HS_TBL_NOTIFY_MAT;
+    HS_AppData.RuntimeBuf[0].AMTCrc = 0x1234;
+    HS_AppData.RuntimeBuf[1].AMTCrc = 0x4321;
+    HS_AppData.RuntimeBuf[0].MATCrc = 0x8765;
+    HS_AppData.RuntimeBuf[1].MATCrc = 0x5678;
+
+    UtAssert_UINT32_EQ(HS_SnapshotTableCrc(HS_SNAPSHOT_APPMON), 0x1234);
+    UtAssert_UINT32_EQ(HS_SnapshotTableCrc(HS_SNAPSHOT_UTIL), 0);
+    UtAssert_UINT32_EQ(HS_SnapshotTableCrc(HS_SNAPSHOT_MSGACT), 0x5678);
+}
+
+void Test_HS_SnapshotCrc(void)
+{
+    /* Test function for:
+     * uint32 HS_SnapshotCrc(const HS_SnapshotHeader_t *HeaderPtr, size_t Size)
+     */
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x1234);
+
+    UtAssert_UINT32_EQ(HS_SnapshotCrc(&HS_AppData.Snapshot.Util.Header, sizeof(HS_AppData.Snapshot.Util)), 0x1234);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+void Test_HS_SnapshotCaptureApply(void)
+{
+    /* Test function for:
+     * void HS_SnapshotCapture(uint32 Section)
+     * void HS_SnapshotApply(uint32 Section)
+     */
+
+    HS_AppData.AppMonState[1].CyclesSinceCheckIn = 4;
+    HS_AppData.AppMonState[1].EscalationRung     = 2;
+    HS_AppData.AppMonState[1].RecoveryCheckIns   = 3;
+    HS_AppData.AppMonEnables[0]                  = 2;
+    HS_AppData.UtilizationTracker[1]             = 300;
+    HS_AppData.CurrentCPUUtilIndex               = 2;
+    HS_AppData.UtilCpuAvg                        = 200;
+    HS_AppData.UtilCpuPeak                       = 300;
+    HS_AppData.CurrentCPUHoggingTime             = 1;
+    HS_AppData.UtilizationCycleCounter           = 5;
+    HS_AppData.MsgActReadyTime[0].Seconds        = 100;
+
+    HS_SnapshotCapture(HS_SNAPSHOT_APPMON);
+    HS_SnapshotCapture(HS_SNAPSHOT_UTIL);
+    HS_SnapshotCapture(HS_SNAPSHOT_MSGACT);
+
+    memset(HS_AppData.AppMonState, 0, sizeof(HS_AppData.AppMonState));
+    memset(HS_AppData.AppMonEnables, 0, sizeof(HS_AppData.AppMonEnables));
+    memset(HS_AppData.UtilizationTracker, 0, sizeof(HS_AppData.UtilizationTracker));
+    memset(HS_AppData.MsgActReadyTime, 0, sizeof(HS_AppData.MsgActReadyTime));
+    HS_AppData.CurrentCPUUtilIndex     = 0;
+    HS_AppData.UtilCpuAvg              = 0;
+    HS_AppData.UtilCpuPeak             = 0;
+    HS_AppData.CurrentCPUHoggingTime   = 0;
+    HS_AppData.UtilizationCycleCounter = 0;
+
+    /* The ladder climbed once more after the snapshot was saved */
+    HS_AppData.CDSLadders.Ladder[1].Rung = 3;
+
+    HS_SnapshotApply(HS_SNAPSHOT_APPMON);
+    HS_SnapshotApply(HS_SNAPSHOT_UTIL);
+    HS_SnapshotApply(HS_SNAPSHOT_MSGACT);
+
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[1].CyclesSinceCheckIn, 4);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[1].EscalationRung, 3);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonState[1].RecoveryCheckIns, 0);
+    UtAssert_UINT32_EQ(HS_AppData.AppMonEnables[0], 2);
+    UtAssert_UINT32_EQ(HS_AppData.UtilizationTracker[1], 300);
+    UtAssert_UINT32_EQ(HS_AppData.CurrentCPUUtilIndex, 2);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCpuAvg, 200);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCpuPeak, 300);
+    UtAssert_UINT32_EQ(HS_AppData.CurrentCPUHoggingTime, 1);
+    UtAssert_UINT32_EQ(HS_AppData.UtilizationCycleCounter, 5);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActReadyTime[0].Seconds, 100);
+}
+
+void Test_HS_SnapshotValid(void)
+{
+    /* Test function for:
+     * bool HS_SnapshotValid(uint32 Section)
+     */
+    CFE_TIME_SysTime_t Age = {HS_SNAPSHOT_MAX_AGE - 1, 0};
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), HS_SNAPSHOT_TEST_CFE_TIME_SubtractHandler, &Age);
+
+    HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_AMT)->AMTCrc = 0x1234;
+    HS_AppData.Snapshot.AppMon.Header.TableCrc             = 0x1234;
+
+    UtAssert_BOOL_TRUE(HS_SnapshotValid(HS_SNAPSHOT_APPMON));
+
+    /* Too old */
+    Age.Seconds = HS_SNAPSHOT_MAX_AGE;
+    UtAssert_BOOL_FALSE(HS_SnapshotValid(HS_SNAPSHOT_APPMON));
+    Age.Seconds = 0;
+
+    /* Saved with another table */
+    HS_AppData.Snapshot.AppMon.Header.TableCrc = 0x5678;
+    UtAssert_BOOL_FALSE(HS_SnapshotValid(HS_SNAPSHOT_APPMON));
+
+    /* Corrupt */
+    HS_AppData.Snapshot.Util.Header.Crc = 1;
+    UtAssert_BOOL_FALSE(HS_SnapshotValid(HS_SNAPSHOT_UTIL));
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_HS_SnapshotInit_New, HS_SNAPSHOT_TEST_Setup, HS_Test_TearDown, "Test_HS_SnapshotInit_New");
+    UtTest_Add(Test_HS_SnapshotInit_Restore, HS_SNAPSHOT_TEST_Setup, HS_Test_TearDown,
+               "Test_HS_SnapshotInit_Restore");
+    UtTest_Add(Test_HS_SnapshotInit_Reset, HS_SNAPSHOT_TEST_Setup, HS_Test_TearDown, "Test_HS_SnapshotInit_Reset");
+    UtTest_Add(Test_HS_SnapshotInit_RegisterError, HS_SNAPSHOT_TEST_Setup, HS_Test_TearDown,
+               "Test_HS_SnapshotInit_RegisterError");
+    UtTest_Add(Test_HS_SnapshotSave, HS_SNAPSHOT_TEST_Setup, HS_Test_TearDown, "Test_HS_SnapshotSave");
+    UtTest_Add(Test_HS_SnapshotSection, HS_SNAPSHOT_TEST_Setup, HS_Test_TearDown, "Test_HS_SnapshotSection");
+    UtTest_Add(Test_HS_SnapshotTableCrc, HS_SNAPSHOT_TEST_Setup, HS_Test_TearDown, "Test_HS_SnapshotTableCrc");
+    UtTest_Add(Test_HS_SnapshotCrc, HS_SNAPSHOT_TEST_Setup, HS_Test_TearDown, "Test_HS_SnapshotCrc");
+    UtTest_Add(Test_HS_SnapshotCaptureApply, HS_SNAPSHOT_TEST_Setup, HS_Test_TearDown,
+               "Test_HS_SnapshotCaptureApply");
+    UtTest_Add(Test_HS_SnapshotValid, HS_SNAPSHOT_TEST_Setup, HS_Test_TearDown, "Test_HS_SnapshotValid");
+}
@@ -0,0 +1,273 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/*
+ * Includes
+ */
+
+#include "hs_stackmon.h"
+#include "hs_app.h"
+#include "hs_eventids.h"
+#include "hs_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "cfe.h"
+
+/* Size ES reports for the stacks in these tests */
+#define HS_STACKMON_TEST_STACK_SIZE 1000
+
+void HS_STACKMON_TEST_CFE_ES_GetTaskIDByNameHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                    const UT_StubContext_t *Context)
+{
+    CFE_ES_TaskId_t *TaskIdPtr = UT_Hook_GetArgValueByName(Context, "TaskIdPtr", CFE_ES_TaskId_t *);
+    const char *     TaskName  = UT_Hook_GetArgValueByName(Context, "TaskName", const char *);
+    int32            Status    = CFE_SUCCESS;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    /* Task "TASKn" has ID n plus the offset, which changes when the tasks restart */
+    if (Status == CFE_SUCCESS)
+    {
+        *TaskIdPtr = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(atoi(&TaskName[4]) + *(uint32 *)UserObj));
+    }
+}
+
+void HS_STACKMON_TEST_CFE_ES_GetTaskInfoHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_ES_TaskInfo_t *TaskInfo = UT_Hook_GetArgValueByName(Context, "TaskInfo", CFE_ES_TaskInfo_t *);
+    int32              Status   = CFE_SUCCESS;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    if (Status == CFE_SUCCESS)
+    {
+        memset(TaskInfo, 0, sizeof(*TaskInfo));
+        TaskInfo->StackSize = CFE_ES_MEMOFFSET_C(HS_STACKMON_TEST_STACK_SIZE);
+    }
+}
+
+/* Fills a stack as if the task had used HighWater bytes of it */
+static void HS_StackMon_Test_SetStack(uint8 *StackPtr, uint32 HighWater)
+{
+    memset(StackPtr, HS_STACKMON_FILL_BYTE, HS_STACKMON_TEST_STACK_SIZE - HighWater);
+    memset(&StackPtr[HS_STACKMON_TEST_STACK_SIZE - HighWater], 0, HighWater);
+}
+
+void Test_HS_StackMonRegister(void)
+{
+    /* Test function for:
+     * bool HS_StackMonRegister(const char *TaskName, cpuaddr StackBase)
+     */
+    uint32 RegIndex;
+    char   TaskName[CFE_MISSION_MAX_API_LEN];
+
+    /* nominal - the first free registrations are taken */
+    UtAssert_BOOL_TRUE(HS_StackMonRegister("TASK1", 0x1000));
+    UtAssert_BOOL_TRUE(HS_StackMonRegister("TASK2", 0x2000));
+    UtAssert_STRINGBUF_EQ(HS_AppData.StackMon.Stacks[1].TaskName, sizeof(HS_AppData.StackMon.Stacks[1].TaskName),
+                          "TASK2", -1);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Stacks[1].StackBase, 0x2000);
+
+    /* registering a task again replaces its stack and lets it cross the limit again */
+    HS_AppData.StackMon.Stacks[0].CrossedId = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(1));
+    UtAssert_BOOL_TRUE(HS_StackMonRegister("TASK1", 0x3000));
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Stacks[0].StackBase, 0x3000);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(HS_AppData.StackMon.Stacks[0].CrossedId));
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Stacks[2].TaskName[0], '\0');
+
+    /* every registration in use */
+    for (RegIndex = 2; RegIndex < HS_MAX_REGISTERED_STACKS; RegIndex++)
+    {
+        snprintf(TaskName, sizeof(TaskName), "TASK%u", (unsigned int)(RegIndex + 1));
+        UtAssert_BOOL_TRUE(HS_StackMonRegister(TaskName, 0x1000 * (RegIndex + 1)));
+    }
+
+    UtAssert_BOOL_FALSE(HS_StackMonRegister("OTHER", 0x9000));
+}
+
+void Test_HS_MonitorStacks_Pass(void)
+{
+    /* Test function for:
+     * void HS_MonitorStacks(void)
+     */
+    uint8  Stacks[3][HS_STACKMON_TEST_STACK_SIZE];
+    uint32 TaskIdOffset = 0;
+    int32  strCmpResult;
+    char   ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Stack Monitor: Task %%s: Used %%u of %%u stack bytes: Action: Event Only");
+
+    HS_StackMon_Test_SetStack(Stacks[0], 500);
+    HS_StackMon_Test_SetStack(Stacks[1], 900);
+    HS_StackMon_Test_SetStack(Stacks[2], 100);
+
+    HS_StackMonRegister("TASK1", (cpuaddr)Stacks[0]);
+    HS_StackMonRegister("TASK2", (cpuaddr)Stacks[1]);
+    HS_StackMonRegister("TASK3", (cpuaddr)Stacks[2]);
+
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetTaskIDByName), HS_STACKMON_TEST_CFE_ES_GetTaskIDByNameHandler,
+                          &TaskIdOffset);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetTaskInfo), HS_STACKMON_TEST_CFE_ES_GetTaskInfoHandler, NULL);
+
+    /* the pass starts with the first registrations */
+    HS_MonitorStacks();
+
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.NextStack, HS_STACKMON_TASKS_PER_CYCLE);
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskInfo, HS_STACKMON_TASKS_PER_CYCLE);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Top[0].HighWaterBytes, 900);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Top[0].TaskId, 2);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Top[0].StackSize, HS_STACKMON_TEST_STACK_SIZE);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Top[1].HighWaterBytes, 500);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Reported[0].StackSize, 0);
+
+    /* the second task used more than the limit */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_STACKMON_LIMIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    /* the pass ends after the last registration and is reported */
+    HS_MonitorStacks();
+
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.NextStack, 0);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Reported[0].HighWaterBytes, 900);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Reported[1].HighWaterBytes, 500);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Reported[2].HighWaterBytes, 100);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Reported[3].StackSize, 0);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Top[0].StackSize, 0);
+
+    /* the next pass doesn't act on the same task again */
+    HS_MonitorStacks();
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* after the tasks restart, the new second task crosses the limit too */
+    TaskIdOffset                   = 10;
+    HS_AppData.StackMon.NextStack = 0;
+
+    HS_MonitorStacks();
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(HS_AppData.StackMon.Stacks[1].CrossedId,
+                                                 CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(12))));
+}
+
+void Test_HS_MonitorStacks_Skipped(void)
+{
+    /* Test function for:
+     * void HS_MonitorStacks(void)
+     */
+    uint8  Stacks[3][HS_STACKMON_TEST_STACK_SIZE];
+    uint32 TaskIdOffset = 0;
+
+    HS_StackMon_Test_SetStack(Stacks[0], 1000);
+    HS_StackMon_Test_SetStack(Stacks[1], 1000);
+    HS_StackMon_Test_SetStack(Stacks[2], 0);
+
+    HS_StackMonRegister("TASK1", (cpuaddr)Stacks[0]);
+    HS_StackMonRegister("TASK2", (cpuaddr)Stacks[1]);
+    HS_StackMonRegister("TASK3", (cpuaddr)Stacks[2]);
+
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetTaskIDByName), HS_STACKMON_TEST_CFE_ES_GetTaskIDByNameHandler,
+                          &TaskIdOffset);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetTaskInfo), HS_STACKMON_TEST_CFE_ES_GetTaskInfoHandler, NULL);
+
+    /* the first task isn't running, ES has no information on the second, and the third's stack is still filled */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskIDByName), 1, CFE_ES_ERR_NAME_NOT_FOUND);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskInfo), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Execute the function being tested until the pass is reported */
+    HS_MonitorStacks();
+    HS_MonitorStacks();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskIDByName, 3);
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskInfo, 2);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.NextStack, 0);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Reported[0].StackSize, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* Nothing registered, each cycle reports an empty pass */
+    memset(&HS_AppData.StackMon, 0, sizeof(HS_AppData.StackMon));
+
+    HS_MonitorStacks();
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskIDByName, 3);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.NextStack, 0);
+}
+
+void Test_HS_StackMonHighWater(void)
+{
+    /* Test function for:
+     * uint32 HS_StackMonHighWater(cpuaddr StackBase, uint32 StackSize)
+     */
+    uint8 Stack[64];
+
+    /* never used */
+    memset(Stack, HS_STACKMON_FILL_BYTE, sizeof(Stack));
+    UtAssert_UINT32_EQ(HS_StackMonHighWater((cpuaddr)Stack, sizeof(Stack)), 0);
+
+    /* the lowest byte that was written is the high-water mark */
+    Stack[50] = 0;
+    Stack[40] = (uint8)~HS_STACKMON_FILL_BYTE;
+    UtAssert_UINT32_EQ(HS_StackMonHighWater((cpuaddr)Stack, sizeof(Stack)), 24);
+
+    /* all of it */
+    Stack[0] = 0;
+    UtAssert_UINT32_EQ(HS_StackMonHighWater((cpuaddr)Stack, sizeof(Stack)), sizeof(Stack));
+}
+
+void Test_HS_StackMonRank(void)
+{
+    /* Test function for:
+     * void HS_StackMonRank(const HS_StackMonTlm_t *EntryPtr)
+     */
+    HS_StackMonTlm_t Entries[6] = {{1, 1000, 500}, {2, 2000, 1500}, {3, 100, 50},
+                                   {4, 4000, 400}, {5, 10, 9},      {6, 1000, 50}};
+    uint32           i;
+
+    for (i = 0; i < 6; i++)
+    {
+        HS_StackMonRank(&Entries[i]);
+    }
+
+    /* Fullest first, ties in the order found, and the emptiest are dropped */
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Top[0].TaskId, 5);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Top[1].TaskId, 2);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Top[2].TaskId, 1);
+    UtAssert_UINT32_EQ(HS_AppData.StackMon.Top[3].TaskId, 3);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_HS_StackMonRegister, HS_Test_Setup, HS_Test_TearDown, "Test_HS_StackMonRegister");
+    UtTest_Add(Test_HS_MonitorStacks_Pass, HS_Test_Setup, HS_Test_TearDown, "Test_HS_MonitorStacks_Pass");
+    UtTest_Add(Test_HS_MonitorStacks_Skipped, HS_Test_Setup, HS_Test_TearDown, "Test_HS_MonitorStacks_Skipped");
+    UtTest_Add(Test_HS_StackMonHighWater, HS_Test_Setup, HS_Test_TearDown, "Test_HS_StackMonHighWater");
+    UtTest_Add(Test_HS_StackMonRank, HS_Test_Setup, HS_Test_TearDown, "Test_HS_StackMonRank");
+}
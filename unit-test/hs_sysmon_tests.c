@@ -24,6 +24,7 @@
 #include "hs_sysmon.h"
 #include "hs_app.h"
 #include "hs_platform_cfg.h"
+#include "hs_eventids.h"
 #include "hs_test_utils.h"
 
 #include "cfe_psp.h"
@@ -35,6 +36,23 @@
 #include "utstubs.h"
 
 #include <stdlib.h>
+#include <string.h>
+
+/* Two samples of /proc/stat, one second apart */
+static char HS_SysMon_Test_Stat1[] = "cpu  100 0 100 700 100 0 0 0 0 0\n"
+                                     "cpu0 50 0 50 350 50 0 0 0 0 0\n"
+                                     "cpu1 50 0 50 350 50 0 0 0 0 0\n"
+                                     "intr 1 2 3\n";
+static char HS_SysMon_Test_Stat2[] = "cpu  300 0 300 1300 100 0 0 0 0 0\n"
+                                     "cpu0 250 0 50 650 50 0 0 0 0 0\n"
+                                     "cpu1 50 0 50 750 150 0 0 0 0 0\n"
+                                     "intr 1 2 3\n";
+
+static void HS_SysMon_Test_SetStat(char *Stat)
+{
+    UT_ResetState(UT_KEY(OS_read));
+    UT_SetDataBuffer(UT_KEY(OS_read), Stat, strlen(Stat), false);
+}
 
 void Test_HS_SysMonInit(void)
 {
@@ -60,6 +78,29 @@ void Test_HS_SysMonInit(void)
     /* fail to lookup subchannel - non-fatal */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_IODriver_Command), 3, CFE_PSP_ERROR);
     UtAssert_INT32_EQ(HS_SysMonInit(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+}
+
+void Test_HS_SysMonInit_Proc(void)
+{
+    /* Test function for:
+     * int32 HS_SysMonInit(void)
+     */
+
+    /* no device, /proc is used instead */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_IODriver_FindByName), 1, CFE_PSP_ERROR);
+    HS_SysMon_Test_SetStat(HS_SysMon_Test_Stat1);
+    UtAssert_INT32_EQ(HS_SysMonInit(), CFE_SUCCESS);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(HS_AppData.SysMonProc.FileId));
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonProc.CoreCount, 2);
+
+    /* /proc can't be opened either - this is a non-fatal error */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_IODriver_FindByName), 1, CFE_PSP_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(HS_SysMonInit(), CFE_SUCCESS);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(HS_AppData.SysMonProc.FileId));
+    UtAssert_UINT32_EQ(HS_AppData.UtilCpuCores[0], 0xFFFFFFFF);
 }
 
 void Test_HS_SysMonCleanup(void)
@@ -79,6 +120,21 @@ void Test_HS_SysMonCleanup(void)
     /* Unable to stop */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_IODriver_Command), 1, CFE_PSP_ERROR);
     UtAssert_VOIDCALL(HS_SysMonCleanup());
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    /* /proc file is closed */
+    HS_AppData.SysMonPspModuleId = 0;
+    HS_AppData.SysMonProc.FileId = OS_ObjectIdFromInteger(1);
+    UtAssert_VOIDCALL(HS_SysMonCleanup());
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(HS_AppData.SysMonProc.FileId));
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 0);
+
+    /* sampler task is stopped */
+    HS_AppData.SysMonSampler.TaskState = HS_STATE_ENABLED;
+    UtAssert_VOIDCALL(HS_SysMonCleanup());
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 1);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.TaskState, HS_STATE_DISABLED);
 }
 
 void Test_HS_SysMonGetCpuUtilization(void)
@@ -98,6 +154,346 @@ void Test_HS_SysMonGetCpuUtilization(void)
     /* error reading from psp module, reports -1  */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_IODriver_Command), 1, CFE_PSP_ERROR);
     UtAssert_INT32_EQ(HS_SysMonGetCpuUtilization(), -1);
+
+    /* nominal - no psp module, reads /proc */
+    HS_AppData.SysMonPspModuleId = 0;
+    HS_AppData.SysMonProc.FileId = OS_ObjectIdFromInteger(1);
+    HS_SysMon_Test_SetStat(HS_SysMon_Test_Stat1);
+    UtAssert_INT32_EQ(HS_SysMonGetCpuUtilization(), (200 * HS_CPU_UTILIZATION_MAX) / 1000);
+    UtAssert_STUB_COUNT(CFE_PSP_IODriver_Command, 2);
+
+    /* sampler task running, its samples are averaged instead */
+    HS_AppData.SysMonSampler.TaskState = HS_STATE_ENABLED;
+    HS_AppData.SysMonSampler.Count     = 2;
+    HS_AppData.SysMonSampler.UtilSum   = 300;
+    HS_AppData.SysMonSampler.Ring[0]   = 9500;
+    HS_AppData.SysMonSampler.RingHead  = 1;
+    UtAssert_INT32_EQ(HS_SysMonGetCpuUtilization(), 150);
+    UtAssert_STUB_COUNT(OS_read, 1);
+
+    /* and the interval's bursts are reported along with it */
+    UtAssert_UINT32_EQ(HS_AppData.UtilBurstCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.UtilSamplePeak, 9500);
+}
+
+void Test_HS_SysMonTaskInit(void)
+{
+    /* Test function for:
+     * void HS_SysMonTaskInit(void)
+     */
+
+    HS_AppData.SysMonSampler.TaskState = HS_STATE_ENABLED;
+    HS_AppData.SysMonSampler.Count     = 5;
+
+    HS_SysMonTaskInit();
+
+#if HS_SYSMON_TASK_PERIOD == 0
+    /* No sampler task is configured */
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.TaskState, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+#else
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.TaskState, HS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.Count, 0);
+    UtAssert_INT32_EQ(HS_AppData.SysMonSampler.LastUtil, -1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* The task runs on a filled stack the stack monitor knows about */
+    UtAssert_UINT32_EQ(((uint8 *)HS_AppData.SysMonSampler.Stack)[0], HS_STACKMON_FILL_BYTE);
+    UtAssert_STUB_COUNT(HS_StackMonRegister, 1);
+
+    /* The /proc backend is not sampled faster than its clock ticks allow */
+    UtAssert_True(HS_AppData.SysMonSampler.Period >= HS_SYSMON_PROC_MIN_PERIOD, "Period %u",
+                  (unsigned int)HS_AppData.SysMonSampler.Period);
+
+    /* A PSP device is sampled on the configured period */
+    HS_AppData.SysMonPspModuleId = 0x1111;
+
+    HS_SysMonTaskInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.Period, HS_SYSMON_TASK_PERIOD);
+
+    /* HS keeps reading the system monitor itself */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), -1);
+
+    HS_SysMonTaskInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.TaskState, HS_STATE_DISABLED);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SYSMON_TASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(HS_StackMonRegister, 2);
+#endif
+}
+
+void Test_HS_SysMonTask(void)
+{
+    /* Test function for:
+     * void HS_SysMonTask(void)
+     */
+
+    HS_AppData.SysMonPspModuleId = 0x1111;
+
+    /* Run one period, then the delay fails as when the task is deleted */
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskDelay), 2, -1);
+
+    HS_SysMonTask();
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 2);
+    UtAssert_STUB_COUNT(CFE_ES_IncrementTaskCounter, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_IODriver_Command, 1);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.Count, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+}
+
+void Test_HS_SysMonTaskSample(void)
+{
+    /* Test function for:
+     * void HS_SysMonTaskSample(void)
+     */
+
+    /* nominal */
+    HS_AppData.SysMonPspModuleId = 0x1111;
+    HS_SysMonTaskSample();
+
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.Seq, 2);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.Count, 1);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.FailCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.RingHead, 1);
+
+    /* read failure is counted, not added to the totals */
+    HS_AppData.SysMonPspModuleId = 0;
+    HS_SysMonTaskSample();
+
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.Seq, 4);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.Count, 1);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.FailCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.RingHead, 1);
+
+    /* the ring wraps */
+    HS_AppData.SysMonPspModuleId      = 0x1111;
+    HS_AppData.SysMonSampler.RingHead = HS_SYSMON_RING_DEPTH;
+    HS_AppData.SysMonSampler.Ring[0]  = 1234;
+    HS_SysMonTaskSample();
+
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.Ring[0], 0);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.RingHead, HS_SYSMON_RING_DEPTH + 1);
+}
+
+void Test_HS_SysMonTaskConsume(void)
+{
+    /* Test function for:
+     * int32 HS_SysMonTaskConsume(void)
+     */
+
+    /* average of the samples since the previous call */
+    HS_AppData.SysMonSampler.Count   = 4;
+    HS_AppData.SysMonSampler.UtilSum = 1000;
+    UtAssert_INT32_EQ(HS_SysMonTaskConsume(), 250);
+
+    HS_AppData.SysMonSampler.Count   = 6;
+    HS_AppData.SysMonSampler.UtilSum = 1200;
+    UtAssert_INT32_EQ(HS_SysMonTaskConsume(), 100);
+
+    /* no samples since the previous call */
+    UtAssert_INT32_EQ(HS_SysMonTaskConsume(), -1);
+
+    /* sampler is in the middle of an update, the previous result is reused */
+    HS_AppData.SysMonSampler.LastUtil = 42;
+    HS_AppData.SysMonSampler.Seq      = 1;
+    HS_AppData.SysMonSampler.Count    = 7;
+    UtAssert_INT32_EQ(HS_SysMonTaskConsume(), 42);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.ContendedCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonSampler.LastCount, 6);
+
+    /* its sample is counted next time */
+    HS_AppData.SysMonSampler.Seq     = 2;
+    HS_AppData.SysMonSampler.UtilSum = 1500;
+    UtAssert_INT32_EQ(HS_SysMonTaskConsume(), 300);
+}
+
+void Test_HS_SysMonBurstUpdate(void)
+{
+    /* Test function for:
+     * void HS_SysMonBurstUpdate(void)
+     */
+    HS_SysMonSampler_t *SamplerPtr = &HS_AppData.SysMonSampler;
+    const uint16        Samples[]  = {100, 9500, 9600, 200, HS_UTIL_BURST_THRESHOLD, 9999};
+    uint32              i;
+
+    for (i = 0; i < sizeof(Samples) / sizeof(Samples[0]); i++)
+    {
+        SamplerPtr->Ring[i] = Samples[i];
+    }
+
+    /* two bursts, the second still going */
+    SamplerPtr->RingHead = 6;
+    HS_SysMonBurstUpdate();
+
+    UtAssert_UINT32_EQ(SamplerPtr->RingTail, 6);
+    UtAssert_UINT32_EQ(SamplerPtr->BurstCount, 2);
+    UtAssert_UINT32_EQ(SamplerPtr->BurstLongest, 2);
+    UtAssert_UINT32_EQ(SamplerPtr->BurstRun, 2);
+    UtAssert_UINT32_EQ(SamplerPtr->SamplePeak, 9999);
+    UtAssert_UINT32_EQ(SamplerPtr->LostCount, 0);
+
+    /* nothing new */
+    HS_SysMonBurstUpdate();
+
+    UtAssert_UINT32_EQ(SamplerPtr->RingTail, 6);
+    UtAssert_UINT32_EQ(SamplerPtr->BurstCount, 2);
+
+    /* the second burst goes on into the next cycle */
+    SamplerPtr->Ring[6]  = 9100;
+    SamplerPtr->RingHead = 7;
+    HS_SysMonBurstUpdate();
+
+    UtAssert_UINT32_EQ(SamplerPtr->BurstCount, 2);
+    UtAssert_UINT32_EQ(SamplerPtr->BurstLongest, 3);
+
+    /*
+     * The sampler lapped HS: the 3 overwritten samples are lost, and so is
+     * the oldest one left, since the sampler may be writing its slot now
+     */
+    memset(SamplerPtr->Ring, 0, sizeof(SamplerPtr->Ring));
+    SamplerPtr->RingHead = 7 + HS_SYSMON_RING_DEPTH + 3;
+    HS_SysMonBurstUpdate();
+
+    UtAssert_UINT32_EQ(SamplerPtr->LostCount, 4);
+    UtAssert_UINT32_EQ(SamplerPtr->RingTail, SamplerPtr->RingHead);
+    UtAssert_UINT32_EQ(SamplerPtr->BurstRun, 0);
+    UtAssert_UINT32_EQ(SamplerPtr->BurstCount, 2);
+}
+
+void Test_HS_SysMonBurstReport(void)
+{
+    /* Test function for:
+     * void HS_SysMonBurstReport(void)
+     */
+    HS_SysMonSampler_t *SamplerPtr = &HS_AppData.SysMonSampler;
+
+    SamplerPtr->Period       = 10;
+    SamplerPtr->BurstCount   = 3;
+    SamplerPtr->BurstLongest = 5;
+    SamplerPtr->BurstRun     = 2;
+    SamplerPtr->SamplePeak   = 9900;
+    SamplerPtr->LostCount    = 7;
+
+    /* the latest samples count toward the interval being reported */
+    SamplerPtr->Ring[0]  = 9950;
+    SamplerPtr->RingHead = 1;
+
+    HS_SysMonBurstReport();
+
+    UtAssert_UINT32_EQ(HS_AppData.UtilBurstCount, 3);
+    UtAssert_UINT32_EQ(HS_AppData.UtilBurstLongest, 50);
+    UtAssert_UINT32_EQ(HS_AppData.UtilSamplePeak, 9950);
+    UtAssert_UINT32_EQ(HS_AppData.UtilSamplesLost, 7);
+
+    /* a new interval starts, the burst in progress carries over */
+    UtAssert_UINT32_EQ(SamplerPtr->BurstCount, 0);
+    UtAssert_UINT32_EQ(SamplerPtr->BurstLongest, 0);
+    UtAssert_UINT32_EQ(SamplerPtr->SamplePeak, 0);
+    UtAssert_UINT32_EQ(SamplerPtr->BurstRun, 3);
+}
+
+void Test_HS_SysMonProcSample(void)
+{
+    /* Test function for:
+     * int32 HS_SysMonProcSample(void)
+     */
+
+    HS_AppData.SysMonProc.FileId = OS_ObjectIdFromInteger(1);
+
+    /* first sample measures from boot */
+    HS_SysMon_Test_SetStat(HS_SysMon_Test_Stat1);
+    UtAssert_INT32_EQ(HS_SysMonProcSample(), (200 * HS_CPU_UTILIZATION_MAX) / 1000);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonProc.CoreCount, 2);
+
+    /* later samples measure from the one before */
+    HS_SysMon_Test_SetStat(HS_SysMon_Test_Stat2);
+    UtAssert_INT32_EQ(HS_SysMonProcSample(), (400 * HS_CPU_UTILIZATION_MAX) / 1000);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCpuCores[0], (200 * HS_CPU_UTILIZATION_MAX) / 500);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCpuCores[1], 0);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCpuCores[2], 0xFFFFFFFF);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+}
+
+void Test_HS_SysMonProcSample_Partial(void)
+{
+    /* Test function for:
+     * int32 HS_SysMonProcSample(void)
+     */
+    char Truncated[] = "cpu  500 0 0 500\ncpu0 1 2";
+    char Unknown[]   = "cpu  500 0 0 500\ncpu200 1 1 1 1\ncpux 1 1 1 1\ncpu0 1 1 1 1\n";
+    char NoCpu[]     = "intr 1 2 3\n";
+    char TwoTotals[] = "cpu  500 0 0 500\ncpu  900 0 0 100\n";
+
+    HS_AppData.SysMonProc.FileId = OS_ObjectIdFromInteger(1);
+
+    /* a line cut off by the end of the read is ignored */
+    HS_SysMon_Test_SetStat(Truncated);
+    UtAssert_INT32_EQ(HS_SysMonProcSample(), HS_CPU_UTILIZATION_MAX / 2);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonProc.CoreCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCpuCores[0], 0xFFFFFFFF);
+
+    /* cores beyond HS_MAX_CPU_CORES aren't reported, and parsing stops at a bad line */
+    HS_SysMon_Test_SetStat(Unknown);
+    UtAssert_INT32_EQ(HS_SysMonProcSample(), HS_CPU_UTILIZATION_MAX / 2);
+    UtAssert_UINT32_EQ(HS_AppData.SysMonProc.CoreCount, 0);
+
+    /* only the first aggregate line is used */
+    memset(&HS_AppData.SysMonProc.Aggregate, 0, sizeof(HS_AppData.SysMonProc.Aggregate));
+    HS_SysMon_Test_SetStat(TwoTotals);
+    UtAssert_INT32_EQ(HS_SysMonProcSample(), HS_CPU_UTILIZATION_MAX / 2);
+
+    /* no aggregate line */
+    HS_SysMon_Test_SetStat(NoCpu);
+    UtAssert_INT32_EQ(HS_SysMonProcSample(), -1);
+
+    /* nothing read */
+    UT_ResetState(UT_KEY(OS_read));
+    UtAssert_INT32_EQ(HS_SysMonProcSample(), -1);
+
+    /* seek failure */
+    UT_ResetState(UT_KEY(OS_read));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, OS_ERROR);
+    UtAssert_INT32_EQ(HS_SysMonProcSample(), -1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+}
+
+void Test_HS_SysMonProcUtil(void)
+{
+    /* Test function for:
+     * uint32 HS_SysMonProcUtil(HS_SysMonProcTimes_t *PrevPtr, const HS_SysMonProcTimes_t *NowPtr, uint32 LastUtil)
+     */
+    HS_SysMonProcTimes_t Prev = {.Total = 1000, .Idle = 600};
+    HS_SysMonProcTimes_t Now  = {.Total = 2000, .Idle = 850};
+
+    /* nominal */
+    UtAssert_UINT32_EQ(HS_SysMonProcUtil(&Prev, &Now, 7), (750 * HS_CPU_UTILIZATION_MAX) / 1000);
+    UtAssert_UINT32_EQ(Prev.Total, 2000);
+    UtAssert_UINT32_EQ(Prev.Idle, 850);
+
+    /* no time passed, the last value is kept */
+    UtAssert_UINT32_EQ(HS_SysMonProcUtil(&Prev, &Now, 7), 7);
+
+    /* counters went backwards, the last value is kept and a new period starts */
+    Now.Total = 100;
+    Now.Idle  = 50;
+    UtAssert_UINT32_EQ(HS_SysMonProcUtil(&Prev, &Now, 7), 7);
+    UtAssert_UINT32_EQ(Prev.Total, 100);
+
+    /* idle counter went backwards */
+    Now.Total = 200;
+    Now.Idle  = 10;
+    UtAssert_UINT32_EQ(HS_SysMonProcUtil(&Prev, &Now, 7), 7);
+
+    /* more idle than total time */
+    Now.Total = 210;
+    Now.Idle  = 30;
+    UtAssert_UINT32_EQ(HS_SysMonProcUtil(&Prev, &Now, 7), 7);
 }
 
 /*
@@ -106,7 +502,19 @@ void Test_HS_SysMonGetCpuUtilization(void)
 void UtTest_Setup(void)
 {
     UtTest_Add(Test_HS_SysMonInit, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonInit");
+    UtTest_Add(Test_HS_SysMonInit_Proc, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonInit_Proc");
 
     UtTest_Add(Test_HS_SysMonCleanup, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonCleanup");
     UtTest_Add(Test_HS_SysMonGetCpuUtilization, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonGetCpuUtilization");
+    UtTest_Add(Test_HS_SysMonProcSample, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonProcSample");
+    UtTest_Add(Test_HS_SysMonProcSample_Partial, HS_Test_Setup, HS_Test_TearDown,
+               "Test_HS_SysMonProcSample_Partial");
+    UtTest_Add(Test_HS_SysMonProcUtil, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonProcUtil");
+
+    UtTest_Add(Test_HS_SysMonTaskInit, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonTaskInit");
+    UtTest_Add(Test_HS_SysMonTask, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonTask");
+    UtTest_Add(Test_HS_SysMonTaskSample, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonTaskSample");
+    UtTest_Add(Test_HS_SysMonTaskConsume, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonTaskConsume");
+    UtTest_Add(Test_HS_SysMonBurstUpdate, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonBurstUpdate");
+    UtTest_Add(Test_HS_SysMonBurstReport, HS_Test_Setup, HS_Test_TearDown, "Test_HS_SysMonBurstReport");
 }
@@ -0,0 +1,274 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "hs_timing.h"
+#include "hs_app.h"
+#include "hs_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Local clock readings, in microseconds, returned by successive OS_GetLocalTime calls */
+int64 HS_TIMING_TEST_ClockUsec[4];
+
+void HS_TIMING_TEST_OS_GetLocalTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *TimePtr = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+
+    *TimePtr = OS_TimeFromTotalMicroseconds(HS_TIMING_TEST_ClockUsec[UT_GetStubCount(FuncKey) - 1]);
+}
+
+void HS_Timing_Test_SetupClock(int64 Start1, int64 Stop1, int64 Start2, int64 Stop2)
+{
+    HS_TIMING_TEST_ClockUsec[0] = Start1;
+    HS_TIMING_TEST_ClockUsec[1] = Stop1;
+    HS_TIMING_TEST_ClockUsec[2] = Start2;
+    HS_TIMING_TEST_ClockUsec[3] = Stop2;
+
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), HS_TIMING_TEST_OS_GetLocalTimeHandler, NULL);
+}
+
+void Test_HS_TimingStartStop(void)
+{
+    /* Test function for:
+     * void HS_TimingStart(uint32 Phase)
+     * void HS_TimingStop(uint32 Phase)
+     */
+
+    HS_Timing_Test_SetupClock(1000, 1250, 5000, 5100);
+
+    HS_TimingStart(HS_PHASE_APPMON);
+    HS_TimingStop(HS_PHASE_APPMON);
+
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_APPMON].Count, 1);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_APPMON].MinUsec, 250);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_APPMON].MaxUsec, 250);
+
+    HS_TimingStart(HS_PHASE_APPMON);
+    HS_TimingStop(HS_PHASE_APPMON);
+
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_APPMON].Count, 2);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_APPMON].MinUsec, 100);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_APPMON].MaxUsec, 250);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.PhaseTotalUsec[HS_PHASE_APPMON], 350);
+
+    /* Other phases are untouched */
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_CMDS].Count, 0);
+
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 4);
+}
+
+void Test_HS_TimingStop_ClockBackwards(void)
+{
+    /* Test function for:
+     * void HS_TimingStop(uint32 Phase)
+     */
+
+    HS_Timing_Test_SetupClock(5000, 4000, 0, 0);
+
+    HS_TimingStart(HS_PHASE_CMDS);
+    HS_TimingStop(HS_PHASE_CMDS);
+
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_CMDS].Count, 1);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_CMDS].MinUsec, 0);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_CMDS].MaxUsec, 0);
+}
+
+void Test_HS_TimingStop_Saturate(void)
+{
+    /* Test function for:
+     * void HS_TimingStop(uint32 Phase)
+     */
+
+    HS_Timing_Test_SetupClock(0, 0x100000000LL, 0, 0);
+
+    HS_TimingStart(HS_PHASE_TBLMGMT);
+    HS_TimingStop(HS_PHASE_TBLMGMT);
+
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_TBLMGMT].MaxUsec, 0xFFFFFFFF);
+}
+
+void Test_HS_TimingReset(void)
+{
+    /* Test function for:
+     * void HS_TimingReset(void)
+     */
+
+    HS_AppData.Timing.Stats.Phases[HS_PHASE_MSGACTS].Count   = 3;
+    HS_AppData.Timing.Stats.Phases[HS_PHASE_MSGACTS].MinUsec = 10;
+    HS_AppData.Timing.Stats.Phases[HS_PHASE_MSGACTS].MaxUsec = 30;
+    HS_AppData.Timing.Stats.PhaseTotalUsec[HS_PHASE_MSGACTS]  = 60;
+
+    HS_TimingReset();
+
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_MSGACTS].Count, 0);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_MSGACTS].MinUsec, 0);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.Phases[HS_PHASE_MSGACTS].MaxUsec, 0);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.PhaseTotalUsec[HS_PHASE_MSGACTS], 0);
+}
+
+void Test_HS_TimingReport(void)
+{
+    /* Test function for:
+     * void HS_TimingReport(HS_TimingTlm_Payload_t *PayloadPtr)
+     */
+
+    HS_TimingTlm_Payload_t Payload;
+
+    memset(&Payload, 0xFF, sizeof(Payload));
+
+    HS_AppData.Timing.Stats.Phases[HS_PHASE_CPUUTIL].Count   = 4;
+    HS_AppData.Timing.Stats.Phases[HS_PHASE_CPUUTIL].MinUsec = 10;
+    HS_AppData.Timing.Stats.Phases[HS_PHASE_CPUUTIL].MaxUsec = 70;
+    HS_AppData.Timing.Stats.PhaseTotalUsec[HS_PHASE_CPUUTIL]  = 130;
+
+    HS_TimingReport(&Payload);
+
+    UtAssert_UINT32_EQ(Payload.Phases[HS_PHASE_CPUUTIL].Count, 4);
+    UtAssert_UINT32_EQ(Payload.Phases[HS_PHASE_CPUUTIL].MinUsec, 10);
+    UtAssert_UINT32_EQ(Payload.Phases[HS_PHASE_CPUUTIL].AvgUsec, 32);
+    UtAssert_UINT32_EQ(Payload.Phases[HS_PHASE_CPUUTIL].MaxUsec, 70);
+
+    /* Phases never timed report all zero */
+    UtAssert_UINT32_EQ(Payload.Phases[HS_PHASE_EVENTMON].Count, 0);
+    UtAssert_UINT32_EQ(Payload.Phases[HS_PHASE_EVENTMON].AvgUsec, 0);
+
+    /* No wakeup intervals measured yet */
+    UtAssert_UINT32_EQ(Payload.IntervalCount, 0);
+    UtAssert_UINT32_EQ(Payload.IntervalAvgUsec, 0);
+    UtAssert_UINT32_EQ(Payload.IntervalStdDevUsec, 0);
+}
+
+void Test_HS_TimingReport_Intervals(void)
+{
+    /* Test function for:
+     * void HS_TimingReport(HS_TimingTlm_Payload_t *PayloadPtr)
+     */
+
+    HS_TimingTlm_Payload_t Payload;
+
+    HS_AppData.Timing.Stats.WakeupCount  = 5;
+    HS_AppData.Timing.Stats.TimeoutCount = 1;
+    HS_AppData.Timing.Stats.OverrunCount = 2;
+    HS_AppData.Timing.Stats.CycleMaxUsec = 300000;
+
+    HS_TimingAddInterval(1000000);
+    HS_TimingAddInterval(1000010);
+    HS_TimingAddInterval(999990);
+
+    HS_TimingReport(&Payload);
+
+    UtAssert_UINT32_EQ(Payload.WakeupCount, 5);
+    UtAssert_UINT32_EQ(Payload.TimeoutCount, 1);
+    UtAssert_UINT32_EQ(Payload.OverrunCount, 2);
+    UtAssert_UINT32_EQ(Payload.CycleMaxUsec, 300000);
+    UtAssert_UINT32_EQ(Payload.IntervalCount, 3);
+    UtAssert_UINT32_EQ(Payload.IntervalMinUsec, 999990);
+    UtAssert_UINT32_EQ(Payload.IntervalMaxUsec, 1000010);
+    UtAssert_UINT32_EQ(Payload.IntervalAvgUsec, 1000000);
+
+    /* Variance of 200 / 3, rounded down to 66 */
+    UtAssert_UINT32_EQ(Payload.IntervalStdDevUsec, 8);
+}
+
+void Test_HS_TimingCycleStart(void)
+{
+    /* Test function for:
+     * void HS_TimingCycleStart(CFE_Status_t RcvStatus)
+     */
+
+    HS_Timing_Test_SetupClock(1000000, 2000100, 3200000, 4000000);
+
+    HS_TimingCycleStart(CFE_SUCCESS);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.IntervalCount, 0);
+
+    HS_TimingCycleStart(CFE_SUCCESS);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.IntervalCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.IntervalMinUsec, 1000100);
+
+    /* A timeout does not count as an interval, nor does the wakeup after it */
+    HS_TimingCycleStart(CFE_SB_TIME_OUT);
+    HS_TimingCycleStart(CFE_SUCCESS);
+
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.WakeupCount, 3);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.TimeoutCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.IntervalCount, 1);
+    UtAssert_BOOL_TRUE(HS_AppData.Timing.Stats.LastWasWakeup);
+}
+
+void Test_HS_TimingCycleEnd(void)
+{
+    /* Test function for:
+     * void HS_TimingCycleEnd(void)
+     */
+
+    HS_Timing_Test_SetupClock(0, (HS_CYCLE_BUDGET * 1000) + 1, 5000000, 5000100);
+
+    HS_TimingCycleStart(CFE_SB_NO_MESSAGE);
+    HS_TimingCycleEnd();
+
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.OverrunCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.CycleMaxUsec, (HS_CYCLE_BUDGET * 1000) + 1);
+
+    /* Within budget */
+    HS_TimingCycleStart(CFE_SUCCESS);
+    HS_TimingCycleEnd();
+
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.OverrunCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.Timing.Stats.CycleMaxUsec, (HS_CYCLE_BUDGET * 1000) + 1);
+}
+
+void Test_HS_TimingSqrt(void)
+{
+    /* Test function for:
+     * uint32 HS_TimingSqrt(uint64 Value)
+     */
+
+    UtAssert_UINT32_EQ(HS_TimingSqrt(0), 0);
+    UtAssert_UINT32_EQ(HS_TimingSqrt(1), 1);
+    UtAssert_UINT32_EQ(HS_TimingSqrt(15), 3);
+    UtAssert_UINT32_EQ(HS_TimingSqrt(16), 4);
+    UtAssert_UINT32_EQ(HS_TimingSqrt(0xFFFFFFFFFFFFFFFFULL), 0xFFFFFFFF);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_HS_TimingStartStop, HS_Test_Setup, HS_Test_TearDown, "Test_HS_TimingStartStop");
+    UtTest_Add(Test_HS_TimingStop_ClockBackwards, HS_Test_Setup, HS_Test_TearDown,
+               "Test_HS_TimingStop_ClockBackwards");
+    UtTest_Add(Test_HS_TimingStop_Saturate, HS_Test_Setup, HS_Test_TearDown, "Test_HS_TimingStop_Saturate");
+    UtTest_Add(Test_HS_TimingReset, HS_Test_Setup, HS_Test_TearDown, "Test_HS_TimingReset");
+    UtTest_Add(Test_HS_TimingReport, HS_Test_Setup, HS_Test_TearDown, "Test_HS_TimingReport");
+    UtTest_Add(Test_HS_TimingReport_Intervals, HS_Test_Setup, HS_Test_TearDown, "Test_HS_TimingReport_Intervals");
+    UtTest_Add(Test_HS_TimingCycleStart, HS_Test_Setup, HS_Test_TearDown, "Test_HS_TimingCycleStart");
+    UtTest_Add(Test_HS_TimingCycleEnd, HS_Test_Setup, HS_Test_TearDown, "Test_HS_TimingCycleEnd");
+    UtTest_Add(Test_HS_TimingSqrt, HS_Test_Setup, HS_Test_TearDown, "Test_HS_TimingSqrt");
+}
@@ -59,6 +59,32 @@ void HS_AMTActionIsValid_Invalid(void)
     UtAssert_True(Result == false, "Result == false");
 }
 
+void HS_AMTEscalationIsValid_Test(void)
+{
+    HS_AMTEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* No escalation at all */
+    UtAssert_BOOL_TRUE(HS_AMTEscalationIsValid(&Entry));
+
+    /* A ladder that ends before the last rung */
+    Entry.Escalation[0].ActionType = HS_AMT_ACT_APP_RESTART;
+    UtAssert_BOOL_TRUE(HS_AMTEscalationIsValid(&Entry));
+
+    /* A rung that could never be reached */
+    Entry.Escalation[HS_MAX_ESCALATION_RUNGS - 1].ActionType = HS_AMT_ACT_PROC_RESET;
+    if (HS_MAX_ESCALATION_RUNGS > 2)
+    {
+        UtAssert_BOOL_FALSE(HS_AMTEscalationIsValid(&Entry));
+    }
+
+    /* An action that doesn't exist */
+    memset(&Entry, 0, sizeof(Entry));
+    Entry.Escalation[0].ActionType = HS_AMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
+    UtAssert_BOOL_FALSE(HS_AMTEscalationIsValid(&Entry));
+}
+
 void HS_EMTActionIsValid_Valid(void)
 {
     uint16 Action = (HS_EMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES);
@@ -77,6 +103,23 @@ void HS_EMTActionIsValid_Invalid(void)
     UtAssert_True(Result == false, "Result == false");
 }
 
+void HS_KeyHash_Test(void)
+{
+    uint32 Hash;
+
+    Hash = HS_KeyHash("AppName", 1);
+
+    /* Same key always hashes the same */
+    UtAssert_UINT32_EQ(HS_KeyHash("AppName", 1), Hash);
+
+    /* Name and numeric key both contribute */
+    UtAssert_True(HS_KeyHash("AppName", 2) != Hash, "HS_KeyHash(\"AppName\", 2) != Hash");
+    UtAssert_True(HS_KeyHash("AppNamf", 1) != Hash, "HS_KeyHash(\"AppNamf\", 1) != Hash");
+
+    /* Empty name is still a valid key */
+    UtAssert_True(HS_KeyHash("", 0) != HS_KeyHash("", 1), "HS_KeyHash(\"\", 0) != HS_KeyHash(\"\", 1)");
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -86,7 +129,11 @@ void UtTest_Setup(void)
 
     UtTest_Add(HS_AMTActionIsValid_Invalid, HS_Test_Setup, HS_Test_TearDown, "HS_AMTActionIsValid_Invalid");
 
+    UtTest_Add(HS_AMTEscalationIsValid_Test, HS_Test_Setup, HS_Test_TearDown, "HS_AMTEscalationIsValid_Test");
+
     UtTest_Add(HS_EMTActionIsValid_Valid, HS_Test_Setup, HS_Test_TearDown, "HS_EMTActionIsValid_Valid");
 
     UtTest_Add(HS_EMTActionIsValid_Invalid, HS_Test_Setup, HS_Test_TearDown, "HS_EMTActionIsValid_Invalid");
+
+    UtTest_Add(HS_KeyHash_Test, HS_Test_Setup, HS_Test_TearDown, "HS_KeyHash_Test");
 }
@@ -0,0 +1,183 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "hs_watchdog.h"
+#include "hs_app.h"
+#include "hs_eventids.h"
+#include "hs_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+void HS_WATCHDOG_TEST_Setup(void)
+{
+    HS_Test_Setup();
+
+    HS_AppData.WatchdogTaskPeriod = 500;
+}
+
+void Test_HS_WatchdogTaskInit(void)
+{
+    /* Test function for:
+     * void HS_WatchdogTaskInit(void)
+     */
+
+    HS_AppData.WatchdogHeartbeat = 4;
+    HS_AppData.WatchdogStaleMsec = 100;
+
+    HS_WatchdogTaskInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogTaskState, HS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogLastHeartbeat, 4);
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogStaleMsec, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* The task runs on a filled stack the stack monitor knows about */
+    UtAssert_UINT32_EQ(((uint8 *)HS_AppData.WatchdogStack)[0], HS_STACKMON_FILL_BYTE);
+    UtAssert_STUB_COUNT(HS_StackMonRegister, 1);
+
+    /* No task with a period of 0 */
+    HS_AppData.WatchdogTaskPeriod = 0;
+
+    HS_WatchdogTaskInit();
+
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogTaskState, HS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+}
+
+void Test_HS_WatchdogTaskInit_Error(void)
+{
+    /* Test function for:
+     * void HS_WatchdogTaskInit(void)
+     */
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), -1);
+
+    HS_AppData.WatchdogTaskState = HS_STATE_ENABLED;
+
+    HS_WatchdogTaskInit();
+
+    /* The main loop keeps servicing the watchdog */
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogTaskState, HS_STATE_DISABLED);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_WATCHDOG_TASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(HS_StackMonRegister, 0);
+}
+
+void Test_HS_WatchdogTask(void)
+{
+    /* Test function for:
+     * void HS_WatchdogTask(void)
+     */
+
+    HS_AppData.ServiceWatchdogFlag = HS_STATE_ENABLED;
+    HS_AppData.WatchdogTaskState   = HS_STATE_ENABLED;
+
+    /* Run one period, then the delay fails as when the task is deleted */
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskDelay), 2, -1);
+
+    HS_WatchdogTask();
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 2);
+    UtAssert_STUB_COUNT(CFE_ES_IncrementTaskCounter, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_WatchdogService, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+
+    /* The main loop services the watchdog again */
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogTaskState, HS_STATE_DISABLED);
+}
+
+void Test_HS_WatchdogCheck(void)
+{
+    /* Test function for:
+     * void HS_WatchdogCheck(void)
+     */
+    uint32 i;
+
+    HS_AppData.ServiceWatchdogFlag = HS_STATE_ENABLED;
+    HS_AppData.WatchdogHeartbeat   = 1;
+    HS_AppData.WatchdogStaleMsec   = HS_AppData.WatchdogTaskPeriod;
+
+    /* Heartbeat moved */
+    HS_WatchdogCheck();
+
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogLastHeartbeat, 1);
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogStaleMsec, 0);
+    UtAssert_STUB_COUNT(CFE_PSP_WatchdogService, 1);
+
+    /* Heartbeat stalls, serviced until the timeout */
+    for (i = 0; i < HS_WATCHDOG_HEARTBEAT_TIMEOUT / HS_AppData.WatchdogTaskPeriod; i++)
+    {
+        HS_WatchdogCheck();
+    }
+
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogStaleMsec, HS_WATCHDOG_HEARTBEAT_TIMEOUT);
+    UtAssert_STUB_COUNT(CFE_PSP_WatchdogService, HS_WATCHDOG_HEARTBEAT_TIMEOUT / HS_AppData.WatchdogTaskPeriod);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_WATCHDOG_STALL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Still stalled, reported only once */
+    HS_WatchdogCheck();
+
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogStaleMsec, HS_WATCHDOG_HEARTBEAT_TIMEOUT);
+    UtAssert_STUB_COUNT(CFE_PSP_WatchdogService, HS_WATCHDOG_HEARTBEAT_TIMEOUT / HS_AppData.WatchdogTaskPeriod);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* HS recovered before the watchdog expired */
+    HS_AppData.WatchdogHeartbeat++;
+
+    HS_WatchdogCheck();
+
+    UtAssert_UINT32_EQ(HS_AppData.WatchdogStaleMsec, 0);
+    UtAssert_STUB_COUNT(CFE_PSP_WatchdogService, (HS_WATCHDOG_HEARTBEAT_TIMEOUT / HS_AppData.WatchdogTaskPeriod) + 1);
+
+    /* HS is about to reset the processor */
+    HS_AppData.ServiceWatchdogFlag = HS_STATE_DISABLED;
+    HS_AppData.WatchdogHeartbeat++;
+
+    HS_WatchdogCheck();
+
+    UtAssert_STUB_COUNT(CFE_PSP_WatchdogService, (HS_WATCHDOG_HEARTBEAT_TIMEOUT / HS_AppData.WatchdogTaskPeriod) + 1);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_HS_WatchdogTaskInit, HS_WATCHDOG_TEST_Setup, HS_Test_TearDown, "Test_HS_WatchdogTaskInit");
+    UtTest_Add(Test_HS_WatchdogTaskInit_Error, HS_WATCHDOG_TEST_Setup, HS_Test_TearDown,
+               "Test_HS_WatchdogTaskInit_Error");
+    UtTest_Add(Test_HS_WatchdogTask, HS_WATCHDOG_TEST_Setup, HS_Test_TearDown, "Test_HS_WatchdogTask");
+    UtTest_Add(Test_HS_WatchdogCheck, HS_WATCHDOG_TEST_Setup, HS_Test_TearDown, "Test_HS_WatchdogCheck");
+}
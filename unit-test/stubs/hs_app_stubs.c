@@ -26,6 +26,17 @@
 #include "hs_app.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_AMSTableInit()
+ * ----------------------------------------------------
+ */
+void HS_AMSTableInit(void)
+{
+
+    UT_GenStub_Execute(HS_AMSTableInit, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_AppInit()
@@ -106,3 +117,16 @@ CFE_Status_t HS_TblInit(void)
 
     return UT_GenStub_GetReturnValue(HS_TblInit, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TblNotifyRegister()
+ * ----------------------------------------------------
+ */
+void HS_TblNotifyRegister(CFE_TBL_Handle_t TblHandle, uint8 TblFlag)
+{
+    UT_GenStub_AddParam(HS_TblNotifyRegister, CFE_TBL_Handle_t, TblHandle);
+    UT_GenStub_AddParam(HS_TblNotifyRegister, uint8, TblFlag);
+
+    UT_GenStub_Execute(HS_TblNotifyRegister, Basic, NULL);
+}
@@ -37,6 +37,18 @@ void HS_AcquirePointers(void)
     UT_GenStub_Execute(HS_AcquirePointers, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_AppMonAddrError()
+ * ----------------------------------------------------
+ */
+void HS_AppMonAddrError(CFE_Status_t Status)
+{
+    UT_GenStub_AddParam(HS_AppMonAddrError, CFE_Status_t, Status);
+
+    UT_GenStub_Execute(HS_AppMonAddrError, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_AppMonStatusRefresh()
@@ -176,6 +188,45 @@ CFE_Status_t HS_EnableEventMonCmd(const HS_EnableEventMonCmd_t *BufPtr)
     return UT_GenStub_GetReturnValue(HS_EnableEventMonCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_EventMonAddrError()
+ * ----------------------------------------------------
+ */
+void HS_EventMonAddrError(CFE_Status_t Status)
+{
+    UT_GenStub_AddParam(HS_EventMonAddrError, CFE_Status_t, Status);
+
+    UT_GenStub_Execute(HS_EventMonAddrError, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_ManageTablesCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t HS_ManageTablesCmd(const HS_ManageTablesCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HS_ManageTablesCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(HS_ManageTablesCmd, const HS_ManageTablesCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(HS_ManageTablesCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_ManageTablesCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MemMonStatusRefresh()
+ * ----------------------------------------------------
+ */
+void HS_MemMonStatusRefresh(void)
+{
+
+    UT_GenStub_Execute(HS_MemMonStatusRefresh, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_MsgActsStatusRefresh()
@@ -187,6 +238,17 @@ void HS_MsgActsStatusRefresh(void)
     UT_GenStub_Execute(HS_MsgActsStatusRefresh, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgMonStatusRefresh()
+ * ----------------------------------------------------
+ */
+void HS_MsgMonStatusRefresh(void)
+{
+
+    UT_GenStub_Execute(HS_MsgMonStatusRefresh, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_NoopCmd()
@@ -203,6 +265,38 @@ CFE_Status_t HS_NoopCmd(const HS_NoopCmd_t *BufPtr)
     return UT_GenStub_GetReturnValue(HS_NoopCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RegisterPoolCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t HS_RegisterPoolCmd(const HS_RegisterPoolCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HS_RegisterPoolCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(HS_RegisterPoolCmd, const HS_RegisterPoolCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(HS_RegisterPoolCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_RegisterPoolCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RegisterStackCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t HS_RegisterStackCmd(const HS_RegisterStackCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HS_RegisterStackCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(HS_RegisterStackCmd, const HS_RegisterStackCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(HS_RegisterStackCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_RegisterStackCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_ResetCmd()
@@ -246,6 +340,38 @@ CFE_Status_t HS_ResetResetsPerformedCmd(const HS_ResetResetsPerformedCmd_t *BufP
     return UT_GenStub_GetReturnValue(HS_ResetResetsPerformedCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_ResetTimingCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t HS_ResetTimingCmd(const HS_ResetTimingCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HS_ResetTimingCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(HS_ResetTimingCmd, const HS_ResetTimingCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(HS_ResetTimingCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_ResetTimingCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SendHistoryCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t HS_SendHistoryCmd(const HS_SendHistoryCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SendHistoryCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(HS_SendHistoryCmd, const HS_SendHistoryCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(HS_SendHistoryCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SendHistoryCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_SendHkCmd()
@@ -277,3 +403,21 @@ CFE_Status_t HS_SetMaxResetsCmd(const HS_SetMaxResetsCmd_t *BufPtr)
 
     return UT_GenStub_GetReturnValue(HS_SetMaxResetsCmd, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TblManageNeeded()
+ * ----------------------------------------------------
+ */
+bool HS_TblManageNeeded(uint8 TblFlag, CFE_TBL_Handle_t TblHandle, bool Compiled)
+{
+    UT_GenStub_SetupReturnBuffer(HS_TblManageNeeded, bool);
+
+    UT_GenStub_AddParam(HS_TblManageNeeded, uint8, TblFlag);
+    UT_GenStub_AddParam(HS_TblManageNeeded, CFE_TBL_Handle_t, TblHandle);
+    UT_GenStub_AddParam(HS_TblManageNeeded, bool, Compiled);
+
+    UT_GenStub_Execute(HS_TblManageNeeded, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_TblManageNeeded, bool);
+}
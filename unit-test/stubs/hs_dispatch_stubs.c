@@ -40,158 +40,98 @@ void HS_AppPipe(const CFE_SB_Buffer_t *BufPtr)
 
 /*
  * ----------------------------------------------------
- * Generated stub function for HS_DisableAlivenessVerifyDispatch()
+ * Generated stub function for HS_CmdHistBin()
  * ----------------------------------------------------
  */
-void HS_DisableAlivenessVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+uint32 HS_CmdHistBin(uint32 Usec)
 {
-    UT_GenStub_AddParam(HS_DisableAlivenessVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_SetupReturnBuffer(HS_CmdHistBin, uint32);
 
-    UT_GenStub_Execute(HS_DisableAlivenessVerifyDispatch, Basic, NULL);
-}
+    UT_GenStub_AddParam(HS_CmdHistBin, uint32, Usec);
 
-/*
- * ----------------------------------------------------
- * Generated stub function for HS_DisableAppMonVerifyDispatch()
- * ----------------------------------------------------
- */
-void HS_DisableAppMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    UT_GenStub_AddParam(HS_DisableAppMonVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
-
-    UT_GenStub_Execute(HS_DisableAppMonVerifyDispatch, Basic, NULL);
-}
-
-/*
- * ----------------------------------------------------
- * Generated stub function for HS_DisableCpuHogVerifyDispatch()
- * ----------------------------------------------------
- */
-void HS_DisableCpuHogVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    UT_GenStub_AddParam(HS_DisableCpuHogVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_Execute(HS_CmdHistBin, Basic, NULL);
 
-    UT_GenStub_Execute(HS_DisableCpuHogVerifyDispatch, Basic, NULL);
+    return UT_GenStub_GetReturnValue(HS_CmdHistBin, uint32);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for HS_DisableEventMonVerifyDispatch()
+ * Generated stub function for HS_CmdLaneDispatch()
  * ----------------------------------------------------
  */
-void HS_DisableEventMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+void HS_CmdLaneDispatch(const CFE_SB_Buffer_t *BufPtr, uint32 Lane)
 {
-    UT_GenStub_AddParam(HS_DisableEventMonVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(HS_CmdLaneDispatch, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(HS_CmdLaneDispatch, uint32, Lane);
 
-    UT_GenStub_Execute(HS_DisableEventMonVerifyDispatch, Basic, NULL);
+    UT_GenStub_Execute(HS_CmdLaneDispatch, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for HS_EnableAlivenessVerifyDispatch()
+ * Generated stub function for HS_CmdLaneDrain()
  * ----------------------------------------------------
  */
-void HS_EnableAlivenessVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+void HS_CmdLaneDrain(void)
 {
-    UT_GenStub_AddParam(HS_EnableAlivenessVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
 
-    UT_GenStub_Execute(HS_EnableAlivenessVerifyDispatch, Basic, NULL);
+    UT_GenStub_Execute(HS_CmdLaneDrain, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for HS_EnableAppMonVerifyDispatch()
+ * Generated stub function for HS_CmdLaneReport()
  * ----------------------------------------------------
  */
-void HS_EnableAppMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+void HS_CmdLaneReport(void)
 {
-    UT_GenStub_AddParam(HS_EnableAppMonVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
 
-    UT_GenStub_Execute(HS_EnableAppMonVerifyDispatch, Basic, NULL);
+    UT_GenStub_Execute(HS_CmdLaneReport, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for HS_EnableCpuHogVerifyDispatch()
+ * Generated stub function for HS_CmdPipeRead()
  * ----------------------------------------------------
  */
-void HS_EnableCpuHogVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+CFE_Status_t HS_CmdPipeRead(void)
 {
-    UT_GenStub_AddParam(HS_EnableCpuHogVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_SetupReturnBuffer(HS_CmdPipeRead, CFE_Status_t);
 
-    UT_GenStub_Execute(HS_EnableCpuHogVerifyDispatch, Basic, NULL);
-}
+    UT_GenStub_Execute(HS_CmdPipeRead, Basic, NULL);
 
-/*
- * ----------------------------------------------------
- * Generated stub function for HS_EnableEventMonVerifyDispatch()
- * ----------------------------------------------------
- */
-void HS_EnableEventMonVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    UT_GenStub_AddParam(HS_EnableEventMonVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
-
-    UT_GenStub_Execute(HS_EnableEventMonVerifyDispatch, Basic, NULL);
+    return UT_GenStub_GetReturnValue(HS_CmdPipeRead, CFE_Status_t);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for HS_NoopVerifyDispatch()
+ * Generated stub function for HS_DispatchCmd()
  * ----------------------------------------------------
  */
-void HS_NoopVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+void HS_DispatchCmd(const CFE_SB_Buffer_t *BufPtr, const HS_CmdDispatchEntry_t *EntryPtr,
+                    HS_CmdCodeStats_t *StatsPtr)
 {
-    UT_GenStub_AddParam(HS_NoopVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(HS_DispatchCmd, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(HS_DispatchCmd, const HS_CmdDispatchEntry_t *, EntryPtr);
+    UT_GenStub_AddParam(HS_DispatchCmd, HS_CmdCodeStats_t *, StatsPtr);
 
-    UT_GenStub_Execute(HS_NoopVerifyDispatch, Basic, NULL);
+    UT_GenStub_Execute(HS_DispatchCmd, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for HS_ResetResetsPerformedVerifyDispatch()
+ * Generated stub function for HS_IsPriorityCmd()
  * ----------------------------------------------------
  */
-void HS_ResetResetsPerformedVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+bool HS_IsPriorityCmd(const CFE_SB_Buffer_t *BufPtr)
 {
-    UT_GenStub_AddParam(HS_ResetResetsPerformedVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_SetupReturnBuffer(HS_IsPriorityCmd, bool);
 
-    UT_GenStub_Execute(HS_ResetResetsPerformedVerifyDispatch, Basic, NULL);
-}
+    UT_GenStub_AddParam(HS_IsPriorityCmd, const CFE_SB_Buffer_t *, BufPtr);
 
-/*
- * ----------------------------------------------------
- * Generated stub function for HS_ResetVerifyDispatch()
- * ----------------------------------------------------
- */
-void HS_ResetVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    UT_GenStub_AddParam(HS_ResetVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
-
-    UT_GenStub_Execute(HS_ResetVerifyDispatch, Basic, NULL);
-}
-
-/*
- * ----------------------------------------------------
- * Generated stub function for HS_SendHkVerifyDispatch()
- * ----------------------------------------------------
- */
-void HS_SendHkVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    UT_GenStub_AddParam(HS_SendHkVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
-
-    UT_GenStub_Execute(HS_SendHkVerifyDispatch, Basic, NULL);
-}
-
-/*
- * ----------------------------------------------------
- * Generated stub function for HS_SetMaxResetsVerifyDispatch()
- * ----------------------------------------------------
- */
-void HS_SetMaxResetsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
-{
-    UT_GenStub_AddParam(HS_SetMaxResetsVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_Execute(HS_IsPriorityCmd, Basic, NULL);
 
-    UT_GenStub_Execute(HS_SetMaxResetsVerifyDispatch, Basic, NULL);
+    return UT_GenStub_GetReturnValue(HS_IsPriorityCmd, bool);
 }
 
 /*
@@ -0,0 +1,80 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in hs_history header
+ */
+
+#include "hs_history.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_HistoryInit()
+ * ----------------------------------------------------
+ */
+void HS_HistoryInit(void)
+{
+
+    UT_GenStub_Execute(HS_HistoryInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_HistoryRecord()
+ * ----------------------------------------------------
+ */
+void HS_HistoryRecord(uint8 Table, uint16 Row, uint16 ActionType)
+{
+    UT_GenStub_AddParam(HS_HistoryRecord, uint8, Table);
+    UT_GenStub_AddParam(HS_HistoryRecord, uint16, Row);
+    UT_GenStub_AddParam(HS_HistoryRecord, uint16, ActionType);
+
+    UT_GenStub_Execute(HS_HistoryRecord, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_HistoryReport()
+ * ----------------------------------------------------
+ */
+void HS_HistoryReport(HS_HistoryTlm_Payload_t *PayloadPtr)
+{
+    UT_GenStub_AddParam(HS_HistoryReport, HS_HistoryTlm_Payload_t *, PayloadPtr);
+
+    UT_GenStub_Execute(HS_HistoryReport, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_HistorySlotCrc()
+ * ----------------------------------------------------
+ */
+uint32 HS_HistorySlotCrc(const HS_HistorySlot_t *SlotPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HS_HistorySlotCrc, uint32);
+
+    UT_GenStub_AddParam(HS_HistorySlotCrc, const HS_HistorySlot_t *, SlotPtr);
+
+    UT_GenStub_Execute(HS_HistorySlotCrc, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_HistorySlotCrc, uint32);
+}
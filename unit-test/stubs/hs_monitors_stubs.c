@@ -26,6 +26,60 @@
 #include "hs_monitors.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_CDSLaddersCorrupt()
+ * ----------------------------------------------------
+ */
+bool HS_CDSLaddersCorrupt(void)
+{
+    UT_GenStub_SetupReturnBuffer(HS_CDSLaddersCorrupt, bool);
+
+    UT_GenStub_Execute(HS_CDSLaddersCorrupt, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_CDSLaddersCorrupt, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_InitCDSLadders()
+ * ----------------------------------------------------
+ */
+void HS_InitCDSLadders(void)
+{
+
+    UT_GenStub_Execute(HS_InitCDSLadders, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_LadderInit()
+ * ----------------------------------------------------
+ */
+void HS_LadderInit(void)
+{
+
+    UT_GenStub_Execute(HS_LadderInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MemMonRead()
+ * ----------------------------------------------------
+ */
+CFE_Status_t HS_MemMonRead(uint32 TableIndex, uint32 *FreeBytesPtr, uint32 *LargestFreePtr)
+{
+    UT_GenStub_SetupReturnBuffer(HS_MemMonRead, CFE_Status_t);
+
+    UT_GenStub_AddParam(HS_MemMonRead, uint32, TableIndex);
+    UT_GenStub_AddParam(HS_MemMonRead, uint32 *, FreeBytesPtr);
+    UT_GenStub_AddParam(HS_MemMonRead, uint32 *, LargestFreePtr);
+
+    UT_GenStub_Execute(HS_MemMonRead, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_MemMonRead, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_MonitorApplications()
@@ -49,6 +103,28 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
     UT_GenStub_Execute(HS_MonitorEvent, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MonitorMemory()
+ * ----------------------------------------------------
+ */
+void HS_MonitorMemory(void)
+{
+
+    UT_GenStub_Execute(HS_MonitorMemory, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MonitorMessages()
+ * ----------------------------------------------------
+ */
+void HS_MonitorMessages(void)
+{
+
+    UT_GenStub_Execute(HS_MonitorMessages, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_MonitorUtilization()
@@ -60,6 +136,74 @@ void HS_MonitorUtilization(void)
     UT_GenStub_Execute(HS_MonitorUtilization, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgActReady()
+ * ----------------------------------------------------
+ */
+bool HS_MsgActReady(uint32 MsgActsIndex)
+{
+    UT_GenStub_SetupReturnBuffer(HS_MsgActReady, bool);
+
+    UT_GenStub_AddParam(HS_MsgActReady, uint32, MsgActsIndex);
+
+    UT_GenStub_Execute(HS_MsgActReady, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_MsgActReady, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgActStartCooldown()
+ * ----------------------------------------------------
+ */
+void HS_MsgActStartCooldown(uint32 MsgActsIndex)
+{
+    UT_GenStub_AddParam(HS_MsgActStartCooldown, uint32, MsgActsIndex);
+
+    UT_GenStub_Execute(HS_MsgActStartCooldown, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgActTrigger()
+ * ----------------------------------------------------
+ */
+bool HS_MsgActTrigger(uint32 MsgActsIndex)
+{
+    UT_GenStub_SetupReturnBuffer(HS_MsgActTrigger, bool);
+
+    UT_GenStub_AddParam(HS_MsgActTrigger, uint32, MsgActsIndex);
+
+    UT_GenStub_Execute(HS_MsgActTrigger, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_MsgActTrigger, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgMonArrival()
+ * ----------------------------------------------------
+ */
+void HS_MsgMonArrival(CFE_SB_MsgId_t MessageID, CFE_TIME_SysTime_t ArrivalTime)
+{
+    UT_GenStub_AddParam(HS_MsgMonArrival, CFE_SB_MsgId_t, MessageID);
+    UT_GenStub_AddParam(HS_MsgMonArrival, CFE_TIME_SysTime_t, ArrivalTime);
+
+    UT_GenStub_Execute(HS_MsgMonArrival, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgMonSubscribe()
+ * ----------------------------------------------------
+ */
+void HS_MsgMonSubscribe(void)
+{
+
+    UT_GenStub_Execute(HS_MsgMonSubscribe, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_SetCDSData()
@@ -73,6 +217,61 @@ void HS_SetCDSData(uint16 ResetsPerformed, uint16 MaxResets)
     UT_GenStub_Execute(HS_SetCDSData, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SetCDSLadder()
+ * ----------------------------------------------------
+ */
+void HS_SetCDSLadder(uint32 TableIndex, uint32 AppHash, uint16 Rung)
+{
+    UT_GenStub_AddParam(HS_SetCDSLadder, uint32, TableIndex);
+    UT_GenStub_AddParam(HS_SetCDSLadder, uint32, AppHash);
+    UT_GenStub_AddParam(HS_SetCDSLadder, uint16, Rung);
+
+    UT_GenStub_Execute(HS_SetCDSLadder, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_ValReportAddPair()
+ * ----------------------------------------------------
+ */
+void HS_ValReportAddPair(uint32 Entry, uint32 FirstEntry, int32 Result)
+{
+    UT_GenStub_AddParam(HS_ValReportAddPair, uint32, Entry);
+    UT_GenStub_AddParam(HS_ValReportAddPair, uint32, FirstEntry);
+    UT_GenStub_AddParam(HS_ValReportAddPair, int32, Result);
+
+    UT_GenStub_Execute(HS_ValReportAddPair, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_ValReportInit()
+ * ----------------------------------------------------
+ */
+void HS_ValReportInit(uint8 Table)
+{
+    UT_GenStub_AddParam(HS_ValReportInit, uint8, Table);
+
+    UT_GenStub_Execute(HS_ValReportInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_ValReportSend()
+ * ----------------------------------------------------
+ */
+void HS_ValReportSend(int32 Result, uint32 GoodCount, uint32 BadCount, uint32 UnusedCount)
+{
+    UT_GenStub_AddParam(HS_ValReportSend, int32, Result);
+    UT_GenStub_AddParam(HS_ValReportSend, uint32, GoodCount);
+    UT_GenStub_AddParam(HS_ValReportSend, uint32, BadCount);
+    UT_GenStub_AddParam(HS_ValReportSend, uint32, UnusedCount);
+
+    UT_GenStub_Execute(HS_ValReportSend, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_ValidateAMTable()
@@ -105,6 +304,19 @@ int32 HS_ValidateEMTable(void *TableData)
     return UT_GenStub_GetReturnValue(HS_ValidateEMTable, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_ValidateMASequences()
+ * ----------------------------------------------------
+ */
+void HS_ValidateMASequences(const HS_MATEntry_t *TableArray, uint8 *SeqState)
+{
+    UT_GenStub_AddParam(HS_ValidateMASequences, const HS_MATEntry_t *, TableArray);
+    UT_GenStub_AddParam(HS_ValidateMASequences, uint8 *, SeqState);
+
+    UT_GenStub_Execute(HS_ValidateMASequences, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_ValidateMATable()
@@ -121,6 +333,38 @@ int32 HS_ValidateMATable(void *TableData)
     return UT_GenStub_GetReturnValue(HS_ValidateMATable, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_ValidateMFTable()
+ * ----------------------------------------------------
+ */
+int32 HS_ValidateMFTable(void *TableData)
+{
+    UT_GenStub_SetupReturnBuffer(HS_ValidateMFTable, int32);
+
+    UT_GenStub_AddParam(HS_ValidateMFTable, void *, TableData);
+
+    UT_GenStub_Execute(HS_ValidateMFTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_ValidateMFTable, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_ValidateMMTable()
+ * ----------------------------------------------------
+ */
+int32 HS_ValidateMMTable(void *TableData)
+{
+    UT_GenStub_SetupReturnBuffer(HS_ValidateMMTable, int32);
+
+    UT_GenStub_AddParam(HS_ValidateMMTable, void *, TableData);
+
+    UT_GenStub_Execute(HS_ValidateMMTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_ValidateMMTable, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_ValidateXCTable()
@@ -0,0 +1,106 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in hs_msgacts header
+ */
+
+#include "hs_msgacts.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgActEnqueue()
+ * ----------------------------------------------------
+ */
+void HS_MsgActEnqueue(uint32 MsgActsIndex)
+{
+    UT_GenStub_AddParam(HS_MsgActEnqueue, uint32, MsgActsIndex);
+
+    UT_GenStub_Execute(HS_MsgActEnqueue, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgActQueueDrain()
+ * ----------------------------------------------------
+ */
+void HS_MsgActQueueDrain(void)
+{
+
+    UT_GenStub_Execute(HS_MsgActQueueDrain, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgActQueueFlush()
+ * ----------------------------------------------------
+ */
+void HS_MsgActQueueFlush(void)
+{
+
+    UT_GenStub_Execute(HS_MsgActQueueFlush, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgActQueueInit()
+ * ----------------------------------------------------
+ */
+void HS_MsgActQueueInit(void)
+{
+
+    UT_GenStub_Execute(HS_MsgActQueueInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgActRefillTokens()
+ * ----------------------------------------------------
+ */
+void HS_MsgActRefillTokens(void)
+{
+
+    UT_GenStub_Execute(HS_MsgActRefillTokens, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgActScheduleNext()
+ * ----------------------------------------------------
+ */
+void HS_MsgActScheduleNext(uint32 MsgActsIndex)
+{
+    UT_GenStub_AddParam(HS_MsgActScheduleNext, uint32, MsgActsIndex);
+
+    UT_GenStub_Execute(HS_MsgActScheduleNext, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MsgActStepsDue()
+ * ----------------------------------------------------
+ */
+void HS_MsgActStepsDue(void)
+{
+
+    UT_GenStub_Execute(HS_MsgActStepsDue, Basic, NULL);
+}
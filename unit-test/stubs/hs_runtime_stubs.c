@@ -0,0 +1,186 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in hs_runtime header
+ */
+
+#include "hs_runtime.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeCompileAMT()
+ * ----------------------------------------------------
+ */
+void HS_RuntimeCompileAMT(HS_RuntimeBuf_t *BufPtr, const HS_AMTEntry_t *TblPtr)
+{
+    UT_GenStub_AddParam(HS_RuntimeCompileAMT, HS_RuntimeBuf_t *, BufPtr);
+    UT_GenStub_AddParam(HS_RuntimeCompileAMT, const HS_AMTEntry_t *, TblPtr);
+
+    UT_GenStub_Execute(HS_RuntimeCompileAMT, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeCompileEMT()
+ * ----------------------------------------------------
+ */
+void HS_RuntimeCompileEMT(HS_RuntimeBuf_t *BufPtr, const HS_EMTEntry_t *TblPtr)
+{
+    UT_GenStub_AddParam(HS_RuntimeCompileEMT, HS_RuntimeBuf_t *, BufPtr);
+    UT_GenStub_AddParam(HS_RuntimeCompileEMT, const HS_EMTEntry_t *, TblPtr);
+
+    UT_GenStub_Execute(HS_RuntimeCompileEMT, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeCompileMAT()
+ * ----------------------------------------------------
+ */
+void HS_RuntimeCompileMAT(HS_RuntimeBuf_t *BufPtr, const HS_MATEntry_t *TblPtr)
+{
+    UT_GenStub_AddParam(HS_RuntimeCompileMAT, HS_RuntimeBuf_t *, BufPtr);
+    UT_GenStub_AddParam(HS_RuntimeCompileMAT, const HS_MATEntry_t *, TblPtr);
+
+    UT_GenStub_Execute(HS_RuntimeCompileMAT, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeCompileMFT()
+ * ----------------------------------------------------
+ */
+void HS_RuntimeCompileMFT(HS_RuntimeBuf_t *BufPtr, const HS_MFTEntry_t *TblPtr)
+{
+    UT_GenStub_AddParam(HS_RuntimeCompileMFT, HS_RuntimeBuf_t *, BufPtr);
+    UT_GenStub_AddParam(HS_RuntimeCompileMFT, const HS_MFTEntry_t *, TblPtr);
+
+    UT_GenStub_Execute(HS_RuntimeCompileMFT, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeCompileMMT()
+ * ----------------------------------------------------
+ */
+void HS_RuntimeCompileMMT(HS_RuntimeBuf_t *BufPtr, const HS_MMTEntry_t *TblPtr)
+{
+    UT_GenStub_AddParam(HS_RuntimeCompileMMT, HS_RuntimeBuf_t *, BufPtr);
+    UT_GenStub_AddParam(HS_RuntimeCompileMMT, const HS_MMTEntry_t *, TblPtr);
+
+    UT_GenStub_Execute(HS_RuntimeCompileMMT, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeCompileXCT()
+ * ----------------------------------------------------
+ */
+void HS_RuntimeCompileXCT(HS_RuntimeBuf_t *BufPtr, const HS_XCTEntry_t *TblPtr)
+{
+    UT_GenStub_AddParam(HS_RuntimeCompileXCT, HS_RuntimeBuf_t *, BufPtr);
+    UT_GenStub_AddParam(HS_RuntimeCompileXCT, const HS_XCTEntry_t *, TblPtr);
+
+    UT_GenStub_Execute(HS_RuntimeCompileXCT, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeInit()
+ * ----------------------------------------------------
+ */
+void HS_RuntimeInit(void)
+{
+    UT_GenStub_Execute(HS_RuntimeInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeResolveMM()
+ * ----------------------------------------------------
+ */
+bool HS_RuntimeResolveMM(HS_RuntimeBuf_t *BufPtr, uint32 TableIndex)
+{
+    UT_GenStub_SetupReturnBuffer(HS_RuntimeResolveMM, bool);
+
+    UT_GenStub_AddParam(HS_RuntimeResolveMM, HS_RuntimeBuf_t *, BufPtr);
+    UT_GenStub_AddParam(HS_RuntimeResolveMM, uint32, TableIndex);
+
+    UT_GenStub_Execute(HS_RuntimeResolveMM, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_RuntimeResolveMM, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeResolveXC()
+ * ----------------------------------------------------
+ */
+bool HS_RuntimeResolveXC(HS_RuntimeBuf_t *BufPtr, uint32 TableIndex)
+{
+    UT_GenStub_SetupReturnBuffer(HS_RuntimeResolveXC, bool);
+
+    UT_GenStub_AddParam(HS_RuntimeResolveXC, HS_RuntimeBuf_t *, BufPtr);
+    UT_GenStub_AddParam(HS_RuntimeResolveXC, uint32, TableIndex);
+
+    UT_GenStub_Execute(HS_RuntimeResolveXC, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_RuntimeResolveXC, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeSetTablePtrs()
+ * ----------------------------------------------------
+ */
+void HS_RuntimeSetTablePtrs(void)
+{
+
+    UT_GenStub_Execute(HS_RuntimeSetTablePtrs, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeStage()
+ * ----------------------------------------------------
+ */
+HS_RuntimeBuf_t *HS_RuntimeStage(uint8 TblFlag)
+{
+    UT_GenStub_SetupReturnBuffer(HS_RuntimeStage, HS_RuntimeBuf_t *);
+
+    UT_GenStub_AddParam(HS_RuntimeStage, uint8, TblFlag);
+
+    UT_GenStub_Execute(HS_RuntimeStage, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_RuntimeStage, HS_RuntimeBuf_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_RuntimeSwap()
+ * ----------------------------------------------------
+ */
+void HS_RuntimeSwap(void)
+{
+    UT_GenStub_Execute(HS_RuntimeSwap, Basic, NULL);
+}
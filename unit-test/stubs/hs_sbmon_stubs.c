@@ -0,0 +1,89 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in hs_sbmon header
+ */
+
+#include "hs_sbmon.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SbMonCycle()
+ * ----------------------------------------------------
+ */
+void HS_SbMonCycle(void)
+{
+
+    UT_GenStub_Execute(HS_SbMonCycle, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SbMonInit()
+ * ----------------------------------------------------
+ */
+CFE_Status_t HS_SbMonInit(void)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SbMonInit, CFE_Status_t);
+
+    UT_GenStub_Execute(HS_SbMonInit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SbMonInit, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SbMonProcessHk()
+ * ----------------------------------------------------
+ */
+void HS_SbMonProcessHk(const CFE_SB_HousekeepingTlm_t *HkPtr)
+{
+    UT_GenStub_AddParam(HS_SbMonProcessHk, const CFE_SB_HousekeepingTlm_t *, HkPtr);
+
+    UT_GenStub_Execute(HS_SbMonProcessHk, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SbMonProcessStats()
+ * ----------------------------------------------------
+ */
+void HS_SbMonProcessStats(const CFE_SB_StatsTlm_t *StatsPtr)
+{
+    UT_GenStub_AddParam(HS_SbMonProcessStats, const CFE_SB_StatsTlm_t *, StatsPtr);
+
+    UT_GenStub_Execute(HS_SbMonProcessStats, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SbMonUpdatePipe()
+ * ----------------------------------------------------
+ */
+void HS_SbMonUpdatePipe(uint32 PipeIndex, const CFE_SB_PipeDepthStats_t *DepthPtr)
+{
+    UT_GenStub_AddParam(HS_SbMonUpdatePipe, uint32, PipeIndex);
+    UT_GenStub_AddParam(HS_SbMonUpdatePipe, const CFE_SB_PipeDepthStats_t *, DepthPtr);
+
+    UT_GenStub_Execute(HS_SbMonUpdatePipe, Basic, NULL);
+}
@@ -0,0 +1,139 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in hs_snapshot header
+ */
+
+#include "hs_snapshot.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SnapshotApply()
+ * ----------------------------------------------------
+ */
+void HS_SnapshotApply(uint32 Section)
+{
+    UT_GenStub_AddParam(HS_SnapshotApply, uint32, Section);
+
+    UT_GenStub_Execute(HS_SnapshotApply, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SnapshotCapture()
+ * ----------------------------------------------------
+ */
+void HS_SnapshotCapture(uint32 Section)
+{
+    UT_GenStub_AddParam(HS_SnapshotCapture, uint32, Section);
+
+    UT_GenStub_Execute(HS_SnapshotCapture, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SnapshotCrc()
+ * ----------------------------------------------------
+ */
+uint32 HS_SnapshotCrc(const HS_SnapshotHeader_t *HeaderPtr, size_t Size)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SnapshotCrc, uint32);
+
+    UT_GenStub_AddParam(HS_SnapshotCrc, const HS_SnapshotHeader_t *, HeaderPtr);
+    UT_GenStub_AddParam(HS_SnapshotCrc, size_t, Size);
+
+    UT_GenStub_Execute(HS_SnapshotCrc, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SnapshotCrc, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SnapshotInit()
+ * ----------------------------------------------------
+ */
+void HS_SnapshotInit(void)
+{
+
+    UT_GenStub_Execute(HS_SnapshotInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SnapshotSave()
+ * ----------------------------------------------------
+ */
+void HS_SnapshotSave(void)
+{
+
+    UT_GenStub_Execute(HS_SnapshotSave, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SnapshotSection()
+ * ----------------------------------------------------
+ */
+HS_SnapshotHeader_t *HS_SnapshotSection(uint32 Section, size_t *SizePtr)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SnapshotSection, HS_SnapshotHeader_t *);
+
+    UT_GenStub_AddParam(HS_SnapshotSection, uint32, Section);
+    UT_GenStub_AddParam(HS_SnapshotSection, size_t *, SizePtr);
+
+    UT_GenStub_Execute(HS_SnapshotSection, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SnapshotSection, HS_SnapshotHeader_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SnapshotTableCrc()
+ * ----------------------------------------------------
+ */
+uint32 HS_SnapshotTableCrc(uint32 Section)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SnapshotTableCrc, uint32);
+
+    UT_GenStub_AddParam(HS_SnapshotTableCrc, uint32, Section);
+
+    UT_GenStub_Execute(HS_SnapshotTableCrc, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SnapshotTableCrc, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SnapshotValid()
+ * ----------------------------------------------------
+ */
+bool HS_SnapshotValid(uint32 Section)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SnapshotValid, bool);
+
+    UT_GenStub_AddParam(HS_SnapshotValid, uint32, Section);
+
+    UT_GenStub_Execute(HS_SnapshotValid, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SnapshotValid, bool);
+}
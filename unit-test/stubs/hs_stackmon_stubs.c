@@ -0,0 +1,84 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in hs_stackmon header
+ */
+
+#include "hs_stackmon.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_MonitorStacks()
+ * ----------------------------------------------------
+ */
+void HS_MonitorStacks(void)
+{
+
+    UT_GenStub_Execute(HS_MonitorStacks, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_StackMonHighWater()
+ * ----------------------------------------------------
+ */
+uint32 HS_StackMonHighWater(cpuaddr StackBase, uint32 StackSize)
+{
+    UT_GenStub_SetupReturnBuffer(HS_StackMonHighWater, uint32);
+
+    UT_GenStub_AddParam(HS_StackMonHighWater, cpuaddr, StackBase);
+    UT_GenStub_AddParam(HS_StackMonHighWater, uint32, StackSize);
+
+    UT_GenStub_Execute(HS_StackMonHighWater, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_StackMonHighWater, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_StackMonRank()
+ * ----------------------------------------------------
+ */
+void HS_StackMonRank(const HS_StackMonTlm_t *EntryPtr)
+{
+    UT_GenStub_AddParam(HS_StackMonRank, const HS_StackMonTlm_t *, EntryPtr);
+
+    UT_GenStub_Execute(HS_StackMonRank, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_StackMonRegister()
+ * ----------------------------------------------------
+ */
+bool HS_StackMonRegister(const char *TaskName, cpuaddr StackBase)
+{
+    UT_GenStub_SetupReturnBuffer(HS_StackMonRegister, bool);
+
+    UT_GenStub_AddParam(HS_StackMonRegister, const char *, TaskName);
+    UT_GenStub_AddParam(HS_StackMonRegister, cpuaddr, StackBase);
+
+    UT_GenStub_Execute(HS_StackMonRegister, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_StackMonRegister, bool);
+}
@@ -26,6 +26,28 @@
 #include "hs_sysmon.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SysMonBurstReport()
+ * ----------------------------------------------------
+ */
+void HS_SysMonBurstReport(void)
+{
+
+    UT_GenStub_Execute(HS_SysMonBurstReport, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SysMonBurstUpdate()
+ * ----------------------------------------------------
+ */
+void HS_SysMonBurstUpdate(void)
+{
+
+    UT_GenStub_Execute(HS_SysMonBurstUpdate, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_SysMonCleanup()
@@ -64,3 +86,110 @@ CFE_Status_t HS_SysMonInit(void)
 
     return UT_GenStub_GetReturnValue(HS_SysMonInit, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SysMonProcInit()
+ * ----------------------------------------------------
+ */
+CFE_Status_t HS_SysMonProcInit(void)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SysMonProcInit, CFE_Status_t);
+
+    UT_GenStub_Execute(HS_SysMonProcInit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SysMonProcInit, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SysMonProcSample()
+ * ----------------------------------------------------
+ */
+int32 HS_SysMonProcSample(void)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SysMonProcSample, int32);
+
+    UT_GenStub_Execute(HS_SysMonProcSample, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SysMonProcSample, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SysMonProcUtil()
+ * ----------------------------------------------------
+ */
+uint32 HS_SysMonProcUtil(HS_SysMonProcTimes_t *PrevPtr, const HS_SysMonProcTimes_t *NowPtr, uint32 LastUtil)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SysMonProcUtil, uint32);
+
+    UT_GenStub_AddParam(HS_SysMonProcUtil, HS_SysMonProcTimes_t *, PrevPtr);
+    UT_GenStub_AddParam(HS_SysMonProcUtil, const HS_SysMonProcTimes_t *, NowPtr);
+    UT_GenStub_AddParam(HS_SysMonProcUtil, uint32, LastUtil);
+
+    UT_GenStub_Execute(HS_SysMonProcUtil, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SysMonProcUtil, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SysMonReadCpuUtilization()
+ * ----------------------------------------------------
+ */
+int32 HS_SysMonReadCpuUtilization(void)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SysMonReadCpuUtilization, int32);
+
+    UT_GenStub_Execute(HS_SysMonReadCpuUtilization, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SysMonReadCpuUtilization, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SysMonTask()
+ * ----------------------------------------------------
+ */
+void HS_SysMonTask(void)
+{
+
+    UT_GenStub_Execute(HS_SysMonTask, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SysMonTaskConsume()
+ * ----------------------------------------------------
+ */
+int32 HS_SysMonTaskConsume(void)
+{
+    UT_GenStub_SetupReturnBuffer(HS_SysMonTaskConsume, int32);
+
+    UT_GenStub_Execute(HS_SysMonTaskConsume, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_SysMonTaskConsume, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SysMonTaskInit()
+ * ----------------------------------------------------
+ */
+void HS_SysMonTaskInit(void)
+{
+
+    UT_GenStub_Execute(HS_SysMonTaskInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_SysMonTaskSample()
+ * ----------------------------------------------------
+ */
+void HS_SysMonTaskSample(void)
+{
+
+    UT_GenStub_Execute(HS_SysMonTaskSample, Basic, NULL);
+}
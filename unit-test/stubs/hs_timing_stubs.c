@@ -0,0 +1,142 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,920-1, and identified as “Core Flight
+ * System (cFS) Health & Safety (HS) Application version 2.4.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in hs_timing header
+ */
+
+#include "hs_timing.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TimingAddInterval()
+ * ----------------------------------------------------
+ */
+void HS_TimingAddInterval(uint32 IntervalUsec)
+{
+    UT_GenStub_AddParam(HS_TimingAddInterval, uint32, IntervalUsec);
+
+    UT_GenStub_Execute(HS_TimingAddInterval, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TimingCycleEnd()
+ * ----------------------------------------------------
+ */
+void HS_TimingCycleEnd(void)
+{
+
+    UT_GenStub_Execute(HS_TimingCycleEnd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TimingCycleStart()
+ * ----------------------------------------------------
+ */
+void HS_TimingCycleStart(CFE_Status_t RcvStatus)
+{
+    UT_GenStub_AddParam(HS_TimingCycleStart, CFE_Status_t, RcvStatus);
+
+    UT_GenStub_Execute(HS_TimingCycleStart, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TimingElapsedUsec()
+ * ----------------------------------------------------
+ */
+uint32 HS_TimingElapsedUsec(OS_time_t Start, OS_time_t Now)
+{
+    UT_GenStub_SetupReturnBuffer(HS_TimingElapsedUsec, uint32);
+
+    UT_GenStub_AddParam(HS_TimingElapsedUsec, OS_time_t, Start);
+    UT_GenStub_AddParam(HS_TimingElapsedUsec, OS_time_t, Now);
+
+    UT_GenStub_Execute(HS_TimingElapsedUsec, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_TimingElapsedUsec, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TimingReport()
+ * ----------------------------------------------------
+ */
+void HS_TimingReport(HS_TimingTlm_Payload_t *PayloadPtr)
+{
+    UT_GenStub_AddParam(HS_TimingReport, HS_TimingTlm_Payload_t *, PayloadPtr);
+
+    UT_GenStub_Execute(HS_TimingReport, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TimingReset()
+ * ----------------------------------------------------
+ */
+void HS_TimingReset(void)
+{
+
+    UT_GenStub_Execute(HS_TimingReset, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TimingSqrt()
+ * ----------------------------------------------------
+ */
+uint32 HS_TimingSqrt(uint64 Value)
+{
+    UT_GenStub_SetupReturnBuffer(HS_TimingSqrt, uint32);
+
+    UT_GenStub_AddParam(HS_TimingSqrt, uint64, Value);
+
+    UT_GenStub_Execute(HS_TimingSqrt, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_TimingSqrt, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TimingStart()
+ * ----------------------------------------------------
+ */
+void HS_TimingStart(uint32 Phase)
+{
+    UT_GenStub_AddParam(HS_TimingStart, uint32, Phase);
+
+    UT_GenStub_Execute(HS_TimingStart, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_TimingStop()
+ * ----------------------------------------------------
+ */
+void HS_TimingStop(uint32 Phase)
+{
+    UT_GenStub_AddParam(HS_TimingStop, uint32, Phase);
+
+    UT_GenStub_Execute(HS_TimingStop, Basic, NULL);
+}
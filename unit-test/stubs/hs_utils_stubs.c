@@ -42,6 +42,22 @@ bool HS_AMTActionIsValid(uint16 ActionType)
     return UT_GenStub_GetReturnValue(HS_AMTActionIsValid, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_AMTEscalationIsValid()
+ * ----------------------------------------------------
+ */
+bool HS_AMTEscalationIsValid(const HS_AMTEntry_t *EntryPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HS_AMTEscalationIsValid, bool);
+
+    UT_GenStub_AddParam(HS_AMTEscalationIsValid, const HS_AMTEntry_t *, EntryPtr);
+
+    UT_GenStub_Execute(HS_AMTEscalationIsValid, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_AMTEscalationIsValid, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HS_EMTActionIsValid()
@@ -57,3 +73,20 @@ bool HS_EMTActionIsValid(uint16 ActionType)
 
     return UT_GenStub_GetReturnValue(HS_EMTActionIsValid, bool);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_KeyHash()
+ * ----------------------------------------------------
+ */
+uint32 HS_KeyHash(const char *Name, uint32 Key)
+{
+    UT_GenStub_SetupReturnBuffer(HS_KeyHash, uint32);
+
+    UT_GenStub_AddParam(HS_KeyHash, const char *, Name);
+    UT_GenStub_AddParam(HS_KeyHash, uint32, Key);
+
+    UT_GenStub_Execute(HS_KeyHash, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HS_KeyHash, uint32);
+}
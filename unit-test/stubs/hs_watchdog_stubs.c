@@ -17,47 +17,44 @@
  * limitations under the License.
  ************************************************************************/
 
-/*
- * Includes
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in hs_watchdog header
  */
 
-#include "hs_cmds.h"
-#include "hs_test_utils.h"
-#include "hs_dispatch.h"
-#include "hs_msgids.h"
+#include "hs_watchdog.h"
+#include "utgenstub.h"
 
-/* UT includes */
-#include "uttest.h"
-#include "utassert.h"
-#include "utstubs.h"
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HS_WatchdogCheck()
+ * ----------------------------------------------------
+ */
+void HS_WatchdogCheck(void)
+{
 
-#include "cfe.h"
-#include "cfe_msg_dispatcher.h"
+    UT_GenStub_Execute(HS_WatchdogCheck, Basic, NULL);
+}
 
 /*
-**********************************************************************************
-**          TEST CASE FUNCTIONS
-**********************************************************************************
-*/
-
-void Test_HS_AppPipe(void)
+ * ----------------------------------------------------
+ * Generated stub function for HS_WatchdogTask()
+ * ----------------------------------------------------
+ */
+void HS_WatchdogTask(void)
 {
-    /*
-     * Test Case For:
-     * void HS_AppPipe
-     */
-    CFE_SB_Buffer_t UtBuf;
 
-    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_EdsDispatch), 1, CFE_SUCCESS);
-
-    memset(&UtBuf, 0, sizeof(UtBuf));
-    UtAssert_VOIDCALL(HS_AppPipe(&UtBuf));
+    UT_GenStub_Execute(HS_WatchdogTask, Basic, NULL);
 }
 
 /*
- * Register the test cases to execute with the unit test tool
+ * ----------------------------------------------------
+ * Generated stub function for HS_WatchdogTaskInit()
+ * ----------------------------------------------------
  */
-void UtTest_Setup(void)
+void HS_WatchdogTaskInit(void)
 {
-    UtTest_Add(Test_HS_AppPipe, HS_Test_Setup, HS_Test_TearDown, "Test_HS_AppPipe");
+
+    UT_GenStub_Execute(HS_WatchdogTaskInit, Basic, NULL);
 }
@@ -120,3 +120,86 @@ void HS_Test_TearDown(void)
 {
     /* cleanup test environment */
 }
+
+/*
+ * Builds the active runtime lookup structures from whatever the test
+ * placed in the AppMon, EventMon, MemMon and MsgMon tables, for use where
+ * hs_runtime.c is stubbed out
+ */
+void HS_Test_CompileRuntime(void)
+{
+    HS_RuntimeBuf_t *RuntimePtr;
+    uint32           TableIndex;
+    uint32           Bucket;
+
+    RuntimePtr                = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_AMT);
+    RuntimePtr->AMActiveCount = 0;
+
+    if (HS_AppData.AMTablePtr != NULL)
+    {
+        for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++)
+        {
+            if (HS_AppData.AMTablePtr[TableIndex].ActionType != HS_AMT_ACT_NOACT)
+            {
+                RuntimePtr->AMActiveList[RuntimePtr->AMActiveCount++] = TableIndex;
+            }
+        }
+    }
+
+    RuntimePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_EMT);
+    memset(RuntimePtr->EMHashHead, 0, sizeof(RuntimePtr->EMHashHead));
+    memset(RuntimePtr->EMHashNext, 0, sizeof(RuntimePtr->EMHashNext));
+    RuntimePtr->EMActiveCount = 0;
+
+    if (HS_AppData.EMTablePtr != NULL)
+    {
+        for (TableIndex = HS_MAX_MONITORED_EVENTS; TableIndex > 0; TableIndex--)
+        {
+            if (HS_AppData.EMTablePtr[TableIndex - 1].ActionType != HS_EMT_ACT_NOACT)
+            {
+                Bucket = HS_RUNTIME_EVENT_HASH(HS_AppData.EMTablePtr[TableIndex - 1].EventID);
+
+                RuntimePtr->EMHashNext[TableIndex - 1] = RuntimePtr->EMHashHead[Bucket];
+                RuntimePtr->EMHashHead[Bucket]         = TableIndex;
+                RuntimePtr->EMActiveCount++;
+            }
+        }
+    }
+
+    RuntimePtr                = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MMT);
+    RuntimePtr->MMActiveCount = 0;
+
+    if (HS_AppData.MMTablePtr != NULL)
+    {
+        for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_MEM; TableIndex++)
+        {
+            /* Pools are registered by each test that needs one */
+            RuntimePtr->MMPoolId[TableIndex] = CFE_ES_MEMHANDLE_UNDEFINED;
+
+            if (HS_AppData.MMTablePtr[TableIndex].ResourceType != HS_MMT_TYPE_NOTYPE)
+            {
+                RuntimePtr->MMActiveList[RuntimePtr->MMActiveCount++] = TableIndex;
+            }
+        }
+    }
+
+    RuntimePtr = HS_RUNTIME_ACTIVE_BUF(HS_TBL_NOTIFY_MFT);
+    memset(RuntimePtr->MFHashHead, 0, sizeof(RuntimePtr->MFHashHead));
+    memset(RuntimePtr->MFHashNext, 0, sizeof(RuntimePtr->MFHashNext));
+    RuntimePtr->MFActiveCount = 0;
+
+    if (HS_AppData.MFTablePtr != NULL)
+    {
+        for (TableIndex = HS_MAX_MONITORED_MSGS; TableIndex > 0; TableIndex--)
+        {
+            if (HS_AppData.MFTablePtr[TableIndex - 1].MaxAgeMsec != 0)
+            {
+                Bucket = HS_RUNTIME_MSGID_HASH(HS_AppData.MFTablePtr[TableIndex - 1].MsgId);
+
+                RuntimePtr->MFHashNext[TableIndex - 1] = RuntimePtr->MFHashHead[Bucket];
+                RuntimePtr->MFHashHead[Bucket]         = TableIndex;
+                RuntimePtr->MFActiveCount++;
+            }
+        }
+    }
+}
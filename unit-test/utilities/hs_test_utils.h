@@ -81,6 +81,11 @@ typedef union
     HS_EnableCpuHogCmd_t         EnableCpuHogCmd;
     HS_DisableCpuHogCmd_t        DisableCpuHogCmd;
     HS_SetMaxResetsCmd_t         SetMaxResetsCmd;
+    HS_ManageTablesCmd_t         ManageTablesCmd;
+    HS_SendHistoryCmd_t          SendHistoryCmd;
+    HS_ResetTimingCmd_t          ResetTimingCmd;
+    HS_RegisterPoolCmd_t         RegisterPoolCmd;
+    HS_RegisterStackCmd_t        RegisterStackCmd;
     HS_SendHkCmd_t               SendHkCmd;
 } UT_CmdBuf_t;
 
@@ -95,5 +100,6 @@ extern UT_CmdBuf_t UT_CmdBuf;
 
 void HS_Test_Setup(void);
 void HS_Test_TearDown(void);
+void HS_Test_CompileRuntime(void);
 
 #endif